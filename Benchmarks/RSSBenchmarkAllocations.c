@@ -0,0 +1,115 @@
+//
+//  RSSBenchmarkAllocations.c
+//  MediaRSSParser
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+
+
+#include "RSSBenchmarkAllocations.h"
+
+#include <stdatomic.h>
+#include <stddef.h>
+#include <sys/resource.h>
+
+#if defined(__GLIBC__)
+#include <malloc.h>
+#elif defined(__APPLE__)
+#include <malloc/malloc.h>
+#endif
+
+#if defined(__GLIBC__)
+
+static atomic_uint_fast64_t gAllocationCount;
+
+extern void *__libc_malloc(size_t size);
+extern void *__libc_calloc(size_t count, size_t size);
+extern void *__libc_realloc(void *pointer, size_t size);
+
+// These replace the glibc symbols for the whole process, including Foundation and libxml2.
+void *malloc(size_t size)
+{
+  atomic_fetch_add_explicit(&gAllocationCount, 1, memory_order_relaxed);
+  return __libc_malloc(size);
+}
+
+void *calloc(size_t count, size_t size)
+{
+  atomic_fetch_add_explicit(&gAllocationCount, 1, memory_order_relaxed);
+  return __libc_calloc(count, size);
+}
+
+void *realloc(void *pointer, size_t size)
+{
+  atomic_fetch_add_explicit(&gAllocationCount, 1, memory_order_relaxed);
+  return __libc_realloc(pointer, size);
+}
+
+int RSSBenchmarkCountsAllocations(void)
+{
+  return 1;
+}
+
+uint64_t RSSBenchmarkAllocationCount(void)
+{
+  return atomic_load_explicit(&gAllocationCount, memory_order_relaxed);
+}
+
+#else
+
+int RSSBenchmarkCountsAllocations(void)
+{
+  return 0;
+}
+
+uint64_t RSSBenchmarkAllocationCount(void)
+{
+  return 0;
+}
+
+#endif
+
+uint64_t RSSBenchmarkAllocatedBytes(void)
+{
+#if defined(__GLIBC__) && (__GLIBC__ > 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 33))
+  return (uint64_t)mallinfo2().uordblks;
+#elif defined(__GLIBC__)
+  // `mallinfo` reports an `int`, which wraps beyond 2 GB
+  return (uint64_t)(unsigned int)mallinfo().uordblks;
+#elif defined(__APPLE__)
+  malloc_statistics_t statistics;
+  malloc_zone_statistics(NULL, &statistics);
+  return (uint64_t)statistics.size_in_use;
+#else
+  return 0;
+#endif
+}
+
+uint64_t RSSBenchmarkPeakResidentBytes(void)
+{
+  struct rusage usage;
+  if (getrusage(RUSAGE_SELF, &usage) != 0) {
+    return 0;
+  }
+#if defined(__APPLE__)
+  return (uint64_t)usage.ru_maxrss;
+#else
+  // Linux reports kilobytes
+  return (uint64_t)usage.ru_maxrss * 1024;
+#endif
+}
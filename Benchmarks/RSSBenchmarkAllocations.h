@@ -0,0 +1,49 @@
+//
+//  RSSBenchmarkAllocations.h
+//  MediaRSSParser
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+
+
+#ifndef RSSBenchmarkAllocations_h
+#define RSSBenchmarkAllocations_h
+
+#include <stdint.h>
+
+/**
+ *  Whether `RSSBenchmarkAllocationCount` counts allocations on this platform. It does with glibc, where `malloc`, `calloc` and `realloc` are replaced by counting wrappers around the glibc allocator.
+ */
+extern int RSSBenchmarkCountsAllocations(void);
+
+/**
+ *  The number of `malloc`, `calloc` and `realloc` calls made by every thread since the process started, or `0` if allocations aren't counted.
+ */
+extern uint64_t RSSBenchmarkAllocationCount(void);
+
+/**
+ *  The number of heap bytes the process has allocated and not yet freed, or `0` if that isn't measured on this platform. It is with glibc and on Apple platforms.
+ */
+extern uint64_t RSSBenchmarkAllocatedBytes(void);
+
+/**
+ *  The peak resident set size of the process in bytes.
+ */
+extern uint64_t RSSBenchmarkPeakResidentBytes(void);
+
+#endif
@@ -0,0 +1,75 @@
+//
+//  RSSBenchmarkRunner.h
+//  MediaRSSParser
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+
+
+#import <Foundation/Foundation.h>
+#import "RSSParser.h"
+
+@class RSSFeedGenerator;
+
+/**
+ *  `RSSBenchmarkRunner` measures each phase of handling one generated document:
+ *
+ *  - `networkStub`: fetching the document through `AFHTTPSessionManager`, with `RSSStubHTTPProtocol` standing in for the server
+ *  - `xmlParse`: reading the document with the backend's XML parser and no-op callbacks
+ *  - `modelBuild`: parsing the document into an `RSSChannel` with `RSSParser`
+ *  - `htmlUtilities`: converting each item's description to plain text, decoding its entities and finding its images
+ *
+ *  Each phase is run `iterations` times and reported by its median, as seconds, MB/s, items/s, allocations per item and the peak resident set size of the process so far.
+ *
+ *  The heap memory retained by the parsed `RSSChannel` is reported as `channelMemory`.
+ */
+@interface RSSBenchmarkRunner : NSObject
+
+/**
+ *  Creates a runner for the document generated by `generator`.
+ */
+- (instancetype)initWithGenerator:(RSSFeedGenerator *)generator;
+
+/**
+ *  The generator of the document that's measured.
+ */
+@property (nonatomic, strong, readonly) RSSFeedGenerator *generator;
+
+/**
+ *  The parser backend used by the `xmlParse` and `modelBuild` phases. The default is `RSSParserBackendNSXMLParser`.
+ */
+@property (nonatomic, assign) RSSParserBackend backend;
+
+/**
+ *  The `stringPoolCountLimit` of the parser used by the `modelBuild` phase. The default is `RSSStringPoolDefaultCountLimit`; compare with `0` to measure the memory that interning saves.
+ */
+@property (nonatomic, assign) NSUInteger stringPoolCountLimit;
+
+/**
+ *  The number of times each phase is run. The default is `5`.
+ */
+@property (nonatomic, assign) NSUInteger iterations;
+
+/**
+ *  Generates the document and measures every phase.
+ *
+ *  @return A JSON object with the generator's `configuration`, the `backend`, the `stringPoolCountLimit`, the `documentBytes`, the results of each phase within `phases` and the `channelMemory`.
+ */
+- (NSDictionary *)run;
+
+@end
@@ -0,0 +1,257 @@
+//
+//  RSSBenchmarkRunner.m
+//  MediaRSSParser
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+
+
+#import "RSSBenchmarkRunner.h"
+#import "RSSBenchmarkAllocations.h"
+#import "RSSFeedGenerator.h"
+
+#import "MediaRSSModels.h"
+#import "RSSStringPool.h"
+#import "NSString+HTML.h"
+#import "RSSStubHTTPProtocol.h"
+
+#import "AFHTTPSessionManager.h"
+
+#import <libxml/parser.h>
+#include <time.h>
+
+static NSString * const RSSBenchmarkFeedURLString = @"http://benchmark.example.com/feed.xml";
+
+#pragma mark - XML Parse Phase
+
+@interface RSSBenchmarkXMLParserDelegate : NSObject <NSXMLParserDelegate>
+@property (nonatomic, assign) NSUInteger elementCount;
+@end
+
+@implementation RSSBenchmarkXMLParserDelegate
+
+- (void)parser:(NSXMLParser *)parser didStartElement:(NSString *)elementName namespaceURI:(NSString *)namespaceURI
+ qualifiedName:(NSString *)qName attributes:(NSDictionary *)attributeDict
+{
+  self.elementCount++;
+}
+
+@end
+
+static void RSSBenchmarkLibXMLStartElement(void *context, const xmlChar *localName, const xmlChar *prefix,
+                                           const xmlChar *URI, int namespaceCount, const xmlChar **namespaces,
+                                           int attributeCount, int defaultedCount, const xmlChar **attributes)
+{
+  (*(NSUInteger *)context)++;
+}
+
+#pragma mark - Timing
+
+static double RSSBenchmarkNow(void)
+{
+  struct timespec now;
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return now.tv_sec + now.tv_nsec / 1e9;
+}
+
+@implementation RSSBenchmarkRunner
+
+#pragma mark - Object Lifecycle
+
+- (instancetype)initWithGenerator:(RSSFeedGenerator *)generator
+{
+  self = [super init];
+  if (self) {
+    _generator = generator;
+    _backend = RSSParserBackendNSXMLParser;
+    _stringPoolCountLimit = RSSStringPoolDefaultCountLimit;
+    _iterations = 5;
+  }
+  return self;
+}
+
+#pragma mark - Running
+
+- (NSDictionary *)run
+{
+  NSData *data = [self.generator feedData];
+  NSUInteger itemCount = self.generator.itemCount;
+  
+  NSMutableDictionary *phases = [NSMutableDictionary dictionary];
+  
+  phases[@"networkStub"] = [self measureBytes:data.length items:itemCount block:^{
+    [self fetchData:data];
+  }];
+  
+  phases[@"xmlParse"] = [self measureBytes:data.length items:itemCount block:^{
+    [self parseXMLData:data];
+  }];
+  
+  __block RSSChannel *channel = nil;
+  phases[@"modelBuild"] = [self measureBytes:data.length items:itemCount block:^{
+    channel = [self channelFromData:data];
+  }];
+  
+  if (channel.items.count != itemCount) {
+    [NSException raise:NSInternalInconsistencyException format:@"Parsed %lu items of %lu",
+     (unsigned long)channel.items.count, (unsigned long)itemCount];
+  }
+  
+  NSArray *descriptions = [channel.items valueForKey:@"itemDescription"];
+  NSUInteger descriptionBytes = 0;
+  for (NSString *description in descriptions) {
+    descriptionBytes += [description lengthOfBytesUsingEncoding:NSUTF8StringEncoding];
+  }
+  phases[@"htmlUtilities"] = [self measureBytes:descriptionBytes items:itemCount block:^{
+    for (RSSItem *item in channel.items) {
+      NSString *description = item.itemDescription;
+      [description stringByConvertingHTMLToPlainText];
+      [description stringByDecodingHTMLEntities];
+      [item imagesFromItemDescription];
+    }
+  }];
+  
+  channel = nil;
+  
+  return @{@"configuration": [self.generator configuration],
+           @"backend": self.backend == RSSParserBackendLibXML ? @"libxml" : @"nsxml",
+           @"stringPoolCountLimit": @(self.stringPoolCountLimit),
+           @"documentBytes": @(data.length),
+           @"phases": phases,
+           @"channelMemory": [self measureChannelMemoryForData:data items:itemCount]};
+}
+
+// The heap bytes still allocated once a channel has been parsed and its parser released, less those allocated before.
+- (NSDictionary *)measureChannelMemoryForData:(NSData *)data items:(NSUInteger)items
+{
+  if (RSSBenchmarkAllocatedBytes() == 0) {
+    return @{@"bytes": [NSNull null], @"bytesPerItem": [NSNull null]};
+  }
+  
+  RSSChannel *channel = nil;
+  uint64_t before = RSSBenchmarkAllocatedBytes();
+  @autoreleasepool {
+    channel = [self channelFromData:data];
+  }
+  uint64_t after = RSSBenchmarkAllocatedBytes();
+  
+  double bytes = after > before ? (double)(after - before) : 0;
+  NSDictionary *memory = @{@"bytes": @(bytes), @"bytesPerItem": @(bytes / MAX(items, 1))};
+  
+  channel = nil;
+  return memory;
+}
+
+- (NSDictionary *)measureBytes:(NSUInteger)bytes items:(NSUInteger)items block:(void (^)(void))block
+{
+  NSMutableArray *seconds = [NSMutableArray arrayWithCapacity:self.iterations];
+  NSMutableArray *allocations = [NSMutableArray arrayWithCapacity:self.iterations];
+  
+  for (NSUInteger i = 0; i < MAX(self.iterations, 1); i++) {
+    @autoreleasepool {
+      uint64_t allocationsBefore = RSSBenchmarkAllocationCount();
+      double start = RSSBenchmarkNow();
+      block();
+      [seconds addObject:@(RSSBenchmarkNow() - start)];
+      [allocations addObject:@(RSSBenchmarkAllocationCount() - allocationsBefore)];
+    }
+  }
+  
+  double medianSeconds = [[self medianOfNumbers:seconds] doubleValue];
+  double medianAllocations = [[self medianOfNumbers:allocations] doubleValue];
+  double safeSeconds = MAX(medianSeconds, 1e-9);
+  
+  return @{@"seconds": @(medianSeconds),
+           @"megabytesPerSecond": @(bytes / (1024.0 * 1024.0) / safeSeconds),
+           @"itemsPerSecond": @(items / safeSeconds),
+           @"allocationsPerItem": RSSBenchmarkCountsAllocations() ? (id)@(medianAllocations / MAX(items, 1)) : [NSNull null],
+           @"peakResidentBytes": @(RSSBenchmarkPeakResidentBytes())};
+}
+
+- (NSNumber *)medianOfNumbers:(NSArray *)numbers
+{
+  NSArray *sorted = [numbers sortedArrayUsingSelector:@selector(compare:)];
+  return sorted[sorted.count / 2];
+}
+
+#pragma mark - Phases
+
+- (void)fetchData:(NSData *)data
+{
+  [RSSStubHTTPProtocol stubResponseWithStatusCode:200 headers:@{@"Content-Type": @"application/rss+xml"} data:data];
+  
+  NSURLSessionConfiguration *configuration = [NSURLSessionConfiguration ephemeralSessionConfiguration];
+  configuration.protocolClasses = @[[RSSStubHTTPProtocol class]];
+  
+  AFHTTPSessionManager *client = [[AFHTTPSessionManager alloc] initWithSessionConfiguration:configuration];
+  client.responseSerializer = [AFHTTPResponseSerializer serializer];
+  client.completionQueue = dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0);
+  
+  dispatch_semaphore_t done = dispatch_semaphore_create(0);
+  [client GET:RSSBenchmarkFeedURLString parameters:nil success:^(NSURLSessionDataTask *task, id responseObject) {
+    dispatch_semaphore_signal(done);
+  } failure:^(NSURLSessionDataTask *task, NSError *error) {
+    NSLog(@"Stubbed request failed: %@", error);
+    dispatch_semaphore_signal(done);
+  }];
+  dispatch_semaphore_wait(done, DISPATCH_TIME_FOREVER);
+  
+  [client invalidateSessionCancelingTasks:YES];
+}
+
+- (void)parseXMLData:(NSData *)data
+{
+  if (self.backend == RSSParserBackendLibXML) {
+    xmlSAXHandler handler;
+    memset(&handler, 0, sizeof(handler));
+    handler.initialized = XML_SAX2_MAGIC;
+    handler.startElementNs = RSSBenchmarkLibXMLStartElement;
+    
+    NSUInteger elementCount = 0;
+    xmlSAXUserParseMemory(&handler, &elementCount, data.bytes, (int)data.length);
+    
+  } else {
+    RSSBenchmarkXMLParserDelegate *delegate = [[RSSBenchmarkXMLParserDelegate alloc] init];
+    NSXMLParser *parser = [[NSXMLParser alloc] initWithData:data];
+    parser.delegate = delegate;
+    [parser parse];
+  }
+}
+
+- (RSSChannel *)channelFromData:(NSData *)data
+{
+  RSSParser *parser = [[RSSParser alloc] init];
+  parser.backend = self.backend;
+  parser.stringPoolCountLimit = self.stringPoolCountLimit;
+  parser.callbackQueue = dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0);
+  
+  __block RSSChannel *channel = nil;
+  dispatch_semaphore_t done = dispatch_semaphore_create(0);
+  [parser parseRSSData:data success:^(RSSChannel *parsedChannel) {
+    channel = parsedChannel;
+    dispatch_semaphore_signal(done);
+  } failure:^(NSError *error) {
+    NSLog(@"Parse failed: %@", error);
+    dispatch_semaphore_signal(done);
+  }];
+  dispatch_semaphore_wait(done, DISPATCH_TIME_FOREVER);
+  
+  return channel;
+}
+
+@end
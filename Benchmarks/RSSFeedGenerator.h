@@ -0,0 +1,81 @@
+//
+//  RSSFeedGenerator.h
+//  MediaRSSParser
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+
+
+#import <Foundation/Foundation.h>
+
+typedef NS_ENUM(NSInteger, RSSFeedGeneratorFormat) {
+  RSSFeedGeneratorFormatRSS2 = 0,
+  RSSFeedGeneratorFormatMediaRSS
+};
+
+/**
+ *  `RSSFeedGenerator` creates synthetic RSS 2.0 and Media RSS documents for benchmarking. The same properties (including `seed`) always generate the same document, so results can be compared between commits.
+ */
+@interface RSSFeedGenerator : NSObject
+
+/**
+ *  Whether to generate plain RSS 2.0 items, or items that also have Media RSS elements. The default is `RSSFeedGeneratorFormatRSS2`.
+ */
+@property (nonatomic, assign) RSSFeedGeneratorFormat format;
+
+/**
+ *  The number of `item` elements. The default is `100`.
+ */
+@property (nonatomic, assign) NSUInteger itemCount;
+
+/**
+ *  The approximate length in characters of the HTML within each item's `description`, before it's escaped for XML. The default is `512`.
+ */
+@property (nonatomic, assign) NSUInteger descriptionLength;
+
+/**
+ *  The fraction of words within each description, from `0` to `1`, that are followed by an HTML character reference such as `&eacute;` or `&#8212;`. The default is `0.05`.
+ */
+@property (nonatomic, assign) double entityDensity;
+
+/**
+ *  The number of `media:content`, `media:thumbnail` and `media:credit` elements within each item, used in turn. This is ignored for `RSSFeedGeneratorFormatRSS2`. The default is `2`.
+ */
+@property (nonatomic, assign) NSUInteger mediaElementsPerItem;
+
+/**
+ *  The prefix bound to the Media RSS namespace, which is used for each Media RSS element. This is ignored for `RSSFeedGeneratorFormatRSS2`. The default is `media`; any other prefix measures the cost of matching elements whose qualified names differ from the conventional ones.
+ */
+@property (nonatomic, copy) NSString *mediaPrefix;
+
+/**
+ *  The seed for the words and references chosen. The default is `1`.
+ */
+@property (nonatomic, assign) uint32_t seed;
+
+/**
+ *  Generates the document, encoded as UTF-8.
+ */
+- (NSData *)feedData;
+
+/**
+ *  A dictionary of the properties above, for reporting alongside results.
+ */
+- (NSDictionary *)configuration;
+
+@end
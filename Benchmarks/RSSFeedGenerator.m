@@ -0,0 +1,226 @@
+//
+//  RSSFeedGenerator.m
+//  MediaRSSParser
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+
+
+#import "RSSFeedGenerator.h"
+
+static NSString * const RSSFeedGeneratorWords[] = {
+  @"lorem", @"ipsum", @"dolor", @"sit", @"amet", @"consectetur", @"adipiscing", @"elit", @"sed", @"do",
+  @"eiusmod", @"tempor", @"incididunt", @"ut", @"labore", @"et", @"dolore", @"magna", @"aliqua", @"enim",
+};
+
+static NSString * const RSSFeedGeneratorReferences[] = {
+  @"&amp;", @"&eacute;", @"&hellip;", @"&mdash;", @"&nbsp;", @"&quot;", @"&#8212;", @"&#x2019;", @"&copy;", @"&lt;",
+};
+
+#define RSSFeedGeneratorCount(array) (sizeof(array) / sizeof(array[0]))
+
+@implementation RSSFeedGenerator {
+  uint32_t _state;
+}
+
+#pragma mark - Object Lifecycle
+
+- (instancetype)init
+{
+  self = [super init];
+  if (self) {
+    _format = RSSFeedGeneratorFormatRSS2;
+    _itemCount = 100;
+    _descriptionLength = 512;
+    _entityDensity = 0.05;
+    _mediaElementsPerItem = 2;
+    _mediaPrefix = @"media";
+    _seed = 1;
+  }
+  return self;
+}
+
+#pragma mark - Random Numbers
+
+// xorshift32, which is the same on every platform for a given seed
+- (uint32_t)nextRandom
+{
+  uint32_t x = _state;
+  x ^= x << 13;
+  x ^= x >> 17;
+  x ^= x << 5;
+  _state = x;
+  return x;
+}
+
+- (double)nextUnitRandom
+{
+  return [self nextRandom] / (double)UINT32_MAX;
+}
+
+#pragma mark - Generating
+
+- (NSData *)feedData
+{
+  _state = self.seed ?: 1;
+  
+  BOOL media = self.format == RSSFeedGeneratorFormatMediaRSS;
+  NSMutableString *feed = [NSMutableString stringWithCapacity:self.itemCount * (self.descriptionLength + 512)];
+  
+  [feed appendString:@"<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"];
+  [feed appendString:media ? @"<rss version=\"2.0\" xmlns:media=\"http://search.yahoo.com/mrss/\">\n" : @"<rss version=\"2.0\">\n"];
+  [feed appendString:@"<channel>\n<title>Synthetic Feed</title>\n<link>http://www.example.com</link>\n"
+   @"<description>Generated for benchmarking</description>\n<language>en-us</language>\n"
+   @"<pubDate>Tue, 10 Jun 2003 04:00:00 GMT</pubDate>\n<ttl>60</ttl>\n"];
+  
+  for (NSUInteger i = 0; i < self.itemCount; i++) {
+    [self appendItemAtIndex:i media:media toFeed:feed];
+  }
+  
+  [feed appendString:@"</channel>\n</rss>\n"];
+  
+  if (media && ![self.mediaPrefix isEqualToString:@"media"]) {
+    [self replaceMediaPrefixInFeed:feed];
+  }
+  return [feed dataUsingEncoding:NSUTF8StringEncoding];
+}
+
+- (void)replaceMediaPrefixInFeed:(NSMutableString *)feed
+{
+  NSDictionary *replacements = @{@"xmlns:media=": [NSString stringWithFormat:@"xmlns:%@=", self.mediaPrefix],
+                                 @"<media:": [NSString stringWithFormat:@"<%@:", self.mediaPrefix],
+                                 @"</media:": [NSString stringWithFormat:@"</%@:", self.mediaPrefix]};
+  
+  for (NSString *target in replacements) {
+    [feed replaceOccurrencesOfString:target withString:replacements[target] options:NSLiteralSearch
+                               range:NSMakeRange(0, feed.length)];
+  }
+}
+
+- (void)appendItemAtIndex:(NSUInteger)index media:(BOOL)media toFeed:(NSMutableString *)feed
+{
+  unsigned long number = (unsigned long)index;
+  
+  [feed appendFormat:@"<item>\n<title>Item %lu %@</title>\n<link>http://www.example.com/items/%lu</link>\n"
+   @"<guid isPermaLink=\"false\">item-%lu</guid>\n<pubDate>%@</pubDate>\n"
+   @"<author>author%lu@example.com (Author %lu)</author>\n",
+   number, RSSFeedGeneratorWords[index % RSSFeedGeneratorCount(RSSFeedGeneratorWords)], number, number,
+   [self pubDateForIndex:index], number % 10, number % 10];
+  
+  [feed appendString:@"<description>"];
+  [feed appendString:[self escapedDescriptionForIndex:index]];
+  [feed appendString:@"</description>\n"];
+  
+  if (media) {
+    [feed appendFormat:@"<media:title>Media %lu</media:title>\n<media:description>Media description %lu</media:description>\n",
+     number, number];
+    for (NSUInteger j = 0; j < self.mediaElementsPerItem; j++) {
+      [self appendMediaElement:j forIndex:index toFeed:feed];
+    }
+  }
+  
+  [feed appendString:@"</item>\n"];
+}
+
+- (NSString *)pubDateForIndex:(NSUInteger)index
+{
+  static NSString * const days[] = { @"Wed", @"Thu", @"Fri", @"Sat", @"Sun", @"Mon", @"Tue" };
+  
+  // Items are a minute apart, newest first, counting back from the last minute of 2014 (which began on a Wednesday)
+  NSUInteger minutes = 365 * 24 * 60 - 1 - (index % (365 * 24 * 60));
+  NSUInteger day = minutes / (24 * 60);
+  NSUInteger dayOfYear = day;
+  
+  static const NSUInteger monthDays[] = { 31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31 };
+  static NSString * const months[] = { @"Jan", @"Feb", @"Mar", @"Apr", @"May", @"Jun",
+                                       @"Jul", @"Aug", @"Sep", @"Oct", @"Nov", @"Dec" };
+  NSUInteger month = 0;
+  while (dayOfYear >= monthDays[month]) {
+    dayOfYear -= monthDays[month];
+    month++;
+  }
+  
+  return [NSString stringWithFormat:@"%@, %02lu %@ 2014 %02lu:%02lu:00 GMT",
+          days[day % 7], (unsigned long)dayOfYear + 1, months[month],
+          (unsigned long)(minutes / 60) % 24, (unsigned long)minutes % 60];
+}
+
+- (NSString *)escapedDescriptionForIndex:(NSUInteger)index
+{
+  NSMutableString *html = [NSMutableString stringWithCapacity:self.descriptionLength + 128];
+  [html appendFormat:@"<p><img src=\"http://www.example.com/images/%lu.jpg\" width=\"300\" /></p><p>", (unsigned long)index];
+  
+  NSUInteger words = 0;
+  while (html.length < self.descriptionLength) {
+    NSString *word = RSSFeedGeneratorWords[[self nextRandom] % RSSFeedGeneratorCount(RSSFeedGeneratorWords)];
+    [html appendString:word];
+    
+    if ([self nextUnitRandom] < self.entityDensity) {
+      [html appendString:RSSFeedGeneratorReferences[[self nextRandom] % RSSFeedGeneratorCount(RSSFeedGeneratorReferences)]];
+    }
+    
+    words++;
+    [html appendString:words % 12 == 0 ? @"</p>\n<p>" : (words % 5 == 0 ? @" <b>bold</b> " : @" ")];
+  }
+  [html appendString:@"</p>"];
+  
+  // The HTML is escaped for XML, so each reference within it becomes, for example, `&amp;eacute;`
+  [html replaceOccurrencesOfString:@"&" withString:@"&amp;" options:NSLiteralSearch range:NSMakeRange(0, html.length)];
+  [html replaceOccurrencesOfString:@"<" withString:@"&lt;" options:NSLiteralSearch range:NSMakeRange(0, html.length)];
+  [html replaceOccurrencesOfString:@">" withString:@"&gt;" options:NSLiteralSearch range:NSMakeRange(0, html.length)];
+  return html;
+}
+
+- (void)appendMediaElement:(NSUInteger)element forIndex:(NSUInteger)index toFeed:(NSMutableString *)feed
+{
+  unsigned long number = (unsigned long)index;
+  unsigned long count = (unsigned long)element;
+  
+  switch (element % 3) {
+    case 0:
+      [feed appendFormat:@"<media:content url=\"http://www.example.com/media/%lu-%lu.mp4\" fileSize=\"%lu\" "
+       @"type=\"video/mp4\" medium=\"video\" isDefault=\"%@\" expression=\"full\" bitrate=\"128\" "
+       @"duration=\"185\" height=\"480\" width=\"640\" lang=\"en\"/>\n",
+       number, count, 100000 + number, element == 0 ? @"true" : @"false"];
+      break;
+      
+    case 1:
+      [feed appendFormat:@"<media:thumbnail url=\"http://www.example.com/thumbnails/%lu-%lu.jpg\" "
+       @"height=\"50\" width=\"75\" time=\"12:05:01.123\"/>\n", number, count];
+      break;
+      
+    default:
+      [feed appendFormat:@"<media:credit role=\"producer\" scheme=\"urn:ebu\">Producer %lu</media:credit>\n", count];
+      break;
+  }
+}
+
+#pragma mark - Reporting
+
+- (NSDictionary *)configuration
+{
+  return @{@"format": self.format == RSSFeedGeneratorFormatMediaRSS ? @"mediaRSS" : @"rss2",
+           @"itemCount": @(self.itemCount),
+           @"descriptionLength": @(self.descriptionLength),
+           @"entityDensity": @(self.entityDensity),
+           @"mediaElementsPerItem": @(self.format == RSSFeedGeneratorFormatMediaRSS ? self.mediaElementsPerItem : 0),
+           @"mediaPrefix": self.format == RSSFeedGeneratorFormatMediaRSS ? self.mediaPrefix : @"",
+           @"seed": @(self.seed)};
+}
+
+@end
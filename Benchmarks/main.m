@@ -0,0 +1,138 @@
+//
+//  main.m
+//  MediaRSSParser
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+
+
+#import <Foundation/Foundation.h>
+#import "RSSBenchmarkAllocations.h"
+#import "RSSBenchmarkRunner.h"
+#import "RSSFeedGenerator.h"
+
+// Options are read as arguments, in the `NSArgumentDomain` form `-name value`:
+//
+//   -items 1,100,10000,100000   item counts to generate, comma separated
+//   -descriptionLength 512      characters of HTML per description
+//   -entityDensity 0.05         fraction of description words followed by a character reference
+//   -mediaElementsPerItem 2     Media RSS elements per item
+//   -mediaPrefix media          prefix bound to the Media RSS namespace
+//   -format both                rss2, mediaRSS or both
+//   -backend nsxml              nsxml, libxml or both
+//   -stringPoolCountLimit 1024  strings interned per parse, 0 to turn interning off
+//   -iterations 5               runs of each phase, reported by their median
+//   -seed 1                     generator seed
+//   -label <name>               recorded in the output, such as a commit hash
+//   -output <path>              where to write the JSON (standard output by default)
+
+static NSString *RSSBenchmarkOption(NSString *name, NSString *defaultValue)
+{
+  return [[NSUserDefaults standardUserDefaults] stringForKey:name] ?: defaultValue;
+}
+
+static NSArray *RSSBenchmarkListOption(NSString *name, NSString *defaultValue)
+{
+  return [RSSBenchmarkOption(name, defaultValue) componentsSeparatedByString:@","];
+}
+
+int main(int argc, const char *argv[])
+{
+  @autoreleasepool {
+    NSArray *itemCounts = RSSBenchmarkListOption(@"items", @"1,100,1000,10000");
+    NSString *format = RSSBenchmarkOption(@"format", @"both");
+    NSString *backend = RSSBenchmarkOption(@"backend", @"nsxml");
+    
+    NSMutableArray *formats = [NSMutableArray array];
+    if ([format isEqualToString:@"rss2"] || [format isEqualToString:@"both"]) {
+      [formats addObject:@(RSSFeedGeneratorFormatRSS2)];
+    }
+    if ([format isEqualToString:@"mediaRSS"] || [format isEqualToString:@"both"]) {
+      [formats addObject:@(RSSFeedGeneratorFormatMediaRSS)];
+    }
+    
+    NSMutableArray *backends = [NSMutableArray array];
+    if ([backend isEqualToString:@"nsxml"] || [backend isEqualToString:@"both"]) {
+      [backends addObject:@(RSSParserBackendNSXMLParser)];
+    }
+    if ([backend isEqualToString:@"libxml"] || [backend isEqualToString:@"both"]) {
+      [backends addObject:@(RSSParserBackendLibXML)];
+    }
+    
+    if (formats.count == 0 || backends.count == 0) {
+      fprintf(stderr, "usage: rss-benchmark [-items 1,100] [-format rss2|mediaRSS|both] [-backend nsxml|libxml|both] "
+              "[-descriptionLength n] [-entityDensity f] [-mediaElementsPerItem n] [-mediaPrefix p] [-stringPoolCountLimit n] "
+              "[-iterations n] [-seed n] [-label name] [-output path]\n");
+      return 1;
+    }
+    
+    NSMutableArray *runs = [NSMutableArray array];
+    for (NSNumber *formatValue in formats) {
+      for (NSString *itemCount in itemCounts) {
+        for (NSNumber *backendValue in backends) {
+          @autoreleasepool {
+            RSSFeedGenerator *generator = [[RSSFeedGenerator alloc] init];
+            generator.format = [formatValue integerValue];
+            generator.itemCount = (NSUInteger)[itemCount integerValue];
+            generator.descriptionLength = (NSUInteger)[RSSBenchmarkOption(@"descriptionLength", @"512") integerValue];
+            generator.entityDensity = [RSSBenchmarkOption(@"entityDensity", @"0.05") doubleValue];
+            generator.mediaElementsPerItem = (NSUInteger)[RSSBenchmarkOption(@"mediaElementsPerItem", @"2") integerValue];
+            generator.mediaPrefix = RSSBenchmarkOption(@"mediaPrefix", @"media");
+            generator.seed = (uint32_t)[RSSBenchmarkOption(@"seed", @"1") longLongValue];
+            
+            RSSBenchmarkRunner *runner = [[RSSBenchmarkRunner alloc] initWithGenerator:generator];
+            runner.backend = [backendValue integerValue];
+            runner.stringPoolCountLimit = (NSUInteger)[RSSBenchmarkOption(@"stringPoolCountLimit", @"1024") integerValue];
+            runner.iterations = (NSUInteger)[RSSBenchmarkOption(@"iterations", @"5") integerValue];
+            
+            fprintf(stderr, "%s, %s items, %s\n", [[generator configuration][@"format"] UTF8String],
+                    [itemCount UTF8String], runner.backend == RSSParserBackendLibXML ? "libxml" : "nsxml");
+            [runs addObject:[runner run]];
+          }
+        }
+      }
+    }
+    
+    NSDictionary *results = @{@"schemaVersion": @1,
+                              @"label": RSSBenchmarkOption(@"label", @""),
+                              @"date": [[NSDate date] description],
+                              @"operatingSystem": [[NSProcessInfo processInfo] operatingSystemVersionString],
+                              @"processorCount": @([[NSProcessInfo processInfo] activeProcessorCount]),
+                              @"countsAllocations": @(RSSBenchmarkCountsAllocations() != 0),
+                              @"runs": runs};
+    
+    NSError *error = nil;
+    NSData *json = [NSJSONSerialization dataWithJSONObject:results options:NSJSONWritingPrettyPrinted error:&error];
+    if (!json) {
+      fprintf(stderr, "Unable to write results: %s\n", [[error description] UTF8String]);
+      return 1;
+    }
+    
+    NSString *output = RSSBenchmarkOption(@"output", nil);
+    if (output) {
+      if (![json writeToFile:output options:NSDataWritingAtomic error:&error]) {
+        fprintf(stderr, "Unable to write %s: %s\n", [output UTF8String], [[error description] UTF8String]);
+        return 1;
+      }
+    } else {
+      fwrite(json.bytes, 1, json.length, stdout);
+      fputc('\n', stdout);
+    }
+  }
+  return 0;
+}
@@ -20,6 +20,12 @@
 //#import "GTMDefines.h"
 #import "GTMNSString+HTML.h"
 
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#include <arm_neon.h>
+#endif
+
 typedef struct {
 	__unsafe_unretained NSString *escapeSequence;
 	unichar uchar;
@@ -370,6 +376,101 @@ static int EscapeMapCompare(const void *ucharVoid, const void *mapVoid) {
 	return val;
 }
 
+// Direct lookup table over the characters covered by one of the tables above,
+// holding the 1-based index of each character's entry or 0 if it has none.
+typedef struct {
+	uint16_t *indexes;
+	unichar maxChar;
+} HTMLEscapeLookup;
+
+static HTMLEscapeLookup HTMLEscapeLookupCreate(HTMLEscapeMap *table, NSUInteger count) {
+	HTMLEscapeLookup lookup;
+	lookup.maxChar = table[count - 1].uchar;
+	lookup.indexes = calloc((size_t)lookup.maxChar + 1, sizeof(uint16_t));
+	for (NSUInteger i = 0; i < count; ++i) {
+		lookup.indexes[table[i].uchar] = (uint16_t)(i + 1);
+	}
+	return lookup;
+}
+
+// Returns the lookup for one of the tables above, built on first use, or NULL
+// for any other table.
+static const HTMLEscapeLookup *HTMLEscapeLookupForTable(HTMLEscapeMap *table, NSUInteger size) {
+	static HTMLEscapeLookup asciiLookup, unicodeLookup;
+	static dispatch_once_t asciiOnce, unicodeOnce;
+	NSUInteger count = size / sizeof(HTMLEscapeMap);
+	if (table == gAsciiHTMLEscapeMap) {
+		dispatch_once(&asciiOnce, ^{
+			asciiLookup = HTMLEscapeLookupCreate(table, count);
+		});
+		return &asciiLookup;
+	}
+	if (table == gUnicodeHTMLEscapeMap) {
+		dispatch_once(&unicodeOnce, ^{
+			unicodeLookup = HTMLEscapeLookupCreate(table, count);
+		});
+		return &unicodeLookup;
+	}
+	return NULL;
+}
+
+// Whether a character might need escaping. Both tables above escape the same
+// five ASCII characters, and every other character they escape is above 127,
+// so anything else up to highLimit has to be looked up.
+static inline BOOL HTMLEscapeCandidate(unichar c, unichar highLimit) {
+	if (c < 128) {
+		return c == '"' || c == '&' || c == '\'' || c == '<' || c == '>';
+	}
+	return c <= highLimit;
+}
+
+// Returns the number of characters at the start of chars that don't need
+// escaping, checking eight characters at a time where SIMD is available.
+static NSUInteger HTMLSafePrefixLength(const unichar *chars, NSUInteger length, unichar highLimit) {
+	NSUInteger i = 0;
+#if defined(__SSE2__)
+	const __m128i zero = _mm_setzero_si128();
+	const __m128i ascii = _mm_set1_epi16(127);
+	const __m128i limit = _mm_set1_epi16((short)highLimit);
+	const __m128i quot = _mm_set1_epi16('"');
+	const __m128i amp = _mm_set1_epi16('&');
+	const __m128i apos = _mm_set1_epi16('\'');
+	const __m128i lt = _mm_set1_epi16('<');
+	const __m128i gt = _mm_set1_epi16('>');
+	for (; i + 8 <= length; i += 8) {
+		__m128i v = _mm_loadu_si128((const __m128i *)(chars + i));
+		__m128i special = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi16(v, quot), _mm_cmpeq_epi16(v, amp)),
+		                               _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi16(v, apos), _mm_cmpeq_epi16(v, lt)),
+		                                            _mm_cmpeq_epi16(v, gt)));
+		// SSE2 has no unsigned 16-bit compare, so v > 127 and v <= highLimit are
+		// tested with saturating subtraction.
+		__m128i notASCII = _mm_cmpeq_epi16(_mm_subs_epu16(v, ascii), zero);
+		__m128i withinLimit = _mm_cmpeq_epi16(_mm_subs_epu16(v, limit), zero);
+		__m128i candidates = _mm_or_si128(special, _mm_andnot_si128(notASCII, withinLimit));
+		if (_mm_movemask_epi8(candidates)) {
+			break;
+		}
+	}
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+	const uint16x8_t ascii = vdupq_n_u16(127);
+	const uint16x8_t limit = vdupq_n_u16(highLimit);
+	for (; i + 8 <= length; i += 8) {
+		uint16x8_t v = vld1q_u16(chars + i);
+		uint16x8_t special = vorrq_u16(vorrq_u16(vceqq_u16(v, vdupq_n_u16('"')), vceqq_u16(v, vdupq_n_u16('&'))),
+		                               vorrq_u16(vorrq_u16(vceqq_u16(v, vdupq_n_u16('\'')), vceqq_u16(v, vdupq_n_u16('<'))),
+		                                         vceqq_u16(v, vdupq_n_u16('>'))));
+		uint16x8_t high = vandq_u16(vcgtq_u16(v, ascii), vcleq_u16(v, limit));
+		if (vmaxvq_u16(vorrq_u16(special, high))) {
+			break;
+		}
+	}
+#endif
+	while (i < length && !HTMLEscapeCandidate(chars[i], highLimit)) {
+		++i;
+	}
+	return i;
+}
+
 @implementation NSString (GTMNSStringHTMLAdditions)
 
 - (NSString *)gtm_stringByEscapingHTMLUsingTable:(HTMLEscapeMap*)table 
@@ -380,8 +481,7 @@ static int EscapeMapCompare(const void *ucharVoid, const void *mapVoid) {
 		return self;
 	}
 	
-	NSMutableString *finalString = [NSMutableString string];
-	NSMutableData *data2 = [NSMutableData dataWithCapacity:sizeof(unichar) * length];
+	NSMutableString *finalString = [NSMutableString stringWithCapacity:length];
 	
 	// this block is common between GTMNSString+HTML and GTMNSString+XML but
 	// it's so short that it isn't really worth trying to share.
@@ -399,44 +499,73 @@ static int EscapeMapCompare(const void *ucharVoid, const void *mapVoid) {
 		buffer = [data bytes];
 	}
 	
-	if (!buffer || !data2) {
+	if (!buffer) {
 		// COV_NF_START
-//		_GTMDevLog(@"Unable to allocate buffer or data2");
+//		_GTMDevLog(@"Unable to allocate buffer");
 		return nil;
 		// COV_NF_END
 	}
 	
-	unichar *buffer2 = (unichar *)[data2 mutableBytes];
-	
-	NSUInteger buffer2Length = 0;
+	const HTMLEscapeLookup *lookup = HTMLEscapeLookupForTable(table, size);
+	unichar highLimit = escapeUnicode ? USHRT_MAX : (lookup ? lookup->maxChar : USHRT_MAX);
 	
-	for (NSUInteger i = 0; i < length; ++i) {
-		HTMLEscapeMap *val = bsearch(&buffer[i], table, 
-									 size / sizeof(HTMLEscapeMap), 
-									 sizeof(HTMLEscapeMap), EscapeMapCompare);
-		if (val || (escapeUnicode && buffer[i] > 127)) {
-			if (buffer2Length) {
+	// Runs of characters that don't need escaping are appended straight from
+	// buffer, rather than copied one at a time.
+	NSUInteger runStart = 0;
+	NSUInteger i = 0;
+	while (i < length) {
+		i += HTMLSafePrefixLength(buffer + i, length - i, highLimit);
+		if (i == length) {
+			break;
+		}
+		
+		unichar uchar = buffer[i];
+		NSString *escapeSequence = nil;
+		if (lookup) {
+			if (uchar <= lookup->maxChar && lookup->indexes[uchar]) {
+				escapeSequence = table[lookup->indexes[uchar] - 1].escapeSequence;
+			}
+		} else {
+			HTMLEscapeMap *val = bsearch(&uchar, table, 
+										 size / sizeof(HTMLEscapeMap), 
+										 sizeof(HTMLEscapeMap), EscapeMapCompare);
+			escapeSequence = val ? val->escapeSequence : nil;
+		}
+		
+		if (escapeSequence || (escapeUnicode && uchar > 127)) {
+			if (i > runStart) {
 				CFStringAppendCharacters((CFMutableStringRef)finalString, 
-										 buffer2, 
-										 buffer2Length);
-				buffer2Length = 0;
+										 buffer + runStart, 
+										 i - runStart);
 			}
-			if (val) {
-				[finalString appendString:val->escapeSequence];
+			if (escapeSequence) {
+				CFStringAppend((CFMutableStringRef)finalString, (CFStringRef)escapeSequence);
 			}
 			else {
-//				_GTMDevAssert(escapeUnicode && buffer[i] > 127, @"Illegal Character");
-				[finalString appendFormat:@"&#%d;", buffer[i]];
+				// Same as appendFormat:@"&#%d;"
+				unichar numeric[8];
+				NSUInteger numericLength = 0;
+				numeric[numericLength++] = '&';
+				numeric[numericLength++] = '#';
+				unichar digits[5];
+				NSUInteger digitCount = 0;
+				for (unsigned value = uchar; value; value /= 10) {
+					digits[digitCount++] = (unichar)('0' + value % 10);
+				}
+				while (digitCount) {
+					numeric[numericLength++] = digits[--digitCount];
+				}
+				numeric[numericLength++] = ';';
+				CFStringAppendCharacters((CFMutableStringRef)finalString, numeric, numericLength);
 			}
-		} else {
-			buffer2[buffer2Length] = buffer[i];
-			buffer2Length += 1;
+			runStart = i + 1;
 		}
+		++i;
 	}
-	if (buffer2Length) {
+	if (length > runStart) {
 		CFStringAppendCharacters((CFMutableStringRef)finalString, 
-								 buffer2, 
-								 buffer2Length);
+								 buffer + runStart, 
+								 length - runStart);
 	}
 	return finalString;
 }
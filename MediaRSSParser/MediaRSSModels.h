@@ -35,6 +35,16 @@
 
 #import <MediaRSSParser/RSSChannel.h>
 #import <MediaRSSParser/RSSItem.h>
+#import <MediaRSSParser/RSSItemIdentity.h>
 #import <MediaRSSParser/RSSMediaContent.h>
 #import <MediaRSSParser/RSSMediaThumbnail.h>
 #import <MediaRSSParser/RSSMediaCredit.h>
+#import <MediaRSSParser/RSSMediaPlayer.h>
+#import <MediaRSSParser/RSSMediaCategory.h>
+#import <MediaRSSParser/RSSMediaRating.h>
+#import <MediaRSSParser/RSSMediaRestriction.h>
+#import <MediaRSSParser/RSSMediaCommunity.h>
+
+#import <MediaRSSParser/RSSChannelSnapshot.h>
+#import <MediaRSSParser/RSSColumnarChannel.h>
+#import <MediaRSSParser/RSSItemDedupIndex.h>
@@ -34,8 +34,15 @@
 //  THE SOFTWARE.
 
 #import <MediaRSSParser/RSSParser.h>
+#import <MediaRSSParser/RSSParseMetrics.h>
+#import <MediaRSSParser/RSSStringPool.h>
 #import <MediaRSSParser/MediaRSSModels.h>
 
+#import <MediaRSSParser/RSSFeedCache.h>
+#import <MediaRSSParser/RSSFeedCacheEntry.h>
+#import <MediaRSSParser/RSSMemoryFeedCache.h>
+#import <MediaRSSParser/RSSDiskFeedCache.h>
+
 #import <MediaRSSParser/GTMNSString+HTML.h>
 
 // WARNING: use of the following category has additional licensing
@@ -29,14 +29,14 @@
 
 #import <Foundation/Foundation.h>
 
-// Dependant upon GTMNSString+HTML
+// Dependant upon GTMNSString+HTML and RSSHTMLEntities
 
 @interface NSString (HTML)
 
 // Strips HTML tags & comments, removes extra whitespace and decodes HTML character entities.
 - (NSString *)stringByConvertingHTMLToPlainText;
 
-// Decode all HTML entities using GTM.
+// Decode all HTML5 named and numeric character references.
 - (NSString *)stringByDecodingHTMLEntities;
 
 // Encode all HTML entities using GTM.
@@ -134,4 +134,16 @@
  */
 @property (nonatomic, copy) NSArray *items;
 
+#pragma mark - Getting Embedded Images
+///---------------------
+/// @name Getting Embedded Images
+///---------------------
+
+/**
+ *  Calls `imagesFromItemDescription` on every item within `items`, spreading the items across a concurrent global queue, and waits for all of them.
+ *
+ *  @return An array with one entry per item, in the same order as `items`. Each entry is the item's `imagesFromItemDescription`, or an empty array if that's `nil`.
+ */
+- (NSArray *)imagesFromItemDescriptions;
+
 @end
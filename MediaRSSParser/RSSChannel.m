@@ -23,9 +23,35 @@
 //  THE SOFTWARE.
 
 #import "RSSChannel.h"
+#import "RSSItem.h"
 
 @implementation RSSChannel
 
+#pragma mark - Getting Embedded Images
+
+- (NSArray *)imagesFromItemDescriptions
+{
+  NSArray *items = self.items;
+  NSUInteger count = items.count;
+  if (count == 0) {
+    return @[];
+  }
+  
+  CFTypeRef *images = calloc(count, sizeof(CFTypeRef));
+  dispatch_apply(count, dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0), ^(size_t index) {
+    NSArray *itemImages = [items[index] imagesFromItemDescription] ?: @[];
+    images[index] = CFBridgingRetain(itemImages);
+  });
+  
+  CFArrayRef array = CFArrayCreate(kCFAllocatorDefault, images, (CFIndex)count, &kCFTypeArrayCallBacks);
+  for (NSUInteger i = 0; i < count; i++) {
+    CFRelease(images[i]);
+  }
+  free(images);
+  
+  return CFBridgingRelease(array);
+}
+
 #pragma mark - NSCoding
 
 - (instancetype)initWithCoder:(NSCoder *)aDecoder
@@ -0,0 +1,97 @@
+//
+//  RSSChannelSnapshot.h
+//  MediaRSSParser
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+
+
+#import <Foundation/Foundation.h>
+
+@class RSSChannel;
+@class RSSItem;
+
+/**
+ *  The error domain for errors reading channel snapshots.
+ */
+extern NSString * const RSSChannelSnapshotErrorDomain;
+
+/**
+ *  The error codes within `RSSChannelSnapshotErrorDomain`.
+ */
+typedef NS_ENUM(NSInteger, RSSChannelSnapshotError) {
+  /**
+   *  The data is not a channel snapshot, or it's truncated.
+   */
+  RSSChannelSnapshotErrorInvalidData = 1,
+  
+  /**
+   *  The snapshot was written with a format version this version of `RSSChannelSnapshot` can't read.
+   */
+  RSSChannelSnapshotErrorUnsupportedVersion
+};
+
+/**
+ *  `RSSChannelSnapshot` reads and writes a compact, versioned binary representation of an `RSSChannel` and its items. It's intended as a faster and smaller alternative to archiving channels with `NSKeyedArchiver`.
+ *
+ *  A snapshot has a header, a table of unique UTF-8 strings that every string or URL property refers to by index, fixed-width numeric fields, and an index of item offsets. Reading a snapshot only decodes the channel's own properties: its `items` array decodes each `RSSItem` the first time it's accessed, so opening a snapshot takes constant time regardless of the number of items.
+ *
+ *  Snapshots store each item's media contents, thumbnails and credits, but not its `mediaKeywords`, `mediaPlayer`, `mediaCategories`, `mediaRatings`, `mediaRestrictions` or `mediaCommunity`. Archive channels with `NSKeyedArchiver` to keep those.
+ */
+@interface RSSChannelSnapshot : NSObject
+
+///---------------------
+/// @name Writing Snapshots
+///---------------------
+
+/**
+ *  Returns a snapshot of the given channel, including all of its items.
+ */
++ (NSData *)dataWithChannel:(RSSChannel *)channel;
+
+/**
+ *  Writes a snapshot of the given channel to the file at `path`, atomically.
+ *
+ *  @return `YES` on success, otherwise `NO`, in which case `error` is set
+ */
++ (BOOL)writeChannel:(RSSChannel *)channel toFile:(NSString *)path error:(NSError **)error;
+
+///---------------------
+/// @name Reading Snapshots
+///---------------------
+
+/**
+ *  Returns the channel within the given snapshot. The returned channel's `items` retain `data` and decode items from it on first access.
+ *
+ *  @return The channel, or `nil` if `data` isn't a valid snapshot, in which case `error` is set
+ */
++ (RSSChannel *)channelWithData:(NSData *)data error:(NSError **)error;
+
+/**
+ *  Memory-maps the snapshot at `path` and returns the channel within it, the same as `channelWithData:error:`. Only the pages holding the header, the channel and the items actually accessed are read from disk.
+ */
++ (RSSChannel *)channelWithContentsOfFile:(NSString *)path error:(NSError **)error;
+
+/**
+ *  Decodes the item at the given index of a snapshot that has already been validated by `channelWithData:error:`. This is used by the lazy `items` array of channels read from snapshots.
+ *
+ *  @return The item, or an empty `RSSItem` if its record is malformed
+ */
++ (RSSItem *)itemAtIndex:(NSUInteger)index inSnapshotData:(NSData *)data;
+
+@end
@@ -0,0 +1,554 @@
+//
+//  RSSChannelSnapshot.m
+//  MediaRSSParser
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+
+
+#import "RSSChannelSnapshot.h"
+#import "RSSSnapshotItemArray.h"
+
+#import "RSSChannel.h"
+#import "RSSItem.h"
+#import "RSSMediaContent.h"
+#import "RSSMediaThumbnail.h"
+#import "RSSMediaCredit.h"
+
+NSString * const RSSChannelSnapshotErrorDomain = @"RSSChannelSnapshotErrorDomain";
+
+// All multi-byte fields are little-endian and may be unaligned.
+//
+// Header (32 bytes):
+//   0  char[4]  magic "RSSS"
+//   4  uint16   version
+//   6  uint16   reserved
+//   8  uint32   string count
+//  12  uint32   string index offset   (string count x { uint32 offset, uint32 length }, relative to string data)
+//  16  uint32   string data offset
+//  20  uint32   channel record offset
+//  24  uint32   item count
+//  28  uint32   item index offset     (item count x uint32 item record offset)
+//
+// String references are uint32 indexes into the string table; RSSSnapshotNoString means `nil`.
+// Dates are float64 intervals since the reference date; NaN means `nil`.
+
+static const char RSSSnapshotMagic[4] = { 'R', 'S', 'S', 'S' };
+static const uint16_t RSSSnapshotVersion = 1;
+static const uint32_t RSSSnapshotNoString = UINT32_MAX;
+
+static const NSUInteger RSSSnapshotHeaderSize = 32;
+static const NSUInteger RSSSnapshotStringIndexEntrySize = 8;
+
+// Channel record: 9 string references, 2 dates, ttl.
+static const NSUInteger RSSSnapshotChannelRecordSize = 9 * 4 + 2 * 8 + 8;
+
+// Item record: 9 string references, a date, then media counts, followed by the media records.
+static const NSUInteger RSSSnapshotItemRecordSize = 9 * 4 + 8 + 3 * 4;
+
+// Media content record: 5 string references, fileSize, isDefault (padded to 8 bytes), bitrate, framerate,
+// samplingRate, channels, duration, width, height.
+static const NSUInteger RSSSnapshotMediaContentRecordSize = 5 * 4 + 8 * 9;
+
+// Media thumbnail record: 2 string references, width, height.
+static const NSUInteger RSSSnapshotMediaThumbnailRecordSize = 2 * 4 + 2 * 8;
+
+// Media credit record: 2 string references.
+static const NSUInteger RSSSnapshotMediaCreditRecordSize = 2 * 4;
+
+#pragma mark - Writing
+
+@interface RSSSnapshotWriter : NSObject
+@property (nonatomic, strong) NSMutableData *records;
+@property (nonatomic, strong) NSMutableDictionary *stringIndexes;
+@property (nonatomic, strong) NSMutableArray *strings;
+@end
+
+@implementation RSSSnapshotWriter
+
+- (instancetype)init
+{
+  self = [super init];
+  if (self) {
+    _records = [[NSMutableData alloc] init];
+    _stringIndexes = [[NSMutableDictionary alloc] init];
+    _strings = [[NSMutableArray alloc] init];
+  }
+  return self;
+}
+
+- (void)appendUInt32:(uint32_t)value
+{
+  uint32_t littleEndian = CFSwapInt32HostToLittle(value);
+  [self.records appendBytes:&littleEndian length:sizeof(littleEndian)];
+}
+
+- (void)appendInt64:(int64_t)value
+{
+  uint64_t littleEndian = CFSwapInt64HostToLittle((uint64_t)value);
+  [self.records appendBytes:&littleEndian length:sizeof(littleEndian)];
+}
+
+- (void)appendDouble:(double)value
+{
+  uint64_t bits;
+  memcpy(&bits, &value, sizeof(bits));
+  [self appendInt64:(int64_t)bits];
+}
+
+- (void)appendDate:(NSDate *)date
+{
+  [self appendDouble:date ? [date timeIntervalSinceReferenceDate] : NAN];
+}
+
+- (void)appendString:(NSString *)string
+{
+  if (!string) {
+    [self appendUInt32:RSSSnapshotNoString];
+    return;
+  }
+  
+  NSNumber *index = self.stringIndexes[string];
+  if (!index) {
+    index = @(self.strings.count);
+    self.stringIndexes[string] = index;
+    [self.strings addObject:string];
+  }
+  
+  [self appendUInt32:(uint32_t)[index unsignedIntegerValue]];
+}
+
+- (void)appendURL:(NSURL *)url
+{
+  [self appendString:url.absoluteString];
+}
+
+- (void)appendChannel:(RSSChannel *)channel
+{
+  [self appendString:channel.title];
+  [self appendURL:channel.link];
+  [self appendString:channel.channelDescription];
+  [self appendString:channel.language];
+  [self appendString:channel.copyright];
+  [self appendString:channel.managingEditorEmail];
+  [self appendString:channel.webMasterEmail];
+  [self appendString:channel.generator];
+  [self appendURL:channel.docsURL];
+  [self appendDate:channel.pubDate];
+  [self appendDate:channel.lastBuildDate];
+  [self appendInt64:channel.ttl];
+}
+
+- (void)appendItem:(RSSItem *)item
+{
+  [self appendString:item.title];
+  [self appendURL:item.link];
+  [self appendString:item.itemDescription];
+  [self appendString:item.authorEmail];
+  [self appendURL:item.commentsURL];
+  [self appendString:item.guid];
+  [self appendString:item.mediaTitle];
+  [self appendString:item.mediaDescription];
+  [self appendString:item.mediaText];
+  [self appendDate:item.pubDate];
+  
+  [self appendUInt32:(uint32_t)item.mediaContents.count];
+  [self appendUInt32:(uint32_t)item.mediaThumbnails.count];
+  [self appendUInt32:(uint32_t)item.mediaCredits.count];
+  
+  for (RSSMediaContent *content in item.mediaContents) {
+    [self appendString:[content.url absoluteString]];
+    [self appendString:content.type];
+    [self appendString:content.medium];
+    [self appendString:content.expression];
+    [self appendString:content.language];
+    [self appendInt64:content.fileSize];
+    [self appendInt64:content.isDefault ? 1 : 0];
+    [self appendInt64:content.bitrate];
+    [self appendInt64:content.framerate];
+    [self appendDouble:content.samplingRate];
+    [self appendInt64:content.channels];
+    [self appendInt64:content.duration];
+    [self appendDouble:content.size.width];
+    [self appendDouble:content.size.height];
+  }
+  
+  for (RSSMediaThumbnail *thumbnail in item.mediaThumbnails) {
+    [self appendURL:thumbnail.url];
+    [self appendString:thumbnail.timeOffset];
+    [self appendDouble:thumbnail.size.width];
+    [self appendDouble:thumbnail.size.height];
+  }
+  
+  for (RSSMediaCredit *credit in item.mediaCredits) {
+    [self appendString:credit.role];
+    [self appendString:credit.value];
+  }
+}
+
+- (NSData *)dataWithChannel:(RSSChannel *)channel
+{
+  NSArray *items = channel.items;
+  
+  [self appendChannel:channel];
+  
+  NSMutableData *itemOffsets = [NSMutableData dataWithCapacity:items.count * sizeof(uint32_t)];
+  for (RSSItem *item in items) {
+    uint32_t offset = CFSwapInt32HostToLittle((uint32_t)self.records.length);
+    [itemOffsets appendBytes:&offset length:sizeof(offset)];
+    [self appendItem:item];
+  }
+  
+  NSMutableData *stringIndex = [NSMutableData dataWithCapacity:self.strings.count * RSSSnapshotStringIndexEntrySize];
+  NSMutableData *stringData = [[NSMutableData alloc] init];
+  for (NSString *string in self.strings) {
+    NSData *bytes = [string dataUsingEncoding:NSUTF8StringEncoding];
+    uint32_t entry[2] = { CFSwapInt32HostToLittle((uint32_t)stringData.length),
+                          CFSwapInt32HostToLittle((uint32_t)bytes.length) };
+    [stringIndex appendBytes:entry length:sizeof(entry)];
+    [stringData appendData:bytes];
+  }
+  
+  uint32_t channelOffset = (uint32_t)RSSSnapshotHeaderSize;
+  uint32_t itemIndexOffset = channelOffset + (uint32_t)RSSSnapshotChannelRecordSize;
+  uint32_t recordsOffset = itemIndexOffset + (uint32_t)itemOffsets.length;
+  uint32_t stringIndexOffset = channelOffset + (uint32_t)self.records.length + (uint32_t)itemOffsets.length;
+  uint32_t stringDataOffset = stringIndexOffset + (uint32_t)stringIndex.length;
+  
+  // Item offsets were recorded relative to the start of `records`, which begins with the channel record.
+  uint32_t *offsets = itemOffsets.mutableBytes;
+  for (NSUInteger i = 0; i < items.count; i++) {
+    uint32_t offset = CFSwapInt32LittleToHost(offsets[i]) - (uint32_t)RSSSnapshotChannelRecordSize + recordsOffset;
+    offsets[i] = CFSwapInt32HostToLittle(offset);
+  }
+  
+  NSMutableData *data = [NSMutableData dataWithCapacity:stringDataOffset + stringData.length];
+  
+  uint16_t version = CFSwapInt16HostToLittle(RSSSnapshotVersion);
+  uint16_t reserved = 0;
+  uint32_t header[6] = {
+    CFSwapInt32HostToLittle((uint32_t)self.strings.count),
+    CFSwapInt32HostToLittle(stringIndexOffset),
+    CFSwapInt32HostToLittle(stringDataOffset),
+    CFSwapInt32HostToLittle(channelOffset),
+    CFSwapInt32HostToLittle((uint32_t)items.count),
+    CFSwapInt32HostToLittle(itemIndexOffset)
+  };
+  [data appendBytes:RSSSnapshotMagic length:sizeof(RSSSnapshotMagic)];
+  [data appendBytes:&version length:sizeof(version)];
+  [data appendBytes:&reserved length:sizeof(reserved)];
+  [data appendBytes:header length:sizeof(header)];
+  
+  [data appendBytes:self.records.bytes length:RSSSnapshotChannelRecordSize];
+  [data appendData:itemOffsets];
+  [data appendBytes:(const char *)self.records.bytes + RSSSnapshotChannelRecordSize
+             length:self.records.length - RSSSnapshotChannelRecordSize];
+  [data appendData:stringIndex];
+  [data appendData:stringData];
+  
+  return data;
+}
+
+@end
+
+#pragma mark - Reading
+
+typedef struct {
+  const uint8_t *bytes;
+  NSUInteger length;
+  uint32_t stringCount;
+  uint32_t stringIndexOffset;
+  uint32_t stringDataOffset;
+  uint32_t channelOffset;
+  uint32_t itemCount;
+  uint32_t itemIndexOffset;
+} RSSSnapshotReader;
+
+static inline uint16_t RSSSnapshotReadUInt16(const uint8_t *bytes)
+{
+  uint16_t value;
+  memcpy(&value, bytes, sizeof(value));
+  return CFSwapInt16LittleToHost(value);
+}
+
+static inline uint32_t RSSSnapshotReadUInt32(const uint8_t *bytes)
+{
+  uint32_t value;
+  memcpy(&value, bytes, sizeof(value));
+  return CFSwapInt32LittleToHost(value);
+}
+
+static inline int64_t RSSSnapshotReadInt64(const uint8_t *bytes)
+{
+  uint64_t value;
+  memcpy(&value, bytes, sizeof(value));
+  return (int64_t)CFSwapInt64LittleToHost(value);
+}
+
+static inline double RSSSnapshotReadDouble(const uint8_t *bytes)
+{
+  uint64_t bits = (uint64_t)RSSSnapshotReadInt64(bytes);
+  double value;
+  memcpy(&value, &bits, sizeof(value));
+  return value;
+}
+
+static inline BOOL RSSSnapshotRangeIsValid(const RSSSnapshotReader *reader, uint64_t offset, uint64_t length)
+{
+  return offset <= reader->length && length <= reader->length - offset;
+}
+
+static BOOL RSSSnapshotReaderInit(RSSSnapshotReader *reader, NSData *data, NSError **error)
+{
+  memset(reader, 0, sizeof(*reader));
+  reader->bytes = data.bytes;
+  reader->length = data.length;
+  
+  NSInteger code = RSSChannelSnapshotErrorInvalidData;
+  
+  if (reader->length >= RSSSnapshotHeaderSize && memcmp(reader->bytes, RSSSnapshotMagic, sizeof(RSSSnapshotMagic)) == 0) {
+    if (RSSSnapshotReadUInt16(reader->bytes + 4) != RSSSnapshotVersion) {
+      code = RSSChannelSnapshotErrorUnsupportedVersion;
+    } else {
+      reader->stringCount = RSSSnapshotReadUInt32(reader->bytes + 8);
+      reader->stringIndexOffset = RSSSnapshotReadUInt32(reader->bytes + 12);
+      reader->stringDataOffset = RSSSnapshotReadUInt32(reader->bytes + 16);
+      reader->channelOffset = RSSSnapshotReadUInt32(reader->bytes + 20);
+      reader->itemCount = RSSSnapshotReadUInt32(reader->bytes + 24);
+      reader->itemIndexOffset = RSSSnapshotReadUInt32(reader->bytes + 28);
+      
+      if (RSSSnapshotRangeIsValid(reader, reader->stringIndexOffset, (uint64_t)reader->stringCount * RSSSnapshotStringIndexEntrySize) &&
+          RSSSnapshotRangeIsValid(reader, reader->stringDataOffset, 0) &&
+          RSSSnapshotRangeIsValid(reader, reader->channelOffset, RSSSnapshotChannelRecordSize) &&
+          RSSSnapshotRangeIsValid(reader, reader->itemIndexOffset, (uint64_t)reader->itemCount * sizeof(uint32_t))) {
+        return YES;
+      }
+    }
+  }
+  
+  if (error) {
+    *error = [NSError errorWithDomain:RSSChannelSnapshotErrorDomain code:code userInfo:nil];
+  }
+  return NO;
+}
+
+static NSString *RSSSnapshotReadString(const RSSSnapshotReader *reader, const uint8_t *field)
+{
+  uint32_t index = RSSSnapshotReadUInt32(field);
+  if (index == RSSSnapshotNoString || index >= reader->stringCount) {
+    return nil;
+  }
+  
+  const uint8_t *entry = reader->bytes + reader->stringIndexOffset + (NSUInteger)index * RSSSnapshotStringIndexEntrySize;
+  uint64_t offset = (uint64_t)reader->stringDataOffset + RSSSnapshotReadUInt32(entry);
+  uint32_t length = RSSSnapshotReadUInt32(entry + 4);
+  
+  if (!RSSSnapshotRangeIsValid(reader, offset, length)) {
+    return nil;
+  }
+  
+  return [[NSString alloc] initWithBytes:reader->bytes + offset length:length encoding:NSUTF8StringEncoding];
+}
+
+static NSURL *RSSSnapshotReadURL(const RSSSnapshotReader *reader, const uint8_t *field)
+{
+  NSString *string = RSSSnapshotReadString(reader, field);
+  return string ? [NSURL URLWithString:string] : nil;
+}
+
+static NSDate *RSSSnapshotReadDate(const uint8_t *field)
+{
+  double interval = RSSSnapshotReadDouble(field);
+  return isnan(interval) ? nil : [NSDate dateWithTimeIntervalSinceReferenceDate:interval];
+}
+
+static RSSChannel *RSSSnapshotReadChannel(const RSSSnapshotReader *reader)
+{
+  const uint8_t *record = reader->bytes + reader->channelOffset;
+  RSSChannel *channel = [[RSSChannel alloc] init];
+  
+  channel.title = RSSSnapshotReadString(reader, record);
+  channel.link = RSSSnapshotReadURL(reader, record + 4);
+  channel.channelDescription = RSSSnapshotReadString(reader, record + 8);
+  channel.language = RSSSnapshotReadString(reader, record + 12);
+  channel.copyright = RSSSnapshotReadString(reader, record + 16);
+  channel.managingEditorEmail = RSSSnapshotReadString(reader, record + 20);
+  channel.webMasterEmail = RSSSnapshotReadString(reader, record + 24);
+  channel.generator = RSSSnapshotReadString(reader, record + 28);
+  channel.docsURL = RSSSnapshotReadURL(reader, record + 32);
+  channel.pubDate = RSSSnapshotReadDate(record + 36);
+  channel.lastBuildDate = RSSSnapshotReadDate(record + 44);
+  channel.ttl = (NSInteger)RSSSnapshotReadInt64(record + 52);
+  
+  return channel;
+}
+
+static NSArray *RSSSnapshotReadMediaContents(const RSSSnapshotReader *reader, const uint8_t *records, uint32_t count)
+{
+  NSMutableArray *contents = [NSMutableArray arrayWithCapacity:count];
+  
+  for (uint32_t i = 0; i < count; i++) {
+    const uint8_t *record = records + (NSUInteger)i * RSSSnapshotMediaContentRecordSize;
+    RSSMediaContent *content = [[RSSMediaContent alloc] init];
+    
+    content.url = RSSSnapshotReadURL(reader, record);
+    content.type = RSSSnapshotReadString(reader, record + 4);
+    content.medium = RSSSnapshotReadString(reader, record + 8);
+    content.expression = RSSSnapshotReadString(reader, record + 12);
+    content.language = RSSSnapshotReadString(reader, record + 16);
+    content.fileSize = (NSInteger)RSSSnapshotReadInt64(record + 20);
+    content.isDefault = RSSSnapshotReadInt64(record + 28) != 0;
+    content.bitrate = (NSInteger)RSSSnapshotReadInt64(record + 36);
+    content.framerate = (NSInteger)RSSSnapshotReadInt64(record + 44);
+    content.samplingRate = (CGFloat)RSSSnapshotReadDouble(record + 52);
+    content.channels = (NSInteger)RSSSnapshotReadInt64(record + 60);
+    content.duration = (NSInteger)RSSSnapshotReadInt64(record + 68);
+    content.size = CGSizeMake((CGFloat)RSSSnapshotReadDouble(record + 76), (CGFloat)RSSSnapshotReadDouble(record + 84));
+    
+    [contents addObject:content];
+  }
+  
+  return contents;
+}
+
+static NSArray *RSSSnapshotReadMediaThumbnails(const RSSSnapshotReader *reader, const uint8_t *records, uint32_t count)
+{
+  NSMutableArray *thumbnails = [NSMutableArray arrayWithCapacity:count];
+  
+  for (uint32_t i = 0; i < count; i++) {
+    const uint8_t *record = records + (NSUInteger)i * RSSSnapshotMediaThumbnailRecordSize;
+    RSSMediaThumbnail *thumbnail = [[RSSMediaThumbnail alloc] init];
+    
+    thumbnail.url = RSSSnapshotReadURL(reader, record);
+    thumbnail.timeOffset = RSSSnapshotReadString(reader, record + 4);
+    thumbnail.size = CGSizeMake((CGFloat)RSSSnapshotReadDouble(record + 8), (CGFloat)RSSSnapshotReadDouble(record + 16));
+    
+    [thumbnails addObject:thumbnail];
+  }
+  
+  return thumbnails;
+}
+
+static NSArray *RSSSnapshotReadMediaCredits(const RSSSnapshotReader *reader, const uint8_t *records, uint32_t count)
+{
+  NSMutableArray *credits = [NSMutableArray arrayWithCapacity:count];
+  
+  for (uint32_t i = 0; i < count; i++) {
+    const uint8_t *record = records + (NSUInteger)i * RSSSnapshotMediaCreditRecordSize;
+    RSSMediaCredit *credit = [[RSSMediaCredit alloc] init];
+    
+    credit.role = RSSSnapshotReadString(reader, record);
+    credit.value = RSSSnapshotReadString(reader, record + 4);
+    
+    [credits addObject:credit];
+  }
+  
+  return credits;
+}
+
+static RSSItem *RSSSnapshotReadItem(const RSSSnapshotReader *reader, NSUInteger index)
+{
+  RSSItem *item = [[RSSItem alloc] init];
+  if (index >= reader->itemCount) {
+    return item;
+  }
+  
+  uint32_t offset = RSSSnapshotReadUInt32(reader->bytes + reader->itemIndexOffset + index * sizeof(uint32_t));
+  if (!RSSSnapshotRangeIsValid(reader, offset, RSSSnapshotItemRecordSize)) {
+    return item;
+  }
+  
+  const uint8_t *record = reader->bytes + offset;
+  uint32_t contentCount = RSSSnapshotReadUInt32(record + 44);
+  uint32_t thumbnailCount = RSSSnapshotReadUInt32(record + 48);
+  uint32_t creditCount = RSSSnapshotReadUInt32(record + 52);
+  
+  uint64_t mediaLength = (uint64_t)contentCount * RSSSnapshotMediaContentRecordSize +
+    (uint64_t)thumbnailCount * RSSSnapshotMediaThumbnailRecordSize +
+    (uint64_t)creditCount * RSSSnapshotMediaCreditRecordSize;
+  if (!RSSSnapshotRangeIsValid(reader, (uint64_t)offset + RSSSnapshotItemRecordSize, mediaLength)) {
+    return item;
+  }
+  
+  item.title = RSSSnapshotReadString(reader, record);
+  item.link = RSSSnapshotReadURL(reader, record + 4);
+  item.itemDescription = RSSSnapshotReadString(reader, record + 8);
+  item.authorEmail = RSSSnapshotReadString(reader, record + 12);
+  item.commentsURL = RSSSnapshotReadURL(reader, record + 16);
+  item.guid = RSSSnapshotReadString(reader, record + 20);
+  item.mediaTitle = RSSSnapshotReadString(reader, record + 24);
+  item.mediaDescription = RSSSnapshotReadString(reader, record + 28);
+  item.mediaText = RSSSnapshotReadString(reader, record + 32);
+  item.pubDate = RSSSnapshotReadDate(record + 36);
+  
+  const uint8_t *media = record + RSSSnapshotItemRecordSize;
+  item.mediaContents = RSSSnapshotReadMediaContents(reader, media, contentCount);
+  
+  media += (NSUInteger)contentCount * RSSSnapshotMediaContentRecordSize;
+  item.mediaThumbnails = RSSSnapshotReadMediaThumbnails(reader, media, thumbnailCount);
+  
+  media += (NSUInteger)thumbnailCount * RSSSnapshotMediaThumbnailRecordSize;
+  item.mediaCredits = RSSSnapshotReadMediaCredits(reader, media, creditCount);
+  
+  return item;
+}
+
+@implementation RSSChannelSnapshot
+
+#pragma mark - Writing Snapshots
+
++ (NSData *)dataWithChannel:(RSSChannel *)channel
+{
+  return [[[RSSSnapshotWriter alloc] init] dataWithChannel:channel];
+}
+
++ (BOOL)writeChannel:(RSSChannel *)channel toFile:(NSString *)path error:(NSError **)error
+{
+  return [[self dataWithChannel:channel] writeToFile:path options:NSDataWritingAtomic error:error];
+}
+
+#pragma mark - Reading Snapshots
+
++ (RSSChannel *)channelWithData:(NSData *)data error:(NSError **)error
+{
+  RSSSnapshotReader reader;
+  if (!RSSSnapshotReaderInit(&reader, data, error)) {
+    return nil;
+  }
+  
+  RSSChannel *channel = RSSSnapshotReadChannel(&reader);
+  channel.items = [[RSSSnapshotItemArray alloc] initWithSnapshotData:data count:reader.itemCount];
+  return channel;
+}
+
++ (RSSChannel *)channelWithContentsOfFile:(NSString *)path error:(NSError **)error
+{
+  NSData *data = [NSData dataWithContentsOfFile:path options:NSDataReadingMappedAlways error:error];
+  return data ? [self channelWithData:data error:error] : nil;
+}
+
++ (RSSItem *)itemAtIndex:(NSUInteger)index inSnapshotData:(NSData *)data
+{
+  RSSSnapshotReader reader;
+  if (!RSSSnapshotReaderInit(&reader, data, NULL)) {
+    return [[RSSItem alloc] init];
+  }
+  return RSSSnapshotReadItem(&reader, index);
+}
+
+@end
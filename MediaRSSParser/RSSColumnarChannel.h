@@ -0,0 +1,229 @@
+//
+//  RSSColumnarChannel.h
+//  MediaRSSParser
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+
+
+
+#import <Foundation/Foundation.h>
+
+@class RSSChannel;
+@class RSSItem;
+
+/**
+ *  The numeric columns of an `RSSColumnarChannel`. Each media value is taken from an item's primary media content: the first `mediaContents` object whose `isDefault` is `YES`, or else its first one.
+ */
+typedef NS_ENUM(NSUInteger, RSSColumnarChannelColumn) {
+  /**
+   *  The item's `pubDate`, as seconds since the reference date, or `NaN` if it has none (see `pubDates`).
+   */
+  RSSColumnarChannelColumnPubDate = 0,
+  
+  /**
+   *  The primary media content's `duration` (see `durations`).
+   */
+  RSSColumnarChannelColumnDuration,
+  
+  /**
+   *  The primary media content's `bitrate` (see `bitrates`).
+   */
+  RSSColumnarChannelColumnBitrate,
+  
+  /**
+   *  The primary media content's `fileSize` (see `fileSizes`).
+   */
+  RSSColumnarChannelColumnFileSize,
+  
+  /**
+   *  The primary media content's `size.width` (see `widths`).
+   */
+  RSSColumnarChannelColumnWidth,
+  
+  /**
+   *  The primary media content's `size.height` (see `heights`).
+   */
+  RSSColumnarChannelColumnHeight
+};
+
+/**
+ *  The string columns of an `RSSColumnarChannel`.
+ */
+typedef NS_ENUM(NSUInteger, RSSColumnarChannelStringColumn) {
+  /**
+   *  The item's `title`.
+   */
+  RSSColumnarChannelStringColumnTitle = 0,
+  
+  /**
+   *  The item's `link`, as its `absoluteString`.
+   */
+  RSSColumnarChannelStringColumnLink,
+  
+  /**
+   *  The item's `guid`.
+   */
+  RSSColumnarChannelStringColumnGUID,
+  
+  /**
+   *  The primary media content's `medium`.
+   */
+  RSSColumnarChannelStringColumnMedium,
+  
+  /**
+   *  The primary media content's `type`.
+   */
+  RSSColumnarChannelStringColumnType
+};
+
+/**
+ *  The string identifier of a missing string value.
+ */
+extern const uint32_t RSSColumnarChannelNoString;
+
+/**
+ *  `RSSColumnarChannel` holds the items of one or more channels as columns: contiguous C arrays of dates, durations, bitrates, file sizes and dimensions, plus string identifiers into a shared arena of unique UTF-8 strings. It's intended for filtering and sorting large numbers of items, which with `RSSItem` objects means following pointers from each item to its media contents.
+ *
+ *  Create one from parsed channels with `initWithChannel:` or `appendItemsFromChannel:`, or have `RSSParser` build one without keeping any `RSSItem` objects (see `parseColumnarRSSData:success:failure:`).
+ *
+ *  Appending items may move the column arrays, so pointers returned by `pubDates` and the other column methods are only valid until the next item is appended. `RSSColumnarChannel` isn't thread-safe while items are being appended; after that, it may be read from any number of threads.
+ */
+@interface RSSColumnarChannel : NSObject
+
+///---------------------
+/// @name Creating Columnar Channels
+///---------------------
+
+/**
+ *  Returns a columnar channel holding the `items` of the given channel.
+ */
+- (instancetype)initWithChannel:(RSSChannel *)channel;
+
+/**
+ *  Appends a row for the given item to every column.
+ */
+- (void)appendItem:(RSSItem *)item;
+
+/**
+ *  Appends a row for each of the given channel's `items`, in order.
+ */
+- (void)appendItemsFromChannel:(RSSChannel *)channel;
+
+///---------------------
+/// @name Reading Columns
+///---------------------
+
+/**
+ *  The number of items, which is the length of every column.
+ */
+@property (nonatomic, assign, readonly) NSUInteger count;
+
+/**
+ *  The items' `pubDate` values, as seconds since the reference date. An item without a `pubDate` has `NaN`.
+ */
+- (const double *)pubDates;
+
+/**
+ *  The `duration` of each item's primary media content, or `0` if it has none.
+ */
+- (const int64_t *)durations;
+
+/**
+ *  The `bitrate` of each item's primary media content, or `0` if it has none.
+ */
+- (const int64_t *)bitrates;
+
+/**
+ *  The `fileSize` of each item's primary media content, or `0` if it has none.
+ */
+- (const int64_t *)fileSizes;
+
+/**
+ *  The `size.width` of each item's primary media content, or `0` if it has none.
+ */
+- (const float *)widths;
+
+/**
+ *  The `size.height` of each item's primary media content, or `0` if it has none.
+ */
+- (const float *)heights;
+
+/**
+ *  Returns the value of the given numeric column for the item at `index`, converted to a `double`.
+ */
+- (double)valueOfColumn:(RSSColumnarChannelColumn)column atIndex:(NSUInteger)index;
+
+///---------------------
+/// @name Reading Strings
+///---------------------
+
+/**
+ *  The number of unique strings within the string arena.
+ */
+@property (nonatomic, assign, readonly) NSUInteger stringCount;
+
+/**
+ *  The string identifiers of the given string column. Equal strings always have the same identifier, so they can be compared without reading the arena. A missing value is `RSSColumnarChannelNoString`.
+ */
+- (const uint32_t *)stringIdentifiersForColumn:(RSSColumnarChannelStringColumn)column;
+
+/**
+ *  Returns the identifier of the given string, or `RSSColumnarChannelNoString` if no item has it.
+ */
+- (uint32_t)identifierOfString:(NSString *)string;
+
+/**
+ *  Returns the string with the given identifier, or `nil` if it's `RSSColumnarChannelNoString`. A new string is created from the arena each time.
+ */
+- (NSString *)stringWithIdentifier:(uint32_t)identifier;
+
+/**
+ *  Returns the value of the given string column for the item at `index`.
+ */
+- (NSString *)stringForColumn:(RSSColumnarChannelStringColumn)column atIndex:(NSUInteger)index;
+
+///---------------------
+/// @name Filtering
+///---------------------
+
+/**
+ *  Returns the indexes of the items whose value of the given column is within `minimum` and `maximum`, inclusive. Items without a `pubDate` never match the `pubDate` column.
+ */
+- (NSIndexSet *)indexesOfItemsWithColumn:(RSSColumnarChannelColumn)column from:(double)minimum to:(double)maximum;
+
+/**
+ *  Returns the indexes of the items published from `startDate` to `endDate`, inclusive. A `nil` date leaves that end of the range open.
+ */
+- (NSIndexSet *)indexesOfItemsPublishedFrom:(NSDate *)startDate to:(NSDate *)endDate;
+
+/**
+ *  Returns the indexes of the items whose value of the given string column equals `string`.
+ */
+- (NSIndexSet *)indexesOfItemsWithString:(NSString *)string inColumn:(RSSColumnarChannelStringColumn)column;
+
+///---------------------
+/// @name Sorting
+///---------------------
+
+/**
+ *  Fills `indexes`, which must have room for `count` values, with the item indexes ordered by the given column. The sort is stable, so items with equal values keep their relative order. Items without a `pubDate` sort last in either direction.
+ */
+- (void)getIndexes:(uint32_t *)indexes sortedByColumn:(RSSColumnarChannelColumn)column ascending:(BOOL)ascending;
+
+@end
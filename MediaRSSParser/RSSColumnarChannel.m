@@ -0,0 +1,584 @@
+//
+//  RSSColumnarChannel.m
+//  MediaRSSParser
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+
+
+
+#import "RSSColumnarChannel.h"
+
+#import "RSSChannel.h"
+#import "RSSItem.h"
+#import "RSSMediaContent.h"
+
+const uint32_t RSSColumnarChannelNoString = UINT32_MAX;
+
+enum {
+  RSSColumnarChannelStringColumnCount = RSSColumnarChannelStringColumnType + 1,
+  
+  // Filters compare a block of values at a time into a byte mask, then add the runs of matches to the index set.
+  RSSColumnarFilterBlockLength = 1024
+};
+
+static const NSUInteger RSSColumnarInitialCapacity = 256;
+
+// Raises `NSMallocException` if the column can't grow, leaving it as it was. Columns that already grew keep their
+// larger allocation, which is harmless because capacities are only updated once every column has grown.
+static inline void *RSSColumnarResize(void *column, NSUInteger capacity, size_t size)
+{
+  void *resized = capacity <= SIZE_MAX / size ? realloc(column, capacity * size) : NULL;
+  if (!resized) {
+    [NSException raise:NSMallocException format:@"Could not grow a column to %lu values", (unsigned long)capacity];
+  }
+  return resized;
+}
+
+static RSSMediaContent *RSSColumnarPrimaryContent(NSArray *contents)
+{
+  for (RSSMediaContent *content in contents) {
+    if (content.isDefault) {
+      return content;
+    }
+  }
+  return [contents firstObject];
+}
+
+#pragma mark - Filtering
+
+static void RSSColumnarMatchDoubles(const double *values, NSUInteger count, double minimum, double maximum, uint8_t *matches)
+{
+  for (NSUInteger i = 0; i < count; i++) {
+    matches[i] = (uint8_t)((values[i] >= minimum) & (values[i] <= maximum));
+  }
+}
+
+static void RSSColumnarMatchFloats(const float *values, NSUInteger count, double minimum, double maximum, uint8_t *matches)
+{
+  for (NSUInteger i = 0; i < count; i++) {
+    double value = values[i];
+    matches[i] = (uint8_t)((value >= minimum) & (value <= maximum));
+  }
+}
+
+static void RSSColumnarMatchIntegers(const int64_t *values, NSUInteger count, int64_t minimum, int64_t maximum, uint8_t *matches)
+{
+  for (NSUInteger i = 0; i < count; i++) {
+    matches[i] = (uint8_t)((values[i] >= minimum) & (values[i] <= maximum));
+  }
+}
+
+static void RSSColumnarMatchIdentifiers(const uint32_t *identifiers, NSUInteger count, uint32_t identifier, uint8_t *matches)
+{
+  for (NSUInteger i = 0; i < count; i++) {
+    matches[i] = (uint8_t)(identifiers[i] == identifier);
+  }
+}
+
+static void RSSColumnarAddMatches(NSMutableIndexSet *indexes, const uint8_t *matches, NSUInteger start, NSUInteger length)
+{
+  NSUInteger i = 0;
+  while (i < length) {
+    while (i < length && matches[i] == 0) {
+      i++;
+    }
+    
+    NSUInteger runStart = i;
+    while (i < length && matches[i] != 0) {
+      i++;
+    }
+    
+    if (i > runStart) {
+      [indexes addIndexesInRange:NSMakeRange(start + runStart, i - runStart)];
+    }
+  }
+}
+
+// Returns `NO` if no integer lies within the bounds.
+static BOOL RSSColumnarIntegerBounds(double minimum, double maximum, int64_t *integerMinimum, int64_t *integerMaximum)
+{
+  if (isnan(minimum) || isnan(maximum) || minimum > maximum || minimum >= 0x1p63 || maximum < -0x1p63) {
+    return NO;
+  }
+  
+  *integerMinimum = minimum <= -0x1p63 ? INT64_MIN : (int64_t)ceil(minimum);
+  *integerMaximum = maximum >= 0x1p63 ? INT64_MAX : (int64_t)floor(maximum);
+  return *integerMinimum <= *integerMaximum;
+}
+
+#pragma mark - Sorting
+
+// Maps doubles onto unsigned integers with the same order: negative values have all of their bits flipped, and
+// positive values only their sign bit.
+static inline uint64_t RSSColumnarDoubleKey(double value)
+{
+  uint64_t bits;
+  memcpy(&bits, &value, sizeof(bits));
+  return (bits >> 63) ? ~bits : bits | 0x8000000000000000ULL;
+}
+
+static inline uint64_t RSSColumnarIntegerKey(int64_t value)
+{
+  return (uint64_t)value ^ 0x8000000000000000ULL;
+}
+
+// A stable least-significant-digit radix sort of `keys`, moving `indexes` along with them. A byte that's the same
+// for every key is skipped, so small integers need only a few passes.
+static void RSSColumnarRadixSort(uint64_t *keys, uint32_t *indexes, NSUInteger count)
+{
+  size_t (*histograms)[256] = calloc(8, sizeof(*histograms));
+  for (NSUInteger i = 0; i < count; i++) {
+    uint64_t key = keys[i];
+    for (NSUInteger byte = 0; byte < 8; byte++) {
+      histograms[byte][(key >> (byte * 8)) & 0xFF] += 1;
+    }
+  }
+  
+  uint64_t *otherKeys = malloc(count * sizeof(uint64_t));
+  uint32_t *otherIndexes = malloc(count * sizeof(uint32_t));
+  
+  uint64_t *sourceKeys = keys, *destinationKeys = otherKeys;
+  uint32_t *sourceIndexes = indexes, *destinationIndexes = otherIndexes;
+  
+  for (NSUInteger byte = 0; byte < 8; byte++) {
+    size_t *offsets = histograms[byte];
+    NSUInteger shift = byte * 8;
+    if (offsets[(sourceKeys[0] >> shift) & 0xFF] == count) {
+      continue;
+    }
+    
+    size_t offset = 0;
+    for (NSUInteger digit = 0; digit < 256; digit++) {
+      size_t digitCount = offsets[digit];
+      offsets[digit] = offset;
+      offset += digitCount;
+    }
+    
+    for (NSUInteger i = 0; i < count; i++) {
+      size_t position = offsets[(sourceKeys[i] >> shift) & 0xFF]++;
+      destinationKeys[position] = sourceKeys[i];
+      destinationIndexes[position] = sourceIndexes[i];
+    }
+    
+    uint64_t *keysSwap = sourceKeys;
+    sourceKeys = destinationKeys;
+    destinationKeys = keysSwap;
+    
+    uint32_t *indexesSwap = sourceIndexes;
+    sourceIndexes = destinationIndexes;
+    destinationIndexes = indexesSwap;
+  }
+  
+  if (sourceIndexes != indexes) {
+    memcpy(indexes, sourceIndexes, count * sizeof(uint32_t));
+  }
+  
+  free(otherIndexes);
+  free(otherKeys);
+  free(histograms);
+}
+
+// Column arrays are grown together, so they always share `_capacity`. The string arena holds each unique string
+// once, without terminators; `_stringOffsets` and `_stringLengths` are indexed by string identifier.
+@implementation RSSColumnarChannel
+{
+  NSUInteger _capacity;
+  
+  double *_pubDates;
+  int64_t *_durations;
+  int64_t *_bitrates;
+  int64_t *_fileSizes;
+  float *_widths;
+  float *_heights;
+  uint32_t *_stringIdentifiers[RSSColumnarChannelStringColumnCount];
+  
+  NSMutableData *_arena;
+  uint32_t *_stringOffsets;
+  uint32_t *_stringLengths;
+  NSUInteger _stringCapacity;
+  NSMutableDictionary *_identifiersByString;
+}
+
+#pragma mark - Object Lifecycle
+
+- (instancetype)init
+{
+  self = [super init];
+  if (self) {
+    _arena = [[NSMutableData alloc] init];
+    _identifiersByString = [[NSMutableDictionary alloc] init];
+  }
+  return self;
+}
+
+- (instancetype)initWithChannel:(RSSChannel *)channel
+{
+  self = [self init];
+  if (self) {
+    [self reserveCapacity:channel.items.count];
+    [self appendItemsFromChannel:channel];
+  }
+  return self;
+}
+
+- (void)dealloc
+{
+  free(_pubDates);
+  free(_durations);
+  free(_bitrates);
+  free(_fileSizes);
+  free(_widths);
+  free(_heights);
+  for (NSUInteger column = 0; column < RSSColumnarChannelStringColumnCount; column++) {
+    free(_stringIdentifiers[column]);
+  }
+  free(_stringOffsets);
+  free(_stringLengths);
+}
+
+#pragma mark - Appending Items
+
+- (void)appendItemsFromChannel:(RSSChannel *)channel
+{
+  NSArray *items = channel.items;
+  [self reserveCapacity:_count + items.count];
+  
+  for (RSSItem *item in items) {
+    [self appendItem:item];
+  }
+}
+
+- (void)appendItem:(RSSItem *)item
+{
+  NSAssert(_count < UINT32_MAX, @"A columnar channel can't hold more than UINT32_MAX - 1 items");
+  
+  if (_count == _capacity) {
+    [self reserveCapacity:MAX(_capacity * 2, RSSColumnarInitialCapacity)];
+  }
+  
+  NSUInteger row = _count;
+  RSSMediaContent *content = RSSColumnarPrimaryContent(item.mediaContents);
+  
+  _pubDates[row] = item.pubDate ? [item.pubDate timeIntervalSinceReferenceDate] : NAN;
+  _durations[row] = content.duration;
+  _bitrates[row] = content.bitrate;
+  _fileSizes[row] = content.fileSize;
+  _widths[row] = (float)content.size.width;
+  _heights[row] = (float)content.size.height;
+  
+  _stringIdentifiers[RSSColumnarChannelStringColumnTitle][row] = [self identifierByAddingString:item.title];
+  _stringIdentifiers[RSSColumnarChannelStringColumnLink][row] = [self identifierByAddingString:item.link.absoluteString];
+  _stringIdentifiers[RSSColumnarChannelStringColumnGUID][row] = [self identifierByAddingString:item.guid];
+  _stringIdentifiers[RSSColumnarChannelStringColumnMedium][row] = [self identifierByAddingString:content.medium];
+  _stringIdentifiers[RSSColumnarChannelStringColumnType][row] = [self identifierByAddingString:content.type];
+  
+  _count += 1;
+}
+
+- (void)reserveCapacity:(NSUInteger)capacity
+{
+  if (capacity <= _capacity) {
+    return;
+  }
+  
+  _pubDates = RSSColumnarResize(_pubDates, capacity, sizeof(double));
+  _durations = RSSColumnarResize(_durations, capacity, sizeof(int64_t));
+  _bitrates = RSSColumnarResize(_bitrates, capacity, sizeof(int64_t));
+  _fileSizes = RSSColumnarResize(_fileSizes, capacity, sizeof(int64_t));
+  _widths = RSSColumnarResize(_widths, capacity, sizeof(float));
+  _heights = RSSColumnarResize(_heights, capacity, sizeof(float));
+  for (NSUInteger column = 0; column < RSSColumnarChannelStringColumnCount; column++) {
+    _stringIdentifiers[column] = RSSColumnarResize(_stringIdentifiers[column], capacity, sizeof(uint32_t));
+  }
+  _capacity = capacity;
+}
+
+- (uint32_t)identifierByAddingString:(NSString *)string
+{
+  if (!string) {
+    return RSSColumnarChannelNoString;
+  }
+  
+  NSNumber *identifier = _identifiersByString[string];
+  if (identifier) {
+    return [identifier unsignedIntValue];
+  }
+  
+  if (_stringCount == _stringCapacity) {
+    NSUInteger stringCapacity = MAX(_stringCapacity * 2, RSSColumnarInitialCapacity);
+    _stringOffsets = RSSColumnarResize(_stringOffsets, stringCapacity, sizeof(uint32_t));
+    _stringLengths = RSSColumnarResize(_stringLengths, stringCapacity, sizeof(uint32_t));
+    _stringCapacity = stringCapacity;
+  }
+  
+  NSUInteger offset = _arena.length;
+  NSUInteger maxLength = [string maximumLengthOfBytesUsingEncoding:NSUTF8StringEncoding];
+  NSAssert(offset + maxLength <= UINT32_MAX, @"A columnar channel's string arena can't exceed 4 GB");
+  
+  NSUInteger length = 0;
+  [_arena increaseLengthBy:maxLength];
+  [string getBytes:(uint8_t *)_arena.mutableBytes + offset
+         maxLength:maxLength
+        usedLength:&length
+          encoding:NSUTF8StringEncoding
+           options:0
+             range:NSMakeRange(0, string.length)
+    remainingRange:NULL];
+  [_arena setLength:offset + length];
+  
+  uint32_t newIdentifier = (uint32_t)_stringCount;
+  _stringOffsets[newIdentifier] = (uint32_t)offset;
+  _stringLengths[newIdentifier] = (uint32_t)length;
+  _identifiersByString[[string copy]] = @(newIdentifier);
+  _stringCount += 1;
+  
+  return newIdentifier;
+}
+
+#pragma mark - Reading Columns
+
+- (const double *)pubDates
+{
+  return _pubDates;
+}
+
+- (const int64_t *)durations
+{
+  return _durations;
+}
+
+- (const int64_t *)bitrates
+{
+  return _bitrates;
+}
+
+- (const int64_t *)fileSizes
+{
+  return _fileSizes;
+}
+
+- (const float *)widths
+{
+  return _widths;
+}
+
+- (const float *)heights
+{
+  return _heights;
+}
+
+- (double)valueOfColumn:(RSSColumnarChannelColumn)column atIndex:(NSUInteger)index
+{
+  NSParameterAssert(index < _count);
+  
+  switch (column) {
+    case RSSColumnarChannelColumnPubDate:
+      return _pubDates[index];
+      
+    case RSSColumnarChannelColumnDuration:
+      return (double)_durations[index];
+      
+    case RSSColumnarChannelColumnBitrate:
+      return (double)_bitrates[index];
+      
+    case RSSColumnarChannelColumnFileSize:
+      return (double)_fileSizes[index];
+      
+    case RSSColumnarChannelColumnWidth:
+      return _widths[index];
+      
+    case RSSColumnarChannelColumnHeight:
+      return _heights[index];
+  }
+  return NAN;
+}
+
+#pragma mark - Reading Strings
+
+- (const uint32_t *)stringIdentifiersForColumn:(RSSColumnarChannelStringColumn)column
+{
+  NSParameterAssert(column < RSSColumnarChannelStringColumnCount);
+  return _stringIdentifiers[column];
+}
+
+- (uint32_t)identifierOfString:(NSString *)string
+{
+  NSNumber *identifier = string ? _identifiersByString[string] : nil;
+  return identifier ? [identifier unsignedIntValue] : RSSColumnarChannelNoString;
+}
+
+- (NSString *)stringWithIdentifier:(uint32_t)identifier
+{
+  if (identifier == RSSColumnarChannelNoString) {
+    return nil;
+  }
+  
+  NSParameterAssert(identifier < _stringCount);
+  const uint8_t *bytes = (const uint8_t *)_arena.bytes + _stringOffsets[identifier];
+  return [[NSString alloc] initWithBytes:bytes length:_stringLengths[identifier] encoding:NSUTF8StringEncoding];
+}
+
+- (NSString *)stringForColumn:(RSSColumnarChannelStringColumn)column atIndex:(NSUInteger)index
+{
+  NSParameterAssert(index < _count);
+  return [self stringWithIdentifier:[self stringIdentifiersForColumn:column][index]];
+}
+
+#pragma mark - Filtering
+
+- (NSIndexSet *)indexesOfItemsWithColumn:(RSSColumnarChannelColumn)column from:(double)minimum to:(double)maximum
+{
+  switch (column) {
+    case RSSColumnarChannelColumnPubDate:
+      return [self indexesOfDoubles:_pubDates from:minimum to:maximum];
+      
+    case RSSColumnarChannelColumnDuration:
+      return [self indexesOfIntegers:_durations from:minimum to:maximum];
+      
+    case RSSColumnarChannelColumnBitrate:
+      return [self indexesOfIntegers:_bitrates from:minimum to:maximum];
+      
+    case RSSColumnarChannelColumnFileSize:
+      return [self indexesOfIntegers:_fileSizes from:minimum to:maximum];
+      
+    case RSSColumnarChannelColumnWidth:
+      return [self indexesOfFloats:_widths from:minimum to:maximum];
+      
+    case RSSColumnarChannelColumnHeight:
+      return [self indexesOfFloats:_heights from:minimum to:maximum];
+  }
+  return [NSIndexSet indexSet];
+}
+
+- (NSIndexSet *)indexesOfItemsPublishedFrom:(NSDate *)startDate to:(NSDate *)endDate
+{
+  double minimum = startDate ? [startDate timeIntervalSinceReferenceDate] : -INFINITY;
+  double maximum = endDate ? [endDate timeIntervalSinceReferenceDate] : INFINITY;
+  return [self indexesOfDoubles:_pubDates from:minimum to:maximum];
+}
+
+- (NSIndexSet *)indexesOfItemsWithString:(NSString *)string inColumn:(RSSColumnarChannelStringColumn)column
+{
+  uint32_t identifier = [self identifierOfString:string];
+  if (string && identifier == RSSColumnarChannelNoString) {
+    return [NSIndexSet indexSet];
+  }
+  
+  const uint32_t *identifiers = [self stringIdentifiersForColumn:column];
+  return [self indexesMatching:^(NSUInteger start, NSUInteger length, uint8_t *matches) {
+    RSSColumnarMatchIdentifiers(identifiers + start, length, identifier, matches);
+  }];
+}
+
+- (NSIndexSet *)indexesOfDoubles:(const double *)values from:(double)minimum to:(double)maximum
+{
+  return [self indexesMatching:^(NSUInteger start, NSUInteger length, uint8_t *matches) {
+    RSSColumnarMatchDoubles(values + start, length, minimum, maximum, matches);
+  }];
+}
+
+- (NSIndexSet *)indexesOfFloats:(const float *)values from:(double)minimum to:(double)maximum
+{
+  return [self indexesMatching:^(NSUInteger start, NSUInteger length, uint8_t *matches) {
+    RSSColumnarMatchFloats(values + start, length, minimum, maximum, matches);
+  }];
+}
+
+- (NSIndexSet *)indexesOfIntegers:(const int64_t *)values from:(double)minimum to:(double)maximum
+{
+  int64_t integerMinimum, integerMaximum;
+  if (!RSSColumnarIntegerBounds(minimum, maximum, &integerMinimum, &integerMaximum)) {
+    return [NSIndexSet indexSet];
+  }
+  
+  return [self indexesMatching:^(NSUInteger start, NSUInteger length, uint8_t *matches) {
+    RSSColumnarMatchIntegers(values + start, length, integerMinimum, integerMaximum, matches);
+  }];
+}
+
+- (NSIndexSet *)indexesMatching:(void (^)(NSUInteger start, NSUInteger length, uint8_t *matches))match
+{
+  NSMutableIndexSet *indexes = [[NSMutableIndexSet alloc] init];
+  uint8_t matches[RSSColumnarFilterBlockLength];
+  
+  for (NSUInteger start = 0; start < _count; start += RSSColumnarFilterBlockLength) {
+    NSUInteger length = MIN((NSUInteger)RSSColumnarFilterBlockLength, _count - start);
+    match(start, length, matches);
+    RSSColumnarAddMatches(indexes, matches, start, length);
+  }
+  return indexes;
+}
+
+#pragma mark - Sorting
+
+- (void)getIndexes:(uint32_t *)indexes sortedByColumn:(RSSColumnarChannelColumn)column ascending:(BOOL)ascending
+{
+  NSUInteger count = _count;
+  if (count == 0) {
+    return;
+  }
+  
+  uint64_t *keys = malloc(count * sizeof(uint64_t));
+  [self getKeys:keys forColumn:column ascending:ascending];
+  
+  for (NSUInteger i = 0; i < count; i++) {
+    indexes[i] = (uint32_t)i;
+  }
+  
+  RSSColumnarRadixSort(keys, indexes, count);
+  free(keys);
+}
+
+- (void)getKeys:(uint64_t *)keys forColumn:(RSSColumnarChannelColumn)column ascending:(BOOL)ascending
+{
+  NSUInteger count = _count;
+  uint64_t flip = ascending ? 0 : UINT64_MAX;
+  
+  switch (column) {
+    case RSSColumnarChannelColumnPubDate:
+      // Missing dates get the largest key either way, so they sort last.
+      for (NSUInteger i = 0; i < count; i++) {
+        double value = _pubDates[i];
+        keys[i] = isnan(value) ? UINT64_MAX : RSSColumnarDoubleKey(value) ^ flip;
+      }
+      break;
+      
+    case RSSColumnarChannelColumnDuration:
+    case RSSColumnarChannelColumnBitrate:
+    case RSSColumnarChannelColumnFileSize: {
+      const int64_t *values = column == RSSColumnarChannelColumnDuration ? _durations :
+                              column == RSSColumnarChannelColumnBitrate ? _bitrates : _fileSizes;
+      for (NSUInteger i = 0; i < count; i++) {
+        keys[i] = RSSColumnarIntegerKey(values[i]) ^ flip;
+      }
+      break;
+    }
+      
+    case RSSColumnarChannelColumnWidth:
+    case RSSColumnarChannelColumnHeight: {
+      const float *values = column == RSSColumnarChannelColumnWidth ? _widths : _heights;
+      for (NSUInteger i = 0; i < count; i++) {
+        keys[i] = RSSColumnarDoubleKey(values[i]) ^ flip;
+      }
+      break;
+    }
+  }
+}
+
+@end
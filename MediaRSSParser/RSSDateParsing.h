@@ -0,0 +1,46 @@
+//
+//  RSSDateParsing.h
+//  MediaRSSParser
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+
+
+#import <Foundation/Foundation.h>
+
+/**
+ *  Parses an RFC 822 (as used by RSS 2.0) or RFC 3339 (as used by Atom) date string, without using `NSDateFormatter`.
+ *
+ *  Supported RFC 822 variants include a missing day of week, missing seconds, two-digit years, full month names, numeric zones (`+0200`, `+02:00`, `GMT+0200`), the named zones from RFC 822 (`GMT`, `UT`, `UTC`, `EST`, `EDT`, `CST`, `CDT`, `MST`, `MDT`, `PST`, `PDT`) and the single-letter military zones (`A` to `I` are +1 to +9 hours, `K` to `M` are +10 to +12, `N` to `Y` are -1 to -12 and `Z` is UTC). The month must be a whole three-letter abbreviation or name, so words such as `Junk` are rejected. Leading and trailing whitespace is ignored.
+ *
+ *  @param string The date string to parse
+ *
+ *  @return The parsed date, or `nil` if `string` isn't in a supported format.
+ */
+extern NSDate *RSSDateFromString(NSString *string);
+
+/**
+ *  Parses an RFC 822 or RFC 3339 date from the given UTF-16 characters. This function doesn't allocate any memory.
+ *
+ *  @param characters The characters to parse
+ *  @param length     The number of characters
+ *  @param interval   On success, set to the parsed date as a time interval since 1970
+ *
+ *  @return `YES` if the characters contain a date in a supported format, otherwise `NO`.
+ */
+extern BOOL RSSDateIntervalFromCharacters(const unichar *characters, NSUInteger length, NSTimeInterval *interval);
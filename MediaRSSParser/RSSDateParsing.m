@@ -0,0 +1,385 @@
+//
+//  RSSDateParsing.m
+//  MediaRSSParser
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+
+
+#import "RSSDateParsing.h"
+
+// Dates longer than this are never valid RFC 822 or RFC 3339 dates, even with surrounding whitespace.
+static const NSUInteger RSSDateMaximumLength = 64;
+
+// Scanner state over a UTF-16 buffer.
+typedef struct {
+  const unichar *chars;
+  NSUInteger length;
+  NSUInteger index;
+} RSSDateScanner;
+
+static inline BOOL RSSDateScannerAtEnd(RSSDateScanner *scanner)
+{
+  return scanner->index >= scanner->length;
+}
+
+static inline unichar RSSDateScannerPeek(RSSDateScanner *scanner)
+{
+  return RSSDateScannerAtEnd(scanner) ? 0 : scanner->chars[scanner->index];
+}
+
+static inline BOOL RSSDateIsDigit(unichar c)
+{
+  return c >= '0' && c <= '9';
+}
+
+static inline BOOL RSSDateIsAlpha(unichar c)
+{
+  return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z');
+}
+
+static inline unichar RSSDateLowercase(unichar c)
+{
+  return (c >= 'A' && c <= 'Z') ? (unichar)(c + ('a' - 'A')) : c;
+}
+
+static void RSSDateSkipSpaces(RSSDateScanner *scanner)
+{
+  while (!RSSDateScannerAtEnd(scanner)) {
+    unichar c = scanner->chars[scanner->index];
+    if (c != ' ' && c != '\t' && c != '\n' && c != '\r') {
+      break;
+    }
+    scanner->index++;
+  }
+}
+
+static BOOL RSSDateScanCharacter(RSSDateScanner *scanner, unichar expected)
+{
+  if (RSSDateScannerPeek(scanner) != expected) {
+    return NO;
+  }
+  scanner->index++;
+  return YES;
+}
+
+// Scans between `minDigits` and `maxDigits` decimal digits, returning the number of digits scanned (0 on failure).
+static NSUInteger RSSDateScanNumber(RSSDateScanner *scanner, NSUInteger minDigits, NSUInteger maxDigits, NSInteger *value)
+{
+  NSUInteger digits = 0;
+  NSInteger result = 0;
+  while (digits < maxDigits && RSSDateIsDigit(RSSDateScannerPeek(scanner))) {
+    result = result * 10 + (scanner->chars[scanner->index] - '0');
+    scanner->index++;
+    digits++;
+  }
+  if (digits < minDigits) {
+    return 0;
+  }
+  *value = result;
+  return digits;
+}
+
+// Scans a run of ASCII letters into `word` (lowercased, NUL-terminated), returning its full length.
+static NSUInteger RSSDateScanWord(RSSDateScanner *scanner, char *word, NSUInteger capacity)
+{
+  NSUInteger length = 0;
+  while (RSSDateIsAlpha(RSSDateScannerPeek(scanner))) {
+    if (length + 1 < capacity) {
+      word[length] = (char)RSSDateLowercase(scanner->chars[scanner->index]);
+    }
+    length++;
+    scanner->index++;
+  }
+  word[length < capacity ? length : capacity - 1] = '\0';
+  return length;
+}
+
+// Returns the month (1 to 12) named by the whole of `word`, either abbreviated to three letters or in full, or 0.
+static NSInteger RSSDateMonthFromWord(const char *word, NSUInteger length)
+{
+  static const char *months[] = { "january", "february", "march", "april", "may", "june",
+                                  "july", "august", "september", "october", "november", "december" };
+  for (NSInteger i = 0; i < 12; i++) {
+    BOOL matches = length == 3 ? strncmp(word, months[i], 3) == 0 : strlen(months[i]) == length && strcmp(word, months[i]) == 0;
+    if (matches) {
+      return i + 1;
+    }
+  }
+  return 0;
+}
+
+// Returns the offset in hours of a single-letter military zone: `a` to `i` are +1 to +9, `k` to `m` are +10 to +12,
+// `n` to `y` are -1 to -12 and `z` is 0. `j` isn't a zone. (RFC 822 gives these signs reversed, which RFC 1123 notes as an error.)
+static BOOL RSSDateMilitaryZoneHours(char letter, NSInteger *hours)
+{
+  if (letter >= 'a' && letter <= 'i') {
+    *hours = letter - 'a' + 1;
+  } else if (letter >= 'k' && letter <= 'm') {
+    *hours = letter - 'k' + 10;
+  } else if (letter >= 'n' && letter <= 'y') {
+    *hours = -(letter - 'n' + 1);
+  } else if (letter == 'z') {
+    *hours = 0;
+  } else {
+    return NO;
+  }
+  return YES;
+}
+
+// Returns YES if `word` is a zone name from RFC 822 section 5.1 (or "utc"), storing its offset in seconds.
+static BOOL RSSDateZoneOffsetFromWord(const char *word, NSUInteger length, NSInteger *offset)
+{
+  NSInteger hours;
+  if (length == 1 && RSSDateMilitaryZoneHours(word[0], &hours)) {
+    *offset = hours * 3600;
+    return YES;
+  }
+
+  static const struct { const char *name; NSInteger hours; } zones[] = {
+    { "gmt", 0 }, { "ut", 0 }, { "utc", 0 },
+    { "est", -5 }, { "edt", -4 },
+    { "cst", -6 }, { "cdt", -5 },
+    { "mst", -7 }, { "mdt", -6 },
+    { "pst", -8 }, { "pdt", -7 },
+  };
+  for (NSUInteger i = 0; i < sizeof(zones) / sizeof(zones[0]); i++) {
+    if (strlen(zones[i].name) == length && strcmp(word, zones[i].name) == 0) {
+      *offset = zones[i].hours * 3600;
+      return YES;
+    }
+  }
+  return NO;
+}
+
+// Scans a numeric zone, `+HHMM`, `-HHMM`, `+HH:MM` or `-HH:MM`, storing its offset in seconds.
+static BOOL RSSDateScanNumericZone(RSSDateScanner *scanner, NSInteger *offset)
+{
+  unichar sign = RSSDateScannerPeek(scanner);
+  if (sign != '+' && sign != '-') {
+    return NO;
+  }
+  scanner->index++;
+
+  NSInteger hours, minutes;
+  if (RSSDateScanNumber(scanner, 2, 2, &hours) == 0) {
+    return NO;
+  }
+  RSSDateScanCharacter(scanner, ':');
+  if (RSSDateScanNumber(scanner, 2, 2, &minutes) == 0 || hours > 23 || minutes > 59) {
+    return NO;
+  }
+
+  *offset = (hours * 3600 + minutes * 60) * (sign == '-' ? -1 : 1);
+  return YES;
+}
+
+// Days since 1970-01-01 for the given proleptic Gregorian date.
+static int64_t RSSDateDaysFromCivil(int64_t year, int64_t month, int64_t day)
+{
+  year -= month <= 2;
+  int64_t era = (year >= 0 ? year : year - 399) / 400;
+  int64_t yearOfEra = year - era * 400;
+  int64_t dayOfYear = (153 * (month + (month > 2 ? -3 : 9)) + 2) / 5 + day - 1;
+  int64_t dayOfEra = yearOfEra * 365 + yearOfEra / 4 - yearOfEra / 100 + dayOfYear;
+  return era * 146097 + dayOfEra - 719468;
+}
+
+static BOOL RSSDateIsLeapYear(NSInteger year)
+{
+  return (year % 4 == 0 && year % 100 != 0) || year % 400 == 0;
+}
+
+static BOOL RSSDateMakeInterval(NSInteger year, NSInteger month, NSInteger day,
+                                NSInteger hour, NSInteger minute, double second,
+                                NSInteger zoneOffset, NSTimeInterval *interval)
+{
+  static const NSInteger daysInMonth[] = { 31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31 };
+
+  if (month < 1 || month > 12 || day < 1 || hour > 23 || minute > 59 || second >= 61) {
+    return NO;
+  }
+  if (day > daysInMonth[month - 1] + (month == 2 && RSSDateIsLeapYear(year) ? 1 : 0)) {
+    return NO;
+  }
+
+  int64_t days = RSSDateDaysFromCivil(year, month, day);
+  *interval = (double)(days * 86400 + hour * 3600 + minute * 60 - zoneOffset) + second;
+  return YES;
+}
+
+// RFC 822 / RFC 1123: `[EEE,] d MMM yy[yy] HH:mm[:ss] zone`
+static BOOL RSSDateParseRFC822(RSSDateScanner *scanner, NSTimeInterval *interval)
+{
+  // Long enough for "september"
+  char word[10];
+  NSInteger day, month, year, hour, minute, second = 0, offset = 0;
+
+  RSSDateSkipSpaces(scanner);
+
+  // Optional day of week, which is ignored
+  if (RSSDateIsAlpha(RSSDateScannerPeek(scanner))) {
+    RSSDateScanWord(scanner, word, sizeof(word));
+    RSSDateSkipSpaces(scanner);
+    RSSDateScanCharacter(scanner, ',');
+    RSSDateSkipSpaces(scanner);
+  }
+
+  if (RSSDateScanNumber(scanner, 1, 2, &day) == 0) {
+    return NO;
+  }
+  RSSDateSkipSpaces(scanner);
+
+  NSUInteger monthLength = RSSDateScanWord(scanner, word, sizeof(word));
+  if ((month = RSSDateMonthFromWord(word, monthLength)) == 0) {
+    return NO;
+  }
+  RSSDateSkipSpaces(scanner);
+
+  NSUInteger yearDigits = RSSDateScanNumber(scanner, 2, 4, &year);
+  if (yearDigits == 2) {
+    year += year < 50 ? 2000 : 1900;
+  } else if (yearDigits != 4) {
+    return NO;
+  }
+  RSSDateSkipSpaces(scanner);
+
+  if (RSSDateScanNumber(scanner, 1, 2, &hour) == 0 || !RSSDateScanCharacter(scanner, ':') ||
+      RSSDateScanNumber(scanner, 2, 2, &minute) == 0) {
+    return NO;
+  }
+  if (RSSDateScanCharacter(scanner, ':') && RSSDateScanNumber(scanner, 2, 2, &second) == 0) {
+    return NO;
+  }
+  RSSDateSkipSpaces(scanner);
+
+  if (RSSDateIsAlpha(RSSDateScannerPeek(scanner))) {
+    NSUInteger length = RSSDateScanWord(scanner, word, sizeof(word));
+    if (!RSSDateZoneOffsetFromWord(word, length, &offset)) {
+      return NO;
+    }
+    // Allows for `GMT+0100` style zones
+    unichar sign = RSSDateScannerPeek(scanner);
+    if (offset == 0 && (sign == '+' || sign == '-') && !RSSDateScanNumericZone(scanner, &offset)) {
+      return NO;
+    }
+  } else if (!RSSDateScanNumericZone(scanner, &offset)) {
+    return NO;
+  }
+
+  RSSDateSkipSpaces(scanner);
+  if (!RSSDateScannerAtEnd(scanner)) {
+    return NO;
+  }
+
+  return RSSDateMakeInterval(year, month, day, hour, minute, second, offset, interval);
+}
+
+// RFC 3339: `yyyy-MM-dd'T'HH:mm:ss[.S+](Z|+HH:mm|-HH:mm)`
+static BOOL RSSDateParseRFC3339(RSSDateScanner *scanner, NSTimeInterval *interval)
+{
+  NSInteger year, month, day, hour, minute, second, offset = 0;
+  double fraction = 0;
+
+  RSSDateSkipSpaces(scanner);
+
+  if (RSSDateScanNumber(scanner, 4, 4, &year) == 0 || !RSSDateScanCharacter(scanner, '-') ||
+      RSSDateScanNumber(scanner, 2, 2, &month) == 0 || !RSSDateScanCharacter(scanner, '-') ||
+      RSSDateScanNumber(scanner, 2, 2, &day) == 0) {
+    return NO;
+  }
+
+  unichar separator = RSSDateScannerPeek(scanner);
+  if (separator != 'T' && separator != 't' && separator != ' ') {
+    return NO;
+  }
+  scanner->index++;
+
+  if (RSSDateScanNumber(scanner, 2, 2, &hour) == 0 || !RSSDateScanCharacter(scanner, ':') ||
+      RSSDateScanNumber(scanner, 2, 2, &minute) == 0 || !RSSDateScanCharacter(scanner, ':') ||
+      RSSDateScanNumber(scanner, 2, 2, &second) == 0) {
+    return NO;
+  }
+
+  if (RSSDateScanCharacter(scanner, '.')) {
+    double scale = 0.1;
+    if (!RSSDateIsDigit(RSSDateScannerPeek(scanner))) {
+      return NO;
+    }
+    while (RSSDateIsDigit(RSSDateScannerPeek(scanner))) {
+      fraction += (scanner->chars[scanner->index] - '0') * scale;
+      scale /= 10;
+      scanner->index++;
+    }
+  }
+
+  unichar zone = RSSDateScannerPeek(scanner);
+  if (zone == 'Z' || zone == 'z') {
+    scanner->index++;
+  } else if (!RSSDateScanNumericZone(scanner, &offset)) {
+    return NO;
+  }
+
+  RSSDateSkipSpaces(scanner);
+  if (!RSSDateScannerAtEnd(scanner)) {
+    return NO;
+  }
+
+  return RSSDateMakeInterval(year, month, day, hour, minute, second + fraction, offset, interval);
+}
+
+static BOOL RSSDateLooksLikeRFC3339(const unichar *chars, NSUInteger length)
+{
+  NSUInteger i = 0;
+  while (i < length && (chars[i] == ' ' || chars[i] == '\t' || chars[i] == '\n' || chars[i] == '\r')) {
+    i++;
+  }
+  return i + 4 < length && RSSDateIsDigit(chars[i]) && RSSDateIsDigit(chars[i + 1]) &&
+    RSSDateIsDigit(chars[i + 2]) && RSSDateIsDigit(chars[i + 3]) && chars[i + 4] == '-';
+}
+
+BOOL RSSDateIntervalFromCharacters(const unichar *characters, NSUInteger length, NSTimeInterval *interval)
+{
+  RSSDateScanner scanner = { characters, length, 0 };
+
+  if (RSSDateLooksLikeRFC3339(characters, length)) {
+    return RSSDateParseRFC3339(&scanner, interval);
+  }
+  return RSSDateParseRFC822(&scanner, interval);
+}
+
+NSDate *RSSDateFromString(NSString *string)
+{
+  NSUInteger length = string.length;
+  if (length == 0 || length > RSSDateMaximumLength) {
+    return nil;
+  }
+  
+  unichar buffer[RSSDateMaximumLength];
+  const unichar *characters = CFStringGetCharactersPtr((__bridge CFStringRef)string);
+  if (!characters) {
+    CFStringGetCharacters((__bridge CFStringRef)string, CFRangeMake(0, length), buffer);
+    characters = buffer;
+  }
+  
+  NSTimeInterval interval;
+  if (!RSSDateIntervalFromCharacters(characters, length, &interval)) {
+    return nil;
+  }
+  return [NSDate dateWithTimeIntervalSince1970:interval];
+}
@@ -0,0 +1,49 @@
+//
+//  RSSDiskFeedCache.h
+//  MediaRSSParser
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+
+
+#import <Foundation/Foundation.h>
+#import "RSSFeedCache.h"
+
+/**
+ *  `RSSDiskFeedCache` archives each feed cache entry to its own file within `directoryURL`, so validators and channels survive relaunches.
+ */
+@interface RSSDiskFeedCache : NSObject <RSSFeedCache>
+
+/**
+ *  The directory entries are written to.
+ */
+@property (nonatomic, copy, readonly) NSURL *directoryURL;
+
+/**
+ *  Returns a disk feed cache that writes to the given directory, which is created if needed.
+ *
+ *  @param directoryURL The file URL of the cache directory
+ */
+- (instancetype)initWithDirectoryURL:(NSURL *)directoryURL;
+
+/**
+ *  Removes every entry within `directoryURL`.
+ */
+- (void)removeAllEntries;
+
+@end
@@ -0,0 +1,120 @@
+//
+//  RSSDiskFeedCache.m
+//  MediaRSSParser
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+
+
+#import "RSSDiskFeedCache.h"
+#import "RSSFeedCacheEntry.h"
+
+#import <CommonCrypto/CommonDigest.h>
+
+@interface RSSDiskFeedCache()
+@property (nonatomic, copy, readwrite) NSURL *directoryURL;
+@end
+
+@implementation RSSDiskFeedCache
+
+#pragma mark - Object Lifecycle
+
+- (instancetype)initWithDirectoryURL:(NSURL *)directoryURL
+{
+  self = [super init];
+  if (self) {
+    _directoryURL = [directoryURL copy];
+    [[NSFileManager defaultManager] createDirectoryAtURL:_directoryURL
+                             withIntermediateDirectories:YES
+                                              attributes:nil
+                                                   error:nil];
+  }
+  return self;
+}
+
+#pragma mark - Files
+
+// Feed URLs can be long and contain path separators, so each entry is named by the SHA-1 of its URL.
+- (NSString *)filePathForURL:(NSURL *)url
+{
+  NSData *data = [url.absoluteString dataUsingEncoding:NSUTF8StringEncoding];
+  unsigned char digest[CC_SHA1_DIGEST_LENGTH];
+  CC_SHA1(data.bytes, (CC_LONG)data.length, digest);
+  
+  NSMutableString *name = [NSMutableString stringWithCapacity:CC_SHA1_DIGEST_LENGTH * 2];
+  for (NSUInteger i = 0; i < CC_SHA1_DIGEST_LENGTH; i++) {
+    [name appendFormat:@"%02x", digest[i]];
+  }
+  
+  return [[self.directoryURL URLByAppendingPathComponent:name] path];
+}
+
+#pragma mark - RSSFeedCache
+
+- (RSSFeedCacheEntry *)cachedEntryForURL:(NSURL *)url
+{
+  if (!url) {
+    return nil;
+  }
+  
+  id entry = nil;
+  @try {
+    entry = [NSKeyedUnarchiver unarchiveObjectWithFile:[self filePathForURL:url]];
+  }
+  @catch (NSException *exception) {
+    // A truncated or otherwise unreadable file is treated as a miss.
+    entry = nil;
+  }
+  
+  return [entry isKindOfClass:[RSSFeedCacheEntry class]] ? entry : nil;
+}
+
+- (void)storeEntry:(RSSFeedCacheEntry *)entry forURL:(NSURL *)url
+{
+  if (!url) {
+    return;
+  }
+  
+  if (!entry) {
+    [self removeEntryForURL:url];
+    return;
+  }
+  
+  [NSKeyedArchiver archiveRootObject:entry toFile:[self filePathForURL:url]];
+}
+
+- (void)removeEntryForURL:(NSURL *)url
+{
+  if (url) {
+    [[NSFileManager defaultManager] removeItemAtPath:[self filePathForURL:url] error:nil];
+  }
+}
+
+- (void)removeAllEntries
+{
+  NSFileManager *fileManager = [NSFileManager defaultManager];
+  NSArray *fileURLs = [fileManager contentsOfDirectoryAtURL:self.directoryURL
+                                 includingPropertiesForKeys:nil
+                                                    options:0
+                                                      error:nil];
+  for (NSURL *fileURL in fileURLs) {
+    [fileManager removeItemAtURL:fileURL error:nil];
+  }
+}
+
+@end
@@ -0,0 +1,50 @@
+//
+//  RSSFeedCache.h
+//  MediaRSSParser
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+
+
+#import <Foundation/Foundation.h>
+
+@class RSSFeedCacheEntry;
+
+/**
+ *  `RSSFeedCache` is adopted by objects that store the HTTP validators (`ETag` and `Last-Modified`) and parsed channel of each feed URL, allowing `RSSParser` to make conditional `GET` requests (see the `feedCache` property on `RSSParser`).
+ *
+ *  See `RSSMemoryFeedCache` and `RSSDiskFeedCache` for the provided implementations. Methods may be called from any thread.
+ */
+@protocol RSSFeedCache <NSObject>
+
+/**
+ *  Returns the entry stored for the given feed URL, or `nil` if there isn't one.
+ */
+- (RSSFeedCacheEntry *)cachedEntryForURL:(NSURL *)url;
+
+/**
+ *  Stores the given entry for the given feed URL, replacing any existing entry.
+ */
+- (void)storeEntry:(RSSFeedCacheEntry *)entry forURL:(NSURL *)url;
+
+/**
+ *  Removes the entry stored for the given feed URL, if any.
+ */
+- (void)removeEntryForURL:(NSURL *)url;
+
+@end
@@ -0,0 +1,53 @@
+//
+//  RSSFeedCacheEntry.h
+//  MediaRSSParser
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+
+
+#import <Foundation/Foundation.h>
+
+@class RSSChannel;
+
+/**
+ *  `RSSFeedCacheEntry` holds the HTTP validators returned with a feed, along with the `RSSChannel` that was parsed from it.
+ */
+@interface RSSFeedCacheEntry : NSObject <NSCoding>
+
+/**
+ *  The value of the `ETag` response header, sent back as `If-None-Match`.
+ */
+@property (nonatomic, copy) NSString *etag;
+
+/**
+ *  The value of the `Last-Modified` response header, sent back as `If-Modified-Since`.
+ */
+@property (nonatomic, copy) NSString *lastModified;
+
+/**
+ *  The channel parsed from the response. This is returned by `RSSParser` when the server responds `304 Not Modified`.
+ */
+@property (nonatomic, strong) RSSChannel *channel;
+
+/**
+ *  Returns a new entry with the validators of the given response, or `nil` if the response has neither an `ETag` nor a `Last-Modified` header.
+ */
++ (instancetype)entryWithResponse:(NSHTTPURLResponse *)response;
+
+@end
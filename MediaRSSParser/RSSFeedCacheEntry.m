@@ -0,0 +1,71 @@
+//
+//  RSSFeedCacheEntry.m
+//  MediaRSSParser
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+
+
+#import "RSSFeedCacheEntry.h"
+#import "RSSChannel.h"
+
+@implementation RSSFeedCacheEntry
+
+#pragma mark - Object Lifecycle
+
++ (instancetype)entryWithResponse:(NSHTTPURLResponse *)response
+{
+  if (![response isKindOfClass:[NSHTTPURLResponse class]]) {
+    return nil;
+  }
+  
+  NSDictionary *headers = response.allHeaderFields;
+  NSString *etag = headers[@"ETag"] ?: headers[@"Etag"];
+  NSString *lastModified = headers[@"Last-Modified"];
+  
+  if (!etag && !lastModified) {
+    return nil;
+  }
+  
+  RSSFeedCacheEntry *entry = [[self alloc] init];
+  entry.etag = etag;
+  entry.lastModified = lastModified;
+  return entry;
+}
+
+#pragma mark - NSCoding
+
+- (instancetype)initWithCoder:(NSCoder *)aDecoder
+{
+  if (self = [super init]) {
+    _etag = [aDecoder decodeObjectForKey:@"etag"];
+    _lastModified = [aDecoder decodeObjectForKey:@"lastModified"];
+    _channel = [aDecoder decodeObjectForKey:@"channel"];
+  }
+  
+  return self;
+}
+
+- (void)encodeWithCoder:(NSCoder *)aCoder
+{
+  [aCoder encodeObject:self.etag forKey:@"etag"];
+  [aCoder encodeObject:self.lastModified forKey:@"lastModified"];
+  [aCoder encodeObject:self.channel forKey:@"channel"];
+}
+
+@end
@@ -0,0 +1,46 @@
+//
+//  RSSHTMLEntities.h
+//  MediaRSSParser
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+
+
+
+#import <Foundation/Foundation.h>
+
+/**
+ *  Decodes the HTML character references within the given string in a single forward pass.
+ *
+ *  Named references are looked up in a hash table of the full HTML5 named character reference set (see `RSSHTMLEntityTable.h`), and must be terminated by `;`. Decimal (`&#233;`) and hexadecimal (`&#xE9;`) references are decoded for any Unicode scalar value, including those above U+FFFF, which become surrogate pairs. References that can't be decoded, such as `&#0;`, `&#xD800;` or unknown names, are left as they are.
+ *
+ *  @param string The string to decode
+ *
+ *  @return A new, immutable string. Its length is never more than that of `string`.
+ */
+extern NSString *RSSStringByDecodingHTMLEntities(NSString *string);
+
+/**
+ *  Decodes the HTML character references within the given characters in place, the same as `RSSStringByDecodingHTMLEntities`.
+ *
+ *  @param characters The characters to decode, which are overwritten by the decoded characters
+ *  @param length     The number of characters
+ *
+ *  @return The number of decoded characters, which is never more than `length`.
+ */
+extern NSUInteger RSSDecodeHTMLEntitiesInPlace(unichar *characters, NSUInteger length);
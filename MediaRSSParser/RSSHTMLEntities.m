@@ -0,0 +1,198 @@
+//
+//  RSSHTMLEntities.m
+//  MediaRSSParser
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+
+
+
+#import "RSSHTMLEntities.h"
+
+typedef struct {
+  uint16_t nameOffset;
+  uint8_t nameLength;
+  uint32_t codePoints[2];
+} RSSHTMLEntity;
+
+#import "RSSHTMLEntityTable.h"
+
+// The longest reference that can be decoded, excluding its `&` and `;`; numeric references are always shorter than this.
+static const NSUInteger RSSHTMLReferenceMaxLength = RSSHTMLEntityMaxNameLength;
+
+#pragma mark - Named References
+
+static inline BOOL RSSHTMLIsReferenceCharacter(unichar c)
+{
+  return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') || c == '#';
+}
+
+// FNV-1a, the same hash used by `Scripts/generate_html_entity_table.py`
+static inline uint32_t RSSHTMLEntityHash(const unichar *name, NSUInteger length)
+{
+  uint32_t hash = 0x811C9DC5;
+  for (NSUInteger i = 0; i < length; i++) {
+    hash = (hash ^ (uint8_t)name[i]) * 0x01000193;
+  }
+  return hash;
+}
+
+static const RSSHTMLEntity *RSSHTMLEntityNamed(const unichar *name, NSUInteger length)
+{
+  if (length > RSSHTMLEntityMaxNameLength) {
+    return NULL;
+  }
+  
+  NSUInteger slot = RSSHTMLEntityHash(name, length) & (RSSHTMLEntitySlotCount - 1);
+  uint16_t index;
+  
+  while ((index = RSSHTMLEntitySlots[slot]) != 0) {
+    const RSSHTMLEntity *entity = &RSSHTMLEntities[index - 1];
+    
+    if (entity->nameLength == length) {
+      const char *entityName = RSSHTMLEntityNames + entity->nameOffset;
+      NSUInteger i = 0;
+      while (i < length && entityName[i] == name[i]) {
+        i++;
+      }
+      if (i == length) {
+        return entity;
+      }
+    }
+    slot = (slot + 1) & (RSSHTMLEntitySlotCount - 1);
+  }
+  
+  return NULL;
+}
+
+#pragma mark - Numeric References
+
+// Returns the code point of the digits following `&#`, or 0 if they aren't a Unicode scalar value.
+static uint32_t RSSHTMLNumericReference(const unichar *digits, NSUInteger length)
+{
+  BOOL hex = length > 0 && (digits[0] == 'x' || digits[0] == 'X');
+  NSUInteger i = hex ? 1 : 0;
+  if (i == length) {
+    return 0;
+  }
+  
+  uint32_t codePoint = 0;
+  for (; i < length; i++) {
+    unichar c = digits[i];
+    uint32_t digit;
+    if (c >= '0' && c <= '9') {
+      digit = c - '0';
+    } else if (hex && c >= 'a' && c <= 'f') {
+      digit = c - 'a' + 10;
+    } else if (hex && c >= 'A' && c <= 'F') {
+      digit = c - 'A' + 10;
+    } else {
+      return 0;
+    }
+    codePoint = codePoint * (hex ? 16 : 10) + digit;
+    if (codePoint > 0x10FFFF) {
+      return 0;
+    }
+  }
+  
+  BOOL surrogate = codePoint >= 0xD800 && codePoint <= 0xDFFF;
+  return surrogate ? 0 : codePoint;
+}
+
+#pragma mark - Decoding
+
+static inline unichar *RSSHTMLWriteCodePoint(uint32_t codePoint, unichar *output)
+{
+  if (codePoint < 0x10000) {
+    *output++ = (unichar)codePoint;
+    return output;
+  }
+  
+  codePoint -= 0x10000;
+  *output++ = (unichar)(0xD800 + (codePoint >> 10));
+  *output++ = (unichar)(0xDC00 + (codePoint & 0x3FF));
+  return output;
+}
+
+// Decodes the reference starting at `c`, which points at a `&`, and returns the position after it.
+static const unichar *RSSHTMLDecodeReference(const unichar *c, const unichar *end, unichar **output)
+{
+  const unichar *name = c + 1;
+  const unichar *limit = name + MIN((NSUInteger)(end - name), RSSHTMLReferenceMaxLength);
+  const unichar *semicolon = name;
+  
+  while (semicolon < limit && RSSHTMLIsReferenceCharacter(*semicolon)) {
+    semicolon++;
+  }
+  
+  if (semicolon > name && semicolon < end && *semicolon == ';') {
+    NSUInteger length = (NSUInteger)(semicolon - name);
+    
+    if (name[0] == '#') {
+      uint32_t codePoint = RSSHTMLNumericReference(name + 1, length - 1);
+      if (codePoint) {
+        *output = RSSHTMLWriteCodePoint(codePoint, *output);
+        return semicolon + 1;
+      }
+      
+    } else {
+      const RSSHTMLEntity *entity = RSSHTMLEntityNamed(name, length);
+      if (entity) {
+        *output = RSSHTMLWriteCodePoint(entity->codePoints[0], *output);
+        if (entity->codePoints[1]) {
+          *output = RSSHTMLWriteCodePoint(entity->codePoints[1], *output);
+        }
+        return semicolon + 1;
+      }
+    }
+  }
+  
+  *(*output)++ = '&';
+  return c + 1;
+}
+
+NSUInteger RSSDecodeHTMLEntitiesInPlace(unichar *characters, NSUInteger length)
+{
+  unichar *output = characters;
+  const unichar *c = characters, *end = characters + length;
+  
+  // No reference is shorter than its replacement, so the output never overtakes the input.
+  while (c < end) {
+    if (*c == '&') {
+      c = RSSHTMLDecodeReference(c, end, &output);
+    } else {
+      *output++ = *c++;
+    }
+  }
+  
+  return (NSUInteger)(output - characters);
+}
+
+NSString *RSSStringByDecodingHTMLEntities(NSString *string)
+{
+  NSUInteger length = string.length;
+  if ([string rangeOfString:@"&" options:NSLiteralSearch].location == NSNotFound) {
+    return [NSString stringWithString:string];
+  }
+  
+  unichar *characters = malloc(length * sizeof(unichar));
+  [string getCharacters:characters range:NSMakeRange(0, length)];
+  
+  NSUInteger decodedLength = RSSDecodeHTMLEntitiesInPlace(characters, length);
+  return [[NSString alloc] initWithCharactersNoCopy:characters length:decodedLength freeWhenDone:YES];
+}
@@ -0,0 +1,2802 @@
+//
+//  RSSHTMLEntityTable.h
+//  MediaRSSParser
+//
+//  Generated by Scripts/generate_html_entity_table.py. Do not edit.
+//
+
+static const NSUInteger RSSHTMLEntityCount = 2125;
+static const NSUInteger RSSHTMLEntitySlotCount = 8192;
+static const NSUInteger RSSHTMLEntityMaxNameLength = 31;
+
+static const char RSSHTMLEntityNames[] =
+  "AEligAMPAacuteAbreveAcircAcyAfrAgraveAlphaAmacrAndAogonAopfApplyFunctionAringAscrAssignAtildeAuml"
+  "BackslashBarvBarwedBcyBecauseBernoullisBetaBfrBopfBreveBscrBumpeqCHcyCOPYCacuteCap"
+  "CapitalDifferentialDCayleysCcaronCcedilCcircCconintCdotCedillaCenterDotCfrChiCircleDotCircleMinus"
+  "CirclePlusCircleTimesClockwiseContourIntegralCloseCurlyDoubleQuoteCloseCurlyQuoteColonColone"
+  "CongruentConintContourIntegralCopfCoproductCounterClockwiseContourIntegralCrossCscrCupCupCapDD"
+  "DDotrahdDJcyDScyDZcyDaggerDarrDashvDcaronDcyDelDeltaDfrDiacriticalAcuteDiacriticalDot"
+  "DiacriticalDoubleAcuteDiacriticalGraveDiacriticalTildeDiamondDifferentialDDopfDotDotDotDotEqual"
+  "DoubleContourIntegralDoubleDotDoubleDownArrowDoubleLeftArrowDoubleLeftRightArrowDoubleLeftTee"
+  "DoubleLongLeftArrowDoubleLongLeftRightArrowDoubleLongRightArrowDoubleRightArrowDoubleRightTee"
+  "DoubleUpArrowDoubleUpDownArrowDoubleVerticalBarDownArrowDownArrowBarDownArrowUpArrowDownBreve"
+  "DownLeftRightVectorDownLeftTeeVectorDownLeftVectorDownLeftVectorBarDownRightTeeVectorDownRightVector"
+  "DownRightVectorBarDownTeeDownTeeArrowDownarrowDscrDstrokENGETHEacuteEcaronEcircEcyEdotEfrEgrave"
+  "ElementEmacrEmptySmallSquareEmptyVerySmallSquareEogonEopfEpsilonEqualEqualTildeEquilibriumEscrEsim"
+  "EtaEumlExistsExponentialEFcyFfrFilledSmallSquareFilledVerySmallSquareFopfForAllFouriertrfFscrGJcyGT"
+  "GammaGammadGbreveGcedilGcircGcyGdotGfrGgGopfGreaterEqualGreaterEqualLessGreaterFullEqual"
+  "GreaterGreaterGreaterLessGreaterSlantEqualGreaterTildeGscrGtHARDcyHacekHatHcircHfrHilbertSpaceHopf"
+  "HorizontalLineHscrHstrokHumpDownHumpHumpEqualIEcyIJligIOcyIacuteIcircIcyIdotIfrIgraveImImacr"
+  "ImaginaryIImpliesIntIntegralIntersectionInvisibleCommaInvisibleTimesIogonIopfIotaIscrItildeIukcyIuml"
+  "JcircJcyJfrJopfJscrJsercyJukcyKHcyKJcyKappaKcedilKcyKfrKopfKscrLJcyLTLacuteLambdaLangLaplacetrfLarr"
+  "LcaronLcedilLcyLeftAngleBracketLeftArrowLeftArrowBarLeftArrowRightArrowLeftCeilingLeftDoubleBracket"
+  "LeftDownTeeVectorLeftDownVectorLeftDownVectorBarLeftFloorLeftRightArrowLeftRightVectorLeftTee"
+  "LeftTeeArrowLeftTeeVectorLeftTriangleLeftTriangleBarLeftTriangleEqualLeftUpDownVectorLeftUpTeeVector"
+  "LeftUpVectorLeftUpVectorBarLeftVectorLeftVectorBarLeftarrowLeftrightarrowLessEqualGreater"
+  "LessFullEqualLessGreaterLessLessLessSlantEqualLessTildeLfrLlLleftarrowLmidotLongLeftArrow"
+  "LongLeftRightArrowLongRightArrowLongleftarrowLongleftrightarrowLongrightarrowLopfLowerLeftArrow"
+  "LowerRightArrowLscrLshLstrokLtMapMcyMediumSpaceMellintrfMfrMinusPlusMopfMscrMuNJcyNacuteNcaronNcedil"
+  "NcyNegativeMediumSpaceNegativeThickSpaceNegativeThinSpaceNegativeVeryThinSpaceNestedGreaterGreater"
+  "NestedLessLessNewLineNfrNoBreakNonBreakingSpaceNopfNotNotCongruentNotCupCapNotDoubleVerticalBar"
+  "NotElementNotEqualNotEqualTildeNotExistsNotGreaterNotGreaterEqualNotGreaterFullEqual"
+  "NotGreaterGreaterNotGreaterLessNotGreaterSlantEqualNotGreaterTildeNotHumpDownHumpNotHumpEqual"
+  "NotLeftTriangleNotLeftTriangleBarNotLeftTriangleEqualNotLessNotLessEqualNotLessGreaterNotLessLess"
+  "NotLessSlantEqualNotLessTildeNotNestedGreaterGreaterNotNestedLessLessNotPrecedesNotPrecedesEqual"
+  "NotPrecedesSlantEqualNotReverseElementNotRightTriangleNotRightTriangleBarNotRightTriangleEqual"
+  "NotSquareSubsetNotSquareSubsetEqualNotSquareSupersetNotSquareSupersetEqualNotSubsetNotSubsetEqual"
+  "NotSucceedsNotSucceedsEqualNotSucceedsSlantEqualNotSucceedsTildeNotSupersetNotSupersetEqualNotTilde"
+  "NotTildeEqualNotTildeFullEqualNotTildeTildeNotVerticalBarNscrNtildeNuOEligOacuteOcircOcyOdblacOfr"
+  "OgraveOmacrOmegaOmicronOopfOpenCurlyDoubleQuoteOpenCurlyQuoteOrOscrOslashOtildeOtimesOumlOverBar"
+  "OverBraceOverBracketOverParenthesisPartialDPcyPfrPhiPiPlusMinusPoincareplanePopfPrPrecedes"
+  "PrecedesEqualPrecedesSlantEqualPrecedesTildePrimeProductProportionProportionalPscrPsiQUOTQfrQopfQscr"
+  "RBarrREGRacuteRangRarrRarrtlRcaronRcedilRcyReReverseElementReverseEquilibriumReverseUpEquilibriumRfr"
+  "RhoRightAngleBracketRightArrowRightArrowBarRightArrowLeftArrowRightCeilingRightDoubleBracket"
+  "RightDownTeeVectorRightDownVectorRightDownVectorBarRightFloorRightTeeRightTeeArrowRightTeeVector"
+  "RightTriangleRightTriangleBarRightTriangleEqualRightUpDownVectorRightUpTeeVectorRightUpVector"
+  "RightUpVectorBarRightVectorRightVectorBarRightarrowRopfRoundImpliesRrightarrowRscrRshRuleDelayed"
+  "SHCHcySHcySOFTcySacuteScScaronScedilScircScySfrShortDownArrowShortLeftArrowShortRightArrow"
+  "ShortUpArrowSigmaSmallCircleSopfSqrtSquareSquareIntersectionSquareSubsetSquareSubsetEqual"
+  "SquareSupersetSquareSupersetEqualSquareUnionSscrStarSubSubsetSubsetEqualSucceedsSucceedsEqual"
+  "SucceedsSlantEqualSucceedsTildeSuchThatSumSupSupersetSupersetEqualSupsetTHORNTRADETSHcyTScyTabTau"
+  "TcaronTcedilTcyTfrThereforeThetaThickSpaceThinSpaceTildeTildeEqualTildeFullEqualTildeTildeTopf"
+  "TripleDotTscrTstrokUacuteUarrUarrocirUbrcyUbreveUcircUcyUdblacUfrUgraveUmacrUnderBarUnderBrace"
+  "UnderBracketUnderParenthesisUnionUnionPlusUogonUopfUpArrowUpArrowBarUpArrowDownArrowUpDownArrow"
+  "UpEquilibriumUpTeeUpTeeArrowUparrowUpdownarrowUpperLeftArrowUpperRightArrowUpsiUpsilonUringUscr"
+  "UtildeUumlVDashVbarVcyVdashVdashlVeeVerbarVertVerticalBarVerticalLineVerticalSeparatorVerticalTilde"
+  "VeryThinSpaceVfrVopfVscrVvdashWcircWedgeWfrWopfWscrXfrXiXopfXscrYAcyYIcyYUcyYacuteYcircYcyYfrYopf"
+  "YscrYumlZHcyZacuteZcaronZcyZdotZeroWidthSpaceZetaZfrZopfZscraacuteabreveacacEacdacircacuteacyaeligaf"
+  "afragravealefsymalephalphaamacramalgampandandandanddandslopeandvangangeangleangmsdangmsdaaangmsdab"
+  "angmsdacangmsdadangmsdaeangmsdafangmsdagangmsdahangrtangrtvbangrtvbdangsphangstangzarraogonaopfapapE"
+  "apacirapeapidaposapproxapproxeqaringascrastasympasympeqatildeaumlawconintawintbNotbackcong"
+  "backepsilonbackprimebacksimbacksimeqbarveebarwedbarwedgebbrkbbrktbrkbcongbcybdquobecausbecause"
+  "bemptyvbepsibernoubetabethbetweenbfrbigcapbigcircbigcupbigodotbigoplusbigotimesbigsqcupbigstar"
+  "bigtriangledownbigtriangleupbiguplusbigveebigwedgebkarowblacklozengeblacksquareblacktriangle"
+  "blacktriangledownblacktriangleleftblacktrianglerightblankblk12blk14blk34blockbnebnequivbnotbopfbot"
+  "bottombowtieboxDLboxDRboxDlboxDrboxHboxHDboxHUboxHdboxHuboxULboxURboxUlboxUrboxVboxVHboxVLboxVRboxVh"
+  "boxVlboxVrboxboxboxdLboxdRboxdlboxdrboxhboxhDboxhUboxhdboxhuboxminusboxplusboxtimesboxuLboxuRboxul"
+  "boxurboxvboxvHboxvLboxvRboxvhboxvlboxvrbprimebrevebrvbarbscrbsemibsimbsimebsolbsolbbsolhsubbull"
+  "bulletbumpbumpEbumpebumpeqcacutecapcapandcapbrcupcapcapcapcupcapdotcapscaretcaronccapsccaronccedil"
+  "ccircccupsccupssmcdotcedilcemptyvcentcenterdotcfrchcycheckcheckmarkchicircirEcirccirceq"
+  "circlearrowleftcirclearrowrightcircledRcircledScircledastcircledcirccircleddashcirecirfnintcirmid"
+  "cirscirclubsclubsuitcoloncolonecoloneqcommacommatcompcompfncomplementcomplexescongcongdotconintcopf"
+  "coprodcopycopysrcrarrcrosscscrcsubcsubecsupcsupectdotcudarrlcudarrrcueprcuesccularrcularrpcup"
+  "cupbrcapcupcapcupcupcupdotcuporcupscurarrcurarrmcurlyeqpreccurlyeqsucccurlyveecurlywedgecurren"
+  "curvearrowleftcurvearrowrightcuveecuwedcwconintcwintcylctydArrdHardaggerdalethdarrdashdashvdbkarow"
+  "dblacdcarondcyddddaggerddarrddotseqdegdeltademptyvdfishtdfrdharldharrdiamdiamonddiamondsuitdiamsdie"
+  "digammadisindivdividedivideontimesdivonxdjcydlcorndlcropdollardopfdotdoteqdoteqdotdotminusdotplus"
+  "dotsquaredoublebarwedgedownarrowdowndownarrowsdownharpoonleftdownharpoonrightdrbkarowdrcorndrcrop"
+  "dscrdscydsoldstrokdtdotdtridtrifduarrduhardwangledzcydzigrarreDDoteDoteacuteeasterecaronecirecirc"
+  "ecolonecyedoteeefDotefregegraveegsegsdotelelintersellelselsdotemacremptyemptysetemptyvemspemsp13"
+  "emsp14engenspeogoneopfepareparsleplusepsiepsilonepsiveqcirceqcoloneqsimeqslantgtreqslantlessequals"
+  "equestequivequivDDeqvparslerDoterarrescresdotesimetaetheumleuroexclexistexpectationexponentiale"
+  "fallingdotseqfcyfemaleffiligffligfflligffrfiligfjligflatflligfltnsfnoffopfforallforkforkvfpartint"
+  "frac12frac13frac14frac15frac16frac18frac23frac25frac34frac35frac38frac45frac56frac58frac78fraslfrown"
+  "fscrgEgElgacutegammagammadgapgbrevegcircgcygdotgegelgeqgeqqgeqslantgesgesccgesdotgesdotogesdotolgesl"
+  "geslesgfrggggggimelgjcyglglEglagljgnEgnapgnapproxgnegneqgneqqgnsimgopfgravegscrgsimgsimegsimlgtgtcc"
+  "gtcirgtdotgtlPargtquestgtrapproxgtrarrgtrdotgtreqlessgtreqqlessgtrlessgtrsimgvertneqqgvnEhArrhairsp"
+  "halfhamilthardcyharrharrcirharrwhbarhcircheartsheartsuithellipherconhfrhksearowhkswarowhoarrhomtht"
+  "hookleftarrowhookrightarrowhopfhorbarhscrhslashhstrokhybullhypheniacuteicicircicyiecyiexcliffifr"
+  "igraveiiiiiintiiintiinfiniiotaijligimacrimageimaglineimagpartimathimofimpedinincareinfininfintie"
+  "inodotintintcalintegersintercalintlarhkintprodiocyiogoniopfiotaiprodiquestiscrisinisinEisindotisins"
+  "isinsvisinvititildeiukcyiumljcircjcyjfrjmathjopfjscrjsercyjukcykappakappavkcedilkcykfrkgreenkhcykjcy"
+  "kopfkscrlAarrlArrlAtaillBarrlElEglHarlacutelaemptyvlagranlambdalanglangdlanglelaplaquolarrlarrb"
+  "larrbfslarrfslarrhklarrlplarrpllarrsimlarrtllatlataillatelateslbarrlbbrklbracelbracklbrkelbrksld"
+  "lbrkslulcaronlcedillceillcublcyldcaldquoldquorldrdharldrusharldshleleftarrowleftarrowtail"
+  "leftharpoondownleftharpoonupleftleftarrowsleftrightarrowleftrightarrowsleftrightharpoons"
+  "leftrightsquigarrowleftthreetimeslegleqleqqleqslantleslescclesdotlesdotolesdotorlesglesgeslessapprox"
+  "lessdotlesseqgtrlesseqqgtrlessgtrlesssimlfishtlfloorlfrlglgElhardlharulharullhblkljcyllllarrllcorner"
+  "llhardlltrilmidotlmoustlmoustachelnElnaplnapproxlnelneqlneqqlnsimloangloarrlobrklongleftarrow"
+  "longleftrightarrowlongmapstolongrightarrowlooparrowleftlooparrowrightloparlopflopluslotimeslowast"
+  "lowbarlozlozengelozflparlparltlrarrlrcornerlrharlrhardlrmlrtrilsaquolscrlshlsimlsimelsimglsqblsquo"
+  "lsquorlstrokltltccltcirltdotlthreeltimesltlarrltquestltrParltriltrieltriflurdsharluruharlvertneqq"
+  "lvnEmDDotmacrmalemaltmaltesemapmapstomapstodownmapstoleftmapstoupmarkermcommamcymdashmeasuredangle"
+  "mfrmhomicromidmidastmidcirmiddotminusminusbminusdminusdumlcpmldrmnplusmodelsmopfmpmscrmstposmu"
+  "multimapmumapnGgnGtnGtvnLeftarrownLeftrightarrownLlnLtnLtvnRightarrownVDashnVdashnablanacutenangnap"
+  "napEnapidnaposnapproxnaturnaturalnaturalsnbspnbumpnbumpencapncaronncedilncongncongdotncupncyndashne"
+  "neArrnearhknearrnearrownedotnequivnesearnesimnexistnexistsnfrngEngengeqngeqqngeqslantngesngsimngt"
+  "ngtrnhArrnharrnhparninisnisdnivnjcynlArrnlEnlarrnldrnlenleftarrownleftrightarrownleqnleqqnleqslant"
+  "nlesnlessnlsimnltnltrinltrienmidnopfnotnotinnotinEnotindotnotinvanotinvbnotinvcnotninotnivanotnivb"
+  "notnivcnparnparallelnparslnpartnpolintnprnprcuenprenprecnpreceqnrArrnrarrnrarrcnrarrwnrightarrow"
+  "nrtrinrtrienscnsccuenscenscrnshortmidnshortparallelnsimnsimensimeqnsmidnsparnsqsubensqsupensubnsubE"
+  "nsubensubsetnsubseteqnsubseteqqnsuccnsucceqnsupnsupEnsupensupsetnsupseteqnsupseteqqntglntildentlg"
+  "ntriangleleftntrianglelefteqntrianglerightntrianglerighteqnunumnumeronumspnvDashnvHarrnvapnvdashnvge"
+  "nvgtnvinfinnvlArrnvlenvltnvltrienvrArrnvrtrienvsimnwArrnwarhknwarrnwarrownwnearoSoacuteoastocirocirc"
+  "ocyodashodblacodivodotodsoldoeligofcirofrogonograveogtohbarohmointolarrolcirolcrossolineoltomacr"
+  "omegaomicronomidominusoopfoparoperpoplusororarrordorderorderofordfordmorigoforororslopeorvoscroslash"
+  "osolotildeotimesotimesasoumlovbarparparaparallelparsimparslpartpcypercntperiodpermilperppertenkpfr"
+  "phiphivphmmatphonepipitchforkpivplanckplanckhplankvplusplusacirplusbpluscirplusdoplusdupluseplusmn"
+  "plussimplustwopmpointintpopfpoundprprEprapprcuepreprecprecapproxpreccurlyeqpreceqprecnapproxprecneqq"
+  "precnsimprecsimprimeprimesprnEprnapprnsimprodprofalarproflineprofsurfpropproptoprsimprurelpscrpsi"
+  "puncspqfrqintqopfqprimeqscrquaternionsquatintquestquesteqquotrAarrrArrrAtailrBarrrHarraceracuteradic"
+  "raemptyvrangrangdrangerangleraquorarrrarraprarrbrarrbfsrarrcrarrfsrarrhkrarrlprarrplrarrsimrarrtl"
+  "rarrwratailratiorationalsrbarrrbbrkrbracerbrackrbrkerbrksldrbrkslurcaronrcedilrceilrcubrcyrdca"
+  "rdldharrdquordquorrdshrealrealinerealpartrealsrectregrfishtrfloorrfrrhardrharurharulrhorhov"
+  "rightarrowrightarrowtailrightharpoondownrightharpoonuprightleftarrowsrightleftharpoons"
+  "rightrightarrowsrightsquigarrowrightthreetimesringrisingdotseqrlarrrlharrlmrmoustrmoustachernmid"
+  "roangroarrrobrkroparropfroplusrotimesrparrpargtrppolintrrarrrsaquorscrrshrsqbrsquorsquorrthreertimes"
+  "rtrirtriertrifrtriltriruluharrxsacutesbquoscscEscapscaronsccuescescedilscircscnEscnapscnsimscpolint"
+  "scsimscysdotsdotbsdoteseArrsearhksearrsearrowsectsemiseswarsetminussetmnsextsfrsfrownsharpshchcyshcy"
+  "shortmidshortparallelshysigmasigmafsigmavsimsimdotsimesimeqsimgsimgEsimlsimlEsimnesimplussimrarr"
+  "slarrsmallsetminussmashpsmeparslsmidsmilesmtsmtesmtessoftcysolsolbsolbarsopfspadesspadesuitsparsqcap"
+  "sqcapssqcupsqcupssqsubsqsubesqsubsetsqsubseteqsqsupsqsupesqsupsetsqsupseteqsqusquaresquarfsqufsrarr"
+  "sscrssetmnssmilesstarfstarstarfstraightepsilonstraightphistrnssubsubEsubdotsubesubedotsubmultsubnE"
+  "subnesubplussubrarrsubsetsubseteqsubseteqqsubsetneqsubsetneqqsubsimsubsubsubsupsuccsuccapprox"
+  "succcurlyeqsucceqsuccnapproxsuccneqqsuccnsimsuccsimsumsungsupsup1sup2sup3supEsupdotsupdsubsupe"
+  "supedotsuphsolsuphsubsuplarrsupmultsupnEsupnesupplussupsetsupseteqsupseteqqsupsetneqsupsetneqqsupsim"
+  "supsubsupsupswArrswarhkswarrswarrowswnwarszligtargettautbrktcarontcediltcytdottelrectfrthere4"
+  "thereforethetathetasymthetavthickapproxthicksimthinspthkapthksimthorntildetimestimesbtimesbartimesd"
+  "tinttoeatoptopbottopcirtopftopforktosatprimetradetriangletriangledowntrianglelefttrianglelefteq"
+  "triangleqtrianglerighttrianglerighteqtridottrietriminustriplustrisbtritimetrpeziumtscrtscytshcy"
+  "tstroktwixttwoheadleftarrowtwoheadrightarrowuArruHaruacuteuarrubrcyubreveucircucyudarrudblacudhar"
+  "ufishtufrugraveuharluharruhblkulcornulcornerulcropultriumacrumluogonuopfuparrowupdownarrow"
+  "upharpoonleftupharpoonrightuplusupsiupsihupsilonupuparrowsurcornurcornerurcropuringurtriuscrutdot"
+  "utildeutriutrifuuarruumluwanglevArrvBarvBarvvDashvangrtvarepsilonvarkappavarnothingvarphivarpi"
+  "varproptovarrvarrhovarsigmavarsubsetneqvarsubsetneqqvarsupsetneqvarsupsetneqqvarthetavartriangleleft"
+  "vartrianglerightvcyvdashveeveebarveeeqvellipverbarvertvfrvltrivnsubvnsupvopfvpropvrtrivscrvsubnE"
+  "vsubnevsupnEvsupnevzigzagwcircwedbarwedgewedgeqweierpwfrwopfwpwrwreathwscrxcapxcircxcupxdtrixfrxhArr"
+  "xharrxixlArrxlarrxmapxnisxodotxopfxoplusxotimexrArrxrarrxscrxsqcupxuplusxutrixveexwedgeyacuteyacy"
+  "ycircycyyenyfryicyyopfyscryucyyumlzacutezcaronzcyzdotzeetrfzetazfrzhcyzigrarrzopfzscrzwjzwnj";
+
+static const RSSHTMLEntity RSSHTMLEntities[] = {
+  { 0, 5, { 0x00C6, 0x0000 } }, // AElig
+  { 5, 3, { 0x0026, 0x0000 } }, // AMP
+  { 8, 6, { 0x00C1, 0x0000 } }, // Aacute
+  { 14, 6, { 0x0102, 0x0000 } }, // Abreve
+  { 20, 5, { 0x00C2, 0x0000 } }, // Acirc
+  { 25, 3, { 0x0410, 0x0000 } }, // Acy
+  { 28, 3, { 0x1D504, 0x0000 } }, // Afr
+  { 31, 6, { 0x00C0, 0x0000 } }, // Agrave
+  { 37, 5, { 0x0391, 0x0000 } }, // Alpha
+  { 42, 5, { 0x0100, 0x0000 } }, // Amacr
+  { 47, 3, { 0x2A53, 0x0000 } }, // And
+  { 50, 5, { 0x0104, 0x0000 } }, // Aogon
+  { 55, 4, { 0x1D538, 0x0000 } }, // Aopf
+  { 59, 13, { 0x2061, 0x0000 } }, // ApplyFunction
+  { 72, 5, { 0x00C5, 0x0000 } }, // Aring
+  { 77, 4, { 0x1D49C, 0x0000 } }, // Ascr
+  { 81, 6, { 0x2254, 0x0000 } }, // Assign
+  { 87, 6, { 0x00C3, 0x0000 } }, // Atilde
+  { 93, 4, { 0x00C4, 0x0000 } }, // Auml
+  { 97, 9, { 0x2216, 0x0000 } }, // Backslash
+  { 106, 4, { 0x2AE7, 0x0000 } }, // Barv
+  { 110, 6, { 0x2306, 0x0000 } }, // Barwed
+  { 116, 3, { 0x0411, 0x0000 } }, // Bcy
+  { 119, 7, { 0x2235, 0x0000 } }, // Because
+  { 126, 10, { 0x212C, 0x0000 } }, // Bernoullis
+  { 136, 4, { 0x0392, 0x0000 } }, // Beta
+  { 140, 3, { 0x1D505, 0x0000 } }, // Bfr
+  { 143, 4, { 0x1D539, 0x0000 } }, // Bopf
+  { 147, 5, { 0x02D8, 0x0000 } }, // Breve
+  { 152, 4, { 0x212C, 0x0000 } }, // Bscr
+  { 156, 6, { 0x224E, 0x0000 } }, // Bumpeq
+  { 162, 4, { 0x0427, 0x0000 } }, // CHcy
+  { 166, 4, { 0x00A9, 0x0000 } }, // COPY
+  { 170, 6, { 0x0106, 0x0000 } }, // Cacute
+  { 176, 3, { 0x22D2, 0x0000 } }, // Cap
+  { 179, 20, { 0x2145, 0x0000 } }, // CapitalDifferentialD
+  { 199, 7, { 0x212D, 0x0000 } }, // Cayleys
+  { 206, 6, { 0x010C, 0x0000 } }, // Ccaron
+  { 212, 6, { 0x00C7, 0x0000 } }, // Ccedil
+  { 218, 5, { 0x0108, 0x0000 } }, // Ccirc
+  { 223, 7, { 0x2230, 0x0000 } }, // Cconint
+  { 230, 4, { 0x010A, 0x0000 } }, // Cdot
+  { 234, 7, { 0x00B8, 0x0000 } }, // Cedilla
+  { 241, 9, { 0x00B7, 0x0000 } }, // CenterDot
+  { 250, 3, { 0x212D, 0x0000 } }, // Cfr
+  { 253, 3, { 0x03A7, 0x0000 } }, // Chi
+  { 256, 9, { 0x2299, 0x0000 } }, // CircleDot
+  { 265, 11, { 0x2296, 0x0000 } }, // CircleMinus
+  { 276, 10, { 0x2295, 0x0000 } }, // CirclePlus
+  { 286, 11, { 0x2297, 0x0000 } }, // CircleTimes
+  { 297, 24, { 0x2232, 0x0000 } }, // ClockwiseContourIntegral
+  { 321, 21, { 0x201D, 0x0000 } }, // CloseCurlyDoubleQuote
+  { 342, 15, { 0x2019, 0x0000 } }, // CloseCurlyQuote
+  { 357, 5, { 0x2237, 0x0000 } }, // Colon
+  { 362, 6, { 0x2A74, 0x0000 } }, // Colone
+  { 368, 9, { 0x2261, 0x0000 } }, // Congruent
+  { 377, 6, { 0x222F, 0x0000 } }, // Conint
+  { 383, 15, { 0x222E, 0x0000 } }, // ContourIntegral
+  { 398, 4, { 0x2102, 0x0000 } }, // Copf
+  { 402, 9, { 0x2210, 0x0000 } }, // Coproduct
+  { 411, 31, { 0x2233, 0x0000 } }, // CounterClockwiseContourIntegral
+  { 442, 5, { 0x2A2F, 0x0000 } }, // Cross
+  { 447, 4, { 0x1D49E, 0x0000 } }, // Cscr
+  { 451, 3, { 0x22D3, 0x0000 } }, // Cup
+  { 454, 6, { 0x224D, 0x0000 } }, // CupCap
+  { 460, 2, { 0x2145, 0x0000 } }, // DD
+  { 462, 8, { 0x2911, 0x0000 } }, // DDotrahd
+  { 470, 4, { 0x0402, 0x0000 } }, // DJcy
+  { 474, 4, { 0x0405, 0x0000 } }, // DScy
+  { 478, 4, { 0x040F, 0x0000 } }, // DZcy
+  { 482, 6, { 0x2021, 0x0000 } }, // Dagger
+  { 488, 4, { 0x21A1, 0x0000 } }, // Darr
+  { 492, 5, { 0x2AE4, 0x0000 } }, // Dashv
+  { 497, 6, { 0x010E, 0x0000 } }, // Dcaron
+  { 503, 3, { 0x0414, 0x0000 } }, // Dcy
+  { 506, 3, { 0x2207, 0x0000 } }, // Del
+  { 509, 5, { 0x0394, 0x0000 } }, // Delta
+  { 514, 3, { 0x1D507, 0x0000 } }, // Dfr
+  { 517, 16, { 0x00B4, 0x0000 } }, // DiacriticalAcute
+  { 533, 14, { 0x02D9, 0x0000 } }, // DiacriticalDot
+  { 547, 22, { 0x02DD, 0x0000 } }, // DiacriticalDoubleAcute
+  { 569, 16, { 0x0060, 0x0000 } }, // DiacriticalGrave
+  { 585, 16, { 0x02DC, 0x0000 } }, // DiacriticalTilde
+  { 601, 7, { 0x22C4, 0x0000 } }, // Diamond
+  { 608, 13, { 0x2146, 0x0000 } }, // DifferentialD
+  { 621, 4, { 0x1D53B, 0x0000 } }, // Dopf
+  { 625, 3, { 0x00A8, 0x0000 } }, // Dot
+  { 628, 6, { 0x20DC, 0x0000 } }, // DotDot
+  { 634, 8, { 0x2250, 0x0000 } }, // DotEqual
+  { 642, 21, { 0x222F, 0x0000 } }, // DoubleContourIntegral
+  { 663, 9, { 0x00A8, 0x0000 } }, // DoubleDot
+  { 672, 15, { 0x21D3, 0x0000 } }, // DoubleDownArrow
+  { 687, 15, { 0x21D0, 0x0000 } }, // DoubleLeftArrow
+  { 702, 20, { 0x21D4, 0x0000 } }, // DoubleLeftRightArrow
+  { 722, 13, { 0x2AE4, 0x0000 } }, // DoubleLeftTee
+  { 735, 19, { 0x27F8, 0x0000 } }, // DoubleLongLeftArrow
+  { 754, 24, { 0x27FA, 0x0000 } }, // DoubleLongLeftRightArrow
+  { 778, 20, { 0x27F9, 0x0000 } }, // DoubleLongRightArrow
+  { 798, 16, { 0x21D2, 0x0000 } }, // DoubleRightArrow
+  { 814, 14, { 0x22A8, 0x0000 } }, // DoubleRightTee
+  { 828, 13, { 0x21D1, 0x0000 } }, // DoubleUpArrow
+  { 841, 17, { 0x21D5, 0x0000 } }, // DoubleUpDownArrow
+  { 858, 17, { 0x2225, 0x0000 } }, // DoubleVerticalBar
+  { 875, 9, { 0x2193, 0x0000 } }, // DownArrow
+  { 884, 12, { 0x2913, 0x0000 } }, // DownArrowBar
+  { 896, 16, { 0x21F5, 0x0000 } }, // DownArrowUpArrow
+  { 912, 9, { 0x0311, 0x0000 } }, // DownBreve
+  { 921, 19, { 0x2950, 0x0000 } }, // DownLeftRightVector
+  { 940, 17, { 0x295E, 0x0000 } }, // DownLeftTeeVector
+  { 957, 14, { 0x21BD, 0x0000 } }, // DownLeftVector
+  { 971, 17, { 0x2956, 0x0000 } }, // DownLeftVectorBar
+  { 988, 18, { 0x295F, 0x0000 } }, // DownRightTeeVector
+  { 1006, 15, { 0x21C1, 0x0000 } }, // DownRightVector
+  { 1021, 18, { 0x2957, 0x0000 } }, // DownRightVectorBar
+  { 1039, 7, { 0x22A4, 0x0000 } }, // DownTee
+  { 1046, 12, { 0x21A7, 0x0000 } }, // DownTeeArrow
+  { 1058, 9, { 0x21D3, 0x0000 } }, // Downarrow
+  { 1067, 4, { 0x1D49F, 0x0000 } }, // Dscr
+  { 1071, 6, { 0x0110, 0x0000 } }, // Dstrok
+  { 1077, 3, { 0x014A, 0x0000 } }, // ENG
+  { 1080, 3, { 0x00D0, 0x0000 } }, // ETH
+  { 1083, 6, { 0x00C9, 0x0000 } }, // Eacute
+  { 1089, 6, { 0x011A, 0x0000 } }, // Ecaron
+  { 1095, 5, { 0x00CA, 0x0000 } }, // Ecirc
+  { 1100, 3, { 0x042D, 0x0000 } }, // Ecy
+  { 1103, 4, { 0x0116, 0x0000 } }, // Edot
+  { 1107, 3, { 0x1D508, 0x0000 } }, // Efr
+  { 1110, 6, { 0x00C8, 0x0000 } }, // Egrave
+  { 1116, 7, { 0x2208, 0x0000 } }, // Element
+  { 1123, 5, { 0x0112, 0x0000 } }, // Emacr
+  { 1128, 16, { 0x25FB, 0x0000 } }, // EmptySmallSquare
+  { 1144, 20, { 0x25AB, 0x0000 } }, // EmptyVerySmallSquare
+  { 1164, 5, { 0x0118, 0x0000 } }, // Eogon
+  { 1169, 4, { 0x1D53C, 0x0000 } }, // Eopf
+  { 1173, 7, { 0x0395, 0x0000 } }, // Epsilon
+  { 1180, 5, { 0x2A75, 0x0000 } }, // Equal
+  { 1185, 10, { 0x2242, 0x0000 } }, // EqualTilde
+  { 1195, 11, { 0x21CC, 0x0000 } }, // Equilibrium
+  { 1206, 4, { 0x2130, 0x0000 } }, // Escr
+  { 1210, 4, { 0x2A73, 0x0000 } }, // Esim
+  { 1214, 3, { 0x0397, 0x0000 } }, // Eta
+  { 1217, 4, { 0x00CB, 0x0000 } }, // Euml
+  { 1221, 6, { 0x2203, 0x0000 } }, // Exists
+  { 1227, 12, { 0x2147, 0x0000 } }, // ExponentialE
+  { 1239, 3, { 0x0424, 0x0000 } }, // Fcy
+  { 1242, 3, { 0x1D509, 0x0000 } }, // Ffr
+  { 1245, 17, { 0x25FC, 0x0000 } }, // FilledSmallSquare
+  { 1262, 21, { 0x25AA, 0x0000 } }, // FilledVerySmallSquare
+  { 1283, 4, { 0x1D53D, 0x0000 } }, // Fopf
+  { 1287, 6, { 0x2200, 0x0000 } }, // ForAll
+  { 1293, 10, { 0x2131, 0x0000 } }, // Fouriertrf
+  { 1303, 4, { 0x2131, 0x0000 } }, // Fscr
+  { 1307, 4, { 0x0403, 0x0000 } }, // GJcy
+  { 1311, 2, { 0x003E, 0x0000 } }, // GT
+  { 1313, 5, { 0x0393, 0x0000 } }, // Gamma
+  { 1318, 6, { 0x03DC, 0x0000 } }, // Gammad
+  { 1324, 6, { 0x011E, 0x0000 } }, // Gbreve
+  { 1330, 6, { 0x0122, 0x0000 } }, // Gcedil
+  { 1336, 5, { 0x011C, 0x0000 } }, // Gcirc
+  { 1341, 3, { 0x0413, 0x0000 } }, // Gcy
+  { 1344, 4, { 0x0120, 0x0000 } }, // Gdot
+  { 1348, 3, { 0x1D50A, 0x0000 } }, // Gfr
+  { 1351, 2, { 0x22D9, 0x0000 } }, // Gg
+  { 1353, 4, { 0x1D53E, 0x0000 } }, // Gopf
+  { 1357, 12, { 0x2265, 0x0000 } }, // GreaterEqual
+  { 1369, 16, { 0x22DB, 0x0000 } }, // GreaterEqualLess
+  { 1385, 16, { 0x2267, 0x0000 } }, // GreaterFullEqual
+  { 1401, 14, { 0x2AA2, 0x0000 } }, // GreaterGreater
+  { 1415, 11, { 0x2277, 0x0000 } }, // GreaterLess
+  { 1426, 17, { 0x2A7E, 0x0000 } }, // GreaterSlantEqual
+  { 1443, 12, { 0x2273, 0x0000 } }, // GreaterTilde
+  { 1455, 4, { 0x1D4A2, 0x0000 } }, // Gscr
+  { 1459, 2, { 0x226B, 0x0000 } }, // Gt
+  { 1461, 6, { 0x042A, 0x0000 } }, // HARDcy
+  { 1467, 5, { 0x02C7, 0x0000 } }, // Hacek
+  { 1472, 3, { 0x005E, 0x0000 } }, // Hat
+  { 1475, 5, { 0x0124, 0x0000 } }, // Hcirc
+  { 1480, 3, { 0x210C, 0x0000 } }, // Hfr
+  { 1483, 12, { 0x210B, 0x0000 } }, // HilbertSpace
+  { 1495, 4, { 0x210D, 0x0000 } }, // Hopf
+  { 1499, 14, { 0x2500, 0x0000 } }, // HorizontalLine
+  { 1513, 4, { 0x210B, 0x0000 } }, // Hscr
+  { 1517, 6, { 0x0126, 0x0000 } }, // Hstrok
+  { 1523, 12, { 0x224E, 0x0000 } }, // HumpDownHump
+  { 1535, 9, { 0x224F, 0x0000 } }, // HumpEqual
+  { 1544, 4, { 0x0415, 0x0000 } }, // IEcy
+  { 1548, 5, { 0x0132, 0x0000 } }, // IJlig
+  { 1553, 4, { 0x0401, 0x0000 } }, // IOcy
+  { 1557, 6, { 0x00CD, 0x0000 } }, // Iacute
+  { 1563, 5, { 0x00CE, 0x0000 } }, // Icirc
+  { 1568, 3, { 0x0418, 0x0000 } }, // Icy
+  { 1571, 4, { 0x0130, 0x0000 } }, // Idot
+  { 1575, 3, { 0x2111, 0x0000 } }, // Ifr
+  { 1578, 6, { 0x00CC, 0x0000 } }, // Igrave
+  { 1584, 2, { 0x2111, 0x0000 } }, // Im
+  { 1586, 5, { 0x012A, 0x0000 } }, // Imacr
+  { 1591, 10, { 0x2148, 0x0000 } }, // ImaginaryI
+  { 1601, 7, { 0x21D2, 0x0000 } }, // Implies
+  { 1608, 3, { 0x222C, 0x0000 } }, // Int
+  { 1611, 8, { 0x222B, 0x0000 } }, // Integral
+  { 1619, 12, { 0x22C2, 0x0000 } }, // Intersection
+  { 1631, 14, { 0x2063, 0x0000 } }, // InvisibleComma
+  { 1645, 14, { 0x2062, 0x0000 } }, // InvisibleTimes
+  { 1659, 5, { 0x012E, 0x0000 } }, // Iogon
+  { 1664, 4, { 0x1D540, 0x0000 } }, // Iopf
+  { 1668, 4, { 0x0399, 0x0000 } }, // Iota
+  { 1672, 4, { 0x2110, 0x0000 } }, // Iscr
+  { 1676, 6, { 0x0128, 0x0000 } }, // Itilde
+  { 1682, 5, { 0x0406, 0x0000 } }, // Iukcy
+  { 1687, 4, { 0x00CF, 0x0000 } }, // Iuml
+  { 1691, 5, { 0x0134, 0x0000 } }, // Jcirc
+  { 1696, 3, { 0x0419, 0x0000 } }, // Jcy
+  { 1699, 3, { 0x1D50D, 0x0000 } }, // Jfr
+  { 1702, 4, { 0x1D541, 0x0000 } }, // Jopf
+  { 1706, 4, { 0x1D4A5, 0x0000 } }, // Jscr
+  { 1710, 6, { 0x0408, 0x0000 } }, // Jsercy
+  { 1716, 5, { 0x0404, 0x0000 } }, // Jukcy
+  { 1721, 4, { 0x0425, 0x0000 } }, // KHcy
+  { 1725, 4, { 0x040C, 0x0000 } }, // KJcy
+  { 1729, 5, { 0x039A, 0x0000 } }, // Kappa
+  { 1734, 6, { 0x0136, 0x0000 } }, // Kcedil
+  { 1740, 3, { 0x041A, 0x0000 } }, // Kcy
+  { 1743, 3, { 0x1D50E, 0x0000 } }, // Kfr
+  { 1746, 4, { 0x1D542, 0x0000 } }, // Kopf
+  { 1750, 4, { 0x1D4A6, 0x0000 } }, // Kscr
+  { 1754, 4, { 0x0409, 0x0000 } }, // LJcy
+  { 1758, 2, { 0x003C, 0x0000 } }, // LT
+  { 1760, 6, { 0x0139, 0x0000 } }, // Lacute
+  { 1766, 6, { 0x039B, 0x0000 } }, // Lambda
+  { 1772, 4, { 0x27EA, 0x0000 } }, // Lang
+  { 1776, 10, { 0x2112, 0x0000 } }, // Laplacetrf
+  { 1786, 4, { 0x219E, 0x0000 } }, // Larr
+  { 1790, 6, { 0x013D, 0x0000 } }, // Lcaron
+  { 1796, 6, { 0x013B, 0x0000 } }, // Lcedil
+  { 1802, 3, { 0x041B, 0x0000 } }, // Lcy
+  { 1805, 16, { 0x27E8, 0x0000 } }, // LeftAngleBracket
+  { 1821, 9, { 0x2190, 0x0000 } }, // LeftArrow
+  { 1830, 12, { 0x21E4, 0x0000 } }, // LeftArrowBar
+  { 1842, 19, { 0x21C6, 0x0000 } }, // LeftArrowRightArrow
+  { 1861, 11, { 0x2308, 0x0000 } }, // LeftCeiling
+  { 1872, 17, { 0x27E6, 0x0000 } }, // LeftDoubleBracket
+  { 1889, 17, { 0x2961, 0x0000 } }, // LeftDownTeeVector
+  { 1906, 14, { 0x21C3, 0x0000 } }, // LeftDownVector
+  { 1920, 17, { 0x2959, 0x0000 } }, // LeftDownVectorBar
+  { 1937, 9, { 0x230A, 0x0000 } }, // LeftFloor
+  { 1946, 14, { 0x2194, 0x0000 } }, // LeftRightArrow
+  { 1960, 15, { 0x294E, 0x0000 } }, // LeftRightVector
+  { 1975, 7, { 0x22A3, 0x0000 } }, // LeftTee
+  { 1982, 12, { 0x21A4, 0x0000 } }, // LeftTeeArrow
+  { 1994, 13, { 0x295A, 0x0000 } }, // LeftTeeVector
+  { 2007, 12, { 0x22B2, 0x0000 } }, // LeftTriangle
+  { 2019, 15, { 0x29CF, 0x0000 } }, // LeftTriangleBar
+  { 2034, 17, { 0x22B4, 0x0000 } }, // LeftTriangleEqual
+  { 2051, 16, { 0x2951, 0x0000 } }, // LeftUpDownVector
+  { 2067, 15, { 0x2960, 0x0000 } }, // LeftUpTeeVector
+  { 2082, 12, { 0x21BF, 0x0000 } }, // LeftUpVector
+  { 2094, 15, { 0x2958, 0x0000 } }, // LeftUpVectorBar
+  { 2109, 10, { 0x21BC, 0x0000 } }, // LeftVector
+  { 2119, 13, { 0x2952, 0x0000 } }, // LeftVectorBar
+  { 2132, 9, { 0x21D0, 0x0000 } }, // Leftarrow
+  { 2141, 14, { 0x21D4, 0x0000 } }, // Leftrightarrow
+  { 2155, 16, { 0x22DA, 0x0000 } }, // LessEqualGreater
+  { 2171, 13, { 0x2266, 0x0000 } }, // LessFullEqual
+  { 2184, 11, { 0x2276, 0x0000 } }, // LessGreater
+  { 2195, 8, { 0x2AA1, 0x0000 } }, // LessLess
+  { 2203, 14, { 0x2A7D, 0x0000 } }, // LessSlantEqual
+  { 2217, 9, { 0x2272, 0x0000 } }, // LessTilde
+  { 2226, 3, { 0x1D50F, 0x0000 } }, // Lfr
+  { 2229, 2, { 0x22D8, 0x0000 } }, // Ll
+  { 2231, 10, { 0x21DA, 0x0000 } }, // Lleftarrow
+  { 2241, 6, { 0x013F, 0x0000 } }, // Lmidot
+  { 2247, 13, { 0x27F5, 0x0000 } }, // LongLeftArrow
+  { 2260, 18, { 0x27F7, 0x0000 } }, // LongLeftRightArrow
+  { 2278, 14, { 0x27F6, 0x0000 } }, // LongRightArrow
+  { 2292, 13, { 0x27F8, 0x0000 } }, // Longleftarrow
+  { 2305, 18, { 0x27FA, 0x0000 } }, // Longleftrightarrow
+  { 2323, 14, { 0x27F9, 0x0000 } }, // Longrightarrow
+  { 2337, 4, { 0x1D543, 0x0000 } }, // Lopf
+  { 2341, 14, { 0x2199, 0x0000 } }, // LowerLeftArrow
+  { 2355, 15, { 0x2198, 0x0000 } }, // LowerRightArrow
+  { 2370, 4, { 0x2112, 0x0000 } }, // Lscr
+  { 2374, 3, { 0x21B0, 0x0000 } }, // Lsh
+  { 2377, 6, { 0x0141, 0x0000 } }, // Lstrok
+  { 2383, 2, { 0x226A, 0x0000 } }, // Lt
+  { 2385, 3, { 0x2905, 0x0000 } }, // Map
+  { 2388, 3, { 0x041C, 0x0000 } }, // Mcy
+  { 2391, 11, { 0x205F, 0x0000 } }, // MediumSpace
+  { 2402, 9, { 0x2133, 0x0000 } }, // Mellintrf
+  { 2411, 3, { 0x1D510, 0x0000 } }, // Mfr
+  { 2414, 9, { 0x2213, 0x0000 } }, // MinusPlus
+  { 2423, 4, { 0x1D544, 0x0000 } }, // Mopf
+  { 2427, 4, { 0x2133, 0x0000 } }, // Mscr
+  { 2431, 2, { 0x039C, 0x0000 } }, // Mu
+  { 2433, 4, { 0x040A, 0x0000 } }, // NJcy
+  { 2437, 6, { 0x0143, 0x0000 } }, // Nacute
+  { 2443, 6, { 0x0147, 0x0000 } }, // Ncaron
+  { 2449, 6, { 0x0145, 0x0000 } }, // Ncedil
+  { 2455, 3, { 0x041D, 0x0000 } }, // Ncy
+  { 2458, 19, { 0x200B, 0x0000 } }, // NegativeMediumSpace
+  { 2477, 18, { 0x200B, 0x0000 } }, // NegativeThickSpace
+  { 2495, 17, { 0x200B, 0x0000 } }, // NegativeThinSpace
+  { 2512, 21, { 0x200B, 0x0000 } }, // NegativeVeryThinSpace
+  { 2533, 20, { 0x226B, 0x0000 } }, // NestedGreaterGreater
+  { 2553, 14, { 0x226A, 0x0000 } }, // NestedLessLess
+  { 2567, 7, { 0x000A, 0x0000 } }, // NewLine
+  { 2574, 3, { 0x1D511, 0x0000 } }, // Nfr
+  { 2577, 7, { 0x2060, 0x0000 } }, // NoBreak
+  { 2584, 16, { 0x00A0, 0x0000 } }, // NonBreakingSpace
+  { 2600, 4, { 0x2115, 0x0000 } }, // Nopf
+  { 2604, 3, { 0x2AEC, 0x0000 } }, // Not
+  { 2607, 12, { 0x2262, 0x0000 } }, // NotCongruent
+  { 2619, 9, { 0x226D, 0x0000 } }, // NotCupCap
+  { 2628, 20, { 0x2226, 0x0000 } }, // NotDoubleVerticalBar
+  { 2648, 10, { 0x2209, 0x0000 } }, // NotElement
+  { 2658, 8, { 0x2260, 0x0000 } }, // NotEqual
+  { 2666, 13, { 0x2242, 0x0338 } }, // NotEqualTilde
+  { 2679, 9, { 0x2204, 0x0000 } }, // NotExists
+  { 2688, 10, { 0x226F, 0x0000 } }, // NotGreater
+  { 2698, 15, { 0x2271, 0x0000 } }, // NotGreaterEqual
+  { 2713, 19, { 0x2267, 0x0338 } }, // NotGreaterFullEqual
+  { 2732, 17, { 0x226B, 0x0338 } }, // NotGreaterGreater
+  { 2749, 14, { 0x2279, 0x0000 } }, // NotGreaterLess
+  { 2763, 20, { 0x2A7E, 0x0338 } }, // NotGreaterSlantEqual
+  { 2783, 15, { 0x2275, 0x0000 } }, // NotGreaterTilde
+  { 2798, 15, { 0x224E, 0x0338 } }, // NotHumpDownHump
+  { 2813, 12, { 0x224F, 0x0338 } }, // NotHumpEqual
+  { 2825, 15, { 0x22EA, 0x0000 } }, // NotLeftTriangle
+  { 2840, 18, { 0x29CF, 0x0338 } }, // NotLeftTriangleBar
+  { 2858, 20, { 0x22EC, 0x0000 } }, // NotLeftTriangleEqual
+  { 2878, 7, { 0x226E, 0x0000 } }, // NotLess
+  { 2885, 12, { 0x2270, 0x0000 } }, // NotLessEqual
+  { 2897, 14, { 0x2278, 0x0000 } }, // NotLessGreater
+  { 2911, 11, { 0x226A, 0x0338 } }, // NotLessLess
+  { 2922, 17, { 0x2A7D, 0x0338 } }, // NotLessSlantEqual
+  { 2939, 12, { 0x2274, 0x0000 } }, // NotLessTilde
+  { 2951, 23, { 0x2AA2, 0x0338 } }, // NotNestedGreaterGreater
+  { 2974, 17, { 0x2AA1, 0x0338 } }, // NotNestedLessLess
+  { 2991, 11, { 0x2280, 0x0000 } }, // NotPrecedes
+  { 3002, 16, { 0x2AAF, 0x0338 } }, // NotPrecedesEqual
+  { 3018, 21, { 0x22E0, 0x0000 } }, // NotPrecedesSlantEqual
+  { 3039, 17, { 0x220C, 0x0000 } }, // NotReverseElement
+  { 3056, 16, { 0x22EB, 0x0000 } }, // NotRightTriangle
+  { 3072, 19, { 0x29D0, 0x0338 } }, // NotRightTriangleBar
+  { 3091, 21, { 0x22ED, 0x0000 } }, // NotRightTriangleEqual
+  { 3112, 15, { 0x228F, 0x0338 } }, // NotSquareSubset
+  { 3127, 20, { 0x22E2, 0x0000 } }, // NotSquareSubsetEqual
+  { 3147, 17, { 0x2290, 0x0338 } }, // NotSquareSuperset
+  { 3164, 22, { 0x22E3, 0x0000 } }, // NotSquareSupersetEqual
+  { 3186, 9, { 0x2282, 0x20D2 } }, // NotSubset
+  { 3195, 14, { 0x2288, 0x0000 } }, // NotSubsetEqual
+  { 3209, 11, { 0x2281, 0x0000 } }, // NotSucceeds
+  { 3220, 16, { 0x2AB0, 0x0338 } }, // NotSucceedsEqual
+  { 3236, 21, { 0x22E1, 0x0000 } }, // NotSucceedsSlantEqual
+  { 3257, 16, { 0x227F, 0x0338 } }, // NotSucceedsTilde
+  { 3273, 11, { 0x2283, 0x20D2 } }, // NotSuperset
+  { 3284, 16, { 0x2289, 0x0000 } }, // NotSupersetEqual
+  { 3300, 8, { 0x2241, 0x0000 } }, // NotTilde
+  { 3308, 13, { 0x2244, 0x0000 } }, // NotTildeEqual
+  { 3321, 17, { 0x2247, 0x0000 } }, // NotTildeFullEqual
+  { 3338, 13, { 0x2249, 0x0000 } }, // NotTildeTilde
+  { 3351, 14, { 0x2224, 0x0000 } }, // NotVerticalBar
+  { 3365, 4, { 0x1D4A9, 0x0000 } }, // Nscr
+  { 3369, 6, { 0x00D1, 0x0000 } }, // Ntilde
+  { 3375, 2, { 0x039D, 0x0000 } }, // Nu
+  { 3377, 5, { 0x0152, 0x0000 } }, // OElig
+  { 3382, 6, { 0x00D3, 0x0000 } }, // Oacute
+  { 3388, 5, { 0x00D4, 0x0000 } }, // Ocirc
+  { 3393, 3, { 0x041E, 0x0000 } }, // Ocy
+  { 3396, 6, { 0x0150, 0x0000 } }, // Odblac
+  { 3402, 3, { 0x1D512, 0x0000 } }, // Ofr
+  { 3405, 6, { 0x00D2, 0x0000 } }, // Ograve
+  { 3411, 5, { 0x014C, 0x0000 } }, // Omacr
+  { 3416, 5, { 0x03A9, 0x0000 } }, // Omega
+  { 3421, 7, { 0x039F, 0x0000 } }, // Omicron
+  { 3428, 4, { 0x1D546, 0x0000 } }, // Oopf
+  { 3432, 20, { 0x201C, 0x0000 } }, // OpenCurlyDoubleQuote
+  { 3452, 14, { 0x2018, 0x0000 } }, // OpenCurlyQuote
+  { 3466, 2, { 0x2A54, 0x0000 } }, // Or
+  { 3468, 4, { 0x1D4AA, 0x0000 } }, // Oscr
+  { 3472, 6, { 0x00D8, 0x0000 } }, // Oslash
+  { 3478, 6, { 0x00D5, 0x0000 } }, // Otilde
+  { 3484, 6, { 0x2A37, 0x0000 } }, // Otimes
+  { 3490, 4, { 0x00D6, 0x0000 } }, // Ouml
+  { 3494, 7, { 0x203E, 0x0000 } }, // OverBar
+  { 3501, 9, { 0x23DE, 0x0000 } }, // OverBrace
+  { 3510, 11, { 0x23B4, 0x0000 } }, // OverBracket
+  { 3521, 15, { 0x23DC, 0x0000 } }, // OverParenthesis
+  { 3536, 8, { 0x2202, 0x0000 } }, // PartialD
+  { 3544, 3, { 0x041F, 0x0000 } }, // Pcy
+  { 3547, 3, { 0x1D513, 0x0000 } }, // Pfr
+  { 3550, 3, { 0x03A6, 0x0000 } }, // Phi
+  { 3553, 2, { 0x03A0, 0x0000 } }, // Pi
+  { 3555, 9, { 0x00B1, 0x0000 } }, // PlusMinus
+  { 3564, 13, { 0x210C, 0x0000 } }, // Poincareplane
+  { 3577, 4, { 0x2119, 0x0000 } }, // Popf
+  { 3581, 2, { 0x2ABB, 0x0000 } }, // Pr
+  { 3583, 8, { 0x227A, 0x0000 } }, // Precedes
+  { 3591, 13, { 0x2AAF, 0x0000 } }, // PrecedesEqual
+  { 3604, 18, { 0x227C, 0x0000 } }, // PrecedesSlantEqual
+  { 3622, 13, { 0x227E, 0x0000 } }, // PrecedesTilde
+  { 3635, 5, { 0x2033, 0x0000 } }, // Prime
+  { 3640, 7, { 0x220F, 0x0000 } }, // Product
+  { 3647, 10, { 0x2237, 0x0000 } }, // Proportion
+  { 3657, 12, { 0x221D, 0x0000 } }, // Proportional
+  { 3669, 4, { 0x1D4AB, 0x0000 } }, // Pscr
+  { 3673, 3, { 0x03A8, 0x0000 } }, // Psi
+  { 3676, 4, { 0x0022, 0x0000 } }, // QUOT
+  { 3680, 3, { 0x1D514, 0x0000 } }, // Qfr
+  { 3683, 4, { 0x211A, 0x0000 } }, // Qopf
+  { 3687, 4, { 0x1D4AC, 0x0000 } }, // Qscr
+  { 3691, 5, { 0x2910, 0x0000 } }, // RBarr
+  { 3696, 3, { 0x00AE, 0x0000 } }, // REG
+  { 3699, 6, { 0x0154, 0x0000 } }, // Racute
+  { 3705, 4, { 0x27EB, 0x0000 } }, // Rang
+  { 3709, 4, { 0x21A0, 0x0000 } }, // Rarr
+  { 3713, 6, { 0x2916, 0x0000 } }, // Rarrtl
+  { 3719, 6, { 0x0158, 0x0000 } }, // Rcaron
+  { 3725, 6, { 0x0156, 0x0000 } }, // Rcedil
+  { 3731, 3, { 0x0420, 0x0000 } }, // Rcy
+  { 3734, 2, { 0x211C, 0x0000 } }, // Re
+  { 3736, 14, { 0x220B, 0x0000 } }, // ReverseElement
+  { 3750, 18, { 0x21CB, 0x0000 } }, // ReverseEquilibrium
+  { 3768, 20, { 0x296F, 0x0000 } }, // ReverseUpEquilibrium
+  { 3788, 3, { 0x211C, 0x0000 } }, // Rfr
+  { 3791, 3, { 0x03A1, 0x0000 } }, // Rho
+  { 3794, 17, { 0x27E9, 0x0000 } }, // RightAngleBracket
+  { 3811, 10, { 0x2192, 0x0000 } }, // RightArrow
+  { 3821, 13, { 0x21E5, 0x0000 } }, // RightArrowBar
+  { 3834, 19, { 0x21C4, 0x0000 } }, // RightArrowLeftArrow
+  { 3853, 12, { 0x2309, 0x0000 } }, // RightCeiling
+  { 3865, 18, { 0x27E7, 0x0000 } }, // RightDoubleBracket
+  { 3883, 18, { 0x295D, 0x0000 } }, // RightDownTeeVector
+  { 3901, 15, { 0x21C2, 0x0000 } }, // RightDownVector
+  { 3916, 18, { 0x2955, 0x0000 } }, // RightDownVectorBar
+  { 3934, 10, { 0x230B, 0x0000 } }, // RightFloor
+  { 3944, 8, { 0x22A2, 0x0000 } }, // RightTee
+  { 3952, 13, { 0x21A6, 0x0000 } }, // RightTeeArrow
+  { 3965, 14, { 0x295B, 0x0000 } }, // RightTeeVector
+  { 3979, 13, { 0x22B3, 0x0000 } }, // RightTriangle
+  { 3992, 16, { 0x29D0, 0x0000 } }, // RightTriangleBar
+  { 4008, 18, { 0x22B5, 0x0000 } }, // RightTriangleEqual
+  { 4026, 17, { 0x294F, 0x0000 } }, // RightUpDownVector
+  { 4043, 16, { 0x295C, 0x0000 } }, // RightUpTeeVector
+  { 4059, 13, { 0x21BE, 0x0000 } }, // RightUpVector
+  { 4072, 16, { 0x2954, 0x0000 } }, // RightUpVectorBar
+  { 4088, 11, { 0x21C0, 0x0000 } }, // RightVector
+  { 4099, 14, { 0x2953, 0x0000 } }, // RightVectorBar
+  { 4113, 10, { 0x21D2, 0x0000 } }, // Rightarrow
+  { 4123, 4, { 0x211D, 0x0000 } }, // Ropf
+  { 4127, 12, { 0x2970, 0x0000 } }, // RoundImplies
+  { 4139, 11, { 0x21DB, 0x0000 } }, // Rrightarrow
+  { 4150, 4, { 0x211B, 0x0000 } }, // Rscr
+  { 4154, 3, { 0x21B1, 0x0000 } }, // Rsh
+  { 4157, 11, { 0x29F4, 0x0000 } }, // RuleDelayed
+  { 4168, 6, { 0x0429, 0x0000 } }, // SHCHcy
+  { 4174, 4, { 0x0428, 0x0000 } }, // SHcy
+  { 4178, 6, { 0x042C, 0x0000 } }, // SOFTcy
+  { 4184, 6, { 0x015A, 0x0000 } }, // Sacute
+  { 4190, 2, { 0x2ABC, 0x0000 } }, // Sc
+  { 4192, 6, { 0x0160, 0x0000 } }, // Scaron
+  { 4198, 6, { 0x015E, 0x0000 } }, // Scedil
+  { 4204, 5, { 0x015C, 0x0000 } }, // Scirc
+  { 4209, 3, { 0x0421, 0x0000 } }, // Scy
+  { 4212, 3, { 0x1D516, 0x0000 } }, // Sfr
+  { 4215, 14, { 0x2193, 0x0000 } }, // ShortDownArrow
+  { 4229, 14, { 0x2190, 0x0000 } }, // ShortLeftArrow
+  { 4243, 15, { 0x2192, 0x0000 } }, // ShortRightArrow
+  { 4258, 12, { 0x2191, 0x0000 } }, // ShortUpArrow
+  { 4270, 5, { 0x03A3, 0x0000 } }, // Sigma
+  { 4275, 11, { 0x2218, 0x0000 } }, // SmallCircle
+  { 4286, 4, { 0x1D54A, 0x0000 } }, // Sopf
+  { 4290, 4, { 0x221A, 0x0000 } }, // Sqrt
+  { 4294, 6, { 0x25A1, 0x0000 } }, // Square
+  { 4300, 18, { 0x2293, 0x0000 } }, // SquareIntersection
+  { 4318, 12, { 0x228F, 0x0000 } }, // SquareSubset
+  { 4330, 17, { 0x2291, 0x0000 } }, // SquareSubsetEqual
+  { 4347, 14, { 0x2290, 0x0000 } }, // SquareSuperset
+  { 4361, 19, { 0x2292, 0x0000 } }, // SquareSupersetEqual
+  { 4380, 11, { 0x2294, 0x0000 } }, // SquareUnion
+  { 4391, 4, { 0x1D4AE, 0x0000 } }, // Sscr
+  { 4395, 4, { 0x22C6, 0x0000 } }, // Star
+  { 4399, 3, { 0x22D0, 0x0000 } }, // Sub
+  { 4402, 6, { 0x22D0, 0x0000 } }, // Subset
+  { 4408, 11, { 0x2286, 0x0000 } }, // SubsetEqual
+  { 4419, 8, { 0x227B, 0x0000 } }, // Succeeds
+  { 4427, 13, { 0x2AB0, 0x0000 } }, // SucceedsEqual
+  { 4440, 18, { 0x227D, 0x0000 } }, // SucceedsSlantEqual
+  { 4458, 13, { 0x227F, 0x0000 } }, // SucceedsTilde
+  { 4471, 8, { 0x220B, 0x0000 } }, // SuchThat
+  { 4479, 3, { 0x2211, 0x0000 } }, // Sum
+  { 4482, 3, { 0x22D1, 0x0000 } }, // Sup
+  { 4485, 8, { 0x2283, 0x0000 } }, // Superset
+  { 4493, 13, { 0x2287, 0x0000 } }, // SupersetEqual
+  { 4506, 6, { 0x22D1, 0x0000 } }, // Supset
+  { 4512, 5, { 0x00DE, 0x0000 } }, // THORN
+  { 4517, 5, { 0x2122, 0x0000 } }, // TRADE
+  { 4522, 5, { 0x040B, 0x0000 } }, // TSHcy
+  { 4527, 4, { 0x0426, 0x0000 } }, // TScy
+  { 4531, 3, { 0x0009, 0x0000 } }, // Tab
+  { 4534, 3, { 0x03A4, 0x0000 } }, // Tau
+  { 4537, 6, { 0x0164, 0x0000 } }, // Tcaron
+  { 4543, 6, { 0x0162, 0x0000 } }, // Tcedil
+  { 4549, 3, { 0x0422, 0x0000 } }, // Tcy
+  { 4552, 3, { 0x1D517, 0x0000 } }, // Tfr
+  { 4555, 9, { 0x2234, 0x0000 } }, // Therefore
+  { 4564, 5, { 0x0398, 0x0000 } }, // Theta
+  { 4569, 10, { 0x205F, 0x200A } }, // ThickSpace
+  { 4579, 9, { 0x2009, 0x0000 } }, // ThinSpace
+  { 4588, 5, { 0x223C, 0x0000 } }, // Tilde
+  { 4593, 10, { 0x2243, 0x0000 } }, // TildeEqual
+  { 4603, 14, { 0x2245, 0x0000 } }, // TildeFullEqual
+  { 4617, 10, { 0x2248, 0x0000 } }, // TildeTilde
+  { 4627, 4, { 0x1D54B, 0x0000 } }, // Topf
+  { 4631, 9, { 0x20DB, 0x0000 } }, // TripleDot
+  { 4640, 4, { 0x1D4AF, 0x0000 } }, // Tscr
+  { 4644, 6, { 0x0166, 0x0000 } }, // Tstrok
+  { 4650, 6, { 0x00DA, 0x0000 } }, // Uacute
+  { 4656, 4, { 0x219F, 0x0000 } }, // Uarr
+  { 4660, 8, { 0x2949, 0x0000 } }, // Uarrocir
+  { 4668, 5, { 0x040E, 0x0000 } }, // Ubrcy
+  { 4673, 6, { 0x016C, 0x0000 } }, // Ubreve
+  { 4679, 5, { 0x00DB, 0x0000 } }, // Ucirc
+  { 4684, 3, { 0x0423, 0x0000 } }, // Ucy
+  { 4687, 6, { 0x0170, 0x0000 } }, // Udblac
+  { 4693, 3, { 0x1D518, 0x0000 } }, // Ufr
+  { 4696, 6, { 0x00D9, 0x0000 } }, // Ugrave
+  { 4702, 5, { 0x016A, 0x0000 } }, // Umacr
+  { 4707, 8, { 0x005F, 0x0000 } }, // UnderBar
+  { 4715, 10, { 0x23DF, 0x0000 } }, // UnderBrace
+  { 4725, 12, { 0x23B5, 0x0000 } }, // UnderBracket
+  { 4737, 16, { 0x23DD, 0x0000 } }, // UnderParenthesis
+  { 4753, 5, { 0x22C3, 0x0000 } }, // Union
+  { 4758, 9, { 0x228E, 0x0000 } }, // UnionPlus
+  { 4767, 5, { 0x0172, 0x0000 } }, // Uogon
+  { 4772, 4, { 0x1D54C, 0x0000 } }, // Uopf
+  { 4776, 7, { 0x2191, 0x0000 } }, // UpArrow
+  { 4783, 10, { 0x2912, 0x0000 } }, // UpArrowBar
+  { 4793, 16, { 0x21C5, 0x0000 } }, // UpArrowDownArrow
+  { 4809, 11, { 0x2195, 0x0000 } }, // UpDownArrow
+  { 4820, 13, { 0x296E, 0x0000 } }, // UpEquilibrium
+  { 4833, 5, { 0x22A5, 0x0000 } }, // UpTee
+  { 4838, 10, { 0x21A5, 0x0000 } }, // UpTeeArrow
+  { 4848, 7, { 0x21D1, 0x0000 } }, // Uparrow
+  { 4855, 11, { 0x21D5, 0x0000 } }, // Updownarrow
+  { 4866, 14, { 0x2196, 0x0000 } }, // UpperLeftArrow
+  { 4880, 15, { 0x2197, 0x0000 } }, // UpperRightArrow
+  { 4895, 4, { 0x03D2, 0x0000 } }, // Upsi
+  { 4899, 7, { 0x03A5, 0x0000 } }, // Upsilon
+  { 4906, 5, { 0x016E, 0x0000 } }, // Uring
+  { 4911, 4, { 0x1D4B0, 0x0000 } }, // Uscr
+  { 4915, 6, { 0x0168, 0x0000 } }, // Utilde
+  { 4921, 4, { 0x00DC, 0x0000 } }, // Uuml
+  { 4925, 5, { 0x22AB, 0x0000 } }, // VDash
+  { 4930, 4, { 0x2AEB, 0x0000 } }, // Vbar
+  { 4934, 3, { 0x0412, 0x0000 } }, // Vcy
+  { 4937, 5, { 0x22A9, 0x0000 } }, // Vdash
+  { 4942, 6, { 0x2AE6, 0x0000 } }, // Vdashl
+  { 4948, 3, { 0x22C1, 0x0000 } }, // Vee
+  { 4951, 6, { 0x2016, 0x0000 } }, // Verbar
+  { 4957, 4, { 0x2016, 0x0000 } }, // Vert
+  { 4961, 11, { 0x2223, 0x0000 } }, // VerticalBar
+  { 4972, 12, { 0x007C, 0x0000 } }, // VerticalLine
+  { 4984, 17, { 0x2758, 0x0000 } }, // VerticalSeparator
+  { 5001, 13, { 0x2240, 0x0000 } }, // VerticalTilde
+  { 5014, 13, { 0x200A, 0x0000 } }, // VeryThinSpace
+  { 5027, 3, { 0x1D519, 0x0000 } }, // Vfr
+  { 5030, 4, { 0x1D54D, 0x0000 } }, // Vopf
+  { 5034, 4, { 0x1D4B1, 0x0000 } }, // Vscr
+  { 5038, 6, { 0x22AA, 0x0000 } }, // Vvdash
+  { 5044, 5, { 0x0174, 0x0000 } }, // Wcirc
+  { 5049, 5, { 0x22C0, 0x0000 } }, // Wedge
+  { 5054, 3, { 0x1D51A, 0x0000 } }, // Wfr
+  { 5057, 4, { 0x1D54E, 0x0000 } }, // Wopf
+  { 5061, 4, { 0x1D4B2, 0x0000 } }, // Wscr
+  { 5065, 3, { 0x1D51B, 0x0000 } }, // Xfr
+  { 5068, 2, { 0x039E, 0x0000 } }, // Xi
+  { 5070, 4, { 0x1D54F, 0x0000 } }, // Xopf
+  { 5074, 4, { 0x1D4B3, 0x0000 } }, // Xscr
+  { 5078, 4, { 0x042F, 0x0000 } }, // YAcy
+  { 5082, 4, { 0x0407, 0x0000 } }, // YIcy
+  { 5086, 4, { 0x042E, 0x0000 } }, // YUcy
+  { 5090, 6, { 0x00DD, 0x0000 } }, // Yacute
+  { 5096, 5, { 0x0176, 0x0000 } }, // Ycirc
+  { 5101, 3, { 0x042B, 0x0000 } }, // Ycy
+  { 5104, 3, { 0x1D51C, 0x0000 } }, // Yfr
+  { 5107, 4, { 0x1D550, 0x0000 } }, // Yopf
+  { 5111, 4, { 0x1D4B4, 0x0000 } }, // Yscr
+  { 5115, 4, { 0x0178, 0x0000 } }, // Yuml
+  { 5119, 4, { 0x0416, 0x0000 } }, // ZHcy
+  { 5123, 6, { 0x0179, 0x0000 } }, // Zacute
+  { 5129, 6, { 0x017D, 0x0000 } }, // Zcaron
+  { 5135, 3, { 0x0417, 0x0000 } }, // Zcy
+  { 5138, 4, { 0x017B, 0x0000 } }, // Zdot
+  { 5142, 14, { 0x200B, 0x0000 } }, // ZeroWidthSpace
+  { 5156, 4, { 0x0396, 0x0000 } }, // Zeta
+  { 5160, 3, { 0x2128, 0x0000 } }, // Zfr
+  { 5163, 4, { 0x2124, 0x0000 } }, // Zopf
+  { 5167, 4, { 0x1D4B5, 0x0000 } }, // Zscr
+  { 5171, 6, { 0x00E1, 0x0000 } }, // aacute
+  { 5177, 6, { 0x0103, 0x0000 } }, // abreve
+  { 5183, 2, { 0x223E, 0x0000 } }, // ac
+  { 5185, 3, { 0x223E, 0x0333 } }, // acE
+  { 5188, 3, { 0x223F, 0x0000 } }, // acd
+  { 5191, 5, { 0x00E2, 0x0000 } }, // acirc
+  { 5196, 5, { 0x00B4, 0x0000 } }, // acute
+  { 5201, 3, { 0x0430, 0x0000 } }, // acy
+  { 5204, 5, { 0x00E6, 0x0000 } }, // aelig
+  { 5209, 2, { 0x2061, 0x0000 } }, // af
+  { 5211, 3, { 0x1D51E, 0x0000 } }, // afr
+  { 5214, 6, { 0x00E0, 0x0000 } }, // agrave
+  { 5220, 7, { 0x2135, 0x0000 } }, // alefsym
+  { 5227, 5, { 0x2135, 0x0000 } }, // aleph
+  { 5232, 5, { 0x03B1, 0x0000 } }, // alpha
+  { 5237, 5, { 0x0101, 0x0000 } }, // amacr
+  { 5242, 5, { 0x2A3F, 0x0000 } }, // amalg
+  { 5247, 3, { 0x0026, 0x0000 } }, // amp
+  { 5250, 3, { 0x2227, 0x0000 } }, // and
+  { 5253, 6, { 0x2A55, 0x0000 } }, // andand
+  { 5259, 4, { 0x2A5C, 0x0000 } }, // andd
+  { 5263, 8, { 0x2A58, 0x0000 } }, // andslope
+  { 5271, 4, { 0x2A5A, 0x0000 } }, // andv
+  { 5275, 3, { 0x2220, 0x0000 } }, // ang
+  { 5278, 4, { 0x29A4, 0x0000 } }, // ange
+  { 5282, 5, { 0x2220, 0x0000 } }, // angle
+  { 5287, 6, { 0x2221, 0x0000 } }, // angmsd
+  { 5293, 8, { 0x29A8, 0x0000 } }, // angmsdaa
+  { 5301, 8, { 0x29A9, 0x0000 } }, // angmsdab
+  { 5309, 8, { 0x29AA, 0x0000 } }, // angmsdac
+  { 5317, 8, { 0x29AB, 0x0000 } }, // angmsdad
+  { 5325, 8, { 0x29AC, 0x0000 } }, // angmsdae
+  { 5333, 8, { 0x29AD, 0x0000 } }, // angmsdaf
+  { 5341, 8, { 0x29AE, 0x0000 } }, // angmsdag
+  { 5349, 8, { 0x29AF, 0x0000 } }, // angmsdah
+  { 5357, 5, { 0x221F, 0x0000 } }, // angrt
+  { 5362, 7, { 0x22BE, 0x0000 } }, // angrtvb
+  { 5369, 8, { 0x299D, 0x0000 } }, // angrtvbd
+  { 5377, 6, { 0x2222, 0x0000 } }, // angsph
+  { 5383, 5, { 0x00C5, 0x0000 } }, // angst
+  { 5388, 7, { 0x237C, 0x0000 } }, // angzarr
+  { 5395, 5, { 0x0105, 0x0000 } }, // aogon
+  { 5400, 4, { 0x1D552, 0x0000 } }, // aopf
+  { 5404, 2, { 0x2248, 0x0000 } }, // ap
+  { 5406, 3, { 0x2A70, 0x0000 } }, // apE
+  { 5409, 6, { 0x2A6F, 0x0000 } }, // apacir
+  { 5415, 3, { 0x224A, 0x0000 } }, // ape
+  { 5418, 4, { 0x224B, 0x0000 } }, // apid
+  { 5422, 4, { 0x0027, 0x0000 } }, // apos
+  { 5426, 6, { 0x2248, 0x0000 } }, // approx
+  { 5432, 8, { 0x224A, 0x0000 } }, // approxeq
+  { 5440, 5, { 0x00E5, 0x0000 } }, // aring
+  { 5445, 4, { 0x1D4B6, 0x0000 } }, // ascr
+  { 5449, 3, { 0x002A, 0x0000 } }, // ast
+  { 5452, 5, { 0x2248, 0x0000 } }, // asymp
+  { 5457, 7, { 0x224D, 0x0000 } }, // asympeq
+  { 5464, 6, { 0x00E3, 0x0000 } }, // atilde
+  { 5470, 4, { 0x00E4, 0x0000 } }, // auml
+  { 5474, 8, { 0x2233, 0x0000 } }, // awconint
+  { 5482, 5, { 0x2A11, 0x0000 } }, // awint
+  { 5487, 4, { 0x2AED, 0x0000 } }, // bNot
+  { 5491, 8, { 0x224C, 0x0000 } }, // backcong
+  { 5499, 11, { 0x03F6, 0x0000 } }, // backepsilon
+  { 5510, 9, { 0x2035, 0x0000 } }, // backprime
+  { 5519, 7, { 0x223D, 0x0000 } }, // backsim
+  { 5526, 9, { 0x22CD, 0x0000 } }, // backsimeq
+  { 5535, 6, { 0x22BD, 0x0000 } }, // barvee
+  { 5541, 6, { 0x2305, 0x0000 } }, // barwed
+  { 5547, 8, { 0x2305, 0x0000 } }, // barwedge
+  { 5555, 4, { 0x23B5, 0x0000 } }, // bbrk
+  { 5559, 8, { 0x23B6, 0x0000 } }, // bbrktbrk
+  { 5567, 5, { 0x224C, 0x0000 } }, // bcong
+  { 5572, 3, { 0x0431, 0x0000 } }, // bcy
+  { 5575, 5, { 0x201E, 0x0000 } }, // bdquo
+  { 5580, 6, { 0x2235, 0x0000 } }, // becaus
+  { 5586, 7, { 0x2235, 0x0000 } }, // because
+  { 5593, 7, { 0x29B0, 0x0000 } }, // bemptyv
+  { 5600, 5, { 0x03F6, 0x0000 } }, // bepsi
+  { 5605, 6, { 0x212C, 0x0000 } }, // bernou
+  { 5611, 4, { 0x03B2, 0x0000 } }, // beta
+  { 5615, 4, { 0x2136, 0x0000 } }, // beth
+  { 5619, 7, { 0x226C, 0x0000 } }, // between
+  { 5626, 3, { 0x1D51F, 0x0000 } }, // bfr
+  { 5629, 6, { 0x22C2, 0x0000 } }, // bigcap
+  { 5635, 7, { 0x25EF, 0x0000 } }, // bigcirc
+  { 5642, 6, { 0x22C3, 0x0000 } }, // bigcup
+  { 5648, 7, { 0x2A00, 0x0000 } }, // bigodot
+  { 5655, 8, { 0x2A01, 0x0000 } }, // bigoplus
+  { 5663, 9, { 0x2A02, 0x0000 } }, // bigotimes
+  { 5672, 8, { 0x2A06, 0x0000 } }, // bigsqcup
+  { 5680, 7, { 0x2605, 0x0000 } }, // bigstar
+  { 5687, 15, { 0x25BD, 0x0000 } }, // bigtriangledown
+  { 5702, 13, { 0x25B3, 0x0000 } }, // bigtriangleup
+  { 5715, 8, { 0x2A04, 0x0000 } }, // biguplus
+  { 5723, 6, { 0x22C1, 0x0000 } }, // bigvee
+  { 5729, 8, { 0x22C0, 0x0000 } }, // bigwedge
+  { 5737, 6, { 0x290D, 0x0000 } }, // bkarow
+  { 5743, 12, { 0x29EB, 0x0000 } }, // blacklozenge
+  { 5755, 11, { 0x25AA, 0x0000 } }, // blacksquare
+  { 5766, 13, { 0x25B4, 0x0000 } }, // blacktriangle
+  { 5779, 17, { 0x25BE, 0x0000 } }, // blacktriangledown
+  { 5796, 17, { 0x25C2, 0x0000 } }, // blacktriangleleft
+  { 5813, 18, { 0x25B8, 0x0000 } }, // blacktriangleright
+  { 5831, 5, { 0x2423, 0x0000 } }, // blank
+  { 5836, 5, { 0x2592, 0x0000 } }, // blk12
+  { 5841, 5, { 0x2591, 0x0000 } }, // blk14
+  { 5846, 5, { 0x2593, 0x0000 } }, // blk34
+  { 5851, 5, { 0x2588, 0x0000 } }, // block
+  { 5856, 3, { 0x003D, 0x20E5 } }, // bne
+  { 5859, 7, { 0x2261, 0x20E5 } }, // bnequiv
+  { 5866, 4, { 0x2310, 0x0000 } }, // bnot
+  { 5870, 4, { 0x1D553, 0x0000 } }, // bopf
+  { 5874, 3, { 0x22A5, 0x0000 } }, // bot
+  { 5877, 6, { 0x22A5, 0x0000 } }, // bottom
+  { 5883, 6, { 0x22C8, 0x0000 } }, // bowtie
+  { 5889, 5, { 0x2557, 0x0000 } }, // boxDL
+  { 5894, 5, { 0x2554, 0x0000 } }, // boxDR
+  { 5899, 5, { 0x2556, 0x0000 } }, // boxDl
+  { 5904, 5, { 0x2553, 0x0000 } }, // boxDr
+  { 5909, 4, { 0x2550, 0x0000 } }, // boxH
+  { 5913, 5, { 0x2566, 0x0000 } }, // boxHD
+  { 5918, 5, { 0x2569, 0x0000 } }, // boxHU
+  { 5923, 5, { 0x2564, 0x0000 } }, // boxHd
+  { 5928, 5, { 0x2567, 0x0000 } }, // boxHu
+  { 5933, 5, { 0x255D, 0x0000 } }, // boxUL
+  { 5938, 5, { 0x255A, 0x0000 } }, // boxUR
+  { 5943, 5, { 0x255C, 0x0000 } }, // boxUl
+  { 5948, 5, { 0x2559, 0x0000 } }, // boxUr
+  { 5953, 4, { 0x2551, 0x0000 } }, // boxV
+  { 5957, 5, { 0x256C, 0x0000 } }, // boxVH
+  { 5962, 5, { 0x2563, 0x0000 } }, // boxVL
+  { 5967, 5, { 0x2560, 0x0000 } }, // boxVR
+  { 5972, 5, { 0x256B, 0x0000 } }, // boxVh
+  { 5977, 5, { 0x2562, 0x0000 } }, // boxVl
+  { 5982, 5, { 0x255F, 0x0000 } }, // boxVr
+  { 5987, 6, { 0x29C9, 0x0000 } }, // boxbox
+  { 5993, 5, { 0x2555, 0x0000 } }, // boxdL
+  { 5998, 5, { 0x2552, 0x0000 } }, // boxdR
+  { 6003, 5, { 0x2510, 0x0000 } }, // boxdl
+  { 6008, 5, { 0x250C, 0x0000 } }, // boxdr
+  { 6013, 4, { 0x2500, 0x0000 } }, // boxh
+  { 6017, 5, { 0x2565, 0x0000 } }, // boxhD
+  { 6022, 5, { 0x2568, 0x0000 } }, // boxhU
+  { 6027, 5, { 0x252C, 0x0000 } }, // boxhd
+  { 6032, 5, { 0x2534, 0x0000 } }, // boxhu
+  { 6037, 8, { 0x229F, 0x0000 } }, // boxminus
+  { 6045, 7, { 0x229E, 0x0000 } }, // boxplus
+  { 6052, 8, { 0x22A0, 0x0000 } }, // boxtimes
+  { 6060, 5, { 0x255B, 0x0000 } }, // boxuL
+  { 6065, 5, { 0x2558, 0x0000 } }, // boxuR
+  { 6070, 5, { 0x2518, 0x0000 } }, // boxul
+  { 6075, 5, { 0x2514, 0x0000 } }, // boxur
+  { 6080, 4, { 0x2502, 0x0000 } }, // boxv
+  { 6084, 5, { 0x256A, 0x0000 } }, // boxvH
+  { 6089, 5, { 0x2561, 0x0000 } }, // boxvL
+  { 6094, 5, { 0x255E, 0x0000 } }, // boxvR
+  { 6099, 5, { 0x253C, 0x0000 } }, // boxvh
+  { 6104, 5, { 0x2524, 0x0000 } }, // boxvl
+  { 6109, 5, { 0x251C, 0x0000 } }, // boxvr
+  { 6114, 6, { 0x2035, 0x0000 } }, // bprime
+  { 6120, 5, { 0x02D8, 0x0000 } }, // breve
+  { 6125, 6, { 0x00A6, 0x0000 } }, // brvbar
+  { 6131, 4, { 0x1D4B7, 0x0000 } }, // bscr
+  { 6135, 5, { 0x204F, 0x0000 } }, // bsemi
+  { 6140, 4, { 0x223D, 0x0000 } }, // bsim
+  { 6144, 5, { 0x22CD, 0x0000 } }, // bsime
+  { 6149, 4, { 0x005C, 0x0000 } }, // bsol
+  { 6153, 5, { 0x29C5, 0x0000 } }, // bsolb
+  { 6158, 8, { 0x27C8, 0x0000 } }, // bsolhsub
+  { 6166, 4, { 0x2022, 0x0000 } }, // bull
+  { 6170, 6, { 0x2022, 0x0000 } }, // bullet
+  { 6176, 4, { 0x224E, 0x0000 } }, // bump
+  { 6180, 5, { 0x2AAE, 0x0000 } }, // bumpE
+  { 6185, 5, { 0x224F, 0x0000 } }, // bumpe
+  { 6190, 6, { 0x224F, 0x0000 } }, // bumpeq
+  { 6196, 6, { 0x0107, 0x0000 } }, // cacute
+  { 6202, 3, { 0x2229, 0x0000 } }, // cap
+  { 6205, 6, { 0x2A44, 0x0000 } }, // capand
+  { 6211, 8, { 0x2A49, 0x0000 } }, // capbrcup
+  { 6219, 6, { 0x2A4B, 0x0000 } }, // capcap
+  { 6225, 6, { 0x2A47, 0x0000 } }, // capcup
+  { 6231, 6, { 0x2A40, 0x0000 } }, // capdot
+  { 6237, 4, { 0x2229, 0xFE00 } }, // caps
+  { 6241, 5, { 0x2041, 0x0000 } }, // caret
+  { 6246, 5, { 0x02C7, 0x0000 } }, // caron
+  { 6251, 5, { 0x2A4D, 0x0000 } }, // ccaps
+  { 6256, 6, { 0x010D, 0x0000 } }, // ccaron
+  { 6262, 6, { 0x00E7, 0x0000 } }, // ccedil
+  { 6268, 5, { 0x0109, 0x0000 } }, // ccirc
+  { 6273, 5, { 0x2A4C, 0x0000 } }, // ccups
+  { 6278, 7, { 0x2A50, 0x0000 } }, // ccupssm
+  { 6285, 4, { 0x010B, 0x0000 } }, // cdot
+  { 6289, 5, { 0x00B8, 0x0000 } }, // cedil
+  { 6294, 7, { 0x29B2, 0x0000 } }, // cemptyv
+  { 6301, 4, { 0x00A2, 0x0000 } }, // cent
+  { 6305, 9, { 0x00B7, 0x0000 } }, // centerdot
+  { 6314, 3, { 0x1D520, 0x0000 } }, // cfr
+  { 6317, 4, { 0x0447, 0x0000 } }, // chcy
+  { 6321, 5, { 0x2713, 0x0000 } }, // check
+  { 6326, 9, { 0x2713, 0x0000 } }, // checkmark
+  { 6335, 3, { 0x03C7, 0x0000 } }, // chi
+  { 6338, 3, { 0x25CB, 0x0000 } }, // cir
+  { 6341, 4, { 0x29C3, 0x0000 } }, // cirE
+  { 6345, 4, { 0x02C6, 0x0000 } }, // circ
+  { 6349, 6, { 0x2257, 0x0000 } }, // circeq
+  { 6355, 15, { 0x21BA, 0x0000 } }, // circlearrowleft
+  { 6370, 16, { 0x21BB, 0x0000 } }, // circlearrowright
+  { 6386, 8, { 0x00AE, 0x0000 } }, // circledR
+  { 6394, 8, { 0x24C8, 0x0000 } }, // circledS
+  { 6402, 10, { 0x229B, 0x0000 } }, // circledast
+  { 6412, 11, { 0x229A, 0x0000 } }, // circledcirc
+  { 6423, 11, { 0x229D, 0x0000 } }, // circleddash
+  { 6434, 4, { 0x2257, 0x0000 } }, // cire
+  { 6438, 8, { 0x2A10, 0x0000 } }, // cirfnint
+  { 6446, 6, { 0x2AEF, 0x0000 } }, // cirmid
+  { 6452, 7, { 0x29C2, 0x0000 } }, // cirscir
+  { 6459, 5, { 0x2663, 0x0000 } }, // clubs
+  { 6464, 8, { 0x2663, 0x0000 } }, // clubsuit
+  { 6472, 5, { 0x003A, 0x0000 } }, // colon
+  { 6477, 6, { 0x2254, 0x0000 } }, // colone
+  { 6483, 7, { 0x2254, 0x0000 } }, // coloneq
+  { 6490, 5, { 0x002C, 0x0000 } }, // comma
+  { 6495, 6, { 0x0040, 0x0000 } }, // commat
+  { 6501, 4, { 0x2201, 0x0000 } }, // comp
+  { 6505, 6, { 0x2218, 0x0000 } }, // compfn
+  { 6511, 10, { 0x2201, 0x0000 } }, // complement
+  { 6521, 9, { 0x2102, 0x0000 } }, // complexes
+  { 6530, 4, { 0x2245, 0x0000 } }, // cong
+  { 6534, 7, { 0x2A6D, 0x0000 } }, // congdot
+  { 6541, 6, { 0x222E, 0x0000 } }, // conint
+  { 6547, 4, { 0x1D554, 0x0000 } }, // copf
+  { 6551, 6, { 0x2210, 0x0000 } }, // coprod
+  { 6557, 4, { 0x00A9, 0x0000 } }, // copy
+  { 6561, 6, { 0x2117, 0x0000 } }, // copysr
+  { 6567, 5, { 0x21B5, 0x0000 } }, // crarr
+  { 6572, 5, { 0x2717, 0x0000 } }, // cross
+  { 6577, 4, { 0x1D4B8, 0x0000 } }, // cscr
+  { 6581, 4, { 0x2ACF, 0x0000 } }, // csub
+  { 6585, 5, { 0x2AD1, 0x0000 } }, // csube
+  { 6590, 4, { 0x2AD0, 0x0000 } }, // csup
+  { 6594, 5, { 0x2AD2, 0x0000 } }, // csupe
+  { 6599, 5, { 0x22EF, 0x0000 } }, // ctdot
+  { 6604, 7, { 0x2938, 0x0000 } }, // cudarrl
+  { 6611, 7, { 0x2935, 0x0000 } }, // cudarrr
+  { 6618, 5, { 0x22DE, 0x0000 } }, // cuepr
+  { 6623, 5, { 0x22DF, 0x0000 } }, // cuesc
+  { 6628, 6, { 0x21B6, 0x0000 } }, // cularr
+  { 6634, 7, { 0x293D, 0x0000 } }, // cularrp
+  { 6641, 3, { 0x222A, 0x0000 } }, // cup
+  { 6644, 8, { 0x2A48, 0x0000 } }, // cupbrcap
+  { 6652, 6, { 0x2A46, 0x0000 } }, // cupcap
+  { 6658, 6, { 0x2A4A, 0x0000 } }, // cupcup
+  { 6664, 6, { 0x228D, 0x0000 } }, // cupdot
+  { 6670, 5, { 0x2A45, 0x0000 } }, // cupor
+  { 6675, 4, { 0x222A, 0xFE00 } }, // cups
+  { 6679, 6, { 0x21B7, 0x0000 } }, // curarr
+  { 6685, 7, { 0x293C, 0x0000 } }, // curarrm
+  { 6692, 11, { 0x22DE, 0x0000 } }, // curlyeqprec
+  { 6703, 11, { 0x22DF, 0x0000 } }, // curlyeqsucc
+  { 6714, 8, { 0x22CE, 0x0000 } }, // curlyvee
+  { 6722, 10, { 0x22CF, 0x0000 } }, // curlywedge
+  { 6732, 6, { 0x00A4, 0x0000 } }, // curren
+  { 6738, 14, { 0x21B6, 0x0000 } }, // curvearrowleft
+  { 6752, 15, { 0x21B7, 0x0000 } }, // curvearrowright
+  { 6767, 5, { 0x22CE, 0x0000 } }, // cuvee
+  { 6772, 5, { 0x22CF, 0x0000 } }, // cuwed
+  { 6777, 8, { 0x2232, 0x0000 } }, // cwconint
+  { 6785, 5, { 0x2231, 0x0000 } }, // cwint
+  { 6790, 6, { 0x232D, 0x0000 } }, // cylcty
+  { 6796, 4, { 0x21D3, 0x0000 } }, // dArr
+  { 6800, 4, { 0x2965, 0x0000 } }, // dHar
+  { 6804, 6, { 0x2020, 0x0000 } }, // dagger
+  { 6810, 6, { 0x2138, 0x0000 } }, // daleth
+  { 6816, 4, { 0x2193, 0x0000 } }, // darr
+  { 6820, 4, { 0x2010, 0x0000 } }, // dash
+  { 6824, 5, { 0x22A3, 0x0000 } }, // dashv
+  { 6829, 7, { 0x290F, 0x0000 } }, // dbkarow
+  { 6836, 5, { 0x02DD, 0x0000 } }, // dblac
+  { 6841, 6, { 0x010F, 0x0000 } }, // dcaron
+  { 6847, 3, { 0x0434, 0x0000 } }, // dcy
+  { 6850, 2, { 0x2146, 0x0000 } }, // dd
+  { 6852, 7, { 0x2021, 0x0000 } }, // ddagger
+  { 6859, 5, { 0x21CA, 0x0000 } }, // ddarr
+  { 6864, 7, { 0x2A77, 0x0000 } }, // ddotseq
+  { 6871, 3, { 0x00B0, 0x0000 } }, // deg
+  { 6874, 5, { 0x03B4, 0x0000 } }, // delta
+  { 6879, 7, { 0x29B1, 0x0000 } }, // demptyv
+  { 6886, 6, { 0x297F, 0x0000 } }, // dfisht
+  { 6892, 3, { 0x1D521, 0x0000 } }, // dfr
+  { 6895, 5, { 0x21C3, 0x0000 } }, // dharl
+  { 6900, 5, { 0x21C2, 0x0000 } }, // dharr
+  { 6905, 4, { 0x22C4, 0x0000 } }, // diam
+  { 6909, 7, { 0x22C4, 0x0000 } }, // diamond
+  { 6916, 11, { 0x2666, 0x0000 } }, // diamondsuit
+  { 6927, 5, { 0x2666, 0x0000 } }, // diams
+  { 6932, 3, { 0x00A8, 0x0000 } }, // die
+  { 6935, 7, { 0x03DD, 0x0000 } }, // digamma
+  { 6942, 5, { 0x22F2, 0x0000 } }, // disin
+  { 6947, 3, { 0x00F7, 0x0000 } }, // div
+  { 6950, 6, { 0x00F7, 0x0000 } }, // divide
+  { 6956, 13, { 0x22C7, 0x0000 } }, // divideontimes
+  { 6969, 6, { 0x22C7, 0x0000 } }, // divonx
+  { 6975, 4, { 0x0452, 0x0000 } }, // djcy
+  { 6979, 6, { 0x231E, 0x0000 } }, // dlcorn
+  { 6985, 6, { 0x230D, 0x0000 } }, // dlcrop
+  { 6991, 6, { 0x0024, 0x0000 } }, // dollar
+  { 6997, 4, { 0x1D555, 0x0000 } }, // dopf
+  { 7001, 3, { 0x02D9, 0x0000 } }, // dot
+  { 7004, 5, { 0x2250, 0x0000 } }, // doteq
+  { 7009, 8, { 0x2251, 0x0000 } }, // doteqdot
+  { 7017, 8, { 0x2238, 0x0000 } }, // dotminus
+  { 7025, 7, { 0x2214, 0x0000 } }, // dotplus
+  { 7032, 9, { 0x22A1, 0x0000 } }, // dotsquare
+  { 7041, 14, { 0x2306, 0x0000 } }, // doublebarwedge
+  { 7055, 9, { 0x2193, 0x0000 } }, // downarrow
+  { 7064, 14, { 0x21CA, 0x0000 } }, // downdownarrows
+  { 7078, 15, { 0x21C3, 0x0000 } }, // downharpoonleft
+  { 7093, 16, { 0x21C2, 0x0000 } }, // downharpoonright
+  { 7109, 8, { 0x2910, 0x0000 } }, // drbkarow
+  { 7117, 6, { 0x231F, 0x0000 } }, // drcorn
+  { 7123, 6, { 0x230C, 0x0000 } }, // drcrop
+  { 7129, 4, { 0x1D4B9, 0x0000 } }, // dscr
+  { 7133, 4, { 0x0455, 0x0000 } }, // dscy
+  { 7137, 4, { 0x29F6, 0x0000 } }, // dsol
+  { 7141, 6, { 0x0111, 0x0000 } }, // dstrok
+  { 7147, 5, { 0x22F1, 0x0000 } }, // dtdot
+  { 7152, 4, { 0x25BF, 0x0000 } }, // dtri
+  { 7156, 5, { 0x25BE, 0x0000 } }, // dtrif
+  { 7161, 5, { 0x21F5, 0x0000 } }, // duarr
+  { 7166, 5, { 0x296F, 0x0000 } }, // duhar
+  { 7171, 7, { 0x29A6, 0x0000 } }, // dwangle
+  { 7178, 4, { 0x045F, 0x0000 } }, // dzcy
+  { 7182, 8, { 0x27FF, 0x0000 } }, // dzigrarr
+  { 7190, 5, { 0x2A77, 0x0000 } }, // eDDot
+  { 7195, 4, { 0x2251, 0x0000 } }, // eDot
+  { 7199, 6, { 0x00E9, 0x0000 } }, // eacute
+  { 7205, 6, { 0x2A6E, 0x0000 } }, // easter
+  { 7211, 6, { 0x011B, 0x0000 } }, // ecaron
+  { 7217, 4, { 0x2256, 0x0000 } }, // ecir
+  { 7221, 5, { 0x00EA, 0x0000 } }, // ecirc
+  { 7226, 6, { 0x2255, 0x0000 } }, // ecolon
+  { 7232, 3, { 0x044D, 0x0000 } }, // ecy
+  { 7235, 4, { 0x0117, 0x0000 } }, // edot
+  { 7239, 2, { 0x2147, 0x0000 } }, // ee
+  { 7241, 5, { 0x2252, 0x0000 } }, // efDot
+  { 7246, 3, { 0x1D522, 0x0000 } }, // efr
+  { 7249, 2, { 0x2A9A, 0x0000 } }, // eg
+  { 7251, 6, { 0x00E8, 0x0000 } }, // egrave
+  { 7257, 3, { 0x2A96, 0x0000 } }, // egs
+  { 7260, 6, { 0x2A98, 0x0000 } }, // egsdot
+  { 7266, 2, { 0x2A99, 0x0000 } }, // el
+  { 7268, 8, { 0x23E7, 0x0000 } }, // elinters
+  { 7276, 3, { 0x2113, 0x0000 } }, // ell
+  { 7279, 3, { 0x2A95, 0x0000 } }, // els
+  { 7282, 6, { 0x2A97, 0x0000 } }, // elsdot
+  { 7288, 5, { 0x0113, 0x0000 } }, // emacr
+  { 7293, 5, { 0x2205, 0x0000 } }, // empty
+  { 7298, 8, { 0x2205, 0x0000 } }, // emptyset
+  { 7306, 6, { 0x2205, 0x0000 } }, // emptyv
+  { 7312, 4, { 0x2003, 0x0000 } }, // emsp
+  { 7316, 6, { 0x2004, 0x0000 } }, // emsp13
+  { 7322, 6, { 0x2005, 0x0000 } }, // emsp14
+  { 7328, 3, { 0x014B, 0x0000 } }, // eng
+  { 7331, 4, { 0x2002, 0x0000 } }, // ensp
+  { 7335, 5, { 0x0119, 0x0000 } }, // eogon
+  { 7340, 4, { 0x1D556, 0x0000 } }, // eopf
+  { 7344, 4, { 0x22D5, 0x0000 } }, // epar
+  { 7348, 6, { 0x29E3, 0x0000 } }, // eparsl
+  { 7354, 5, { 0x2A71, 0x0000 } }, // eplus
+  { 7359, 4, { 0x03B5, 0x0000 } }, // epsi
+  { 7363, 7, { 0x03B5, 0x0000 } }, // epsilon
+  { 7370, 5, { 0x03F5, 0x0000 } }, // epsiv
+  { 7375, 6, { 0x2256, 0x0000 } }, // eqcirc
+  { 7381, 7, { 0x2255, 0x0000 } }, // eqcolon
+  { 7388, 5, { 0x2242, 0x0000 } }, // eqsim
+  { 7393, 10, { 0x2A96, 0x0000 } }, // eqslantgtr
+  { 7403, 11, { 0x2A95, 0x0000 } }, // eqslantless
+  { 7414, 6, { 0x003D, 0x0000 } }, // equals
+  { 7420, 6, { 0x225F, 0x0000 } }, // equest
+  { 7426, 5, { 0x2261, 0x0000 } }, // equiv
+  { 7431, 7, { 0x2A78, 0x0000 } }, // equivDD
+  { 7438, 8, { 0x29E5, 0x0000 } }, // eqvparsl
+  { 7446, 5, { 0x2253, 0x0000 } }, // erDot
+  { 7451, 5, { 0x2971, 0x0000 } }, // erarr
+  { 7456, 4, { 0x212F, 0x0000 } }, // escr
+  { 7460, 5, { 0x2250, 0x0000 } }, // esdot
+  { 7465, 4, { 0x2242, 0x0000 } }, // esim
+  { 7469, 3, { 0x03B7, 0x0000 } }, // eta
+  { 7472, 3, { 0x00F0, 0x0000 } }, // eth
+  { 7475, 4, { 0x00EB, 0x0000 } }, // euml
+  { 7479, 4, { 0x20AC, 0x0000 } }, // euro
+  { 7483, 4, { 0x0021, 0x0000 } }, // excl
+  { 7487, 5, { 0x2203, 0x0000 } }, // exist
+  { 7492, 11, { 0x2130, 0x0000 } }, // expectation
+  { 7503, 12, { 0x2147, 0x0000 } }, // exponentiale
+  { 7515, 13, { 0x2252, 0x0000 } }, // fallingdotseq
+  { 7528, 3, { 0x0444, 0x0000 } }, // fcy
+  { 7531, 6, { 0x2640, 0x0000 } }, // female
+  { 7537, 6, { 0xFB03, 0x0000 } }, // ffilig
+  { 7543, 5, { 0xFB00, 0x0000 } }, // fflig
+  { 7548, 6, { 0xFB04, 0x0000 } }, // ffllig
+  { 7554, 3, { 0x1D523, 0x0000 } }, // ffr
+  { 7557, 5, { 0xFB01, 0x0000 } }, // filig
+  { 7562, 5, { 0x0066, 0x006A } }, // fjlig
+  { 7567, 4, { 0x266D, 0x0000 } }, // flat
+  { 7571, 5, { 0xFB02, 0x0000 } }, // fllig
+  { 7576, 5, { 0x25B1, 0x0000 } }, // fltns
+  { 7581, 4, { 0x0192, 0x0000 } }, // fnof
+  { 7585, 4, { 0x1D557, 0x0000 } }, // fopf
+  { 7589, 6, { 0x2200, 0x0000 } }, // forall
+  { 7595, 4, { 0x22D4, 0x0000 } }, // fork
+  { 7599, 5, { 0x2AD9, 0x0000 } }, // forkv
+  { 7604, 8, { 0x2A0D, 0x0000 } }, // fpartint
+  { 7612, 6, { 0x00BD, 0x0000 } }, // frac12
+  { 7618, 6, { 0x2153, 0x0000 } }, // frac13
+  { 7624, 6, { 0x00BC, 0x0000 } }, // frac14
+  { 7630, 6, { 0x2155, 0x0000 } }, // frac15
+  { 7636, 6, { 0x2159, 0x0000 } }, // frac16
+  { 7642, 6, { 0x215B, 0x0000 } }, // frac18
+  { 7648, 6, { 0x2154, 0x0000 } }, // frac23
+  { 7654, 6, { 0x2156, 0x0000 } }, // frac25
+  { 7660, 6, { 0x00BE, 0x0000 } }, // frac34
+  { 7666, 6, { 0x2157, 0x0000 } }, // frac35
+  { 7672, 6, { 0x215C, 0x0000 } }, // frac38
+  { 7678, 6, { 0x2158, 0x0000 } }, // frac45
+  { 7684, 6, { 0x215A, 0x0000 } }, // frac56
+  { 7690, 6, { 0x215D, 0x0000 } }, // frac58
+  { 7696, 6, { 0x215E, 0x0000 } }, // frac78
+  { 7702, 5, { 0x2044, 0x0000 } }, // frasl
+  { 7707, 5, { 0x2322, 0x0000 } }, // frown
+  { 7712, 4, { 0x1D4BB, 0x0000 } }, // fscr
+  { 7716, 2, { 0x2267, 0x0000 } }, // gE
+  { 7718, 3, { 0x2A8C, 0x0000 } }, // gEl
+  { 7721, 6, { 0x01F5, 0x0000 } }, // gacute
+  { 7727, 5, { 0x03B3, 0x0000 } }, // gamma
+  { 7732, 6, { 0x03DD, 0x0000 } }, // gammad
+  { 7738, 3, { 0x2A86, 0x0000 } }, // gap
+  { 7741, 6, { 0x011F, 0x0000 } }, // gbreve
+  { 7747, 5, { 0x011D, 0x0000 } }, // gcirc
+  { 7752, 3, { 0x0433, 0x0000 } }, // gcy
+  { 7755, 4, { 0x0121, 0x0000 } }, // gdot
+  { 7759, 2, { 0x2265, 0x0000 } }, // ge
+  { 7761, 3, { 0x22DB, 0x0000 } }, // gel
+  { 7764, 3, { 0x2265, 0x0000 } }, // geq
+  { 7767, 4, { 0x2267, 0x0000 } }, // geqq
+  { 7771, 8, { 0x2A7E, 0x0000 } }, // geqslant
+  { 7779, 3, { 0x2A7E, 0x0000 } }, // ges
+  { 7782, 5, { 0x2AA9, 0x0000 } }, // gescc
+  { 7787, 6, { 0x2A80, 0x0000 } }, // gesdot
+  { 7793, 7, { 0x2A82, 0x0000 } }, // gesdoto
+  { 7800, 8, { 0x2A84, 0x0000 } }, // gesdotol
+  { 7808, 4, { 0x22DB, 0xFE00 } }, // gesl
+  { 7812, 6, { 0x2A94, 0x0000 } }, // gesles
+  { 7818, 3, { 0x1D524, 0x0000 } }, // gfr
+  { 7821, 2, { 0x226B, 0x0000 } }, // gg
+  { 7823, 3, { 0x22D9, 0x0000 } }, // ggg
+  { 7826, 5, { 0x2137, 0x0000 } }, // gimel
+  { 7831, 4, { 0x0453, 0x0000 } }, // gjcy
+  { 7835, 2, { 0x2277, 0x0000 } }, // gl
+  { 7837, 3, { 0x2A92, 0x0000 } }, // glE
+  { 7840, 3, { 0x2AA5, 0x0000 } }, // gla
+  { 7843, 3, { 0x2AA4, 0x0000 } }, // glj
+  { 7846, 3, { 0x2269, 0x0000 } }, // gnE
+  { 7849, 4, { 0x2A8A, 0x0000 } }, // gnap
+  { 7853, 8, { 0x2A8A, 0x0000 } }, // gnapprox
+  { 7861, 3, { 0x2A88, 0x0000 } }, // gne
+  { 7864, 4, { 0x2A88, 0x0000 } }, // gneq
+  { 7868, 5, { 0x2269, 0x0000 } }, // gneqq
+  { 7873, 5, { 0x22E7, 0x0000 } }, // gnsim
+  { 7878, 4, { 0x1D558, 0x0000 } }, // gopf
+  { 7882, 5, { 0x0060, 0x0000 } }, // grave
+  { 7887, 4, { 0x210A, 0x0000 } }, // gscr
+  { 7891, 4, { 0x2273, 0x0000 } }, // gsim
+  { 7895, 5, { 0x2A8E, 0x0000 } }, // gsime
+  { 7900, 5, { 0x2A90, 0x0000 } }, // gsiml
+  { 7905, 2, { 0x003E, 0x0000 } }, // gt
+  { 7907, 4, { 0x2AA7, 0x0000 } }, // gtcc
+  { 7911, 5, { 0x2A7A, 0x0000 } }, // gtcir
+  { 7916, 5, { 0x22D7, 0x0000 } }, // gtdot
+  { 7921, 6, { 0x2995, 0x0000 } }, // gtlPar
+  { 7927, 7, { 0x2A7C, 0x0000 } }, // gtquest
+  { 7934, 9, { 0x2A86, 0x0000 } }, // gtrapprox
+  { 7943, 6, { 0x2978, 0x0000 } }, // gtrarr
+  { 7949, 6, { 0x22D7, 0x0000 } }, // gtrdot
+  { 7955, 9, { 0x22DB, 0x0000 } }, // gtreqless
+  { 7964, 10, { 0x2A8C, 0x0000 } }, // gtreqqless
+  { 7974, 7, { 0x2277, 0x0000 } }, // gtrless
+  { 7981, 6, { 0x2273, 0x0000 } }, // gtrsim
+  { 7987, 9, { 0x2269, 0xFE00 } }, // gvertneqq
+  { 7996, 4, { 0x2269, 0xFE00 } }, // gvnE
+  { 8000, 4, { 0x21D4, 0x0000 } }, // hArr
+  { 8004, 6, { 0x200A, 0x0000 } }, // hairsp
+  { 8010, 4, { 0x00BD, 0x0000 } }, // half
+  { 8014, 6, { 0x210B, 0x0000 } }, // hamilt
+  { 8020, 6, { 0x044A, 0x0000 } }, // hardcy
+  { 8026, 4, { 0x2194, 0x0000 } }, // harr
+  { 8030, 7, { 0x2948, 0x0000 } }, // harrcir
+  { 8037, 5, { 0x21AD, 0x0000 } }, // harrw
+  { 8042, 4, { 0x210F, 0x0000 } }, // hbar
+  { 8046, 5, { 0x0125, 0x0000 } }, // hcirc
+  { 8051, 6, { 0x2665, 0x0000 } }, // hearts
+  { 8057, 9, { 0x2665, 0x0000 } }, // heartsuit
+  { 8066, 6, { 0x2026, 0x0000 } }, // hellip
+  { 8072, 6, { 0x22B9, 0x0000 } }, // hercon
+  { 8078, 3, { 0x1D525, 0x0000 } }, // hfr
+  { 8081, 8, { 0x2925, 0x0000 } }, // hksearow
+  { 8089, 8, { 0x2926, 0x0000 } }, // hkswarow
+  { 8097, 5, { 0x21FF, 0x0000 } }, // hoarr
+  { 8102, 6, { 0x223B, 0x0000 } }, // homtht
+  { 8108, 13, { 0x21A9, 0x0000 } }, // hookleftarrow
+  { 8121, 14, { 0x21AA, 0x0000 } }, // hookrightarrow
+  { 8135, 4, { 0x1D559, 0x0000 } }, // hopf
+  { 8139, 6, { 0x2015, 0x0000 } }, // horbar
+  { 8145, 4, { 0x1D4BD, 0x0000 } }, // hscr
+  { 8149, 6, { 0x210F, 0x0000 } }, // hslash
+  { 8155, 6, { 0x0127, 0x0000 } }, // hstrok
+  { 8161, 6, { 0x2043, 0x0000 } }, // hybull
+  { 8167, 6, { 0x2010, 0x0000 } }, // hyphen
+  { 8173, 6, { 0x00ED, 0x0000 } }, // iacute
+  { 8179, 2, { 0x2063, 0x0000 } }, // ic
+  { 8181, 5, { 0x00EE, 0x0000 } }, // icirc
+  { 8186, 3, { 0x0438, 0x0000 } }, // icy
+  { 8189, 4, { 0x0435, 0x0000 } }, // iecy
+  { 8193, 5, { 0x00A1, 0x0000 } }, // iexcl
+  { 8198, 3, { 0x21D4, 0x0000 } }, // iff
+  { 8201, 3, { 0x1D526, 0x0000 } }, // ifr
+  { 8204, 6, { 0x00EC, 0x0000 } }, // igrave
+  { 8210, 2, { 0x2148, 0x0000 } }, // ii
+  { 8212, 6, { 0x2A0C, 0x0000 } }, // iiiint
+  { 8218, 5, { 0x222D, 0x0000 } }, // iiint
+  { 8223, 6, { 0x29DC, 0x0000 } }, // iinfin
+  { 8229, 5, { 0x2129, 0x0000 } }, // iiota
+  { 8234, 5, { 0x0133, 0x0000 } }, // ijlig
+  { 8239, 5, { 0x012B, 0x0000 } }, // imacr
+  { 8244, 5, { 0x2111, 0x0000 } }, // image
+  { 8249, 8, { 0x2110, 0x0000 } }, // imagline
+  { 8257, 8, { 0x2111, 0x0000 } }, // imagpart
+  { 8265, 5, { 0x0131, 0x0000 } }, // imath
+  { 8270, 4, { 0x22B7, 0x0000 } }, // imof
+  { 8274, 5, { 0x01B5, 0x0000 } }, // imped
+  { 8279, 2, { 0x2208, 0x0000 } }, // in
+  { 8281, 6, { 0x2105, 0x0000 } }, // incare
+  { 8287, 5, { 0x221E, 0x0000 } }, // infin
+  { 8292, 8, { 0x29DD, 0x0000 } }, // infintie
+  { 8300, 6, { 0x0131, 0x0000 } }, // inodot
+  { 8306, 3, { 0x222B, 0x0000 } }, // int
+  { 8309, 6, { 0x22BA, 0x0000 } }, // intcal
+  { 8315, 8, { 0x2124, 0x0000 } }, // integers
+  { 8323, 8, { 0x22BA, 0x0000 } }, // intercal
+  { 8331, 8, { 0x2A17, 0x0000 } }, // intlarhk
+  { 8339, 7, { 0x2A3C, 0x0000 } }, // intprod
+  { 8346, 4, { 0x0451, 0x0000 } }, // iocy
+  { 8350, 5, { 0x012F, 0x0000 } }, // iogon
+  { 8355, 4, { 0x1D55A, 0x0000 } }, // iopf
+  { 8359, 4, { 0x03B9, 0x0000 } }, // iota
+  { 8363, 5, { 0x2A3C, 0x0000 } }, // iprod
+  { 8368, 6, { 0x00BF, 0x0000 } }, // iquest
+  { 8374, 4, { 0x1D4BE, 0x0000 } }, // iscr
+  { 8378, 4, { 0x2208, 0x0000 } }, // isin
+  { 8382, 5, { 0x22F9, 0x0000 } }, // isinE
+  { 8387, 7, { 0x22F5, 0x0000 } }, // isindot
+  { 8394, 5, { 0x22F4, 0x0000 } }, // isins
+  { 8399, 6, { 0x22F3, 0x0000 } }, // isinsv
+  { 8405, 5, { 0x2208, 0x0000 } }, // isinv
+  { 8410, 2, { 0x2062, 0x0000 } }, // it
+  { 8412, 6, { 0x0129, 0x0000 } }, // itilde
+  { 8418, 5, { 0x0456, 0x0000 } }, // iukcy
+  { 8423, 4, { 0x00EF, 0x0000 } }, // iuml
+  { 8427, 5, { 0x0135, 0x0000 } }, // jcirc
+  { 8432, 3, { 0x0439, 0x0000 } }, // jcy
+  { 8435, 3, { 0x1D527, 0x0000 } }, // jfr
+  { 8438, 5, { 0x0237, 0x0000 } }, // jmath
+  { 8443, 4, { 0x1D55B, 0x0000 } }, // jopf
+  { 8447, 4, { 0x1D4BF, 0x0000 } }, // jscr
+  { 8451, 6, { 0x0458, 0x0000 } }, // jsercy
+  { 8457, 5, { 0x0454, 0x0000 } }, // jukcy
+  { 8462, 5, { 0x03BA, 0x0000 } }, // kappa
+  { 8467, 6, { 0x03F0, 0x0000 } }, // kappav
+  { 8473, 6, { 0x0137, 0x0000 } }, // kcedil
+  { 8479, 3, { 0x043A, 0x0000 } }, // kcy
+  { 8482, 3, { 0x1D528, 0x0000 } }, // kfr
+  { 8485, 6, { 0x0138, 0x0000 } }, // kgreen
+  { 8491, 4, { 0x0445, 0x0000 } }, // khcy
+  { 8495, 4, { 0x045C, 0x0000 } }, // kjcy
+  { 8499, 4, { 0x1D55C, 0x0000 } }, // kopf
+  { 8503, 4, { 0x1D4C0, 0x0000 } }, // kscr
+  { 8507, 5, { 0x21DA, 0x0000 } }, // lAarr
+  { 8512, 4, { 0x21D0, 0x0000 } }, // lArr
+  { 8516, 6, { 0x291B, 0x0000 } }, // lAtail
+  { 8522, 5, { 0x290E, 0x0000 } }, // lBarr
+  { 8527, 2, { 0x2266, 0x0000 } }, // lE
+  { 8529, 3, { 0x2A8B, 0x0000 } }, // lEg
+  { 8532, 4, { 0x2962, 0x0000 } }, // lHar
+  { 8536, 6, { 0x013A, 0x0000 } }, // lacute
+  { 8542, 8, { 0x29B4, 0x0000 } }, // laemptyv
+  { 8550, 6, { 0x2112, 0x0000 } }, // lagran
+  { 8556, 6, { 0x03BB, 0x0000 } }, // lambda
+  { 8562, 4, { 0x27E8, 0x0000 } }, // lang
+  { 8566, 5, { 0x2991, 0x0000 } }, // langd
+  { 8571, 6, { 0x27E8, 0x0000 } }, // langle
+  { 8577, 3, { 0x2A85, 0x0000 } }, // lap
+  { 8580, 5, { 0x00AB, 0x0000 } }, // laquo
+  { 8585, 4, { 0x2190, 0x0000 } }, // larr
+  { 8589, 5, { 0x21E4, 0x0000 } }, // larrb
+  { 8594, 7, { 0x291F, 0x0000 } }, // larrbfs
+  { 8601, 6, { 0x291D, 0x0000 } }, // larrfs
+  { 8607, 6, { 0x21A9, 0x0000 } }, // larrhk
+  { 8613, 6, { 0x21AB, 0x0000 } }, // larrlp
+  { 8619, 6, { 0x2939, 0x0000 } }, // larrpl
+  { 8625, 7, { 0x2973, 0x0000 } }, // larrsim
+  { 8632, 6, { 0x21A2, 0x0000 } }, // larrtl
+  { 8638, 3, { 0x2AAB, 0x0000 } }, // lat
+  { 8641, 6, { 0x2919, 0x0000 } }, // latail
+  { 8647, 4, { 0x2AAD, 0x0000 } }, // late
+  { 8651, 5, { 0x2AAD, 0xFE00 } }, // lates
+  { 8656, 5, { 0x290C, 0x0000 } }, // lbarr
+  { 8661, 5, { 0x2772, 0x0000 } }, // lbbrk
+  { 8666, 6, { 0x007B, 0x0000 } }, // lbrace
+  { 8672, 6, { 0x005B, 0x0000 } }, // lbrack
+  { 8678, 5, { 0x298B, 0x0000 } }, // lbrke
+  { 8683, 7, { 0x298F, 0x0000 } }, // lbrksld
+  { 8690, 7, { 0x298D, 0x0000 } }, // lbrkslu
+  { 8697, 6, { 0x013E, 0x0000 } }, // lcaron
+  { 8703, 6, { 0x013C, 0x0000 } }, // lcedil
+  { 8709, 5, { 0x2308, 0x0000 } }, // lceil
+  { 8714, 4, { 0x007B, 0x0000 } }, // lcub
+  { 8718, 3, { 0x043B, 0x0000 } }, // lcy
+  { 8721, 4, { 0x2936, 0x0000 } }, // ldca
+  { 8725, 5, { 0x201C, 0x0000 } }, // ldquo
+  { 8730, 6, { 0x201E, 0x0000 } }, // ldquor
+  { 8736, 7, { 0x2967, 0x0000 } }, // ldrdhar
+  { 8743, 8, { 0x294B, 0x0000 } }, // ldrushar
+  { 8751, 4, { 0x21B2, 0x0000 } }, // ldsh
+  { 8755, 2, { 0x2264, 0x0000 } }, // le
+  { 8757, 9, { 0x2190, 0x0000 } }, // leftarrow
+  { 8766, 13, { 0x21A2, 0x0000 } }, // leftarrowtail
+  { 8779, 15, { 0x21BD, 0x0000 } }, // leftharpoondown
+  { 8794, 13, { 0x21BC, 0x0000 } }, // leftharpoonup
+  { 8807, 14, { 0x21C7, 0x0000 } }, // leftleftarrows
+  { 8821, 14, { 0x2194, 0x0000 } }, // leftrightarrow
+  { 8835, 15, { 0x21C6, 0x0000 } }, // leftrightarrows
+  { 8850, 17, { 0x21CB, 0x0000 } }, // leftrightharpoons
+  { 8867, 19, { 0x21AD, 0x0000 } }, // leftrightsquigarrow
+  { 8886, 14, { 0x22CB, 0x0000 } }, // leftthreetimes
+  { 8900, 3, { 0x22DA, 0x0000 } }, // leg
+  { 8903, 3, { 0x2264, 0x0000 } }, // leq
+  { 8906, 4, { 0x2266, 0x0000 } }, // leqq
+  { 8910, 8, { 0x2A7D, 0x0000 } }, // leqslant
+  { 8918, 3, { 0x2A7D, 0x0000 } }, // les
+  { 8921, 5, { 0x2AA8, 0x0000 } }, // lescc
+  { 8926, 6, { 0x2A7F, 0x0000 } }, // lesdot
+  { 8932, 7, { 0x2A81, 0x0000 } }, // lesdoto
+  { 8939, 8, { 0x2A83, 0x0000 } }, // lesdotor
+  { 8947, 4, { 0x22DA, 0xFE00 } }, // lesg
+  { 8951, 6, { 0x2A93, 0x0000 } }, // lesges
+  { 8957, 10, { 0x2A85, 0x0000 } }, // lessapprox
+  { 8967, 7, { 0x22D6, 0x0000 } }, // lessdot
+  { 8974, 9, { 0x22DA, 0x0000 } }, // lesseqgtr
+  { 8983, 10, { 0x2A8B, 0x0000 } }, // lesseqqgtr
+  { 8993, 7, { 0x2276, 0x0000 } }, // lessgtr
+  { 9000, 7, { 0x2272, 0x0000 } }, // lesssim
+  { 9007, 6, { 0x297C, 0x0000 } }, // lfisht
+  { 9013, 6, { 0x230A, 0x0000 } }, // lfloor
+  { 9019, 3, { 0x1D529, 0x0000 } }, // lfr
+  { 9022, 2, { 0x2276, 0x0000 } }, // lg
+  { 9024, 3, { 0x2A91, 0x0000 } }, // lgE
+  { 9027, 5, { 0x21BD, 0x0000 } }, // lhard
+  { 9032, 5, { 0x21BC, 0x0000 } }, // lharu
+  { 9037, 6, { 0x296A, 0x0000 } }, // lharul
+  { 9043, 5, { 0x2584, 0x0000 } }, // lhblk
+  { 9048, 4, { 0x0459, 0x0000 } }, // ljcy
+  { 9052, 2, { 0x226A, 0x0000 } }, // ll
+  { 9054, 5, { 0x21C7, 0x0000 } }, // llarr
+  { 9059, 8, { 0x231E, 0x0000 } }, // llcorner
+  { 9067, 6, { 0x296B, 0x0000 } }, // llhard
+  { 9073, 5, { 0x25FA, 0x0000 } }, // lltri
+  { 9078, 6, { 0x0140, 0x0000 } }, // lmidot
+  { 9084, 6, { 0x23B0, 0x0000 } }, // lmoust
+  { 9090, 10, { 0x23B0, 0x0000 } }, // lmoustache
+  { 9100, 3, { 0x2268, 0x0000 } }, // lnE
+  { 9103, 4, { 0x2A89, 0x0000 } }, // lnap
+  { 9107, 8, { 0x2A89, 0x0000 } }, // lnapprox
+  { 9115, 3, { 0x2A87, 0x0000 } }, // lne
+  { 9118, 4, { 0x2A87, 0x0000 } }, // lneq
+  { 9122, 5, { 0x2268, 0x0000 } }, // lneqq
+  { 9127, 5, { 0x22E6, 0x0000 } }, // lnsim
+  { 9132, 5, { 0x27EC, 0x0000 } }, // loang
+  { 9137, 5, { 0x21FD, 0x0000 } }, // loarr
+  { 9142, 5, { 0x27E6, 0x0000 } }, // lobrk
+  { 9147, 13, { 0x27F5, 0x0000 } }, // longleftarrow
+  { 9160, 18, { 0x27F7, 0x0000 } }, // longleftrightarrow
+  { 9178, 10, { 0x27FC, 0x0000 } }, // longmapsto
+  { 9188, 14, { 0x27F6, 0x0000 } }, // longrightarrow
+  { 9202, 13, { 0x21AB, 0x0000 } }, // looparrowleft
+  { 9215, 14, { 0x21AC, 0x0000 } }, // looparrowright
+  { 9229, 5, { 0x2985, 0x0000 } }, // lopar
+  { 9234, 4, { 0x1D55D, 0x0000 } }, // lopf
+  { 9238, 6, { 0x2A2D, 0x0000 } }, // loplus
+  { 9244, 7, { 0x2A34, 0x0000 } }, // lotimes
+  { 9251, 6, { 0x2217, 0x0000 } }, // lowast
+  { 9257, 6, { 0x005F, 0x0000 } }, // lowbar
+  { 9263, 3, { 0x25CA, 0x0000 } }, // loz
+  { 9266, 7, { 0x25CA, 0x0000 } }, // lozenge
+  { 9273, 4, { 0x29EB, 0x0000 } }, // lozf
+  { 9277, 4, { 0x0028, 0x0000 } }, // lpar
+  { 9281, 6, { 0x2993, 0x0000 } }, // lparlt
+  { 9287, 5, { 0x21C6, 0x0000 } }, // lrarr
+  { 9292, 8, { 0x231F, 0x0000 } }, // lrcorner
+  { 9300, 5, { 0x21CB, 0x0000 } }, // lrhar
+  { 9305, 6, { 0x296D, 0x0000 } }, // lrhard
+  { 9311, 3, { 0x200E, 0x0000 } }, // lrm
+  { 9314, 5, { 0x22BF, 0x0000 } }, // lrtri
+  { 9319, 6, { 0x2039, 0x0000 } }, // lsaquo
+  { 9325, 4, { 0x1D4C1, 0x0000 } }, // lscr
+  { 9329, 3, { 0x21B0, 0x0000 } }, // lsh
+  { 9332, 4, { 0x2272, 0x0000 } }, // lsim
+  { 9336, 5, { 0x2A8D, 0x0000 } }, // lsime
+  { 9341, 5, { 0x2A8F, 0x0000 } }, // lsimg
+  { 9346, 4, { 0x005B, 0x0000 } }, // lsqb
+  { 9350, 5, { 0x2018, 0x0000 } }, // lsquo
+  { 9355, 6, { 0x201A, 0x0000 } }, // lsquor
+  { 9361, 6, { 0x0142, 0x0000 } }, // lstrok
+  { 9367, 2, { 0x003C, 0x0000 } }, // lt
+  { 9369, 4, { 0x2AA6, 0x0000 } }, // ltcc
+  { 9373, 5, { 0x2A79, 0x0000 } }, // ltcir
+  { 9378, 5, { 0x22D6, 0x0000 } }, // ltdot
+  { 9383, 6, { 0x22CB, 0x0000 } }, // lthree
+  { 9389, 6, { 0x22C9, 0x0000 } }, // ltimes
+  { 9395, 6, { 0x2976, 0x0000 } }, // ltlarr
+  { 9401, 7, { 0x2A7B, 0x0000 } }, // ltquest
+  { 9408, 6, { 0x2996, 0x0000 } }, // ltrPar
+  { 9414, 4, { 0x25C3, 0x0000 } }, // ltri
+  { 9418, 5, { 0x22B4, 0x0000 } }, // ltrie
+  { 9423, 5, { 0x25C2, 0x0000 } }, // ltrif
+  { 9428, 8, { 0x294A, 0x0000 } }, // lurdshar
+  { 9436, 7, { 0x2966, 0x0000 } }, // luruhar
+  { 9443, 9, { 0x2268, 0xFE00 } }, // lvertneqq
+  { 9452, 4, { 0x2268, 0xFE00 } }, // lvnE
+  { 9456, 5, { 0x223A, 0x0000 } }, // mDDot
+  { 9461, 4, { 0x00AF, 0x0000 } }, // macr
+  { 9465, 4, { 0x2642, 0x0000 } }, // male
+  { 9469, 4, { 0x2720, 0x0000 } }, // malt
+  { 9473, 7, { 0x2720, 0x0000 } }, // maltese
+  { 9480, 3, { 0x21A6, 0x0000 } }, // map
+  { 9483, 6, { 0x21A6, 0x0000 } }, // mapsto
+  { 9489, 10, { 0x21A7, 0x0000 } }, // mapstodown
+  { 9499, 10, { 0x21A4, 0x0000 } }, // mapstoleft
+  { 9509, 8, { 0x21A5, 0x0000 } }, // mapstoup
+  { 9517, 6, { 0x25AE, 0x0000 } }, // marker
+  { 9523, 6, { 0x2A29, 0x0000 } }, // mcomma
+  { 9529, 3, { 0x043C, 0x0000 } }, // mcy
+  { 9532, 5, { 0x2014, 0x0000 } }, // mdash
+  { 9537, 13, { 0x2221, 0x0000 } }, // measuredangle
+  { 9550, 3, { 0x1D52A, 0x0000 } }, // mfr
+  { 9553, 3, { 0x2127, 0x0000 } }, // mho
+  { 9556, 5, { 0x00B5, 0x0000 } }, // micro
+  { 9561, 3, { 0x2223, 0x0000 } }, // mid
+  { 9564, 6, { 0x002A, 0x0000 } }, // midast
+  { 9570, 6, { 0x2AF0, 0x0000 } }, // midcir
+  { 9576, 6, { 0x00B7, 0x0000 } }, // middot
+  { 9582, 5, { 0x2212, 0x0000 } }, // minus
+  { 9587, 6, { 0x229F, 0x0000 } }, // minusb
+  { 9593, 6, { 0x2238, 0x0000 } }, // minusd
+  { 9599, 7, { 0x2A2A, 0x0000 } }, // minusdu
+  { 9606, 4, { 0x2ADB, 0x0000 } }, // mlcp
+  { 9610, 4, { 0x2026, 0x0000 } }, // mldr
+  { 9614, 6, { 0x2213, 0x0000 } }, // mnplus
+  { 9620, 6, { 0x22A7, 0x0000 } }, // models
+  { 9626, 4, { 0x1D55E, 0x0000 } }, // mopf
+  { 9630, 2, { 0x2213, 0x0000 } }, // mp
+  { 9632, 4, { 0x1D4C2, 0x0000 } }, // mscr
+  { 9636, 6, { 0x223E, 0x0000 } }, // mstpos
+  { 9642, 2, { 0x03BC, 0x0000 } }, // mu
+  { 9644, 8, { 0x22B8, 0x0000 } }, // multimap
+  { 9652, 5, { 0x22B8, 0x0000 } }, // mumap
+  { 9657, 3, { 0x22D9, 0x0338 } }, // nGg
+  { 9660, 3, { 0x226B, 0x20D2 } }, // nGt
+  { 9663, 4, { 0x226B, 0x0338 } }, // nGtv
+  { 9667, 10, { 0x21CD, 0x0000 } }, // nLeftarrow
+  { 9677, 15, { 0x21CE, 0x0000 } }, // nLeftrightarrow
+  { 9692, 3, { 0x22D8, 0x0338 } }, // nLl
+  { 9695, 3, { 0x226A, 0x20D2 } }, // nLt
+  { 9698, 4, { 0x226A, 0x0338 } }, // nLtv
+  { 9702, 11, { 0x21CF, 0x0000 } }, // nRightarrow
+  { 9713, 6, { 0x22AF, 0x0000 } }, // nVDash
+  { 9719, 6, { 0x22AE, 0x0000 } }, // nVdash
+  { 9725, 5, { 0x2207, 0x0000 } }, // nabla
+  { 9730, 6, { 0x0144, 0x0000 } }, // nacute
+  { 9736, 4, { 0x2220, 0x20D2 } }, // nang
+  { 9740, 3, { 0x2249, 0x0000 } }, // nap
+  { 9743, 4, { 0x2A70, 0x0338 } }, // napE
+  { 9747, 5, { 0x224B, 0x0338 } }, // napid
+  { 9752, 5, { 0x0149, 0x0000 } }, // napos
+  { 9757, 7, { 0x2249, 0x0000 } }, // napprox
+  { 9764, 5, { 0x266E, 0x0000 } }, // natur
+  { 9769, 7, { 0x266E, 0x0000 } }, // natural
+  { 9776, 8, { 0x2115, 0x0000 } }, // naturals
+  { 9784, 4, { 0x00A0, 0x0000 } }, // nbsp
+  { 9788, 5, { 0x224E, 0x0338 } }, // nbump
+  { 9793, 6, { 0x224F, 0x0338 } }, // nbumpe
+  { 9799, 4, { 0x2A43, 0x0000 } }, // ncap
+  { 9803, 6, { 0x0148, 0x0000 } }, // ncaron
+  { 9809, 6, { 0x0146, 0x0000 } }, // ncedil
+  { 9815, 5, { 0x2247, 0x0000 } }, // ncong
+  { 9820, 8, { 0x2A6D, 0x0338 } }, // ncongdot
+  { 9828, 4, { 0x2A42, 0x0000 } }, // ncup
+  { 9832, 3, { 0x043D, 0x0000 } }, // ncy
+  { 9835, 5, { 0x2013, 0x0000 } }, // ndash
+  { 9840, 2, { 0x2260, 0x0000 } }, // ne
+  { 9842, 5, { 0x21D7, 0x0000 } }, // neArr
+  { 9847, 6, { 0x2924, 0x0000 } }, // nearhk
+  { 9853, 5, { 0x2197, 0x0000 } }, // nearr
+  { 9858, 7, { 0x2197, 0x0000 } }, // nearrow
+  { 9865, 5, { 0x2250, 0x0338 } }, // nedot
+  { 9870, 6, { 0x2262, 0x0000 } }, // nequiv
+  { 9876, 6, { 0x2928, 0x0000 } }, // nesear
+  { 9882, 5, { 0x2242, 0x0338 } }, // nesim
+  { 9887, 6, { 0x2204, 0x0000 } }, // nexist
+  { 9893, 7, { 0x2204, 0x0000 } }, // nexists
+  { 9900, 3, { 0x1D52B, 0x0000 } }, // nfr
+  { 9903, 3, { 0x2267, 0x0338 } }, // ngE
+  { 9906, 3, { 0x2271, 0x0000 } }, // nge
+  { 9909, 4, { 0x2271, 0x0000 } }, // ngeq
+  { 9913, 5, { 0x2267, 0x0338 } }, // ngeqq
+  { 9918, 9, { 0x2A7E, 0x0338 } }, // ngeqslant
+  { 9927, 4, { 0x2A7E, 0x0338 } }, // nges
+  { 9931, 5, { 0x2275, 0x0000 } }, // ngsim
+  { 9936, 3, { 0x226F, 0x0000 } }, // ngt
+  { 9939, 4, { 0x226F, 0x0000 } }, // ngtr
+  { 9943, 5, { 0x21CE, 0x0000 } }, // nhArr
+  { 9948, 5, { 0x21AE, 0x0000 } }, // nharr
+  { 9953, 5, { 0x2AF2, 0x0000 } }, // nhpar
+  { 9958, 2, { 0x220B, 0x0000 } }, // ni
+  { 9960, 3, { 0x22FC, 0x0000 } }, // nis
+  { 9963, 4, { 0x22FA, 0x0000 } }, // nisd
+  { 9967, 3, { 0x220B, 0x0000 } }, // niv
+  { 9970, 4, { 0x045A, 0x0000 } }, // njcy
+  { 9974, 5, { 0x21CD, 0x0000 } }, // nlArr
+  { 9979, 3, { 0x2266, 0x0338 } }, // nlE
+  { 9982, 5, { 0x219A, 0x0000 } }, // nlarr
+  { 9987, 4, { 0x2025, 0x0000 } }, // nldr
+  { 9991, 3, { 0x2270, 0x0000 } }, // nle
+  { 9994, 10, { 0x219A, 0x0000 } }, // nleftarrow
+  { 10004, 15, { 0x21AE, 0x0000 } }, // nleftrightarrow
+  { 10019, 4, { 0x2270, 0x0000 } }, // nleq
+  { 10023, 5, { 0x2266, 0x0338 } }, // nleqq
+  { 10028, 9, { 0x2A7D, 0x0338 } }, // nleqslant
+  { 10037, 4, { 0x2A7D, 0x0338 } }, // nles
+  { 10041, 5, { 0x226E, 0x0000 } }, // nless
+  { 10046, 5, { 0x2274, 0x0000 } }, // nlsim
+  { 10051, 3, { 0x226E, 0x0000 } }, // nlt
+  { 10054, 5, { 0x22EA, 0x0000 } }, // nltri
+  { 10059, 6, { 0x22EC, 0x0000 } }, // nltrie
+  { 10065, 4, { 0x2224, 0x0000 } }, // nmid
+  { 10069, 4, { 0x1D55F, 0x0000 } }, // nopf
+  { 10073, 3, { 0x00AC, 0x0000 } }, // not
+  { 10076, 5, { 0x2209, 0x0000 } }, // notin
+  { 10081, 6, { 0x22F9, 0x0338 } }, // notinE
+  { 10087, 8, { 0x22F5, 0x0338 } }, // notindot
+  { 10095, 7, { 0x2209, 0x0000 } }, // notinva
+  { 10102, 7, { 0x22F7, 0x0000 } }, // notinvb
+  { 10109, 7, { 0x22F6, 0x0000 } }, // notinvc
+  { 10116, 5, { 0x220C, 0x0000 } }, // notni
+  { 10121, 7, { 0x220C, 0x0000 } }, // notniva
+  { 10128, 7, { 0x22FE, 0x0000 } }, // notnivb
+  { 10135, 7, { 0x22FD, 0x0000 } }, // notnivc
+  { 10142, 4, { 0x2226, 0x0000 } }, // npar
+  { 10146, 9, { 0x2226, 0x0000 } }, // nparallel
+  { 10155, 6, { 0x2AFD, 0x20E5 } }, // nparsl
+  { 10161, 5, { 0x2202, 0x0338 } }, // npart
+  { 10166, 7, { 0x2A14, 0x0000 } }, // npolint
+  { 10173, 3, { 0x2280, 0x0000 } }, // npr
+  { 10176, 6, { 0x22E0, 0x0000 } }, // nprcue
+  { 10182, 4, { 0x2AAF, 0x0338 } }, // npre
+  { 10186, 5, { 0x2280, 0x0000 } }, // nprec
+  { 10191, 7, { 0x2AAF, 0x0338 } }, // npreceq
+  { 10198, 5, { 0x21CF, 0x0000 } }, // nrArr
+  { 10203, 5, { 0x219B, 0x0000 } }, // nrarr
+  { 10208, 6, { 0x2933, 0x0338 } }, // nrarrc
+  { 10214, 6, { 0x219D, 0x0338 } }, // nrarrw
+  { 10220, 11, { 0x219B, 0x0000 } }, // nrightarrow
+  { 10231, 5, { 0x22EB, 0x0000 } }, // nrtri
+  { 10236, 6, { 0x22ED, 0x0000 } }, // nrtrie
+  { 10242, 3, { 0x2281, 0x0000 } }, // nsc
+  { 10245, 6, { 0x22E1, 0x0000 } }, // nsccue
+  { 10251, 4, { 0x2AB0, 0x0338 } }, // nsce
+  { 10255, 4, { 0x1D4C3, 0x0000 } }, // nscr
+  { 10259, 9, { 0x2224, 0x0000 } }, // nshortmid
+  { 10268, 14, { 0x2226, 0x0000 } }, // nshortparallel
+  { 10282, 4, { 0x2241, 0x0000 } }, // nsim
+  { 10286, 5, { 0x2244, 0x0000 } }, // nsime
+  { 10291, 6, { 0x2244, 0x0000 } }, // nsimeq
+  { 10297, 5, { 0x2224, 0x0000 } }, // nsmid
+  { 10302, 5, { 0x2226, 0x0000 } }, // nspar
+  { 10307, 7, { 0x22E2, 0x0000 } }, // nsqsube
+  { 10314, 7, { 0x22E3, 0x0000 } }, // nsqsupe
+  { 10321, 4, { 0x2284, 0x0000 } }, // nsub
+  { 10325, 5, { 0x2AC5, 0x0338 } }, // nsubE
+  { 10330, 5, { 0x2288, 0x0000 } }, // nsube
+  { 10335, 7, { 0x2282, 0x20D2 } }, // nsubset
+  { 10342, 9, { 0x2288, 0x0000 } }, // nsubseteq
+  { 10351, 10, { 0x2AC5, 0x0338 } }, // nsubseteqq
+  { 10361, 5, { 0x2281, 0x0000 } }, // nsucc
+  { 10366, 7, { 0x2AB0, 0x0338 } }, // nsucceq
+  { 10373, 4, { 0x2285, 0x0000 } }, // nsup
+  { 10377, 5, { 0x2AC6, 0x0338 } }, // nsupE
+  { 10382, 5, { 0x2289, 0x0000 } }, // nsupe
+  { 10387, 7, { 0x2283, 0x20D2 } }, // nsupset
+  { 10394, 9, { 0x2289, 0x0000 } }, // nsupseteq
+  { 10403, 10, { 0x2AC6, 0x0338 } }, // nsupseteqq
+  { 10413, 4, { 0x2279, 0x0000 } }, // ntgl
+  { 10417, 6, { 0x00F1, 0x0000 } }, // ntilde
+  { 10423, 4, { 0x2278, 0x0000 } }, // ntlg
+  { 10427, 13, { 0x22EA, 0x0000 } }, // ntriangleleft
+  { 10440, 15, { 0x22EC, 0x0000 } }, // ntrianglelefteq
+  { 10455, 14, { 0x22EB, 0x0000 } }, // ntriangleright
+  { 10469, 16, { 0x22ED, 0x0000 } }, // ntrianglerighteq
+  { 10485, 2, { 0x03BD, 0x0000 } }, // nu
+  { 10487, 3, { 0x0023, 0x0000 } }, // num
+  { 10490, 6, { 0x2116, 0x0000 } }, // numero
+  { 10496, 5, { 0x2007, 0x0000 } }, // numsp
+  { 10501, 6, { 0x22AD, 0x0000 } }, // nvDash
+  { 10507, 6, { 0x2904, 0x0000 } }, // nvHarr
+  { 10513, 4, { 0x224D, 0x20D2 } }, // nvap
+  { 10517, 6, { 0x22AC, 0x0000 } }, // nvdash
+  { 10523, 4, { 0x2265, 0x20D2 } }, // nvge
+  { 10527, 4, { 0x003E, 0x20D2 } }, // nvgt
+  { 10531, 7, { 0x29DE, 0x0000 } }, // nvinfin
+  { 10538, 6, { 0x2902, 0x0000 } }, // nvlArr
+  { 10544, 4, { 0x2264, 0x20D2 } }, // nvle
+  { 10548, 4, { 0x003C, 0x20D2 } }, // nvlt
+  { 10552, 7, { 0x22B4, 0x20D2 } }, // nvltrie
+  { 10559, 6, { 0x2903, 0x0000 } }, // nvrArr
+  { 10565, 7, { 0x22B5, 0x20D2 } }, // nvrtrie
+  { 10572, 5, { 0x223C, 0x20D2 } }, // nvsim
+  { 10577, 5, { 0x21D6, 0x0000 } }, // nwArr
+  { 10582, 6, { 0x2923, 0x0000 } }, // nwarhk
+  { 10588, 5, { 0x2196, 0x0000 } }, // nwarr
+  { 10593, 7, { 0x2196, 0x0000 } }, // nwarrow
+  { 10600, 6, { 0x2927, 0x0000 } }, // nwnear
+  { 10606, 2, { 0x24C8, 0x0000 } }, // oS
+  { 10608, 6, { 0x00F3, 0x0000 } }, // oacute
+  { 10614, 4, { 0x229B, 0x0000 } }, // oast
+  { 10618, 4, { 0x229A, 0x0000 } }, // ocir
+  { 10622, 5, { 0x00F4, 0x0000 } }, // ocirc
+  { 10627, 3, { 0x043E, 0x0000 } }, // ocy
+  { 10630, 5, { 0x229D, 0x0000 } }, // odash
+  { 10635, 6, { 0x0151, 0x0000 } }, // odblac
+  { 10641, 4, { 0x2A38, 0x0000 } }, // odiv
+  { 10645, 4, { 0x2299, 0x0000 } }, // odot
+  { 10649, 6, { 0x29BC, 0x0000 } }, // odsold
+  { 10655, 5, { 0x0153, 0x0000 } }, // oelig
+  { 10660, 5, { 0x29BF, 0x0000 } }, // ofcir
+  { 10665, 3, { 0x1D52C, 0x0000 } }, // ofr
+  { 10668, 4, { 0x02DB, 0x0000 } }, // ogon
+  { 10672, 6, { 0x00F2, 0x0000 } }, // ograve
+  { 10678, 3, { 0x29C1, 0x0000 } }, // ogt
+  { 10681, 5, { 0x29B5, 0x0000 } }, // ohbar
+  { 10686, 3, { 0x03A9, 0x0000 } }, // ohm
+  { 10689, 4, { 0x222E, 0x0000 } }, // oint
+  { 10693, 5, { 0x21BA, 0x0000 } }, // olarr
+  { 10698, 5, { 0x29BE, 0x0000 } }, // olcir
+  { 10703, 7, { 0x29BB, 0x0000 } }, // olcross
+  { 10710, 5, { 0x203E, 0x0000 } }, // oline
+  { 10715, 3, { 0x29C0, 0x0000 } }, // olt
+  { 10718, 5, { 0x014D, 0x0000 } }, // omacr
+  { 10723, 5, { 0x03C9, 0x0000 } }, // omega
+  { 10728, 7, { 0x03BF, 0x0000 } }, // omicron
+  { 10735, 4, { 0x29B6, 0x0000 } }, // omid
+  { 10739, 6, { 0x2296, 0x0000 } }, // ominus
+  { 10745, 4, { 0x1D560, 0x0000 } }, // oopf
+  { 10749, 4, { 0x29B7, 0x0000 } }, // opar
+  { 10753, 5, { 0x29B9, 0x0000 } }, // operp
+  { 10758, 5, { 0x2295, 0x0000 } }, // oplus
+  { 10763, 2, { 0x2228, 0x0000 } }, // or
+  { 10765, 5, { 0x21BB, 0x0000 } }, // orarr
+  { 10770, 3, { 0x2A5D, 0x0000 } }, // ord
+  { 10773, 5, { 0x2134, 0x0000 } }, // order
+  { 10778, 7, { 0x2134, 0x0000 } }, // orderof
+  { 10785, 4, { 0x00AA, 0x0000 } }, // ordf
+  { 10789, 4, { 0x00BA, 0x0000 } }, // ordm
+  { 10793, 6, { 0x22B6, 0x0000 } }, // origof
+  { 10799, 4, { 0x2A56, 0x0000 } }, // oror
+  { 10803, 7, { 0x2A57, 0x0000 } }, // orslope
+  { 10810, 3, { 0x2A5B, 0x0000 } }, // orv
+  { 10813, 4, { 0x2134, 0x0000 } }, // oscr
+  { 10817, 6, { 0x00F8, 0x0000 } }, // oslash
+  { 10823, 4, { 0x2298, 0x0000 } }, // osol
+  { 10827, 6, { 0x00F5, 0x0000 } }, // otilde
+  { 10833, 6, { 0x2297, 0x0000 } }, // otimes
+  { 10839, 8, { 0x2A36, 0x0000 } }, // otimesas
+  { 10847, 4, { 0x00F6, 0x0000 } }, // ouml
+  { 10851, 5, { 0x233D, 0x0000 } }, // ovbar
+  { 10856, 3, { 0x2225, 0x0000 } }, // par
+  { 10859, 4, { 0x00B6, 0x0000 } }, // para
+  { 10863, 8, { 0x2225, 0x0000 } }, // parallel
+  { 10871, 6, { 0x2AF3, 0x0000 } }, // parsim
+  { 10877, 5, { 0x2AFD, 0x0000 } }, // parsl
+  { 10882, 4, { 0x2202, 0x0000 } }, // part
+  { 10886, 3, { 0x043F, 0x0000 } }, // pcy
+  { 10889, 6, { 0x0025, 0x0000 } }, // percnt
+  { 10895, 6, { 0x002E, 0x0000 } }, // period
+  { 10901, 6, { 0x2030, 0x0000 } }, // permil
+  { 10907, 4, { 0x22A5, 0x0000 } }, // perp
+  { 10911, 7, { 0x2031, 0x0000 } }, // pertenk
+  { 10918, 3, { 0x1D52D, 0x0000 } }, // pfr
+  { 10921, 3, { 0x03C6, 0x0000 } }, // phi
+  { 10924, 4, { 0x03D5, 0x0000 } }, // phiv
+  { 10928, 6, { 0x2133, 0x0000 } }, // phmmat
+  { 10934, 5, { 0x260E, 0x0000 } }, // phone
+  { 10939, 2, { 0x03C0, 0x0000 } }, // pi
+  { 10941, 9, { 0x22D4, 0x0000 } }, // pitchfork
+  { 10950, 3, { 0x03D6, 0x0000 } }, // piv
+  { 10953, 6, { 0x210F, 0x0000 } }, // planck
+  { 10959, 7, { 0x210E, 0x0000 } }, // planckh
+  { 10966, 6, { 0x210F, 0x0000 } }, // plankv
+  { 10972, 4, { 0x002B, 0x0000 } }, // plus
+  { 10976, 8, { 0x2A23, 0x0000 } }, // plusacir
+  { 10984, 5, { 0x229E, 0x0000 } }, // plusb
+  { 10989, 7, { 0x2A22, 0x0000 } }, // pluscir
+  { 10996, 6, { 0x2214, 0x0000 } }, // plusdo
+  { 11002, 6, { 0x2A25, 0x0000 } }, // plusdu
+  { 11008, 5, { 0x2A72, 0x0000 } }, // pluse
+  { 11013, 6, { 0x00B1, 0x0000 } }, // plusmn
+  { 11019, 7, { 0x2A26, 0x0000 } }, // plussim
+  { 11026, 7, { 0x2A27, 0x0000 } }, // plustwo
+  { 11033, 2, { 0x00B1, 0x0000 } }, // pm
+  { 11035, 8, { 0x2A15, 0x0000 } }, // pointint
+  { 11043, 4, { 0x1D561, 0x0000 } }, // popf
+  { 11047, 5, { 0x00A3, 0x0000 } }, // pound
+  { 11052, 2, { 0x227A, 0x0000 } }, // pr
+  { 11054, 3, { 0x2AB3, 0x0000 } }, // prE
+  { 11057, 4, { 0x2AB7, 0x0000 } }, // prap
+  { 11061, 5, { 0x227C, 0x0000 } }, // prcue
+  { 11066, 3, { 0x2AAF, 0x0000 } }, // pre
+  { 11069, 4, { 0x227A, 0x0000 } }, // prec
+  { 11073, 10, { 0x2AB7, 0x0000 } }, // precapprox
+  { 11083, 11, { 0x227C, 0x0000 } }, // preccurlyeq
+  { 11094, 6, { 0x2AAF, 0x0000 } }, // preceq
+  { 11100, 11, { 0x2AB9, 0x0000 } }, // precnapprox
+  { 11111, 8, { 0x2AB5, 0x0000 } }, // precneqq
+  { 11119, 8, { 0x22E8, 0x0000 } }, // precnsim
+  { 11127, 7, { 0x227E, 0x0000 } }, // precsim
+  { 11134, 5, { 0x2032, 0x0000 } }, // prime
+  { 11139, 6, { 0x2119, 0x0000 } }, // primes
+  { 11145, 4, { 0x2AB5, 0x0000 } }, // prnE
+  { 11149, 5, { 0x2AB9, 0x0000 } }, // prnap
+  { 11154, 6, { 0x22E8, 0x0000 } }, // prnsim
+  { 11160, 4, { 0x220F, 0x0000 } }, // prod
+  { 11164, 8, { 0x232E, 0x0000 } }, // profalar
+  { 11172, 8, { 0x2312, 0x0000 } }, // profline
+  { 11180, 8, { 0x2313, 0x0000 } }, // profsurf
+  { 11188, 4, { 0x221D, 0x0000 } }, // prop
+  { 11192, 6, { 0x221D, 0x0000 } }, // propto
+  { 11198, 5, { 0x227E, 0x0000 } }, // prsim
+  { 11203, 6, { 0x22B0, 0x0000 } }, // prurel
+  { 11209, 4, { 0x1D4C5, 0x0000 } }, // pscr
+  { 11213, 3, { 0x03C8, 0x0000 } }, // psi
+  { 11216, 6, { 0x2008, 0x0000 } }, // puncsp
+  { 11222, 3, { 0x1D52E, 0x0000 } }, // qfr
+  { 11225, 4, { 0x2A0C, 0x0000 } }, // qint
+  { 11229, 4, { 0x1D562, 0x0000 } }, // qopf
+  { 11233, 6, { 0x2057, 0x0000 } }, // qprime
+  { 11239, 4, { 0x1D4C6, 0x0000 } }, // qscr
+  { 11243, 11, { 0x210D, 0x0000 } }, // quaternions
+  { 11254, 7, { 0x2A16, 0x0000 } }, // quatint
+  { 11261, 5, { 0x003F, 0x0000 } }, // quest
+  { 11266, 7, { 0x225F, 0x0000 } }, // questeq
+  { 11273, 4, { 0x0022, 0x0000 } }, // quot
+  { 11277, 5, { 0x21DB, 0x0000 } }, // rAarr
+  { 11282, 4, { 0x21D2, 0x0000 } }, // rArr
+  { 11286, 6, { 0x291C, 0x0000 } }, // rAtail
+  { 11292, 5, { 0x290F, 0x0000 } }, // rBarr
+  { 11297, 4, { 0x2964, 0x0000 } }, // rHar
+  { 11301, 4, { 0x223D, 0x0331 } }, // race
+  { 11305, 6, { 0x0155, 0x0000 } }, // racute
+  { 11311, 5, { 0x221A, 0x0000 } }, // radic
+  { 11316, 8, { 0x29B3, 0x0000 } }, // raemptyv
+  { 11324, 4, { 0x27E9, 0x0000 } }, // rang
+  { 11328, 5, { 0x2992, 0x0000 } }, // rangd
+  { 11333, 5, { 0x29A5, 0x0000 } }, // range
+  { 11338, 6, { 0x27E9, 0x0000 } }, // rangle
+  { 11344, 5, { 0x00BB, 0x0000 } }, // raquo
+  { 11349, 4, { 0x2192, 0x0000 } }, // rarr
+  { 11353, 6, { 0x2975, 0x0000 } }, // rarrap
+  { 11359, 5, { 0x21E5, 0x0000 } }, // rarrb
+  { 11364, 7, { 0x2920, 0x0000 } }, // rarrbfs
+  { 11371, 5, { 0x2933, 0x0000 } }, // rarrc
+  { 11376, 6, { 0x291E, 0x0000 } }, // rarrfs
+  { 11382, 6, { 0x21AA, 0x0000 } }, // rarrhk
+  { 11388, 6, { 0x21AC, 0x0000 } }, // rarrlp
+  { 11394, 6, { 0x2945, 0x0000 } }, // rarrpl
+  { 11400, 7, { 0x2974, 0x0000 } }, // rarrsim
+  { 11407, 6, { 0x21A3, 0x0000 } }, // rarrtl
+  { 11413, 5, { 0x219D, 0x0000 } }, // rarrw
+  { 11418, 6, { 0x291A, 0x0000 } }, // ratail
+  { 11424, 5, { 0x2236, 0x0000 } }, // ratio
+  { 11429, 9, { 0x211A, 0x0000 } }, // rationals
+  { 11438, 5, { 0x290D, 0x0000 } }, // rbarr
+  { 11443, 5, { 0x2773, 0x0000 } }, // rbbrk
+  { 11448, 6, { 0x007D, 0x0000 } }, // rbrace
+  { 11454, 6, { 0x005D, 0x0000 } }, // rbrack
+  { 11460, 5, { 0x298C, 0x0000 } }, // rbrke
+  { 11465, 7, { 0x298E, 0x0000 } }, // rbrksld
+  { 11472, 7, { 0x2990, 0x0000 } }, // rbrkslu
+  { 11479, 6, { 0x0159, 0x0000 } }, // rcaron
+  { 11485, 6, { 0x0157, 0x0000 } }, // rcedil
+  { 11491, 5, { 0x2309, 0x0000 } }, // rceil
+  { 11496, 4, { 0x007D, 0x0000 } }, // rcub
+  { 11500, 3, { 0x0440, 0x0000 } }, // rcy
+  { 11503, 4, { 0x2937, 0x0000 } }, // rdca
+  { 11507, 7, { 0x2969, 0x0000 } }, // rdldhar
+  { 11514, 5, { 0x201D, 0x0000 } }, // rdquo
+  { 11519, 6, { 0x201D, 0x0000 } }, // rdquor
+  { 11525, 4, { 0x21B3, 0x0000 } }, // rdsh
+  { 11529, 4, { 0x211C, 0x0000 } }, // real
+  { 11533, 7, { 0x211B, 0x0000 } }, // realine
+  { 11540, 8, { 0x211C, 0x0000 } }, // realpart
+  { 11548, 5, { 0x211D, 0x0000 } }, // reals
+  { 11553, 4, { 0x25AD, 0x0000 } }, // rect
+  { 11557, 3, { 0x00AE, 0x0000 } }, // reg
+  { 11560, 6, { 0x297D, 0x0000 } }, // rfisht
+  { 11566, 6, { 0x230B, 0x0000 } }, // rfloor
+  { 11572, 3, { 0x1D52F, 0x0000 } }, // rfr
+  { 11575, 5, { 0x21C1, 0x0000 } }, // rhard
+  { 11580, 5, { 0x21C0, 0x0000 } }, // rharu
+  { 11585, 6, { 0x296C, 0x0000 } }, // rharul
+  { 11591, 3, { 0x03C1, 0x0000 } }, // rho
+  { 11594, 4, { 0x03F1, 0x0000 } }, // rhov
+  { 11598, 10, { 0x2192, 0x0000 } }, // rightarrow
+  { 11608, 14, { 0x21A3, 0x0000 } }, // rightarrowtail
+  { 11622, 16, { 0x21C1, 0x0000 } }, // rightharpoondown
+  { 11638, 14, { 0x21C0, 0x0000 } }, // rightharpoonup
+  { 11652, 15, { 0x21C4, 0x0000 } }, // rightleftarrows
+  { 11667, 17, { 0x21CC, 0x0000 } }, // rightleftharpoons
+  { 11684, 16, { 0x21C9, 0x0000 } }, // rightrightarrows
+  { 11700, 15, { 0x219D, 0x0000 } }, // rightsquigarrow
+  { 11715, 15, { 0x22CC, 0x0000 } }, // rightthreetimes
+  { 11730, 4, { 0x02DA, 0x0000 } }, // ring
+  { 11734, 12, { 0x2253, 0x0000 } }, // risingdotseq
+  { 11746, 5, { 0x21C4, 0x0000 } }, // rlarr
+  { 11751, 5, { 0x21CC, 0x0000 } }, // rlhar
+  { 11756, 3, { 0x200F, 0x0000 } }, // rlm
+  { 11759, 6, { 0x23B1, 0x0000 } }, // rmoust
+  { 11765, 10, { 0x23B1, 0x0000 } }, // rmoustache
+  { 11775, 5, { 0x2AEE, 0x0000 } }, // rnmid
+  { 11780, 5, { 0x27ED, 0x0000 } }, // roang
+  { 11785, 5, { 0x21FE, 0x0000 } }, // roarr
+  { 11790, 5, { 0x27E7, 0x0000 } }, // robrk
+  { 11795, 5, { 0x2986, 0x0000 } }, // ropar
+  { 11800, 4, { 0x1D563, 0x0000 } }, // ropf
+  { 11804, 6, { 0x2A2E, 0x0000 } }, // roplus
+  { 11810, 7, { 0x2A35, 0x0000 } }, // rotimes
+  { 11817, 4, { 0x0029, 0x0000 } }, // rpar
+  { 11821, 6, { 0x2994, 0x0000 } }, // rpargt
+  { 11827, 8, { 0x2A12, 0x0000 } }, // rppolint
+  { 11835, 5, { 0x21C9, 0x0000 } }, // rrarr
+  { 11840, 6, { 0x203A, 0x0000 } }, // rsaquo
+  { 11846, 4, { 0x1D4C7, 0x0000 } }, // rscr
+  { 11850, 3, { 0x21B1, 0x0000 } }, // rsh
+  { 11853, 4, { 0x005D, 0x0000 } }, // rsqb
+  { 11857, 5, { 0x2019, 0x0000 } }, // rsquo
+  { 11862, 6, { 0x2019, 0x0000 } }, // rsquor
+  { 11868, 6, { 0x22CC, 0x0000 } }, // rthree
+  { 11874, 6, { 0x22CA, 0x0000 } }, // rtimes
+  { 11880, 4, { 0x25B9, 0x0000 } }, // rtri
+  { 11884, 5, { 0x22B5, 0x0000 } }, // rtrie
+  { 11889, 5, { 0x25B8, 0x0000 } }, // rtrif
+  { 11894, 8, { 0x29CE, 0x0000 } }, // rtriltri
+  { 11902, 7, { 0x2968, 0x0000 } }, // ruluhar
+  { 11909, 2, { 0x211E, 0x0000 } }, // rx
+  { 11911, 6, { 0x015B, 0x0000 } }, // sacute
+  { 11917, 5, { 0x201A, 0x0000 } }, // sbquo
+  { 11922, 2, { 0x227B, 0x0000 } }, // sc
+  { 11924, 3, { 0x2AB4, 0x0000 } }, // scE
+  { 11927, 4, { 0x2AB8, 0x0000 } }, // scap
+  { 11931, 6, { 0x0161, 0x0000 } }, // scaron
+  { 11937, 5, { 0x227D, 0x0000 } }, // sccue
+  { 11942, 3, { 0x2AB0, 0x0000 } }, // sce
+  { 11945, 6, { 0x015F, 0x0000 } }, // scedil
+  { 11951, 5, { 0x015D, 0x0000 } }, // scirc
+  { 11956, 4, { 0x2AB6, 0x0000 } }, // scnE
+  { 11960, 5, { 0x2ABA, 0x0000 } }, // scnap
+  { 11965, 6, { 0x22E9, 0x0000 } }, // scnsim
+  { 11971, 8, { 0x2A13, 0x0000 } }, // scpolint
+  { 11979, 5, { 0x227F, 0x0000 } }, // scsim
+  { 11984, 3, { 0x0441, 0x0000 } }, // scy
+  { 11987, 4, { 0x22C5, 0x0000 } }, // sdot
+  { 11991, 5, { 0x22A1, 0x0000 } }, // sdotb
+  { 11996, 5, { 0x2A66, 0x0000 } }, // sdote
+  { 12001, 5, { 0x21D8, 0x0000 } }, // seArr
+  { 12006, 6, { 0x2925, 0x0000 } }, // searhk
+  { 12012, 5, { 0x2198, 0x0000 } }, // searr
+  { 12017, 7, { 0x2198, 0x0000 } }, // searrow
+  { 12024, 4, { 0x00A7, 0x0000 } }, // sect
+  { 12028, 4, { 0x003B, 0x0000 } }, // semi
+  { 12032, 6, { 0x2929, 0x0000 } }, // seswar
+  { 12038, 8, { 0x2216, 0x0000 } }, // setminus
+  { 12046, 5, { 0x2216, 0x0000 } }, // setmn
+  { 12051, 4, { 0x2736, 0x0000 } }, // sext
+  { 12055, 3, { 0x1D530, 0x0000 } }, // sfr
+  { 12058, 6, { 0x2322, 0x0000 } }, // sfrown
+  { 12064, 5, { 0x266F, 0x0000 } }, // sharp
+  { 12069, 6, { 0x0449, 0x0000 } }, // shchcy
+  { 12075, 4, { 0x0448, 0x0000 } }, // shcy
+  { 12079, 8, { 0x2223, 0x0000 } }, // shortmid
+  { 12087, 13, { 0x2225, 0x0000 } }, // shortparallel
+  { 12100, 3, { 0x00AD, 0x0000 } }, // shy
+  { 12103, 5, { 0x03C3, 0x0000 } }, // sigma
+  { 12108, 6, { 0x03C2, 0x0000 } }, // sigmaf
+  { 12114, 6, { 0x03C2, 0x0000 } }, // sigmav
+  { 12120, 3, { 0x223C, 0x0000 } }, // sim
+  { 12123, 6, { 0x2A6A, 0x0000 } }, // simdot
+  { 12129, 4, { 0x2243, 0x0000 } }, // sime
+  { 12133, 5, { 0x2243, 0x0000 } }, // simeq
+  { 12138, 4, { 0x2A9E, 0x0000 } }, // simg
+  { 12142, 5, { 0x2AA0, 0x0000 } }, // simgE
+  { 12147, 4, { 0x2A9D, 0x0000 } }, // siml
+  { 12151, 5, { 0x2A9F, 0x0000 } }, // simlE
+  { 12156, 5, { 0x2246, 0x0000 } }, // simne
+  { 12161, 7, { 0x2A24, 0x0000 } }, // simplus
+  { 12168, 7, { 0x2972, 0x0000 } }, // simrarr
+  { 12175, 5, { 0x2190, 0x0000 } }, // slarr
+  { 12180, 13, { 0x2216, 0x0000 } }, // smallsetminus
+  { 12193, 6, { 0x2A33, 0x0000 } }, // smashp
+  { 12199, 8, { 0x29E4, 0x0000 } }, // smeparsl
+  { 12207, 4, { 0x2223, 0x0000 } }, // smid
+  { 12211, 5, { 0x2323, 0x0000 } }, // smile
+  { 12216, 3, { 0x2AAA, 0x0000 } }, // smt
+  { 12219, 4, { 0x2AAC, 0x0000 } }, // smte
+  { 12223, 5, { 0x2AAC, 0xFE00 } }, // smtes
+  { 12228, 6, { 0x044C, 0x0000 } }, // softcy
+  { 12234, 3, { 0x002F, 0x0000 } }, // sol
+  { 12237, 4, { 0x29C4, 0x0000 } }, // solb
+  { 12241, 6, { 0x233F, 0x0000 } }, // solbar
+  { 12247, 4, { 0x1D564, 0x0000 } }, // sopf
+  { 12251, 6, { 0x2660, 0x0000 } }, // spades
+  { 12257, 9, { 0x2660, 0x0000 } }, // spadesuit
+  { 12266, 4, { 0x2225, 0x0000 } }, // spar
+  { 12270, 5, { 0x2293, 0x0000 } }, // sqcap
+  { 12275, 6, { 0x2293, 0xFE00 } }, // sqcaps
+  { 12281, 5, { 0x2294, 0x0000 } }, // sqcup
+  { 12286, 6, { 0x2294, 0xFE00 } }, // sqcups
+  { 12292, 5, { 0x228F, 0x0000 } }, // sqsub
+  { 12297, 6, { 0x2291, 0x0000 } }, // sqsube
+  { 12303, 8, { 0x228F, 0x0000 } }, // sqsubset
+  { 12311, 10, { 0x2291, 0x0000 } }, // sqsubseteq
+  { 12321, 5, { 0x2290, 0x0000 } }, // sqsup
+  { 12326, 6, { 0x2292, 0x0000 } }, // sqsupe
+  { 12332, 8, { 0x2290, 0x0000 } }, // sqsupset
+  { 12340, 10, { 0x2292, 0x0000 } }, // sqsupseteq
+  { 12350, 3, { 0x25A1, 0x0000 } }, // squ
+  { 12353, 6, { 0x25A1, 0x0000 } }, // square
+  { 12359, 6, { 0x25AA, 0x0000 } }, // squarf
+  { 12365, 4, { 0x25AA, 0x0000 } }, // squf
+  { 12369, 5, { 0x2192, 0x0000 } }, // srarr
+  { 12374, 4, { 0x1D4C8, 0x0000 } }, // sscr
+  { 12378, 6, { 0x2216, 0x0000 } }, // ssetmn
+  { 12384, 6, { 0x2323, 0x0000 } }, // ssmile
+  { 12390, 6, { 0x22C6, 0x0000 } }, // sstarf
+  { 12396, 4, { 0x2606, 0x0000 } }, // star
+  { 12400, 5, { 0x2605, 0x0000 } }, // starf
+  { 12405, 15, { 0x03F5, 0x0000 } }, // straightepsilon
+  { 12420, 11, { 0x03D5, 0x0000 } }, // straightphi
+  { 12431, 5, { 0x00AF, 0x0000 } }, // strns
+  { 12436, 3, { 0x2282, 0x0000 } }, // sub
+  { 12439, 4, { 0x2AC5, 0x0000 } }, // subE
+  { 12443, 6, { 0x2ABD, 0x0000 } }, // subdot
+  { 12449, 4, { 0x2286, 0x0000 } }, // sube
+  { 12453, 7, { 0x2AC3, 0x0000 } }, // subedot
+  { 12460, 7, { 0x2AC1, 0x0000 } }, // submult
+  { 12467, 5, { 0x2ACB, 0x0000 } }, // subnE
+  { 12472, 5, { 0x228A, 0x0000 } }, // subne
+  { 12477, 7, { 0x2ABF, 0x0000 } }, // subplus
+  { 12484, 7, { 0x2979, 0x0000 } }, // subrarr
+  { 12491, 6, { 0x2282, 0x0000 } }, // subset
+  { 12497, 8, { 0x2286, 0x0000 } }, // subseteq
+  { 12505, 9, { 0x2AC5, 0x0000 } }, // subseteqq
+  { 12514, 9, { 0x228A, 0x0000 } }, // subsetneq
+  { 12523, 10, { 0x2ACB, 0x0000 } }, // subsetneqq
+  { 12533, 6, { 0x2AC7, 0x0000 } }, // subsim
+  { 12539, 6, { 0x2AD5, 0x0000 } }, // subsub
+  { 12545, 6, { 0x2AD3, 0x0000 } }, // subsup
+  { 12551, 4, { 0x227B, 0x0000 } }, // succ
+  { 12555, 10, { 0x2AB8, 0x0000 } }, // succapprox
+  { 12565, 11, { 0x227D, 0x0000 } }, // succcurlyeq
+  { 12576, 6, { 0x2AB0, 0x0000 } }, // succeq
+  { 12582, 11, { 0x2ABA, 0x0000 } }, // succnapprox
+  { 12593, 8, { 0x2AB6, 0x0000 } }, // succneqq
+  { 12601, 8, { 0x22E9, 0x0000 } }, // succnsim
+  { 12609, 7, { 0x227F, 0x0000 } }, // succsim
+  { 12616, 3, { 0x2211, 0x0000 } }, // sum
+  { 12619, 4, { 0x266A, 0x0000 } }, // sung
+  { 12623, 3, { 0x2283, 0x0000 } }, // sup
+  { 12626, 4, { 0x00B9, 0x0000 } }, // sup1
+  { 12630, 4, { 0x00B2, 0x0000 } }, // sup2
+  { 12634, 4, { 0x00B3, 0x0000 } }, // sup3
+  { 12638, 4, { 0x2AC6, 0x0000 } }, // supE
+  { 12642, 6, { 0x2ABE, 0x0000 } }, // supdot
+  { 12648, 7, { 0x2AD8, 0x0000 } }, // supdsub
+  { 12655, 4, { 0x2287, 0x0000 } }, // supe
+  { 12659, 7, { 0x2AC4, 0x0000 } }, // supedot
+  { 12666, 7, { 0x27C9, 0x0000 } }, // suphsol
+  { 12673, 7, { 0x2AD7, 0x0000 } }, // suphsub
+  { 12680, 7, { 0x297B, 0x0000 } }, // suplarr
+  { 12687, 7, { 0x2AC2, 0x0000 } }, // supmult
+  { 12694, 5, { 0x2ACC, 0x0000 } }, // supnE
+  { 12699, 5, { 0x228B, 0x0000 } }, // supne
+  { 12704, 7, { 0x2AC0, 0x0000 } }, // supplus
+  { 12711, 6, { 0x2283, 0x0000 } }, // supset
+  { 12717, 8, { 0x2287, 0x0000 } }, // supseteq
+  { 12725, 9, { 0x2AC6, 0x0000 } }, // supseteqq
+  { 12734, 9, { 0x228B, 0x0000 } }, // supsetneq
+  { 12743, 10, { 0x2ACC, 0x0000 } }, // supsetneqq
+  { 12753, 6, { 0x2AC8, 0x0000 } }, // supsim
+  { 12759, 6, { 0x2AD4, 0x0000 } }, // supsub
+  { 12765, 6, { 0x2AD6, 0x0000 } }, // supsup
+  { 12771, 5, { 0x21D9, 0x0000 } }, // swArr
+  { 12776, 6, { 0x2926, 0x0000 } }, // swarhk
+  { 12782, 5, { 0x2199, 0x0000 } }, // swarr
+  { 12787, 7, { 0x2199, 0x0000 } }, // swarrow
+  { 12794, 6, { 0x292A, 0x0000 } }, // swnwar
+  { 12800, 5, { 0x00DF, 0x0000 } }, // szlig
+  { 12805, 6, { 0x2316, 0x0000 } }, // target
+  { 12811, 3, { 0x03C4, 0x0000 } }, // tau
+  { 12814, 4, { 0x23B4, 0x0000 } }, // tbrk
+  { 12818, 6, { 0x0165, 0x0000 } }, // tcaron
+  { 12824, 6, { 0x0163, 0x0000 } }, // tcedil
+  { 12830, 3, { 0x0442, 0x0000 } }, // tcy
+  { 12833, 4, { 0x20DB, 0x0000 } }, // tdot
+  { 12837, 6, { 0x2315, 0x0000 } }, // telrec
+  { 12843, 3, { 0x1D531, 0x0000 } }, // tfr
+  { 12846, 6, { 0x2234, 0x0000 } }, // there4
+  { 12852, 9, { 0x2234, 0x0000 } }, // therefore
+  { 12861, 5, { 0x03B8, 0x0000 } }, // theta
+  { 12866, 8, { 0x03D1, 0x0000 } }, // thetasym
+  { 12874, 6, { 0x03D1, 0x0000 } }, // thetav
+  { 12880, 11, { 0x2248, 0x0000 } }, // thickapprox
+  { 12891, 8, { 0x223C, 0x0000 } }, // thicksim
+  { 12899, 6, { 0x2009, 0x0000 } }, // thinsp
+  { 12905, 5, { 0x2248, 0x0000 } }, // thkap
+  { 12910, 6, { 0x223C, 0x0000 } }, // thksim
+  { 12916, 5, { 0x00FE, 0x0000 } }, // thorn
+  { 12921, 5, { 0x02DC, 0x0000 } }, // tilde
+  { 12926, 5, { 0x00D7, 0x0000 } }, // times
+  { 12931, 6, { 0x22A0, 0x0000 } }, // timesb
+  { 12937, 8, { 0x2A31, 0x0000 } }, // timesbar
+  { 12945, 6, { 0x2A30, 0x0000 } }, // timesd
+  { 12951, 4, { 0x222D, 0x0000 } }, // tint
+  { 12955, 4, { 0x2928, 0x0000 } }, // toea
+  { 12959, 3, { 0x22A4, 0x0000 } }, // top
+  { 12962, 6, { 0x2336, 0x0000 } }, // topbot
+  { 12968, 6, { 0x2AF1, 0x0000 } }, // topcir
+  { 12974, 4, { 0x1D565, 0x0000 } }, // topf
+  { 12978, 7, { 0x2ADA, 0x0000 } }, // topfork
+  { 12985, 4, { 0x2929, 0x0000 } }, // tosa
+  { 12989, 6, { 0x2034, 0x0000 } }, // tprime
+  { 12995, 5, { 0x2122, 0x0000 } }, // trade
+  { 13000, 8, { 0x25B5, 0x0000 } }, // triangle
+  { 13008, 12, { 0x25BF, 0x0000 } }, // triangledown
+  { 13020, 12, { 0x25C3, 0x0000 } }, // triangleleft
+  { 13032, 14, { 0x22B4, 0x0000 } }, // trianglelefteq
+  { 13046, 9, { 0x225C, 0x0000 } }, // triangleq
+  { 13055, 13, { 0x25B9, 0x0000 } }, // triangleright
+  { 13068, 15, { 0x22B5, 0x0000 } }, // trianglerighteq
+  { 13083, 6, { 0x25EC, 0x0000 } }, // tridot
+  { 13089, 4, { 0x225C, 0x0000 } }, // trie
+  { 13093, 8, { 0x2A3A, 0x0000 } }, // triminus
+  { 13101, 7, { 0x2A39, 0x0000 } }, // triplus
+  { 13108, 5, { 0x29CD, 0x0000 } }, // trisb
+  { 13113, 7, { 0x2A3B, 0x0000 } }, // tritime
+  { 13120, 8, { 0x23E2, 0x0000 } }, // trpezium
+  { 13128, 4, { 0x1D4C9, 0x0000 } }, // tscr
+  { 13132, 4, { 0x0446, 0x0000 } }, // tscy
+  { 13136, 5, { 0x045B, 0x0000 } }, // tshcy
+  { 13141, 6, { 0x0167, 0x0000 } }, // tstrok
+  { 13147, 5, { 0x226C, 0x0000 } }, // twixt
+  { 13152, 16, { 0x219E, 0x0000 } }, // twoheadleftarrow
+  { 13168, 17, { 0x21A0, 0x0000 } }, // twoheadrightarrow
+  { 13185, 4, { 0x21D1, 0x0000 } }, // uArr
+  { 13189, 4, { 0x2963, 0x0000 } }, // uHar
+  { 13193, 6, { 0x00FA, 0x0000 } }, // uacute
+  { 13199, 4, { 0x2191, 0x0000 } }, // uarr
+  { 13203, 5, { 0x045E, 0x0000 } }, // ubrcy
+  { 13208, 6, { 0x016D, 0x0000 } }, // ubreve
+  { 13214, 5, { 0x00FB, 0x0000 } }, // ucirc
+  { 13219, 3, { 0x0443, 0x0000 } }, // ucy
+  { 13222, 5, { 0x21C5, 0x0000 } }, // udarr
+  { 13227, 6, { 0x0171, 0x0000 } }, // udblac
+  { 13233, 5, { 0x296E, 0x0000 } }, // udhar
+  { 13238, 6, { 0x297E, 0x0000 } }, // ufisht
+  { 13244, 3, { 0x1D532, 0x0000 } }, // ufr
+  { 13247, 6, { 0x00F9, 0x0000 } }, // ugrave
+  { 13253, 5, { 0x21BF, 0x0000 } }, // uharl
+  { 13258, 5, { 0x21BE, 0x0000 } }, // uharr
+  { 13263, 5, { 0x2580, 0x0000 } }, // uhblk
+  { 13268, 6, { 0x231C, 0x0000 } }, // ulcorn
+  { 13274, 8, { 0x231C, 0x0000 } }, // ulcorner
+  { 13282, 6, { 0x230F, 0x0000 } }, // ulcrop
+  { 13288, 5, { 0x25F8, 0x0000 } }, // ultri
+  { 13293, 5, { 0x016B, 0x0000 } }, // umacr
+  { 13298, 3, { 0x00A8, 0x0000 } }, // uml
+  { 13301, 5, { 0x0173, 0x0000 } }, // uogon
+  { 13306, 4, { 0x1D566, 0x0000 } }, // uopf
+  { 13310, 7, { 0x2191, 0x0000 } }, // uparrow
+  { 13317, 11, { 0x2195, 0x0000 } }, // updownarrow
+  { 13328, 13, { 0x21BF, 0x0000 } }, // upharpoonleft
+  { 13341, 14, { 0x21BE, 0x0000 } }, // upharpoonright
+  { 13355, 5, { 0x228E, 0x0000 } }, // uplus
+  { 13360, 4, { 0x03C5, 0x0000 } }, // upsi
+  { 13364, 5, { 0x03D2, 0x0000 } }, // upsih
+  { 13369, 7, { 0x03C5, 0x0000 } }, // upsilon
+  { 13376, 10, { 0x21C8, 0x0000 } }, // upuparrows
+  { 13386, 6, { 0x231D, 0x0000 } }, // urcorn
+  { 13392, 8, { 0x231D, 0x0000 } }, // urcorner
+  { 13400, 6, { 0x230E, 0x0000 } }, // urcrop
+  { 13406, 5, { 0x016F, 0x0000 } }, // uring
+  { 13411, 5, { 0x25F9, 0x0000 } }, // urtri
+  { 13416, 4, { 0x1D4CA, 0x0000 } }, // uscr
+  { 13420, 5, { 0x22F0, 0x0000 } }, // utdot
+  { 13425, 6, { 0x0169, 0x0000 } }, // utilde
+  { 13431, 4, { 0x25B5, 0x0000 } }, // utri
+  { 13435, 5, { 0x25B4, 0x0000 } }, // utrif
+  { 13440, 5, { 0x21C8, 0x0000 } }, // uuarr
+  { 13445, 4, { 0x00FC, 0x0000 } }, // uuml
+  { 13449, 7, { 0x29A7, 0x0000 } }, // uwangle
+  { 13456, 4, { 0x21D5, 0x0000 } }, // vArr
+  { 13460, 4, { 0x2AE8, 0x0000 } }, // vBar
+  { 13464, 5, { 0x2AE9, 0x0000 } }, // vBarv
+  { 13469, 5, { 0x22A8, 0x0000 } }, // vDash
+  { 13474, 6, { 0x299C, 0x0000 } }, // vangrt
+  { 13480, 10, { 0x03F5, 0x0000 } }, // varepsilon
+  { 13490, 8, { 0x03F0, 0x0000 } }, // varkappa
+  { 13498, 10, { 0x2205, 0x0000 } }, // varnothing
+  { 13508, 6, { 0x03D5, 0x0000 } }, // varphi
+  { 13514, 5, { 0x03D6, 0x0000 } }, // varpi
+  { 13519, 9, { 0x221D, 0x0000 } }, // varpropto
+  { 13528, 4, { 0x2195, 0x0000 } }, // varr
+  { 13532, 6, { 0x03F1, 0x0000 } }, // varrho
+  { 13538, 8, { 0x03C2, 0x0000 } }, // varsigma
+  { 13546, 12, { 0x228A, 0xFE00 } }, // varsubsetneq
+  { 13558, 13, { 0x2ACB, 0xFE00 } }, // varsubsetneqq
+  { 13571, 12, { 0x228B, 0xFE00 } }, // varsupsetneq
+  { 13583, 13, { 0x2ACC, 0xFE00 } }, // varsupsetneqq
+  { 13596, 8, { 0x03D1, 0x0000 } }, // vartheta
+  { 13604, 15, { 0x22B2, 0x0000 } }, // vartriangleleft
+  { 13619, 16, { 0x22B3, 0x0000 } }, // vartriangleright
+  { 13635, 3, { 0x0432, 0x0000 } }, // vcy
+  { 13638, 5, { 0x22A2, 0x0000 } }, // vdash
+  { 13643, 3, { 0x2228, 0x0000 } }, // vee
+  { 13646, 6, { 0x22BB, 0x0000 } }, // veebar
+  { 13652, 5, { 0x225A, 0x0000 } }, // veeeq
+  { 13657, 6, { 0x22EE, 0x0000 } }, // vellip
+  { 13663, 6, { 0x007C, 0x0000 } }, // verbar
+  { 13669, 4, { 0x007C, 0x0000 } }, // vert
+  { 13673, 3, { 0x1D533, 0x0000 } }, // vfr
+  { 13676, 5, { 0x22B2, 0x0000 } }, // vltri
+  { 13681, 5, { 0x2282, 0x20D2 } }, // vnsub
+  { 13686, 5, { 0x2283, 0x20D2 } }, // vnsup
+  { 13691, 4, { 0x1D567, 0x0000 } }, // vopf
+  { 13695, 5, { 0x221D, 0x0000 } }, // vprop
+  { 13700, 5, { 0x22B3, 0x0000 } }, // vrtri
+  { 13705, 4, { 0x1D4CB, 0x0000 } }, // vscr
+  { 13709, 6, { 0x2ACB, 0xFE00 } }, // vsubnE
+  { 13715, 6, { 0x228A, 0xFE00 } }, // vsubne
+  { 13721, 6, { 0x2ACC, 0xFE00 } }, // vsupnE
+  { 13727, 6, { 0x228B, 0xFE00 } }, // vsupne
+  { 13733, 7, { 0x299A, 0x0000 } }, // vzigzag
+  { 13740, 5, { 0x0175, 0x0000 } }, // wcirc
+  { 13745, 6, { 0x2A5F, 0x0000 } }, // wedbar
+  { 13751, 5, { 0x2227, 0x0000 } }, // wedge
+  { 13756, 6, { 0x2259, 0x0000 } }, // wedgeq
+  { 13762, 6, { 0x2118, 0x0000 } }, // weierp
+  { 13768, 3, { 0x1D534, 0x0000 } }, // wfr
+  { 13771, 4, { 0x1D568, 0x0000 } }, // wopf
+  { 13775, 2, { 0x2118, 0x0000 } }, // wp
+  { 13777, 2, { 0x2240, 0x0000 } }, // wr
+  { 13779, 6, { 0x2240, 0x0000 } }, // wreath
+  { 13785, 4, { 0x1D4CC, 0x0000 } }, // wscr
+  { 13789, 4, { 0x22C2, 0x0000 } }, // xcap
+  { 13793, 5, { 0x25EF, 0x0000 } }, // xcirc
+  { 13798, 4, { 0x22C3, 0x0000 } }, // xcup
+  { 13802, 5, { 0x25BD, 0x0000 } }, // xdtri
+  { 13807, 3, { 0x1D535, 0x0000 } }, // xfr
+  { 13810, 5, { 0x27FA, 0x0000 } }, // xhArr
+  { 13815, 5, { 0x27F7, 0x0000 } }, // xharr
+  { 13820, 2, { 0x03BE, 0x0000 } }, // xi
+  { 13822, 5, { 0x27F8, 0x0000 } }, // xlArr
+  { 13827, 5, { 0x27F5, 0x0000 } }, // xlarr
+  { 13832, 4, { 0x27FC, 0x0000 } }, // xmap
+  { 13836, 4, { 0x22FB, 0x0000 } }, // xnis
+  { 13840, 5, { 0x2A00, 0x0000 } }, // xodot
+  { 13845, 4, { 0x1D569, 0x0000 } }, // xopf
+  { 13849, 6, { 0x2A01, 0x0000 } }, // xoplus
+  { 13855, 6, { 0x2A02, 0x0000 } }, // xotime
+  { 13861, 5, { 0x27F9, 0x0000 } }, // xrArr
+  { 13866, 5, { 0x27F6, 0x0000 } }, // xrarr
+  { 13871, 4, { 0x1D4CD, 0x0000 } }, // xscr
+  { 13875, 6, { 0x2A06, 0x0000 } }, // xsqcup
+  { 13881, 6, { 0x2A04, 0x0000 } }, // xuplus
+  { 13887, 5, { 0x25B3, 0x0000 } }, // xutri
+  { 13892, 4, { 0x22C1, 0x0000 } }, // xvee
+  { 13896, 6, { 0x22C0, 0x0000 } }, // xwedge
+  { 13902, 6, { 0x00FD, 0x0000 } }, // yacute
+  { 13908, 4, { 0x044F, 0x0000 } }, // yacy
+  { 13912, 5, { 0x0177, 0x0000 } }, // ycirc
+  { 13917, 3, { 0x044B, 0x0000 } }, // ycy
+  { 13920, 3, { 0x00A5, 0x0000 } }, // yen
+  { 13923, 3, { 0x1D536, 0x0000 } }, // yfr
+  { 13926, 4, { 0x0457, 0x0000 } }, // yicy
+  { 13930, 4, { 0x1D56A, 0x0000 } }, // yopf
+  { 13934, 4, { 0x1D4CE, 0x0000 } }, // yscr
+  { 13938, 4, { 0x044E, 0x0000 } }, // yucy
+  { 13942, 4, { 0x00FF, 0x0000 } }, // yuml
+  { 13946, 6, { 0x017A, 0x0000 } }, // zacute
+  { 13952, 6, { 0x017E, 0x0000 } }, // zcaron
+  { 13958, 3, { 0x0437, 0x0000 } }, // zcy
+  { 13961, 4, { 0x017C, 0x0000 } }, // zdot
+  { 13965, 6, { 0x2128, 0x0000 } }, // zeetrf
+  { 13971, 4, { 0x03B6, 0x0000 } }, // zeta
+  { 13975, 3, { 0x1D537, 0x0000 } }, // zfr
+  { 13978, 4, { 0x0436, 0x0000 } }, // zhcy
+  { 13982, 7, { 0x21DD, 0x0000 } }, // zigrarr
+  { 13989, 4, { 0x1D56B, 0x0000 } }, // zopf
+  { 13993, 4, { 0x1D4CF, 0x0000 } }, // zscr
+  { 13997, 3, { 0x200D, 0x0000 } }, // zwj
+  { 14000, 4, { 0x200C, 0x0000 } }, // zwnj
+};
+
+// Each slot holds an index into RSSHTMLEntities plus one, or 0 if it is empty.
+static const uint16_t RSSHTMLEntitySlots[] = {
+  0, 1183, 0, 0, 0, 0, 0, 0, 1713, 0, 0, 1863, 0, 0, 0, 0,
+  0, 0, 0, 1149, 0, 0, 1365, 0, 0, 0, 0, 0, 0, 0, 0, 883,
+  106, 1079, 0, 0, 0, 0, 0, 39, 0, 0, 0, 0, 1919, 0, 453, 669,
+  0, 1543, 0, 0, 763, 0, 0, 0, 0, 0, 0, 55, 423, 1407, 0, 1399,
+  1329, 813, 0, 0, 0, 0, 0, 0, 0, 509, 0, 0, 1509, 0, 0, 0,
+  0, 0, 0, 0, 1475, 0, 686, 0, 0, 0, 0, 503, 0, 0, 0, 0,
+  0, 1708, 0, 0, 0, 0, 2043, 0, 0, 850, 1311, 0, 0, 0, 0, 1734,
+  0, 0, 0, 0, 0, 0, 0, 0, 497, 2, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 1846, 0, 1418, 0, 0, 0, 0, 0, 0, 1974, 308, 1012, 0,
+  0, 708, 0, 130, 0, 0, 0, 985, 1706, 0, 0, 0, 1124, 1372, 1377, 2054,
+  1076, 946, 0, 0, 0, 0, 1487, 0, 1669, 1066, 0, 604, 1330, 0, 0, 0,
+  968, 1821, 0, 0, 0, 0, 0, 140, 1649, 0, 0, 0, 0, 0, 0, 0,
+  940, 0, 0, 0, 57, 0, 0, 0, 1729, 0, 0, 0, 402, 809, 1611, 793,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 943, 1725, 0, 0, 0, 844, 0,
+  0, 51, 1022, 0, 0, 0, 0, 0, 0, 0, 795, 615, 0, 0, 0, 580,
+  85, 0, 210, 761, 930, 0, 0, 0, 1755, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 1146, 0, 0, 346, 0, 0, 0, 0, 0, 0, 1797, 0, 0, 0,
+  0, 0, 0, 622, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1569, 0, 1193,
+  282, 515, 845, 1123, 0, 1763, 0, 986, 0, 0, 0, 2113, 0, 0, 0, 0,
+  0, 0, 0, 1772, 0, 1860, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 1676, 0, 583, 1025, 0, 0, 2011, 0, 0, 0, 0, 0, 0, 0, 152,
+  0, 0, 0, 0, 0, 0, 647, 0, 0, 607, 857, 0, 0, 0, 0, 0,
+  125, 1154, 0, 0, 0, 439, 992, 0, 0, 59, 0, 0, 0, 0, 0, 1152,
+  0, 0, 0, 0, 0, 0, 0, 0, 429, 0, 0, 0, 0, 1390, 0, 0,
+  0, 0, 0, 0, 0, 2078, 0, 0, 0, 0, 0, 900, 0, 0, 0, 0,
+  0, 0, 0, 290, 0, 0, 1249, 1373, 0, 0, 1327, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 512, 0, 0, 309, 0, 0, 0, 0, 0, 1952, 571,
+  866, 1099, 0, 0, 234, 356, 0, 0, 1128, 0, 0, 0, 174, 1510, 0, 0,
+  2083, 0, 1214, 0, 1239, 0, 0, 0, 1542, 1536, 0, 0, 0, 0, 0, 1035,
+  0, 0, 0, 1225, 1230, 0, 0, 1319, 0, 466, 456, 1434, 1663, 0, 0, 1238,
+  0, 0, 0, 0, 0, 0, 1631, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  2102, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 147,
+  0, 0, 0, 1127, 0, 46, 0, 0, 0, 0, 0, 1442, 0, 544, 1916, 1031,
+  2010, 2090, 1739, 380, 0, 0, 0, 1778, 3, 2034, 0, 0, 0, 0, 0, 1389,
+  0, 1013, 973, 0, 0, 0, 0, 0, 16, 0, 0, 0, 0, 0, 1184, 0,
+  0, 337, 0, 0, 0, 0, 0, 0, 0, 1581, 0, 506, 341, 638, 0, 1537,
+  0, 0, 223, 1711, 0, 0, 0, 0, 0, 49, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 394, 0, 464, 0, 0, 0, 0, 2109,
+  0, 0, 0, 0, 949, 0, 418, 0, 0, 1798, 1209, 0, 0, 0, 0, 0,
+  898, 0, 0, 0, 0, 0, 467, 0, 0, 0, 0, 0, 1496, 1538, 719, 0,
+  0, 0, 1620, 134, 0, 0, 0, 0, 0, 299, 0, 0, 0, 0, 0, 0,
+  296, 384, 2055, 0, 0, 460, 0, 0, 1673, 0, 0, 0, 1421, 0, 1045, 0,
+  0, 0, 395, 1300, 0, 0, 617, 1563, 1986, 0, 0, 747, 0, 0, 1551, 0,
+  0, 0, 0, 70, 0, 1477, 0, 929, 0, 0, 0, 0, 0, 0, 823, 0,
+  1001, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 1553, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 919, 0, 0, 0, 0, 1430, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 1038, 0, 0, 0, 1050, 0, 0, 0, 0, 0, 0, 0, 742, 858,
+  0, 0, 1572, 867, 1326, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 908, 0, 0, 0, 0, 0, 1742, 0, 0, 1540, 0, 0, 0, 0, 0,
+  2110, 0, 0, 0, 0, 0, 0, 0, 0, 1469, 0, 0, 0, 0, 0, 0,
+  207, 2080, 0, 0, 0, 0, 0, 0, 0, 1478, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 1254, 1837, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  2007, 0, 0, 0, 0, 0, 0, 0, 0, 646, 0, 0, 1060, 0, 0, 0,
+  547, 0, 0, 0, 0, 0, 0, 0, 675, 0, 0, 0, 0, 1435, 0, 0,
+  420, 0, 0, 535, 0, 0, 1525, 0, 0, 42, 398, 158, 769, 1834, 0, 270,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 316, 348, 440, 1003, 0, 980, 1143, 1386,
+  0, 0, 1941, 0, 0, 0, 521, 0, 881, 1942, 0, 0, 0, 0, 0, 0,
+  525, 0, 0, 0, 1014, 2121, 162, 1115, 842, 1402, 0, 0, 0, 0, 0, 0,
+  753, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 956, 0, 0, 0, 2005, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 28, 0, 0, 0, 0, 0, 0, 1378, 0, 0, 0, 0,
+  0, 0, 0, 0, 493, 0, 1135, 0, 1587, 0, 0, 24, 204, 661, 0, 261,
+  0, 0, 2112, 703, 0, 1420, 0, 0, 0, 0, 0, 0, 0, 1088, 0, 0,
+  1163, 0, 187, 0, 1689, 1085, 1520, 0, 624, 543, 0, 0, 0, 0, 0, 0,
+  0, 690, 1009, 0, 0, 361, 0, 0, 0, 0, 0, 0, 776, 1589, 0, 355,
+  0, 0, 0, 0, 0, 0, 0, 0, 1464, 0, 733, 564, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1092, 0, 0, 0,
+  0, 265, 0, 0, 966, 0, 0, 0, 0, 1104, 0, 0, 0, 0, 1955, 0,
+  0, 0, 0, 1008, 670, 0, 0, 1298, 0, 0, 0, 713, 0, 0, 0, 221,
+  772, 1205, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 673, 0, 711, 0,
+  1080, 1388, 0, 0, 1227, 1623, 0, 0, 0, 0, 860, 1828, 2122, 0, 0, 1027,
+  0, 0, 0, 0, 1120, 1779, 0, 0, 0, 0, 72, 254, 0, 65, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 117, 0, 0, 0, 0, 0, 1093, 1602, 0, 246,
+  0, 1685, 0, 0, 0, 2117, 0, 678, 0, 0, 0, 0, 0, 0, 501, 0,
+  0, 0, 0, 0, 0, 0, 0, 1485, 0, 918, 0, 0, 0, 363, 0, 0,
+  430, 2097, 0, 965, 476, 0, 0, 1387, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 1109, 0, 0, 1283, 1731, 0, 0, 0, 1761, 1568, 1616, 0, 1557, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 751, 0, 1995, 0,
+  0, 0, 0, 0, 0, 0, 0, 1935, 0, 0, 0, 0, 0, 0, 0, 1002,
+  127, 917, 0, 1963, 0, 1270, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 1138, 0, 368, 902, 0, 0, 0, 0,
+  0, 765, 0, 643, 939, 0, 0, 1015, 0, 0, 0, 5, 0, 0, 0, 0,
+  0, 0, 218, 0, 0, 0, 0, 0, 0, 0, 757, 0, 0, 0, 74, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 1816, 0, 0, 0, 0, 0, 1281, 0,
+  0, 0, 0, 0, 0, 0, 1074, 0, 820, 1006, 1417, 0, 0, 0, 0, 0,
+  400, 0, 1277, 1103, 0, 0, 0, 0, 1825, 1921, 0, 0, 0, 0, 0, 1255,
+  149, 0, 0, 863, 691, 1719, 1810, 0, 0, 1312, 0, 1028, 1604, 0, 0, 0,
+  0, 0, 232, 0, 0, 0, 1625, 1849, 0, 1325, 0, 1251, 0, 0, 1913, 0,
+  0, 1486, 0, 649, 0, 0, 0, 0, 0, 455, 0, 0, 0, 0, 1636, 0,
+  0, 0, 1424, 0, 0, 0, 0, 0, 318, 0, 0, 1463, 0, 0, 1641, 2023,
+  0, 671, 0, 0, 0, 0, 0, 1817, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 1923, 0, 243, 17, 1393, 0, 664,
+  805, 0, 0, 1783, 0, 0, 154, 1155, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 785, 0, 0, 0, 0, 2015, 0, 0, 0, 0, 903,
+  629, 0, 0, 0, 0, 1328, 1216, 249, 0, 0, 0, 0, 0, 0, 0, 855,
+  0, 0, 0, 1981, 2036, 1902, 465, 2006, 0, 0, 0, 1269, 1445, 0, 830, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1490, 390, 1273, 1310, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 636,
+  0, 0, 0, 0, 0, 0, 926, 1808, 0, 1618, 0, 0, 0, 0, 0, 1634,
+  0, 0, 0, 0, 0, 0, 835, 1294, 0, 0, 0, 1530, 382, 0, 0, 0,
+  0, 0, 0, 0, 0, 145, 1615, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 494, 0, 0, 1431, 1169, 0, 0, 0, 0, 0, 0,
+  0, 1361, 0, 0, 0, 0, 0, 129, 0, 0, 1505, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 828, 0, 0, 0, 220, 685, 2085, 0, 0, 0, 0, 0,
+  1457, 1760, 1793, 0, 0, 0, 0, 0, 0, 536, 931, 0, 0, 0, 0, 124,
+  861, 0, 0, 1978, 1858, 2025, 0, 0, 0, 0, 1391, 0, 1586, 0, 859, 1764,
+  0, 0, 0, 0, 0, 0, 0, 0, 1756, 1789, 1016, 0, 0, 0, 0, 0,
+  0, 0, 2081, 150, 0, 0, 0, 0, 1097, 0, 0, 725, 0, 0, 0, 0,
+  0, 273, 0, 545, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 431, 1600, 0, 705, 0, 1474, 0, 0, 1516, 0, 1471, 1724,
+  0, 2093, 0, 0, 550, 779, 0, 0, 381, 0, 0, 0, 121, 824, 0, 240,
+  0, 0, 1472, 0, 0, 38, 40, 0, 768, 213, 310, 195, 0, 0, 1020, 0,
+  0, 0, 0, 1975, 0, 0, 451, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  259, 424, 0, 694, 0, 0, 0, 0, 0, 2115, 404, 0, 0, 0, 0, 196,
+  0, 0, 0, 833, 153, 0, 0, 0, 0, 387, 1176, 1503, 0, 601, 303, 1462,
+  729, 0, 560, 0, 0, 0, 0, 1790, 0, 800, 0, 192, 0, 0, 1207, 680,
+  498, 0, 317, 2048, 0, 230, 0, 933, 1791, 0, 1650, 0, 0, 1112, 1746, 1785,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 370, 0,
+  0, 0, 1906, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 1514, 4, 630, 0, 832, 937, 10, 0, 0, 0, 257, 0, 1381, 739, 0,
+  836, 1323, 1972, 0, 0, 0, 0, 0, 1977, 0, 1897, 0, 0, 0, 0, 0,
+  0, 0, 0, 48, 0, 0, 554, 0, 0, 663, 379, 1645, 0, 0, 0, 0,
+  953, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1989, 0, 2086, 43, 819, 0,
+  0, 0, 0, 452, 0, 0, 0, 0, 0, 1449, 822, 1827, 0, 8, 0, 472,
+  0, 1134, 0, 1585, 2059, 982, 1583, 0, 0, 0, 0, 327, 652, 0, 0, 0,
+  0, 1830, 0, 0, 0, 405, 1964, 0, 909, 0, 19, 0, 0, 0, 0, 0,
+  582, 0, 0, 0, 1268, 0, 0, 320, 0, 0, 0, 0, 0, 1555, 324, 1370,
+  0, 1950, 0, 684, 21, 1815, 0, 0, 0, 0, 0, 0, 157, 0, 0, 0,
+  0, 0, 0, 1340, 1562, 0, 0, 0, 1072, 874, 1287, 0, 0, 0, 0, 788,
+  470, 0, 0, 0, 826, 0, 745, 0, 1922, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 1965, 0, 1096, 0, 0, 0, 0, 0, 1748, 0, 0, 0, 0, 0, 0,
+  1427, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1591, 0, 0,
+  0, 0, 1640, 0, 0, 1823, 0, 123, 0, 1915, 714, 0, 1567, 1871, 1758, 0,
+  0, 0, 0, 0, 47, 532, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 1091, 0, 0, 0, 0, 1744, 0, 0, 0, 0, 0, 0,
+  0, 0, 1578, 31, 0, 0, 1948, 534, 1081, 1802, 1969, 1927, 0, 0, 0, 393,
+  567, 1021, 2118, 1757, 0, 0, 0, 1994, 0, 0, 0, 241, 0, 0, 0, 0,
+  0, 0, 574, 1582, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  921, 1759, 0, 0, 0, 0, 1768, 0, 0, 0, 2060, 0, 1129, 1529, 0, 0,
+  0, 1158, 1479, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1954, 0, 0, 0,
+  0, 1848, 0, 0, 1903, 0, 0, 409, 1682, 0, 737, 0, 0, 0, 0, 0,
+  0, 0, 1164, 0, 408, 0, 83, 354, 1394, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 519, 0, 0, 0, 0, 0, 0, 0, 1034, 0, 326, 236, 0, 0,
+  0, 1532, 0, 0, 0, 0, 537, 126, 631, 1243, 2120, 0, 0, 375, 0, 0,
+  0, 700, 0, 0, 0, 0, 102, 1515, 565, 957, 0, 0, 0, 0, 0, 0,
+  445, 1492, 0, 0, 0, 871, 1707, 1286, 0, 0, 0, 0, 540, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2004, 0, 1968,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 1573, 0, 0, 0, 383, 0, 0, 0, 0, 161, 0, 1403,
+  1664, 1439, 1901, 0, 449, 1222, 0, 0, 1368, 0, 2091, 1356, 0, 0, 315, 0,
+  0, 0, 1345, 0, 0, 0, 0, 0, 0, 0, 1110, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 1360, 0, 1996, 0, 0, 0, 0, 0, 0,
+  1358, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 781, 1662, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 333, 371, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 1818, 2028, 0, 274, 984, 1049, 0, 0, 0, 0, 0, 0, 0, 0, 1395,
+  1187, 0, 0, 0, 1075, 1940, 0, 1316, 1795, 0, 0, 0, 752, 807, 0, 0,
+  0, 0, 1847, 0, 1843, 0, 852, 275, 505, 1, 1335, 442, 1398, 0, 0, 268,
+  0, 224, 1065, 0, 0, 0, 0, 0, 0, 1534, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 1556, 0, 952, 0, 332, 504, 1344, 0, 1317, 0, 0, 0, 0,
+  0, 0, 0, 68, 801, 634, 831, 1630, 0, 0, 0, 0, 169, 0, 1220, 1346,
+  0, 0, 1341, 165, 0, 0, 1813, 0, 0, 0, 0, 0, 0, 0, 0, 1482,
+  1182, 0, 0, 414, 0, 799, 0, 0, 1671, 653, 1037, 0, 0, 0, 0, 0,
+  1095, 1456, 0, 0, 0, 0, 0, 0, 0, 1290, 1842, 0, 0, 0, 0, 0,
+  0, 1226, 1100, 1904, 7, 1605, 0, 0, 0, 0, 0, 0, 0, 0, 0, 300,
+  0, 2037, 0, 932, 0, 0, 0, 0, 1639, 0, 0, 0, 0, 0, 0, 0,
+  69, 0, 977, 0, 0, 0, 2072, 557, 0, 0, 0, 0, 357, 0, 0, 0,
+  0, 0, 0, 1053, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 1320, 0, 0, 0, 602, 632, 0, 0, 0, 0, 0, 0,
+  0, 1248, 132, 2047, 0, 436, 0, 0, 0, 0, 0, 0, 0, 0, 1710, 0,
+  0, 0, 0, 1854, 0, 0, 0, 1064, 0, 0, 0, 0, 0, 1321, 1721, 0,
+  0, 0, 0, 67, 0, 0, 0, 0, 1271, 0, 0, 0, 0, 0, 0, 0,
+  1493, 0, 314, 0, 0, 0, 0, 0, 1162, 0, 0, 1106, 2124, 0, 0, 0,
+  0, 0, 0, 0, 469, 750, 0, 0, 425, 0, 0, 0, 0, 0, 0, 0,
+  401, 0, 0, 0, 391, 306, 0, 0, 0, 0, 712, 0, 1980, 0, 1732, 1899,
+  1621, 0, 0, 0, 0, 0, 0, 0, 0, 1624, 0, 0, 0, 566, 0, 61,
+  0, 0, 0, 1677, 0, 0, 0, 2103, 897, 1697, 0, 935, 0, 0, 0, 1224,
+  1867, 0, 0, 1473, 0, 171, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 964, 0, 0, 0, 936, 1349, 2088, 1997, 0, 0, 227, 0, 0,
+  0, 0, 0, 531, 0, 0, 0, 0, 0, 0, 1198, 0, 0, 0, 0, 0,
+  0, 0, 1627, 1999, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 136,
+  2062, 0, 113, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 806,
+  1575, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 516, 1351, 1929, 0,
+  715, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1343, 1054, 0, 142, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  1675, 0, 672, 1082, 1912, 0, 0, 0, 0, 1524, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 336, 0, 0, 0, 0, 0, 0, 783, 0, 1284, 0,
+  0, 0, 1609, 0, 0, 0, 22, 0, 0, 0, 0, 810, 0, 0, 90, 0,
+  0, 0, 172, 0, 0, 0, 0, 0, 286, 0, 229, 0, 0, 0, 0, 105,
+  1990, 0, 1223, 1305, 0, 0, 1052, 2001, 0, 893, 0, 291, 0, 0, 0, 0,
+  219, 0, 1700, 0, 0, 0, 0, 1550, 0, 179, 0, 0, 0, 0, 0, 0,
+  738, 1648, 0, 1914, 0, 0, 0, 0, 0, 496, 0, 0, 0, 0, 877, 1857,
+  0, 0, 0, 0, 0, 0, 0, 0, 593, 0, 156, 0, 1723, 539, 2038, 0,
+  0, 0, 0, 1976, 0, 876, 0, 13, 0, 0, 0, 1970, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 1908, 473, 37, 0, 0, 0, 0, 0, 0, 0, 914,
+  0, 0, 0, 0, 0, 808, 0, 0, 0, 0, 0, 0, 0, 0, 0, 586,
+  746, 0, 0, 0, 0, 115, 0, 0, 1453, 0, 659, 1090, 0, 0, 0, 0,
+  0, 0, 0, 559, 0, 92, 278, 1559, 0, 0, 0, 0, 0, 0, 0, 0,
+  2030, 0, 297, 0, 0, 0, 0, 0, 0, 260, 0, 0, 0, 0, 0, 0,
+  111, 0, 667, 0, 0, 0, 0, 1261, 0, 0, 0, 0, 1704, 0, 0, 0,
+  0, 0, 623, 1773, 710, 1548, 0, 0, 0, 0, 360, 0, 0, 0, 1308, 0,
+  0, 962, 1679, 0, 0, 0, 1910, 0, 0, 0, 0, 0, 0, 0, 1928, 0,
+  0, 1292, 1683, 0, 0, 1720, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 1523, 0, 589, 0, 0, 0, 1666, 1926, 0, 0, 1869,
+  1733, 875, 0, 0, 1263, 777, 0, 1718, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 392, 0, 0, 0, 0, 489, 0, 0, 0, 0, 0, 0, 0, 0,
+  1535, 1212, 0, 0, 0, 0, 865, 1440, 1809, 0, 0, 0, 0, 1315, 0, 0,
+  0, 1379, 0, 1835, 0, 0, 0, 0, 0, 301, 0, 0, 492, 0, 0, 0,
+  0, 0, 0, 1907, 0, 0, 11, 0, 0, 0, 0, 0, 0, 1204, 0, 1861,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1803, 35, 474, 298, 2070, 258,
+  1696, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 53, 520, 0, 1489,
+  621, 1413, 0, 0, 561, 704, 0, 1614, 0, 0, 872, 0, 214, 1839, 0, 0,
+  0, 0, 600, 1375, 0, 0, 0, 0, 0, 1643, 56, 2111, 0, 0, 0, 205,
+  0, 0, 160, 773, 976, 1784, 60, 1101, 0, 0, 1544, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 620, 0, 613, 728, 0, 1157, 0,
+  0, 635, 0, 0, 0, 0, 2019, 0, 0, 2067, 0, 0, 0, 0, 0, 0,
+  0, 252, 0, 0, 0, 2071, 0, 0, 0, 1406, 0, 0, 0, 0, 513, 0,
+  0, 0, 0, 0, 0, 0, 0, 1083, 0, 840, 815, 1040, 1055, 2021, 0, 1259,
+  0, 0, 1188, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 626,
+  0, 0, 0, 330, 0, 882, 0, 0, 0, 0, 0, 0, 0, 0, 696, 0,
+  0, 0, 0, 0, 0, 978, 0, 0, 0, 0, 18, 0, 0, 0, 0, 1235,
+  350, 0, 0, 0, 2045, 0, 913, 1111, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 1197, 0, 880, 0, 0, 0, 1875, 1528, 0, 0, 0, 0, 0,
+  0, 0, 208, 0, 426, 0, 399, 1018, 0, 0, 0, 0, 0, 0, 0, 2061,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 590, 0, 0, 1776, 0,
+  0, 0, 0, 2002, 0, 0, 0, 0, 0, 1956, 1314, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 1678, 0, 0, 1592, 0, 0, 186, 0, 578, 0, 0,
+  0, 0, 1626, 181, 925, 1502, 1807, 1571, 0, 0, 0, 0, 0, 0, 0, 825,
+  0, 0, 1480, 0, 0, 0, 994, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 1397, 0, 0, 0, 0, 0, 0, 0, 899, 0, 0, 0, 0, 0, 0,
+  347, 0, 1179, 0, 0, 0, 0, 0, 416, 1531, 0, 0, 0, 0, 0, 0,
+  1272, 0, 1032, 0, 1148, 1943, 2065, 0, 0, 0, 0, 0, 0, 0, 905, 0,
+  0, 0, 0, 0, 0, 0, 0, 1280, 0, 0, 0, 0, 0, 0, 0, 522,
+  0, 0, 1382, 0, 0, 648, 995, 0, 0, 0, 0, 0, 0, 0, 377, 1574,
+  1740, 0, 0, 0, 0, 0, 0, 0, 971, 0, 76, 0, 0, 0, 0, 444,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 1192, 1306, 0, 0, 0, 1279, 0,
+  0, 0, 0, 0, 0, 0, 0, 99, 1603, 0, 0, 0, 0, 0, 131, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 331, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 1408, 183, 1078, 1208, 0, 0, 242, 264, 1738,
+  0, 1787, 0, 0, 191, 0, 0, 0, 0, 2066, 0, 0, 253, 1665, 972, 0,
+  0, 0, 1228, 0, 0, 0, 448, 0, 1699, 237, 0, 581, 271, 2096, 0, 0,
+  0, 0, 0, 459, 0, 724, 0, 0, 1973, 376, 0, 0, 1500, 0, 0, 0,
+  1211, 0, 176, 0, 0, 0, 0, 0, 0, 0, 32, 0, 0, 0, 0, 0,
+  0, 556, 1859, 231, 0, 0, 0, 2032, 0, 0, 0, 0, 0, 435, 0, 0,
+  0, 0, 627, 0, 0, 0, 1236, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 594, 0, 0, 0, 471, 611, 0, 0, 0, 0, 0,
+  0, 722, 1722, 0, 0, 0, 0, 0, 0, 95, 0, 0, 0, 479, 0, 0,
+  0, 999, 1342, 1147, 277, 770, 0, 0, 0, 0, 0, 0, 1824, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 373, 0, 1409, 0, 1887, 1282, 1191, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 2012, 0, 1153, 71, 54, 302, 417, 0,
+  0, 0, 0, 0, 0, 0, 0, 912, 0, 372, 0, 0, 1743, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 869, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 250, 0, 0, 0, 0, 0, 950, 369, 0, 0, 1404, 0, 1185, 0, 0,
+  0, 0, 0, 0, 0, 0, 262, 0, 0, 0, 0, 0, 1961, 0, 0, 0,
+  0, 741, 0, 0, 0, 0, 0, 1629, 1458, 0, 1232, 0, 0, 294, 0, 0,
+  1959, 0, 0, 0, 0, 879, 1877, 461, 0, 0, 0, 0, 0, 0, 0, 0,
+  1044, 0, 0, 0, 0, 0, 0, 389, 637, 0, 0, 0, 1588, 0, 0, 0,
+  0, 285, 553, 0, 344, 0, 0, 1911, 0, 0, 0, 0, 0, 1714, 0, 0,
+  485, 0, 0, 0, 1895, 0, 0, 0, 0, 0, 1862, 0, 0, 0, 0, 734,
+  0, 0, 0, 2018, 0, 0, 0, 120, 0, 1168, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 1957, 843, 0, 100, 500, 0, 0, 1465, 0, 0, 0,
+  0, 0, 0, 605, 2040, 0, 0, 1576, 546, 1769, 541, 1933, 0, 1411, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 891, 854, 0, 0, 598, 0, 0, 1299, 0,
+  0, 0, 0, 1852, 0, 482, 0, 0, 0, 0, 0, 0, 122, 928, 0, 0,
+  0, 0, 0, 0, 1788, 0, 0, 0, 411, 0, 0, 0, 0, 0, 0, 1595,
+  1017, 0, 1750, 0, 0, 0, 0, 2106, 0, 0, 0, 0, 0, 0, 0, 0,
+  1841, 0, 0, 0, 0, 1655, 0, 963, 0, 0, 255, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  803, 0, 0, 0, 0, 628, 0, 52, 88, 212, 1596, 0, 0, 849, 0, 0,
+  0, 0, 1186, 103, 0, 0, 0, 0, 0, 2050, 0, 0, 0, 569, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 1256, 0, 0, 0, 0, 0, 0,
+  0, 0, 947, 0, 692, 1063, 1888, 396, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 118, 1495, 0, 0, 184, 0, 1771, 0, 1938, 0, 0, 1019, 0, 0, 1754,
+  0, 0, 0, 0, 0, 0, 0, 0, 2014, 0, 0, 353, 0, 0, 524, 0,
+  0, 0, 0, 0, 1647, 1658, 0, 1371, 0, 0, 0, 0, 0, 0, 0, 0,
+  319, 944, 1898, 2076, 0, 0, 1024, 0, 0, 0, 0, 305, 0, 0, 0, 0,
+  1712, 0, 0, 0, 0, 1455, 0, 1347, 0, 0, 0, 1811, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 838, 365, 0, 0, 907, 0, 0, 0, 0, 1608,
+  0, 0, 0, 447, 0, 0, 0, 693, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 639, 0, 244, 0, 0, 0, 0, 0, 0, 1105, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1684, 0,
+  0, 0, 665, 0, 821, 0, 427, 990, 0, 151, 1195, 878, 1885, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 2041, 1894, 1651, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 1653, 0, 0, 915, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 941, 0, 228, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1237, 0, 0, 0, 2108,
+  0, 562, 0, 0, 0, 2100, 0, 0, 0, 0, 0, 1354, 0, 188, 0, 1767,
+  0, 457, 1483, 1967, 0, 0, 1851, 0, 490, 0, 0, 9, 175, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 507, 570, 0, 0, 0, 0, 0, 0,
+  0, 1011, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 2052, 0, 0, 0, 1288, 266, 0, 0, 0, 0, 0, 0, 1262,
+  0, 0, 1401, 901, 0, 0, 0, 0, 0, 0, 0, 75, 1366, 0, 0, 1826,
+  0, 0, 0, 0, 0, 352, 480, 293, 951, 996, 1930, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 50, 1506, 0, 0, 0, 0, 0,
+  0, 1219, 0, 0, 0, 0, 0, 138, 0, 0, 0, 870, 0, 0, 0, 1374,
+  0, 0, 0, 0, 1619, 0, 238, 0, 1924, 0, 0, 0, 0, 1000, 0, 0,
+  287, 0, 0, 0, 1056, 1992, 0, 0, 0, 0, 0, 1414, 0, 0, 0, 0,
+  0, 0, 701, 0, 0, 0, 1792, 1160, 0, 0, 0, 0, 0, 1693, 0, 0,
+  523, 0, 0, 954, 1350, 0, 0, 0, 1873, 2024, 754, 0, 987, 0, 0, 0,
+  0, 0, 0, 1946, 251, 0, 233, 0, 0, 0, 0, 44, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 104, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 1883, 983, 0, 1728, 0, 0, 0, 0, 0, 0, 0, 0, 2089,
+  0, 0, 0, 1709, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 139, 269, 2026, 0, 0, 0, 0, 0, 0, 0, 1460, 351,
+  1881, 0, 0, 0, 0, 0, 0, 0, 0, 185, 0, 674, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 441,
+  0, 1686, 0, 0, 0, 1125, 0, 0, 1726, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 1805, 0, 0, 0, 0, 133, 0, 0, 1893, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 173, 1853, 816, 0, 812, 0, 934, 182, 1566, 1433,
+  0, 0, 0, 0, 0, 0, 0, 80, 0, 1715, 549, 0, 292, 0, 0, 2013,
+  0, 0, 433, 0, 1850, 2056, 0, 1579, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 112, 0, 0, 0, 0, 0, 0, 0, 1745, 0, 0, 0, 0, 0,
+  0, 0, 0, 1638, 0, 0, 1436, 0, 0, 0, 0, 215, 0, 1077, 0, 0,
+  0, 478, 0, 0, 0, 0, 0, 0, 0, 0, 655, 0, 0, 0, 0, 1041,
+  0, 0, 0, 575, 0, 862, 0, 0, 2009, 0, 0, 1829, 0, 0, 0, 0,
+  25, 0, 0, 1412, 0, 0, 0, 1246, 0, 1233, 1033, 0, 0, 1518, 0, 847,
+  0, 82, 0, 0, 0, 0, 760, 846, 961, 0, 0, 1687, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 1547, 0, 0, 0, 0, 0, 0,
+  1416, 0, 0, 0, 0, 979, 0, 1939, 0, 0, 1504, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 555, 650, 0, 0, 0, 0, 1931, 0, 0, 0, 837,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 491,
+  0, 0, 0, 413, 0, 0, 0, 0, 1590, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 538, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  967, 0, 0, 0, 0, 1301, 1780, 0, 1692, 1876, 0, 148, 1681, 0, 0, 0,
+  2027, 0, 0, 1467, 0, 0, 0, 0, 0, 0, 0, 0, 1751, 0, 988, 428,
+  1229, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1046, 1059, 2095, 0,
+  0, 58, 0, 0, 0, 0, 397, 0, 0, 0, 1607, 0, 0, 0, 802, 0,
+  0, 2031, 0, 0, 0, 0, 0, 141, 0, 0, 576, 998, 1690, 0, 0, 0,
+  687, 0, 1166, 0, 0, 0, 1023, 0, 0, 0, 0, 1348, 1497, 0, 721, 595,
+  1142, 1459, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  1194, 0, 0, 0, 1730, 1010, 0, 0, 0, 216, 596, 1367, 0, 197, 0, 0,
+  732, 0, 0, 0, 0, 0, 1561, 0, 1114, 0, 0, 749, 794, 0, 0, 695,
+  0, 681, 0, 0, 0, 0, 892, 0, 0, 0, 0, 0, 0, 0, 321, 0,
+  1560, 0, 0, 0, 0, 0, 0, 0, 415, 0, 0, 0, 364, 1275, 0, 1029,
+  487, 657, 1905, 2000, 0, 0, 0, 144, 0, 0, 0, 62, 817, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 572, 1141, 0, 829, 0, 0, 6, 0, 0, 0,
+  0, 0, 0, 0, 1819, 0, 0, 0, 1352, 0, 0, 0, 0, 0, 740, 0,
+  924, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  2039, 1276, 0, 0, 0, 0, 437, 403, 0, 0, 0, 0, 0, 0, 0, 0,
+  1642, 0, 0, 0, 0, 0, 0, 1363, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 1309, 1415, 0, 1481, 0, 0, 0, 0, 916, 1657, 0, 0, 0, 1132,
+  0, 27, 109, 1289, 0, 0, 0, 0, 0, 0, 577, 775, 0, 1405, 1701, 0,
+  910, 0, 0, 0, 0, 0, 0, 1554, 0, 0, 180, 1322, 0, 0, 0, 0,
+  1253, 0, 438, 1884, 1217, 0, 0, 0, 0, 0, 868, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 283, 1118, 0, 1451, 1546, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 1512, 0, 0, 0, 289, 450, 839, 1133, 0, 0, 199, 0,
+  0, 0, 1334, 0, 0, 0, 0, 614, 651, 0, 0, 1747, 0, 0, 0, 0,
+  0, 0, 0, 0, 1597, 0, 0, 0, 0, 340, 766, 0, 0, 0, 0, 334,
+  756, 0, 0, 0, 2105, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 311,
+  0, 0, 0, 0, 0, 462, 1617, 0, 1257, 0, 239, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 511, 0, 0, 0, 517, 0, 0, 2099,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1151, 1171, 1337, 0, 0,
+  0, 329, 0, 0, 0, 1419, 0, 0, 1468, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 1891, 0, 0, 0, 0, 1932, 0, 0, 325, 0, 0, 0, 0, 0,
+  1313, 280, 0, 0, 0, 0, 0, 1868, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 1181, 483, 0, 1159, 0, 0, 0, 0, 730, 0, 679, 0, 1210, 0,
+  0, 0, 0, 0, 0, 164, 0, 0, 323, 782, 0, 0, 0, 0, 0, 0,
+  529, 0, 0, 0, 0, 0, 1087, 0, 0, 0, 198, 0, 0, 0, 0, 0,
+  0, 1116, 0, 0, 584, 0, 0, 0, 0, 1786, 1541, 0, 0, 0, 0, 0,
+  771, 894, 1428, 0, 0, 1200, 0, 0, 814, 0, 0, 0, 0, 0, 0, 0,
+  0, 778, 0, 0, 0, 0, 856, 0, 1102, 0, 0, 0, 889, 0, 0, 1691,
+  1988, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1396, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  1156, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1376, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 1089, 1635, 2116, 0, 709, 0, 0, 0, 203, 0,
+  0, 0, 0, 1882, 1252, 0, 0, 641, 0, 0, 366, 0, 0, 0, 0, 0,
+  2008, 1266, 0, 0, 0, 0, 0, 0, 1667, 0, 0, 0, 0, 0, 1987, 0,
+  890, 0, 0, 0, 0, 0, 0, 137, 1190, 790, 385, 0, 0, 0, 1770, 942,
+  2057, 0, 658, 0, 0, 0, 563, 619, 0, 0, 0, 0, 727, 338, 0, 0,
+  0, 0, 0, 0, 1285, 0, 1295, 0, 0, 0, 0, 530, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 1068, 2042, 0, 96, 948, 0, 0, 0, 1353, 0, 0,
+  0, 0, 0, 0, 0, 0, 1178, 0, 0, 0, 0, 0, 0, 0, 2022, 2125,
+  1117, 0, 0, 645, 378, 697, 0, 0, 0, 0, 0, 1736, 0, 0, 0, 0,
+  0, 0, 970, 0, 0, 0, 1513, 0, 0, 0, 1799, 0, 0, 135, 1137, 0,
+  0, 0, 0, 0, 0, 0, 0, 542, 0, 343, 1336, 0, 0, 0, 1278, 0,
+  0, 0, 0, 1203, 1840, 0, 0, 0, 0, 1173, 0, 14, 0, 0, 0, 911,
+  1067, 0, 0, 0, 811, 0, 245, 263, 1633, 0, 248, 1644, 0, 2051, 1694, 0,
+  0, 0, 0, 0, 1476, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 419, 0, 0, 358, 0, 1167, 0, 0, 0, 1577, 2044, 2075, 0, 0, 0,
+  0, 0, 0, 30, 0, 0, 1213, 339, 1612, 0, 0, 81, 0, 0, 0, 767,
+  0, 0, 93, 0, 0, 1872, 1026, 0, 0, 0, 0, 1593, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 222, 0, 0, 0, 0, 0, 193, 2033, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 1656, 0, 0, 0, 0, 0, 0, 0, 0,
+  1613, 0, 0, 0, 0, 0, 0, 0, 486, 0, 0, 0, 2079, 1845, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1717, 0, 0, 1610, 0, 0,
+  0, 0, 36, 0, 0, 0, 0, 0, 89, 0, 0, 0, 0, 0, 1601, 0,
+  0, 0, 1936, 510, 1702, 0, 1242, 1983, 0, 0, 45, 0, 0, 848, 0, 110,
+  1245, 0, 0, 0, 0, 194, 791, 0, 0, 0, 1934, 834, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 2020, 155, 1511, 177, 0, 0, 0,
+  0, 1991, 0, 0, 0, 748, 0, 1539, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 1937, 0, 0, 1165, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 163, 1119, 29, 551, 682, 0, 0, 0, 0, 0, 0, 86, 1057,
+  1307, 0, 0, 0, 1423, 0, 116, 406, 1221, 1501, 0, 0, 499, 1362, 0, 0,
+  1865, 0, 0, 0, 633, 0, 0, 0, 989, 0, 0, 0, 0, 0, 0, 0,
+  0, 1971, 0, 0, 0, 0, 0, 0, 0, 0, 1005, 0, 974, 284, 0, 0,
+  0, 0, 0, 0, 0, 1864, 0, 0, 0, 0, 1508, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 660, 0, 0, 0, 0,
+  1866, 2063, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1296, 625, 0, 0,
+  0, 0, 495, 0, 0, 0, 0, 0, 0, 0, 0, 723, 0, 0, 225, 1484,
+  1833, 0, 0, 0, 328, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1140,
+  698, 1318, 2084, 0, 0, 1174, 0, 0, 0, 0, 0, 789, 0, 0, 0, 0,
+  1007, 23, 0, 235, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 1201, 0, 0, 787, 0, 1170, 0, 0, 0, 0, 0, 1071, 888, 41,
+  1466, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 1521, 0, 0, 0, 0, 0, 597, 0, 1338, 1918,
+  0, 0, 0, 0, 0, 0, 0, 421, 0, 0, 0, 0, 119, 0, 0, 295,
+  0, 0, 841, 0, 0, 1654, 0, 1410, 2068, 1380, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 1522, 0, 0, 895, 0, 0, 1145, 1297, 508, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 15, 0, 0, 0, 0, 1121, 0, 0, 0, 1130,
+  1844, 0, 0, 1470, 0, 0, 0, 362, 0, 1832, 0, 0, 0, 0, 0, 0,
+  1672, 0, 0, 335, 0, 0, 1545, 579, 0, 159, 0, 0, 0, 0, 718, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 616, 668, 1960, 502, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1637, 1206, 0,
+  0, 920, 1800, 0, 0, 759, 0, 0, 1113, 0, 0, 0, 374, 1441, 0, 0,
+  587, 0, 0, 1161, 1108, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 1622, 0, 0, 0, 0, 0, 0, 2029, 388, 0, 0, 0, 0, 568,
+  0, 0, 885, 1777, 1812, 1806, 312, 1838, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 993, 288, 1735, 1766, 0, 0, 0, 458, 0,
+  0, 0, 0, 0, 0, 945, 166, 1231, 407, 1425, 0, 0, 1302, 0, 0, 654,
+  514, 1519, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2049, 0, 1139, 0,
+  0, 0, 0, 0, 0, 0, 211, 0, 1890, 0, 0, 226, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 780, 0, 349, 281, 0, 0, 0, 0, 0, 0,
+  189, 0, 683, 762, 0, 0, 0, 0, 0, 0, 0, 0, 0, 610, 0, 1507,
+  676, 367, 798, 0, 279, 1958, 0, 0, 0, 0, 0, 0, 342, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 716, 796, 1870, 2098, 552, 0,
+  0, 0, 0, 0, 2017, 0, 1606, 0, 0, 0, 0, 1250, 0, 0, 0, 0,
+  0, 0, 1293, 0, 0, 0, 0, 0, 1175, 0, 0, 0, 1878, 1180, 0, 0,
+  0, 0, 0, 454, 0, 1900, 313, 1422, 0, 0, 0, 818, 0, 0, 0, 938,
+  758, 0, 588, 0, 0, 0, 1781, 0, 0, 0, 0, 1043, 896, 0, 0, 0,
+  677, 0, 1069, 2074, 0, 0, 0, 0, 0, 0, 0, 1979, 0, 0, 0, 0,
+  0, 0, 2053, 518, 0, 0, 1782, 84, 0, 0, 1698, 0, 731, 0, 0, 0,
+  1985, 0, 0, 0, 0, 1196, 1384, 0, 0, 0, 0, 0, 0, 981, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 108, 735, 1737, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 1030, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 63, 0, 0, 0, 0, 2123, 79, 0, 0, 0,
+  0, 481, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  1202, 0, 1426, 1741, 997, 1879, 2114, 0, 0, 0, 1584, 0, 0, 0, 0, 1886,
+  0, 0, 0, 1086, 0, 0, 0, 0, 0, 0, 1951, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 887, 0, 0, 851, 0, 475, 0, 774, 0,
+  0, 443, 0, 0, 642, 0, 666, 1267, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 107, 1355, 26, 2092, 0, 656, 0, 0, 0, 267, 612,
+  0, 0, 0, 0, 1447, 0, 0, 0, 167, 0, 206, 0, 0, 0, 0, 0,
+  0, 322, 1058, 0, 0, 217, 0, 0, 0, 1357, 94, 0, 699, 0, 0, 0,
+  0, 1688, 0, 12, 792, 1628, 0, 0, 0, 0, 0, 1247, 0, 0, 0, 0,
+  0, 884, 0, 0, 0, 0, 488, 1240, 0, 0, 0, 1258, 0, 0, 0, 0,
+  0, 0, 1594, 0, 97, 1383, 0, 0, 0, 0, 1632, 0, 1949, 0, 0, 0,
+  0, 0, 0, 1674, 0, 0, 0, 797, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 2082, 0, 573, 2064, 0, 0, 1452, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 78, 0, 0, 0, 1331, 755, 0, 0, 0,
+  0, 0, 0, 1874, 0, 1004, 1944, 0, 975, 484, 0, 477, 0, 0, 1265, 2016,
+  0, 386, 0, 0, 0, 0, 0, 0, 0, 0, 1454, 0, 1369, 1822, 1670, 0,
+  0, 0, 1774, 0, 0, 0, 0, 0, 0, 0, 0, 0, 923, 0, 0, 0,
+  2058, 0, 0, 114, 0, 2046, 2101, 1598, 0, 0, 0, 0, 0, 200, 0, 0,
+  0, 960, 2077, 0, 0, 412, 101, 1303, 0, 0, 0, 1172, 0, 0, 1494, 1892,
+  0, 0, 0, 0, 0, 1047, 1499, 1668, 0, 0, 0, 1993, 1444, 0, 0, 1446,
+  0, 0, 0, 0, 0, 0, 0, 422, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 1660, 201, 0, 1199, 0, 0, 0, 1552, 0,
+  0, 0, 0, 0, 0, 726, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 434, 0, 0, 0, 786, 0, 927, 0, 0, 1036, 0, 2094, 1558,
+  2069, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 991, 0, 0, 0,
+  0, 1432, 0, 178, 527, 0, 304, 0, 0, 0, 2035, 0, 1716, 0, 0, 1984,
+  0, 1917, 0, 1073, 0, 2073, 0, 0, 0, 0, 1966, 0, 0, 0, 0, 904,
+  0, 720, 1136, 0, 0, 1880, 1705, 1061, 1680, 1392, 256, 1801, 0, 0, 0, 0,
+  0, 0, 0, 1264, 0, 0, 0, 0, 0, 2119, 0, 0, 0, 0, 0, 0,
+  0, 0, 706, 0, 0, 0, 0, 0, 209, 0, 0, 0, 0, 146, 689, 1039,
+  1836, 0, 0, 1762, 1749, 0, 1855, 0, 0, 2003, 0, 0, 0, 1107, 0, 0,
+  0, 0, 0, 784, 0, 0, 0, 0, 0, 1814, 0, 0, 0, 0, 1896, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 1831, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 606, 548, 0, 1359,
+  1333, 0, 0, 1517, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1150, 0, 0,
+  1703, 128, 702, 743, 0, 0, 0, 0, 0, 0, 1189, 827, 1982, 0, 0, 0,
+  0, 526, 0, 0, 0, 0, 0, 864, 1498, 73, 1752, 0, 0, 143, 0, 91,
+  345, 0, 0, 1909, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  1084, 1062, 0, 0, 0, 0, 0, 688, 0, 0, 0, 0, 0, 0, 1332, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1098, 0, 0, 0,
+  717, 0, 0, 0, 0, 0, 0, 20, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 1565, 662, 0, 0, 0, 0, 1122, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 959, 0, 1448, 0, 1549, 1564, 0, 0, 0, 0, 0, 1177,
+  1488, 1652, 0, 0, 0, 0, 0, 1260, 0, 1570, 0, 0, 707, 0, 1144, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 190, 0, 0, 1438, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 1695, 0, 0, 0, 0, 0, 0, 359, 1947, 1998, 0, 0,
+  736, 0, 1131, 0, 1291, 0, 0, 0, 0, 1856, 0, 1753, 0, 0, 0, 1920,
+  0, 0, 432, 1794, 2104, 1962, 0, 0, 0, 0, 0, 0, 0, 0, 744, 64,
+  1304, 0, 0, 202, 0, 0, 0, 0, 1450, 0, 1646, 603, 0, 0, 1274, 0,
+  0, 77, 307, 0, 591, 0, 0, 0, 1953, 1796, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 272, 0, 0, 0, 0, 0, 0, 0, 644,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 592, 0, 0, 0, 0, 34, 955,
+  0, 0, 0, 0, 0, 66, 873, 1234, 410, 599, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 922, 0, 0, 0, 0, 0, 0, 1727, 1945, 0, 0, 0, 1218,
+  0, 1580, 528, 558, 0, 1804, 0, 0, 0, 0, 0, 0, 0, 969, 463, 1599,
+  906, 0, 1527, 0, 1491, 0, 1241, 0, 0, 468, 1820, 0, 2107, 0, 0, 0,
+  0, 1765, 1429, 0, 853, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 804,
+  0, 1244, 0, 0, 33, 0, 0, 1526, 0, 0, 0, 0, 0, 0, 0, 618,
+  0, 0, 0, 0, 0, 0, 0, 1126, 0, 0, 0, 0, 0, 0, 0, 1461,
+  0, 0, 0, 0, 0, 0, 0, 0, 1324, 0, 0, 0, 0, 0, 0, 886,
+  1400, 0, 0, 640, 533, 1775, 0, 0, 1042, 0, 0, 0, 2087, 98, 608, 1385,
+  0, 0, 0, 764, 0, 168, 1094, 1437, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 1889, 0, 1533, 0, 0, 0, 0, 247, 0, 0, 0, 0, 1048, 0,
+  0, 0, 0, 0, 0, 1659, 0, 0, 0, 0, 0, 0, 0, 0, 1925, 0,
+  1215, 0, 0, 0, 0, 170, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  87, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 585, 0, 1364, 0,
+  1339, 276, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 446, 1070, 609, 1661, 0, 0, 0, 0, 0, 0, 0, 0, 1051, 0,
+  0, 0, 0, 0, 958, 1443, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
@@ -0,0 +1,42 @@
+//
+//  RSSHTMLPlainText.h
+//  MediaRSSParser
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+
+
+
+#import <Foundation/Foundation.h>
+
+/**
+ *  Converts HTML to plain text in a single pass, with the same output as the original `NSScanner` based implementation of `-[NSString stringByConvertingHTMLToPlainText]`:
+ *
+ *  - Comments and `script` elements are removed along with their content.
+ *  - Tags are removed. Closing tags are replaced by a space, unless they close an inline element (`a`, `b`, `i`, `q`, `span`, `em`, `strong`, `cite`, `abbr`, `acronym` or `label`) or end the string.
+ *  - Each run of whitespace and newlines is replaced by a single space, except at the start and end of the string.
+ *  - HTML character references are decoded (see `RSSDecodeHTMLEntitiesInPlace`).
+ *
+ *  The characters are read through a `CFStringInlineBuffer` and written to the buffer of the returned string, which is the only allocation.
+ */
+extern NSString *RSSStringByConvertingHTMLToPlainText(NSString *string);
+
+/**
+ *  Removes tags in a single pass, with the same output as the original implementation of the deprecated `-[NSString stringByStrippingTags]`: each tag is replaced by a space unless it's exactly `<a>`, `</a>`, `<span>`, `</span>`, `<strong>`, `</strong>`, `<em>` or `</em>`, and then whitespace is collapsed as by `-[NSString stringByRemovingNewLinesAndWhitespace]`. A string without any `<` is returned unchanged.
+ */
+extern NSString *RSSStringByStrippingTags(NSString *string);
@@ -0,0 +1,218 @@
+//
+//  RSSHTMLPlainText.m
+//  MediaRSSParser
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+
+
+
+#import "RSSHTMLPlainText.h"
+#import "RSSHTMLEntities.h"
+
+#pragma mark - Scanning
+
+typedef struct {
+  CFStringInlineBuffer buffer;
+  CFIndex length;
+} RSSHTMLScanner;
+
+static inline void RSSHTMLScannerInit(RSSHTMLScanner *scanner, NSString *string)
+{
+  scanner->length = (CFIndex)string.length;
+  CFStringInitInlineBuffer((__bridge CFStringRef)string, &scanner->buffer, CFRangeMake(0, scanner->length));
+}
+
+static inline unichar RSSHTMLCharacterAtIndex(RSSHTMLScanner *scanner, CFIndex index)
+{
+  return CFStringGetCharacterFromInlineBuffer(&scanner->buffer, index);
+}
+
+// Returns YES if the ASCII `string` occurs at `index`, matching case exactly.
+static BOOL RSSHTMLHasStringAtIndex(RSSHTMLScanner *scanner, CFIndex index, const char *string)
+{
+  for (CFIndex i = 0; string[i]; i++) {
+    if (index + i >= scanner->length || RSSHTMLCharacterAtIndex(scanner, index + i) != (unichar)string[i]) {
+      return NO;
+    }
+  }
+  return YES;
+}
+
+// Returns the index of the next occurrence of the ASCII `string` at or after `index`, or the length if there isn't one.
+static CFIndex RSSHTMLIndexOfString(RSSHTMLScanner *scanner, CFIndex index, const char *string)
+{
+  unichar first = (unichar)string[0];
+  for (; index < scanner->length; index++) {
+    if (RSSHTMLCharacterAtIndex(scanner, index) == first && RSSHTMLHasStringAtIndex(scanner, index, string)) {
+      return index;
+    }
+  }
+  return scanner->length;
+}
+
+// Returns the index just past the next occurrence of the ASCII `string`, or the length if there isn't one.
+static CFIndex RSSHTMLIndexPastString(RSSHTMLScanner *scanner, CFIndex index, const char *string)
+{
+  CFIndex found = RSSHTMLIndexOfString(scanner, index, string);
+  return found < scanner->length ? found + (CFIndex)strlen(string) : found;
+}
+
+// Whitespace and newlines, including Next Line (U+0085), Form Feed (U+000C), Line Separator (U+2028) and Paragraph Separator (U+2029)
+static inline BOOL RSSHTMLIsWhitespace(unichar c)
+{
+  return c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == 0x0085 || c == 0x000C || c == 0x2028 || c == 0x2029;
+}
+
+static inline BOOL RSSHTMLIsLetter(unichar c)
+{
+  return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z');
+}
+
+static BOOL RSSHTMLIsInlineTagName(RSSHTMLScanner *scanner, CFIndex start, CFIndex end)
+{
+  static const char *names[] = { "a", "b", "i", "q", "span", "em", "strong", "cite", "abbr", "acronym", "label" };
+  
+  for (size_t n = 0; n < sizeof(names) / sizeof(names[0]); n++) {
+    const char *name = names[n];
+    CFIndex i = 0;
+    while (start + i < end && name[i] && (RSSHTMLCharacterAtIndex(scanner, start + i) | 0x20) == (unichar)name[i]) {
+      i++;
+    }
+    if (start + i == end && name[i] == '\0') {
+      return YES;
+    }
+  }
+  return NO;
+}
+
+static BOOL RSSHTMLIsInlineTag(RSSHTMLScanner *scanner, CFIndex start, CFIndex end)
+{
+  static const char *tags[] = { "<a>", "</a>", "<span>", "</span>", "<strong>", "</strong>", "<em>", "</em>" };
+  
+  for (size_t n = 0; n < sizeof(tags) / sizeof(tags[0]); n++) {
+    if ((size_t)(end - start) == strlen(tags[n]) && RSSHTMLHasStringAtIndex(scanner, start, tags[n])) {
+      return YES;
+    }
+  }
+  return NO;
+}
+
+#pragma mark - Converting
+
+NSString *RSSStringByConvertingHTMLToPlainText(NSString *string)
+{
+  RSSHTMLScanner scanner;
+  RSSHTMLScannerInit(&scanner, string);
+  CFIndex length = scanner.length;
+  
+  // Every replacement is shorter than what it replaces, so the output fits in the input's length.
+  unichar *output = malloc((size_t)MAX(length, 1) * sizeof(unichar));
+  NSUInteger count = 0;
+  CFIndex i = 0;
+  
+  while (i < length) {
+    unichar c = RSSHTMLCharacterAtIndex(&scanner, i);
+    
+    if (c == '<') {
+      i++;
+      
+      if (RSSHTMLHasStringAtIndex(&scanner, i, "!--")) {
+        i = RSSHTMLIndexPastString(&scanner, i + 3, "-->");
+        
+      } else if (RSSHTMLHasStringAtIndex(&scanner, i, "script")) {
+        i = RSSHTMLIndexPastString(&scanner, i + 6, "</script>");
+        
+      } else {
+        if (i < length && RSSHTMLCharacterAtIndex(&scanner, i) == '/') {
+          CFIndex nameStart = ++i;
+          while (i < length && RSSHTMLIsLetter(RSSHTMLCharacterAtIndex(&scanner, i))) {
+            i++;
+          }
+          
+          if (!RSSHTMLIsInlineTagName(&scanner, nameStart, i) && count > 0 && i < length) {
+            output[count++] = ' ';
+          }
+        }
+        i = RSSHTMLIndexPastString(&scanner, i, ">");
+      }
+      
+    } else if (RSSHTMLIsWhitespace(c)) {
+      while (i < length && RSSHTMLIsWhitespace(RSSHTMLCharacterAtIndex(&scanner, i))) {
+        i++;
+      }
+      if (count > 0 && i < length) {
+        output[count++] = ' ';
+      }
+      
+    } else {
+      output[count++] = c;
+      i++;
+    }
+  }
+  
+  count = RSSDecodeHTMLEntitiesInPlace(output, count);
+  return [[NSString alloc] initWithCharactersNoCopy:output length:count freeWhenDone:YES];
+}
+
+NSString *RSSStringByStrippingTags(NSString *string)
+{
+  if ([string rangeOfString:@"<" options:NSLiteralSearch].location == NSNotFound) {
+    return [NSString stringWithString:string];
+  }
+  
+  RSSHTMLScanner scanner;
+  RSSHTMLScannerInit(&scanner, string);
+  CFIndex length = scanner.length;
+  
+  unichar *output = malloc((size_t)length * sizeof(unichar));
+  NSUInteger count = 0;
+  BOOL pendingSpace = NO;
+  CFIndex i = 0;
+  
+  while (i < length) {
+    unichar c = RSSHTMLCharacterAtIndex(&scanner, i);
+    
+    if (c == '<') {
+      CFIndex tagEnd = RSSHTMLIndexOfString(&scanner, i + 1, ">");
+      
+      if (tagEnd < length) {
+        // A tag replaced by a space joins any whitespace around it
+        if (!RSSHTMLIsInlineTag(&scanner, i, tagEnd + 1)) {
+          pendingSpace = count > 0;
+        }
+        i = tagEnd + 1;
+        continue;
+      }
+    }
+    
+    if (RSSHTMLIsWhitespace(c)) {
+      pendingSpace = count > 0;
+      
+    } else {
+      if (pendingSpace) {
+        output[count++] = ' ';
+        pendingSpace = NO;
+      }
+      output[count++] = c;
+    }
+    i++;
+  }
+  
+  return [[NSString alloc] initWithCharactersNoCopy:output length:count freeWhenDone:YES];
+}
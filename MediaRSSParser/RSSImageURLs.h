@@ -0,0 +1,35 @@
+//
+//  RSSImageURLs.h
+//  MediaRSSParser
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+
+
+#import <Foundation/Foundation.h>
+
+/**
+ *  Finds the image URLs within the given string, matching the same substrings as the regular expression `(https?)\S*(png|jpg|jpeg|gif)` (case insensitive) that `-[RSSItem imagesFromHTML:]` used to compile on every call.
+ *
+ *  Each match starts at an `http` and runs to the last `png`, `jpg`, `jpeg` or `gif` before the next whitespace character. The string is scanned once through a `CFStringInlineBuffer`; the only allocations are the returned array and its strings.
+ *
+ *  @param string The string to search, typically HTML
+ *
+ *  @return An array of `NSString` objects in the order they occur, which is empty if there are none
+ */
+extern NSArray *RSSImageURLStringsInString(NSString *string);
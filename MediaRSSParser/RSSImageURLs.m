@@ -0,0 +1,134 @@
+//
+//  RSSImageURLs.m
+//  MediaRSSParser
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+
+
+#import "RSSImageURLs.h"
+
+#define RSSImageURLInitialRangeCapacity 16
+
+typedef struct {
+  CFStringInlineBuffer buffer;
+  CFIndex length;
+} RSSImageURLScanner;
+
+static inline unichar RSSImageURLLowercaseCharacterAtIndex(RSSImageURLScanner *scanner, CFIndex index)
+{
+  unichar c = CFStringGetCharacterFromInlineBuffer(&scanner->buffer, index);
+  return (c >= 'A' && c <= 'Z') ? (unichar)(c + ('a' - 'A')) : c;
+}
+
+// The Unicode White_Space property, which is what `\s` matches in an `NSRegularExpression`.
+static inline BOOL RSSImageURLIsWhitespace(unichar c)
+{
+  return (c >= 0x0009 && c <= 0x000D) || c == 0x0020 || c == 0x0085 || c == 0x00A0 || c == 0x1680 ||
+    (c >= 0x2000 && c <= 0x200A) || c == 0x2028 || c == 0x2029 || c == 0x202F || c == 0x205F || c == 0x3000;
+}
+
+static BOOL RSSImageURLHasStringAtIndex(RSSImageURLScanner *scanner, CFIndex index, CFIndex end, const char *string)
+{
+  for (CFIndex i = 0; string[i]; i++) {
+    if (index + i >= end || RSSImageURLLowercaseCharacterAtIndex(scanner, index + i) != (unichar)string[i]) {
+      return NO;
+    }
+  }
+  return YES;
+}
+
+// Returns the end of the longest match of `(png|jpg|jpeg|gif)` that starts at or after `start` and ends at or before `end`, or `0` if there isn't one.
+static CFIndex RSSImageURLExtensionEnd(RSSImageURLScanner *scanner, CFIndex start, CFIndex end)
+{
+  static const char *extensions[] = { "png", "jpg", "jpeg", "gif" };
+  
+  for (CFIndex index = end - 3; index >= start; index--) {
+    for (NSUInteger i = 0; i < sizeof(extensions) / sizeof(extensions[0]); i++) {
+      if (RSSImageURLHasStringAtIndex(scanner, index, end, extensions[i])) {
+        return index + (CFIndex)strlen(extensions[i]);
+      }
+    }
+  }
+  return 0;
+}
+
+NSArray *RSSImageURLStringsInString(NSString *string)
+{
+  RSSImageURLScanner scanner;
+  scanner.length = (CFIndex)string.length;
+  CFStringInitInlineBuffer((__bridge CFStringRef)string, &scanner.buffer, CFRangeMake(0, scanner.length));
+  
+  CFRange stackRanges[RSSImageURLInitialRangeCapacity];
+  CFRange *ranges = stackRanges;
+  NSUInteger capacity = RSSImageURLInitialRangeCapacity;
+  NSUInteger count = 0;
+  
+  CFIndex index = 0;
+  while (index + 4 <= scanner.length) {
+    if (!RSSImageURLHasStringAtIndex(&scanner, index, scanner.length, "http")) {
+      index++;
+      continue;
+    }
+    
+    // The regular expression's `\S*` is greedy, so a match ends at the last extension before whitespace
+    CFIndex runEnd = index + 4;
+    while (runEnd < scanner.length && !RSSImageURLIsWhitespace(CFStringGetCharacterFromInlineBuffer(&scanner.buffer, runEnd))) {
+      runEnd++;
+    }
+    
+    CFIndex matchEnd = RSSImageURLExtensionEnd(&scanner, index + 4, runEnd);
+    if (matchEnd == 0) {
+      // Any later `http` within this run has even fewer characters to match against
+      index = runEnd;
+      continue;
+    }
+    
+    if (count == capacity) {
+      capacity *= 2;
+      if (ranges == stackRanges) {
+        ranges = malloc(capacity * sizeof(CFRange));
+        memcpy(ranges, stackRanges, sizeof(stackRanges));
+      } else {
+        ranges = realloc(ranges, capacity * sizeof(CFRange));
+      }
+    }
+    ranges[count++] = CFRangeMake(index, matchEnd - index);
+    index = matchEnd;
+  }
+  
+  if (count == 0) {
+    return @[];
+  }
+  
+  CFStringRef *strings = malloc(count * sizeof(CFStringRef));
+  for (NSUInteger i = 0; i < count; i++) {
+    strings[i] = CFStringCreateWithSubstring(kCFAllocatorDefault, (__bridge CFStringRef)string, ranges[i]);
+  }
+  CFArrayRef array = CFArrayCreate(kCFAllocatorDefault, (const void **)strings, (CFIndex)count, &kCFTypeArrayCallBacks);
+  
+  for (NSUInteger i = 0; i < count; i++) {
+    CFRelease(strings[i]);
+  }
+  free(strings);
+  if (ranges != stackRanges) {
+    free(ranges);
+  }
+  
+  return CFBridgingRelease(array);
+}
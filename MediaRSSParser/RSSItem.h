@@ -25,6 +25,9 @@
 
 #import <Foundation/Foundation.h>
 
+@class RSSMediaPlayer;
+@class RSSMediaCommunity;
+
 /**
  *  `RSSItem` corresponds to a single `item` or `entry` element within an RSS feed.
  *
@@ -154,13 +157,86 @@
  */
 @property (nonatomic, copy) NSString *mediaText;
 
+/**
+ *  This is an array of `NSString` objects, corresponding to the comma-separated keywords of the `media:keywords` element within an `item` element.
+ *
+ *  This is part of the Media RSS specification, a namespace extension to RSS 2.0.
+ *
+ *  Per the Media RSS specification, it is a list of "highly relevant keywords describing the media object."
+ */
+@property (nonatomic, copy) NSArray *mediaKeywords;
+
+/**
+ *  Corresponds to the `media:player` element within an `item` element.
+ *
+ *  This is part of the Media RSS specification, a namespace extension to RSS 2.0.
+ *
+ *  Per the Media RSS specification, it "allows the media object to be accessed through a web browser media player console."
+ */
+@property (nonatomic, strong) RSSMediaPlayer *mediaPlayer;
+
+/**
+ *  This is an array of `RSSMediaCategory` objects, corresponding to the `media:category` elements within an `item` element.
+ *
+ *  This is part of the Media RSS specification, a namespace extension to RSS 2.0.
+ *
+ *  Per the Media RSS specification, it "allows a taxonomy to be set that gives an indication of the type of media content, and its particular contents."
+ */
+@property (nonatomic, copy) NSArray *mediaCategories;
+
+/**
+ *  This is an array of `RSSMediaRating` objects, corresponding to the `media:rating` elements within an `item` element.
+ *
+ *  This is part of the Media RSS specification, a namespace extension to RSS 2.0.
+ *
+ *  Per the Media RSS specification, it is "the permissible audience."
+ */
+@property (nonatomic, copy) NSArray *mediaRatings;
+
+/**
+ *  This is an array of `RSSMediaRestriction` objects, corresponding to the `media:restriction` elements within an `item` element.
+ *
+ *  This is part of the Media RSS specification, a namespace extension to RSS 2.0.
+ *
+ *  Per the Media RSS specification, it "allows restrictions to be placed on the aggregator rendering the media in the feed."
+ */
+@property (nonatomic, copy) NSArray *mediaRestrictions;
+
+/**
+ *  Corresponds to the `media:community` element within an `item` element, including its `media:starRating`, `media:statistics` and `media:tags` elements.
+ *
+ *  This is part of the Media RSS specification, a namespace extension to RSS 2.0.
+ *
+ *  Per the Media RSS specification, it "stands for the community related content."
+ */
+@property (nonatomic, strong) RSSMediaCommunity *mediaCommunity;
+
+#pragma mark - Identity
+///---------------------
+/// @name Identity
+///---------------------
+
+/**
+ *  A 64-bit key identifying the item across feeds: a hash of its `guid`, or of its normalized `link` if it has no `guid` (see `RSSItemIdentityKey`). It's `RSSItemNoIdentityKey` if the item has neither.
+ *
+ *  The key is computed once and kept until `guid` or `link` is set. `RSSParser` computes it while parsing, except for items whose fields are decoded lazily, which compute it on first access.
+ *
+ *  `isEqual:` and `hash` are based on this key: two items are equal if they have the same `guid`, or if neither has a `guid` and their normalized links are the same. An item with neither is only equal to itself.
+ */
+@property (nonatomic, assign, readonly) uint64_t identityKey;
+
 #pragma mark - Getting Embedded Images
 ///---------------------
 /// @name Getting Embedded Images
 ///---------------------
 
 /**
- *  Calls `imagesFromHTML:` passing in its `itemDescription` property.
+ *  The image URLs found within the `itemDescription` property while parsing, if the parser's `extractsImagesFromItemDescriptions` property was `YES`. This is reset to `nil` whenever `itemDescription` is set.
+ */
+@property (nonatomic, copy) NSArray *itemDescriptionImages;
+
+/**
+ *  Returns `itemDescriptionImages` if it's set, and otherwise calls `imagesFromHTML:` passing in its `itemDescription` property.
  *
  *  @return An array of `NSString` objects containing links (strings starting within `http` or `https`) to all images from the `itemDescription` property.
  */
@@ -174,7 +250,7 @@
 - (NSArray *)imagesFromMediaText;
 
 /**
- *  Creates an array of `NSString` objects containing URLs (starting with either `http` or `https` only) to all images from the passed in `html` property. This method uses an `NSRegularExpression` to search for strings matching the format `(https?)\\S*(png|jpg|jpeg|gif)`.
+ *  Creates an array of `NSString` objects containing URLs (starting with either `http` or `https` only) to all images from the passed in `html` property. This method matches the same strings as the regular expression `(https?)\\S*(png|jpg|jpeg|gif)`, without compiling one (see `RSSImageURLStringsInString`).
  *
  *  @param html The string to search for images (http(s) links).
  *
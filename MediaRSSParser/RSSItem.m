@@ -24,13 +24,23 @@
 //  THE SOFTWARE.
 
 #import "RSSItem.h"
+#import "RSSImageURLs.h"
+#import "RSSItemIdentity.h"
 
 @implementation RSSItem
+{
+  uint64_t _identityKey;
+  BOOL _hasIdentityKey;
+}
 
 #pragma mark - Getting Images from HTML
 
 - (NSArray *)imagesFromItemDescription
 {
+  NSArray *images = self.itemDescriptionImages;
+  if (images) {
+    return images;
+  }
   return self.itemDescription.length ? [self imagesFromHTML:self.itemDescription] : nil;
 }
 
@@ -41,23 +51,48 @@
 
 - (NSArray *)imagesFromHTML:(NSString *)html
 {
-  NSMutableArray *imagesURLStringArray = [[NSMutableArray alloc] init];
-  
-  NSError *error;
-  
-  NSRegularExpression *regex = [NSRegularExpression
-                                regularExpressionWithPattern:@"(https?)\\S*(png|jpg|jpeg|gif)"
-                                options:NSRegularExpressionCaseInsensitive
-                                error:&error];
-  
-  [regex enumerateMatchesInString:html
-                          options:0
-                            range:NSMakeRange(0, html.length)
-                       usingBlock:^(NSTextCheckingResult *result, NSMatchingFlags flags, BOOL *stop) {
-                         [imagesURLStringArray addObject:[html substringWithRange:result.range]];
-                       }];
-  
-  return [NSArray arrayWithArray:imagesURLStringArray];
+  return RSSImageURLStringsInString(html);
+}
+
+#pragma mark - Custom Accessors
+
+- (void)setItemDescription:(NSString *)itemDescription
+{
+  _itemDescription = [itemDescription copy];
+  _itemDescriptionImages = nil;
+}
+
+- (void)setLink:(NSURL *)link
+{
+  _link = [link copy];
+  _hasIdentityKey = NO;
+}
+
+- (void)setGuid:(NSString *)guid
+{
+  _guid = [guid copy];
+  _hasIdentityKey = NO;
+}
+
+#pragma mark - Identity
+
+- (uint64_t)identityKey
+{
+  if (!_hasIdentityKey) {
+    _identityKey = RSSItemIdentityKey(self.guid, self.link);
+    _hasIdentityKey = YES;
+  }
+  return _identityKey;
+}
+
+- (BOOL)hasSameIdentityAsItem:(RSSItem *)item
+{
+  // Equal keys almost always mean equal identities, so this only confirms them.
+  NSString *guid = self.guid;
+  if (guid.length) {
+    return [guid isEqualToString:item.guid];
+  }
+  return item.guid.length == 0 && [RSSItemNormalizedLinkString(self.link) isEqualToString:RSSItemNormalizedLinkString(item.link)];
 }
 
 #pragma mark - NSCoding
@@ -68,6 +103,7 @@
     _title = [aDecoder decodeObjectForKey:@"title"];
     _link = [aDecoder decodeObjectForKey:@"link"];
     _itemDescription = [aDecoder decodeObjectForKey:@"itemDescription"];
+    _itemDescriptionImages = [aDecoder decodeObjectForKey:@"itemDescriptionImages"];
     _authorEmail = [aDecoder decodeObjectForKey:@"authorEmail"];
     _commentsURL = [aDecoder decodeObjectForKey:@"commentsURL"];
     _guid = [aDecoder decodeObjectForKey:@"guid"];
@@ -79,6 +115,12 @@
     _mediaCredits = [aDecoder decodeObjectForKey:@"mediaCredits"];
     _mediaThumbnails = [aDecoder decodeObjectForKey:@"mediaThumbnails"];
     _mediaText = [aDecoder decodeObjectForKey:@"mediaText"];
+    _mediaKeywords = [aDecoder decodeObjectForKey:@"mediaKeywords"];
+    _mediaPlayer = [aDecoder decodeObjectForKey:@"mediaPlayer"];
+    _mediaCategories = [aDecoder decodeObjectForKey:@"mediaCategories"];
+    _mediaRatings = [aDecoder decodeObjectForKey:@"mediaRatings"];
+    _mediaRestrictions = [aDecoder decodeObjectForKey:@"mediaRestrictions"];
+    _mediaCommunity = [aDecoder decodeObjectForKey:@"mediaCommunity"];
   }
   return self;
 }
@@ -88,6 +130,7 @@
   [aCoder encodeObject:self.title forKey:@"title"];
   [aCoder encodeObject:self.link forKey:@"link"];
   [aCoder encodeObject:self.itemDescription forKey:@"itemDescription"];
+  [aCoder encodeObject:self.itemDescriptionImages forKey:@"itemDescriptionImages"];
   [aCoder encodeObject:self.authorEmail forKey:@"authorEmail"];
   [aCoder encodeObject:self.commentsURL forKey:@"commentsLink"];
   [aCoder encodeObject:self.guid forKey:@"guid"];
@@ -99,19 +142,31 @@
   [aCoder encodeObject:self.mediaCredits forKey:@"mediaCredits"];
   [aCoder encodeObject:self.mediaThumbnails forKey:@"mediaThumbnails"];
   [aCoder encodeObject:self.mediaText forKey:@"mediaText"];
+  [aCoder encodeObject:self.mediaKeywords forKey:@"mediaKeywords"];
+  [aCoder encodeObject:self.mediaPlayer forKey:@"mediaPlayer"];
+  [aCoder encodeObject:self.mediaCategories forKey:@"mediaCategories"];
+  [aCoder encodeObject:self.mediaRatings forKey:@"mediaRatings"];
+  [aCoder encodeObject:self.mediaRestrictions forKey:@"mediaRestrictions"];
+  [aCoder encodeObject:self.mediaCommunity forKey:@"mediaCommunity"];
 }
 
 #pragma mark - NSObject Protocol
 
 - (BOOL)isEqual:(RSSItem *)object
 {
-  return [object isKindOfClass:[self class]] &&
-    [object.link.absoluteString isEqualToString:self.link.absoluteString];
+  if (object == self) {
+    return YES;
+  }
+  
+  uint64_t identityKey = self.identityKey;
+  return [object isKindOfClass:[RSSItem class]] && identityKey != RSSItemNoIdentityKey &&
+    object.identityKey == identityKey && [self hasSameIdentityAsItem:object];
 }
 
 - (NSUInteger)hash
 {
-  return [self.link.absoluteString hash];
+  uint64_t identityKey = self.identityKey;
+  return identityKey != RSSItemNoIdentityKey ? (NSUInteger)identityKey : [super hash];
 }
 
 - (NSString *)description
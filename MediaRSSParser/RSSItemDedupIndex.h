@@ -0,0 +1,110 @@
+//
+//  RSSItemDedupIndex.h
+//  MediaRSSParser
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+
+
+
+#import <Foundation/Foundation.h>
+
+@class RSSItem;
+
+/**
+ *  The number of shards of an `RSSItemDedupIndex` created with `init`.
+ */
+extern const NSUInteger RSSItemDedupIndexDefaultShardCount;
+
+/**
+ *  `RSSItemDedupIndex` is a set of item identity keys (see `-[RSSItem identityKey]`) for deduplicating items across any number of channels, for example when merging many feeds that syndicate the same items.
+ *
+ *  Only the 64-bit keys are stored, not the items, so an index of a million items takes 16 to 32 MB. Keys are spread over shards by their high bits, and each shard has its own lock, so many threads can add and look up items at the same time with little contention.
+ *
+ *  Because the items aren't stored, the index treats equal identity keys as equal items. Unlike `-[RSSItem isEqual:]`, it can't confirm a match by comparing `guid` or `link`, so two different items whose keys collide are treated as duplicates and the second is dropped. For `n` items, the chance of any collision is about `n * n / 2^65`, or roughly one in 37 million for a million items. If that isn't acceptable, deduplicate with an `NSMutableSet` of the items instead.
+ *
+ *  Items without an identity key (`RSSItemNoIdentityKey`) can't be deduplicated: they're never contained in an index, and adding one always succeeds without storing anything.
+ */
+@interface RSSItemDedupIndex : NSObject
+
+///---------------------
+/// @name Creating Indexes
+///---------------------
+
+/**
+ *  Returns an empty index with `shardCount` shards, rounded up to a power of two. More shards reduce contention between threads adding items at the same time.
+ */
+- (instancetype)initWithShardCount:(NSUInteger)shardCount;
+
+/**
+ *  The number of shards.
+ */
+@property (nonatomic, assign, readonly) NSUInteger shardCount;
+
+/**
+ *  The number of identity keys within the index.
+ */
+@property (nonatomic, assign, readonly) NSUInteger count;
+
+///---------------------
+/// @name Adding Items
+///---------------------
+
+/**
+ *  Adds the identity key of `item` to the index.
+ *
+ *  @return `YES` if no item with the same identity key had been added before, otherwise `NO`
+ */
+- (BOOL)addItem:(RSSItem *)item;
+
+/**
+ *  Adds the identity key of each of the given items, in order.
+ *
+ *  @return The items that weren't duplicates of an item added before, including of an earlier item within `items`, in their original order
+ */
+- (NSArray *)addItemsFromArray:(NSArray *)items;
+
+/**
+ *  Adds the given identity key, the same as `addItem:`.
+ */
+- (BOOL)addIdentityKey:(uint64_t)identityKey;
+
+///---------------------
+/// @name Looking Up Items
+///---------------------
+
+/**
+ *  Returns `YES` if an item with the same identity key as `item` has been added.
+ */
+- (BOOL)containsItem:(RSSItem *)item;
+
+/**
+ *  Returns `YES` if the given identity key has been added.
+ */
+- (BOOL)containsIdentityKey:(uint64_t)identityKey;
+
+///---------------------
+/// @name Removing Items
+///---------------------
+
+/**
+ *  Removes every identity key from the index.
+ */
+- (void)removeAllItems;
+
+@end
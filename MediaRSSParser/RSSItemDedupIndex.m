@@ -0,0 +1,218 @@
+//
+//  RSSItemDedupIndex.m
+//  MediaRSSParser
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+
+
+
+#import "RSSItemDedupIndex.h"
+#import "RSSItem.h"
+#import "RSSItemIdentity.h"
+
+#import <pthread.h>
+
+const NSUInteger RSSItemDedupIndexDefaultShardCount = 64;
+
+static const NSUInteger RSSItemDedupIndexInitialSlotCount = 64;
+
+// Shards take their index from bits 40 and up of a key, and slots from its low bits.
+static const NSUInteger RSSItemDedupIndexShardShift = 40;
+static const NSUInteger RSSItemDedupIndexMaxShardCount = 1 << 16;
+
+// Each shard is an open-addressed table with linear probing, at most half full. An empty slot holds
+// `RSSItemNoIdentityKey`, which is never stored. Shards are aligned to cache lines so that
+// threads locking neighbouring shards don't contend for the same line.
+typedef struct {
+  pthread_mutex_t lock;
+  uint64_t *slots;
+  NSUInteger slotCount;
+  NSUInteger count;
+} __attribute__((aligned(64))) RSSItemDedupShard;
+
+static NSUInteger RSSItemDedupShardFindSlot(const uint64_t *slots, NSUInteger slotCount, uint64_t key)
+{
+  NSUInteger mask = slotCount - 1;
+  NSUInteger index = (NSUInteger)key & mask;
+  
+  while (slots[index] != RSSItemNoIdentityKey && slots[index] != key) {
+    index = (index + 1) & mask;
+  }
+  return index;
+}
+
+static void RSSItemDedupShardGrow(RSSItemDedupShard *shard)
+{
+  NSUInteger slotCount = shard->slotCount ? shard->slotCount * 2 : RSSItemDedupIndexInitialSlotCount;
+  uint64_t *slots = calloc(slotCount, sizeof(uint64_t));
+  
+  for (NSUInteger i = 0; i < shard->slotCount; i++) {
+    uint64_t key = shard->slots[i];
+    if (key != RSSItemNoIdentityKey) {
+      slots[RSSItemDedupShardFindSlot(slots, slotCount, key)] = key;
+    }
+  }
+  
+  free(shard->slots);
+  shard->slots = slots;
+  shard->slotCount = slotCount;
+}
+
+@implementation RSSItemDedupIndex
+{
+  RSSItemDedupShard *_shards;
+  NSUInteger _shardMask;
+}
+
+#pragma mark - Object Lifecycle
+
+- (instancetype)init
+{
+  return [self initWithShardCount:RSSItemDedupIndexDefaultShardCount];
+}
+
+- (instancetype)initWithShardCount:(NSUInteger)shardCount
+{
+  self = [super init];
+  if (self) {
+    _shardCount = 1;
+    while (_shardCount < MIN(shardCount, RSSItemDedupIndexMaxShardCount)) {
+      _shardCount *= 2;
+    }
+    _shardMask = _shardCount - 1;
+    
+    void *shards = NULL;
+    posix_memalign(&shards, 64, _shardCount * sizeof(RSSItemDedupShard));
+    _shards = shards;
+    memset(_shards, 0, _shardCount * sizeof(RSSItemDedupShard));
+    
+    for (NSUInteger i = 0; i < _shardCount; i++) {
+      pthread_mutex_init(&_shards[i].lock, NULL);
+    }
+  }
+  return self;
+}
+
+- (void)dealloc
+{
+  for (NSUInteger i = 0; i < _shardCount; i++) {
+    pthread_mutex_destroy(&_shards[i].lock);
+    free(_shards[i].slots);
+  }
+  free(_shards);
+}
+
+#pragma mark - Shards
+
+- (RSSItemDedupShard *)shardForIdentityKey:(uint64_t)identityKey
+{
+  return &_shards[(NSUInteger)(identityKey >> RSSItemDedupIndexShardShift) & _shardMask];
+}
+
+#pragma mark - Adding Items
+
+- (BOOL)addItem:(RSSItem *)item
+{
+  return [self addIdentityKey:item.identityKey];
+}
+
+- (NSArray *)addItemsFromArray:(NSArray *)items
+{
+  NSMutableArray *newItems = [[NSMutableArray alloc] initWithCapacity:items.count];
+  for (RSSItem *item in items) {
+    if ([self addItem:item]) {
+      [newItems addObject:item];
+    }
+  }
+  return newItems;
+}
+
+- (BOOL)addIdentityKey:(uint64_t)identityKey
+{
+  if (identityKey == RSSItemNoIdentityKey) {
+    return YES;
+  }
+  
+  RSSItemDedupShard *shard = [self shardForIdentityKey:identityKey];
+  pthread_mutex_lock(&shard->lock);
+  
+  if ((shard->count + 1) * 2 > shard->slotCount) {
+    RSSItemDedupShardGrow(shard);
+  }
+  
+  NSUInteger index = RSSItemDedupShardFindSlot(shard->slots, shard->slotCount, identityKey);
+  BOOL added = shard->slots[index] == RSSItemNoIdentityKey;
+  if (added) {
+    shard->slots[index] = identityKey;
+    shard->count += 1;
+  }
+  
+  pthread_mutex_unlock(&shard->lock);
+  return added;
+}
+
+#pragma mark - Looking Up Items
+
+- (BOOL)containsItem:(RSSItem *)item
+{
+  return [self containsIdentityKey:item.identityKey];
+}
+
+- (BOOL)containsIdentityKey:(uint64_t)identityKey
+{
+  if (identityKey == RSSItemNoIdentityKey) {
+    return NO;
+  }
+  
+  RSSItemDedupShard *shard = [self shardForIdentityKey:identityKey];
+  pthread_mutex_lock(&shard->lock);
+  
+  BOOL contains = shard->slotCount > 0 &&
+    shard->slots[RSSItemDedupShardFindSlot(shard->slots, shard->slotCount, identityKey)] == identityKey;
+  
+  pthread_mutex_unlock(&shard->lock);
+  return contains;
+}
+
+- (NSUInteger)count
+{
+  NSUInteger count = 0;
+  for (NSUInteger i = 0; i < _shardCount; i++) {
+    pthread_mutex_lock(&_shards[i].lock);
+    count += _shards[i].count;
+    pthread_mutex_unlock(&_shards[i].lock);
+  }
+  return count;
+}
+
+#pragma mark - Removing Items
+
+- (void)removeAllItems
+{
+  for (NSUInteger i = 0; i < _shardCount; i++) {
+    pthread_mutex_lock(&_shards[i].lock);
+    free(_shards[i].slots);
+    _shards[i].slots = NULL;
+    _shards[i].slotCount = 0;
+    _shards[i].count = 0;
+    pthread_mutex_unlock(&_shards[i].lock);
+  }
+}
+
+@end
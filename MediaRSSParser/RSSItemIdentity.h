@@ -0,0 +1,46 @@
+//
+//  RSSItemIdentity.h
+//  MediaRSSParser
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+
+
+
+#import <Foundation/Foundation.h>
+
+/**
+ *  The identity key of an item that has neither a `guid` nor a `link`. No other item identity key is ever `0`.
+ */
+extern const uint64_t RSSItemNoIdentityKey;
+
+/**
+ *  Returns the 64-bit identity key of an item with the given `guid` and `link`, as stored by `-[RSSItem identityKey]`.
+ *
+ *  The key is a hash of `guid` if it's non-empty, and otherwise of `link` normalized by `RSSItemNormalizedLinkString`. Keys derived from a `guid` and from a `link` never intentionally coincide, even if the strings are equal. Keys don't depend on the process or platform, so they may be persisted.
+ *
+ *  @return The identity key, or `RSSItemNoIdentityKey` if there's neither a non-empty `guid` nor a non-empty `link`
+ */
+extern uint64_t RSSItemIdentityKey(NSString *guid, NSURL *link);
+
+/**
+ *  Returns the `absoluteString` of `link` with its scheme and authority lowercased, the default port of `http` (`80`) or `https` (`443`) removed, an empty path after the authority replaced with `/`, and its fragment removed. Links that only differ in these ways refer to the same item.
+ *
+ *  @return The normalized string, or `nil` if `link` is `nil`
+ */
+extern NSString *RSSItemNormalizedLinkString(NSURL *link);
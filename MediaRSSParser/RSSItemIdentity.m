@@ -0,0 +1,205 @@
+//
+//  RSSItemIdentity.m
+//  MediaRSSParser
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+
+
+
+#import "RSSItemIdentity.h"
+
+const uint64_t RSSItemNoIdentityKey = 0;
+
+static const uint64_t RSSItemIdentityFNVOffsetBasis = 0xcbf29ce484222325ULL;
+static const uint64_t RSSItemIdentityFNVPrime = 0x100000001b3ULL;
+
+// The parts of a link's `absoluteString` that `RSSItemNormalizedLinkString` keeps: characters before
+// `lowercaseEnd` are lowercased, then `/` is inserted if `insertsSlash`, then the characters from `restStart`
+// up to `end` are kept as they are.
+typedef struct {
+  CFIndex lowercaseEnd;
+  CFIndex restStart;
+  CFIndex end;
+  BOOL insertsSlash;
+} RSSItemLinkParts;
+
+static inline unichar RSSItemIdentityLowercase(unichar c)
+{
+  return (c >= 'A' && c <= 'Z') ? (unichar)(c + ('a' - 'A')) : c;
+}
+
+static BOOL RSSItemLinkHasSubstring(CFStringInlineBuffer *buffer, CFIndex index, CFIndex end, const char *string)
+{
+  for (CFIndex i = 0; string[i]; i++) {
+    if (index + i >= end || RSSItemIdentityLowercase(CFStringGetCharacterFromInlineBuffer(buffer, index + i)) != (unichar)string[i]) {
+      return NO;
+    }
+  }
+  return YES;
+}
+
+static RSSItemLinkParts RSSItemLinkPartsOfString(CFStringInlineBuffer *buffer, CFIndex length)
+{
+  RSSItemLinkParts parts = { 0, 0, length, NO };
+  
+  for (CFIndex i = 0; i < length; i++) {
+    if (CFStringGetCharacterFromInlineBuffer(buffer, i) == '#') {
+      parts.end = i;
+      break;
+    }
+  }
+  
+  CFIndex schemeEnd = kCFNotFound;
+  for (CFIndex i = 0; i < parts.end; i++) {
+    unichar c = CFStringGetCharacterFromInlineBuffer(buffer, i);
+    if (c == ':') {
+      schemeEnd = i;
+      break;
+    } else if (c == '/' || c == '?') {
+      break;
+    }
+  }
+  
+  if (schemeEnd == kCFNotFound) {
+    return parts;
+  }
+  
+  parts.lowercaseEnd = parts.restStart = schemeEnd;
+  if (!RSSItemLinkHasSubstring(buffer, schemeEnd, parts.end, "://")) {
+    return parts;
+  }
+  
+  CFIndex authorityEnd = schemeEnd + 3;
+  while (authorityEnd < parts.end) {
+    unichar c = CFStringGetCharacterFromInlineBuffer(buffer, authorityEnd);
+    if (c == '/' || c == '?') {
+      break;
+    }
+    authorityEnd++;
+  }
+  
+  parts.lowercaseEnd = parts.restStart = authorityEnd;
+  parts.insertsSlash = authorityEnd == parts.end || CFStringGetCharacterFromInlineBuffer(buffer, authorityEnd) == '?';
+  
+  const char *defaultPort = NULL;
+  if (schemeEnd == 4 && RSSItemLinkHasSubstring(buffer, 0, schemeEnd, "http")) {
+    defaultPort = ":80";
+  } else if (schemeEnd == 5 && RSSItemLinkHasSubstring(buffer, 0, schemeEnd, "https")) {
+    defaultPort = ":443";
+  }
+  
+  CFIndex portLength = defaultPort ? (CFIndex)strlen(defaultPort) : 0;
+  if (defaultPort && authorityEnd - portLength > schemeEnd + 3 &&
+      RSSItemLinkHasSubstring(buffer, authorityEnd - portLength, authorityEnd, defaultPort)) {
+    parts.lowercaseEnd = authorityEnd - portLength;
+  }
+  
+  return parts;
+}
+
+#pragma mark - Hashing
+
+static inline uint64_t RSSItemIdentityHashCharacter(uint64_t hash, unichar c)
+{
+  hash = (hash ^ (c & 0xFF)) * RSSItemIdentityFNVPrime;
+  return (hash ^ (c >> 8)) * RSSItemIdentityFNVPrime;
+}
+
+// FNV-1a over UTF-16 code units, followed by the SplitMix64 finalizer so that every bit of the key depends on every
+// character. Sharded tables take their shard and slot from different bits of the key.
+static inline uint64_t RSSItemIdentityFinalizeHash(uint64_t hash)
+{
+  hash = (hash ^ (hash >> 30)) * 0xbf58476d1ce4e5b9ULL;
+  hash = (hash ^ (hash >> 27)) * 0x94d049bb133111ebULL;
+  hash ^= hash >> 31;
+  return hash == RSSItemNoIdentityKey ? 1 : hash;
+}
+
+static uint64_t RSSItemIdentityGuidKey(NSString *guid)
+{
+  CFIndex length = (CFIndex)guid.length;
+  CFStringInlineBuffer buffer;
+  CFStringInitInlineBuffer((__bridge CFStringRef)guid, &buffer, CFRangeMake(0, length));
+  
+  uint64_t hash = RSSItemIdentityHashCharacter(RSSItemIdentityFNVOffsetBasis, 'g');
+  for (CFIndex i = 0; i < length; i++) {
+    hash = RSSItemIdentityHashCharacter(hash, CFStringGetCharacterFromInlineBuffer(&buffer, i));
+  }
+  return RSSItemIdentityFinalizeHash(hash);
+}
+
+static uint64_t RSSItemIdentityLinkKey(NSString *link)
+{
+  CFIndex length = (CFIndex)link.length;
+  CFStringInlineBuffer buffer;
+  CFStringInitInlineBuffer((__bridge CFStringRef)link, &buffer, CFRangeMake(0, length));
+  RSSItemLinkParts parts = RSSItemLinkPartsOfString(&buffer, length);
+  
+  uint64_t hash = RSSItemIdentityHashCharacter(RSSItemIdentityFNVOffsetBasis, 'l');
+  for (CFIndex i = 0; i < parts.lowercaseEnd; i++) {
+    hash = RSSItemIdentityHashCharacter(hash, RSSItemIdentityLowercase(CFStringGetCharacterFromInlineBuffer(&buffer, i)));
+  }
+  if (parts.insertsSlash) {
+    hash = RSSItemIdentityHashCharacter(hash, '/');
+  }
+  for (CFIndex i = parts.restStart; i < parts.end; i++) {
+    hash = RSSItemIdentityHashCharacter(hash, CFStringGetCharacterFromInlineBuffer(&buffer, i));
+  }
+  return RSSItemIdentityFinalizeHash(hash);
+}
+
+uint64_t RSSItemIdentityKey(NSString *guid, NSURL *link)
+{
+  if (guid.length) {
+    return RSSItemIdentityGuidKey(guid);
+  }
+  
+  NSString *linkString = link.absoluteString;
+  return linkString.length ? RSSItemIdentityLinkKey(linkString) : RSSItemNoIdentityKey;
+}
+
+#pragma mark - Normalizing Links
+
+NSString *RSSItemNormalizedLinkString(NSURL *link)
+{
+  NSString *string = link.absoluteString;
+  if (!string) {
+    return nil;
+  }
+  
+  CFIndex length = (CFIndex)string.length;
+  CFStringInlineBuffer buffer;
+  CFStringInitInlineBuffer((__bridge CFStringRef)string, &buffer, CFRangeMake(0, length));
+  RSSItemLinkParts parts = RSSItemLinkPartsOfString(&buffer, length);
+  
+  unichar *characters = malloc(((NSUInteger)length + 1) * sizeof(unichar));
+  NSUInteger count = 0;
+  
+  for (CFIndex i = 0; i < parts.lowercaseEnd; i++) {
+    characters[count++] = RSSItemIdentityLowercase(CFStringGetCharacterFromInlineBuffer(&buffer, i));
+  }
+  if (parts.insertsSlash) {
+    characters[count++] = '/';
+  }
+  for (CFIndex i = parts.restStart; i < parts.end; i++) {
+    characters[count++] = CFStringGetCharacterFromInlineBuffer(&buffer, i);
+  }
+  
+  return [[NSString alloc] initWithCharactersNoCopy:characters length:count freeWhenDone:YES];
+}
@@ -0,0 +1,70 @@
+//
+//  RSSLazyItem.h
+//  MediaRSSParser
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+
+
+
+#import "RSSItem.h"
+#import "RSSParserElements.h"
+
+/**
+ *  `RSSLazyItem` is the `RSSItem` subclass created by `RSSParser` when `decodesItemFieldsLazily` is set.
+ *
+ *  Rather than a decoded value, each text property (`title`, `link`, `itemDescription`, `authorEmail`, `commentsURL`, `guid`, `pubDate`, `mediaTitle`, `mediaDescription` and `mediaText`) initially holds the byte range of its element's content within the source document. The content is decoded the first time the property is read, then kept for later reads. Once every property has been decoded, the source document is released.
+ *
+ *  Setting a property discards its byte range. Accessors are synchronized, so items can be read from any thread.
+ */
+@interface RSSLazyItem : RSSItem
+
+/**
+ *  Returns an item with no properties set, whose byte ranges refer to the given UTF-8 encoded document.
+ *
+ *  @param data          The document the item was parsed from. It's retained until every property has been decoded.
+ *  @param dateFormatter The fallback date formatter used for `pubDate`, see `RSSParser`.
+ */
+- (instancetype)initWithSourceData:(NSData *)data dateFormatter:(NSDateFormatter *)dateFormatter;
+
+/**
+ *  Returns `YES` if the property for the given element type is decoded lazily by this class.
+ */
++ (BOOL)decodesElementTypeLazily:(RSSElementType)elementType;
+
+/**
+ *  Sets the byte range of the raw content (character data, entity references, CDATA sections, comments and any nested markup) of an element of the given type within the source document. An empty range is ignored, the same as an empty element when decoding eagerly.
+ */
+- (void)setSourceRange:(NSRange)range forElementType:(RSSElementType)elementType;
+
+/**
+ *  The number of properties that still hold a byte range rather than a decoded value.
+ */
+@property (nonatomic, assign, readonly) NSUInteger pendingFieldCount;
+
+@end
+
+/**
+ *  Decodes the raw content of an XML element the same way the parsing backends report its text: entity and character references are replaced, line endings are normalized to `\n`, and CDATA sections, comments, processing instructions and nested tags are dropped.
+ *
+ *  @param bytes  The UTF-8 encoded content
+ *  @param length The number of bytes
+ *
+ *  @return The decoded text, or `nil` if it isn't valid UTF-8.
+ */
+extern NSString *RSSXMLTextFromBytes(const char *bytes, NSUInteger length);
@@ -0,0 +1,537 @@
+//
+//  RSSLazyItem.m
+//  MediaRSSParser
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+
+
+
+#import "RSSLazyItem.h"
+#import "RSSDateParsing.h"
+
+typedef NS_ENUM(NSUInteger, RSSLazyItemField) {
+  RSSLazyItemFieldTitle = 0,
+  RSSLazyItemFieldLink,
+  RSSLazyItemFieldDescription,
+  RSSLazyItemFieldAuthor,
+  RSSLazyItemFieldComments,
+  RSSLazyItemFieldGuid,
+  RSSLazyItemFieldPubDate,
+  RSSLazyItemFieldMediaTitle,
+  RSSLazyItemFieldMediaDescription,
+  RSSLazyItemFieldMediaText,
+  
+  RSSLazyItemFieldCount
+};
+
+static NSUInteger RSSLazyItemFieldForElementType(RSSElementType elementType)
+{
+  switch (elementType) {
+    case RSSElementTypeTitle:             return RSSLazyItemFieldTitle;
+    case RSSElementTypeLink:              return RSSLazyItemFieldLink;
+    case RSSElementTypeDescription:       return RSSLazyItemFieldDescription;
+    case RSSElementTypeAuthor:            return RSSLazyItemFieldAuthor;
+    case RSSElementTypeComments:          return RSSLazyItemFieldComments;
+    case RSSElementTypeGuid:              return RSSLazyItemFieldGuid;
+    case RSSElementTypePubDate:           return RSSLazyItemFieldPubDate;
+    case RSSElementTypeMediaTitle:        return RSSLazyItemFieldMediaTitle;
+    case RSSElementTypeMediaDescription:  return RSSLazyItemFieldMediaDescription;
+    case RSSElementTypeMediaText:         return RSSLazyItemFieldMediaText;
+    default:                              return NSNotFound;
+  }
+}
+
+#pragma mark - Decoding Text
+
+static BOOL RSSXMLTextNeedsDecoding(const char *bytes, NSUInteger length)
+{
+  for (NSUInteger i = 0; i < length; i++) {
+    char c = bytes[i];
+    if (c == '&' || c == '<' || c == '\r') {
+      return YES;
+    }
+  }
+  return NO;
+}
+
+static BOOL RSSXMLHasPrefix(const char *c, const char *end, const char *prefix)
+{
+  size_t length = strlen(prefix);
+  return (size_t)(end - c) >= length && memcmp(c, prefix, length) == 0;
+}
+
+// Returns the position just past the next `terminator`, or `end` if there isn't one.
+static const char *RSSXMLSkipPast(const char *c, const char *end, const char *terminator)
+{
+  size_t length = strlen(terminator);
+  for (; (size_t)(end - c) >= length; c++) {
+    if (memcmp(c, terminator, length) == 0) {
+      return c + length;
+    }
+  }
+  return end;
+}
+
+// Skips the markup starting at `c`, which points at a `<`.
+static const char *RSSXMLSkipMarkup(const char *c, const char *end)
+{
+  if (RSSXMLHasPrefix(c, end, "<![CDATA[")) {
+    return RSSXMLSkipPast(c + 9, end, "]]>");
+  }
+  if (RSSXMLHasPrefix(c, end, "<!--")) {
+    return RSSXMLSkipPast(c + 4, end, "-->");
+  }
+  if (RSSXMLHasPrefix(c, end, "<?")) {
+    return RSSXMLSkipPast(c + 2, end, "?>");
+  }
+  
+  // A nested start or end tag, whose attribute values may contain `>`
+  char quote = 0;
+  for (c++; c < end; c++) {
+    if (quote) {
+      if (*c == quote) {
+        quote = 0;
+      }
+    } else if (*c == '"' || *c == '\'') {
+      quote = *c;
+    } else if (*c == '>') {
+      return c + 1;
+    }
+  }
+  return end;
+}
+
+static size_t RSSXMLWriteUTF8(uint32_t codePoint, char *output)
+{
+  if (codePoint < 0x80) {
+    output[0] = (char)codePoint;
+    return 1;
+  }
+  if (codePoint < 0x800) {
+    output[0] = (char)(0xC0 | (codePoint >> 6));
+    output[1] = (char)(0x80 | (codePoint & 0x3F));
+    return 2;
+  }
+  if (codePoint < 0x10000) {
+    output[0] = (char)(0xE0 | (codePoint >> 12));
+    output[1] = (char)(0x80 | ((codePoint >> 6) & 0x3F));
+    output[2] = (char)(0x80 | (codePoint & 0x3F));
+    return 3;
+  }
+  output[0] = (char)(0xF0 | (codePoint >> 18));
+  output[1] = (char)(0x80 | ((codePoint >> 12) & 0x3F));
+  output[2] = (char)(0x80 | ((codePoint >> 6) & 0x3F));
+  output[3] = (char)(0x80 | (codePoint & 0x3F));
+  return 4;
+}
+
+// Returns the code point of a character reference name such as `#38` or `#x26`, or 0 if it isn't valid.
+static uint32_t RSSXMLCharacterReference(const char *name, size_t length)
+{
+  BOOL hex = length > 1 && (name[1] == 'x' || name[1] == 'X');
+  size_t i = hex ? 2 : 1;
+  if (i == length) {
+    return 0;
+  }
+  
+  uint32_t codePoint = 0;
+  for (; i < length; i++) {
+    char c = name[i];
+    uint32_t digit;
+    if (c >= '0' && c <= '9') {
+      digit = (uint32_t)(c - '0');
+    } else if (hex && c >= 'a' && c <= 'f') {
+      digit = (uint32_t)(c - 'a' + 10);
+    } else if (hex && c >= 'A' && c <= 'F') {
+      digit = (uint32_t)(c - 'A' + 10);
+    } else {
+      return 0;
+    }
+    codePoint = codePoint * (hex ? 16 : 10) + digit;
+    if (codePoint > 0x10FFFF) {
+      return 0;
+    }
+  }
+  
+  BOOL surrogate = codePoint >= 0xD800 && codePoint <= 0xDFFF;
+  return surrogate ? 0 : codePoint;
+}
+
+// Returns the code point of one of the five predefined entities, or 0.
+static uint32_t RSSXMLPredefinedEntity(const char *name, size_t length)
+{
+  static const struct { const char *name; uint32_t codePoint; } entities[] = {
+    { "amp", '&' }, { "lt", '<' }, { "gt", '>' }, { "quot", '"' }, { "apos", '\'' },
+  };
+  for (size_t i = 0; i < sizeof(entities) / sizeof(entities[0]); i++) {
+    if (strlen(entities[i].name) == length && memcmp(entities[i].name, name, length) == 0) {
+      return entities[i].codePoint;
+    }
+  }
+  return 0;
+}
+
+// Decodes the reference starting at `c`, which points at a `&`, and returns the position after it. References that can't be decoded are copied as they are.
+static const char *RSSXMLDecodeReference(const char *c, const char *end, char **output)
+{
+  // The longest reference that can be decoded is `&#x10FFFF;` or `&#1114111;`
+  const char *semicolon = memchr(c, ';', (size_t)MIN(end - c, 11));
+  
+  if (semicolon) {
+    const char *name = c + 1;
+    size_t length = (size_t)(semicolon - name);
+    uint32_t codePoint = (length && name[0] == '#') ? RSSXMLCharacterReference(name, length) : RSSXMLPredefinedEntity(name, length);
+    
+    if (codePoint) {
+      *output += RSSXMLWriteUTF8(codePoint, *output);
+      return semicolon + 1;
+    }
+  }
+  
+  *(*output)++ = '&';
+  return c + 1;
+}
+
+NSString *RSSXMLTextFromBytes(const char *bytes, NSUInteger length)
+{
+  if (!RSSXMLTextNeedsDecoding(bytes, length)) {
+    return [[NSString alloc] initWithBytes:bytes length:length encoding:NSUTF8StringEncoding];
+  }
+  
+  // Decoding never lengthens the text: every reference is at least as long as the UTF-8 it's replaced by.
+  char *decoded = malloc(length);
+  char *output = decoded;
+  const char *c = bytes, *end = bytes + length;
+  
+  while (c < end) {
+    switch (*c) {
+      case '&':
+        c = RSSXMLDecodeReference(c, end, &output);
+        break;
+        
+      case '<':
+        c = RSSXMLSkipMarkup(c, end);
+        break;
+        
+      case '\r':
+        *output++ = '\n';
+        c++;
+        if (c < end && *c == '\n') {
+          c++;
+        }
+        break;
+        
+      default:
+        *output++ = *c++;
+        break;
+    }
+  }
+  
+  NSString *string = [[NSString alloc] initWithBytes:decoded length:(NSUInteger)(output - decoded) encoding:NSUTF8StringEncoding];
+  free(decoded);
+  return string;
+}
+
+@implementation RSSLazyItem
+{
+  NSData *_sourceData;
+  NSDateFormatter *_dateFormatter;
+  NSRange _sourceRanges[RSSLazyItemFieldCount];
+  NSUInteger _pendingFields;
+}
+
+#pragma mark - Object Lifecycle
+
+- (instancetype)initWithSourceData:(NSData *)data dateFormatter:(NSDateFormatter *)dateFormatter
+{
+  self = [super init];
+  if (self) {
+    _sourceData = data;
+    _dateFormatter = dateFormatter;
+  }
+  return self;
+}
+
++ (BOOL)decodesElementTypeLazily:(RSSElementType)elementType
+{
+  return RSSLazyItemFieldForElementType(elementType) != NSNotFound;
+}
+
+#pragma mark - Source Ranges
+
+- (void)setSourceRange:(NSRange)range forElementType:(RSSElementType)elementType
+{
+  NSUInteger field = RSSLazyItemFieldForElementType(elementType);
+  
+  @synchronized(self) {
+    if (field == NSNotFound || range.length == 0 || NSMaxRange(range) > _sourceData.length) {
+      return;
+    }
+    _sourceRanges[field] = range;
+    _pendingFields |= (1 << field);
+  }
+}
+
+- (NSUInteger)pendingFieldCount
+{
+  @synchronized(self) {
+    NSUInteger count = 0;
+    for (NSUInteger field = 0; field < RSSLazyItemFieldCount; field++) {
+      count += (_pendingFields >> field) & 1;
+    }
+    return count;
+  }
+}
+
+- (void)decodeFieldIfPending:(RSSLazyItemField)field
+{
+  @synchronized(self) {
+    if ((_pendingFields & (1 << field)) == 0) {
+      return;
+    }
+    _pendingFields &= ~(1 << field);
+    
+    NSRange range = _sourceRanges[field];
+    NSString *string = RSSXMLTextFromBytes((const char *)_sourceData.bytes + range.location, range.length);
+    
+    // Matches the eager parse, which ignores elements without text
+    if (string.length) {
+      [self setDecodedString:string forField:field];
+    }
+    
+    if (_pendingFields == 0) {
+      _sourceData = nil;
+      _dateFormatter = nil;
+    }
+  }
+}
+
+- (void)discardFieldIfPending:(RSSLazyItemField)field
+{
+  _pendingFields &= ~(1 << field);
+}
+
+- (void)setDecodedString:(NSString *)string forField:(RSSLazyItemField)field
+{
+  switch (field) {
+    case RSSLazyItemFieldTitle:
+      [super setTitle:string];
+      break;
+      
+    case RSSLazyItemFieldLink:
+      [super setLink:[NSURL URLWithString:string]];
+      break;
+      
+    case RSSLazyItemFieldDescription:
+      [super setItemDescription:string];
+      break;
+      
+    case RSSLazyItemFieldAuthor:
+      [super setAuthorEmail:string];
+      break;
+      
+    case RSSLazyItemFieldComments:
+      [super setCommentsURL:[NSURL URLWithString:string]];
+      break;
+      
+    case RSSLazyItemFieldGuid:
+      [super setGuid:string];
+      break;
+      
+    case RSSLazyItemFieldPubDate:
+      [super setPubDate:RSSDateFromString(string) ?: [_dateFormatter dateFromString:string]];
+      break;
+      
+    case RSSLazyItemFieldMediaTitle:
+      [super setMediaTitle:string];
+      break;
+      
+    case RSSLazyItemFieldMediaDescription:
+      [super setMediaDescription:string];
+      break;
+      
+    case RSSLazyItemFieldMediaText:
+      [super setMediaText:string];
+      break;
+      
+    default:
+      break;
+  }
+}
+
+#pragma mark - Custom Accessors
+
+- (NSString *)title
+{
+  [self decodeFieldIfPending:RSSLazyItemFieldTitle];
+  return [super title];
+}
+
+- (void)setTitle:(NSString *)title
+{
+  @synchronized(self) {
+    [self discardFieldIfPending:RSSLazyItemFieldTitle];
+    [super setTitle:title];
+  }
+}
+
+- (NSURL *)link
+{
+  [self decodeFieldIfPending:RSSLazyItemFieldLink];
+  return [super link];
+}
+
+- (void)setLink:(NSURL *)link
+{
+  @synchronized(self) {
+    [self discardFieldIfPending:RSSLazyItemFieldLink];
+    [super setLink:link];
+  }
+}
+
+- (NSString *)itemDescription
+{
+  [self decodeFieldIfPending:RSSLazyItemFieldDescription];
+  return [super itemDescription];
+}
+
+- (void)setItemDescription:(NSString *)itemDescription
+{
+  @synchronized(self) {
+    [self discardFieldIfPending:RSSLazyItemFieldDescription];
+    [super setItemDescription:itemDescription];
+  }
+}
+
+- (NSString *)authorEmail
+{
+  [self decodeFieldIfPending:RSSLazyItemFieldAuthor];
+  return [super authorEmail];
+}
+
+- (void)setAuthorEmail:(NSString *)authorEmail
+{
+  @synchronized(self) {
+    [self discardFieldIfPending:RSSLazyItemFieldAuthor];
+    [super setAuthorEmail:authorEmail];
+  }
+}
+
+- (NSURL *)commentsURL
+{
+  [self decodeFieldIfPending:RSSLazyItemFieldComments];
+  return [super commentsURL];
+}
+
+- (void)setCommentsURL:(NSURL *)commentsURL
+{
+  @synchronized(self) {
+    [self discardFieldIfPending:RSSLazyItemFieldComments];
+    [super setCommentsURL:commentsURL];
+  }
+}
+
+- (NSString *)guid
+{
+  [self decodeFieldIfPending:RSSLazyItemFieldGuid];
+  return [super guid];
+}
+
+- (void)setGuid:(NSString *)guid
+{
+  @synchronized(self) {
+    [self discardFieldIfPending:RSSLazyItemFieldGuid];
+    [super setGuid:guid];
+  }
+}
+
+- (NSDate *)pubDate
+{
+  [self decodeFieldIfPending:RSSLazyItemFieldPubDate];
+  return [super pubDate];
+}
+
+- (void)setPubDate:(NSDate *)pubDate
+{
+  @synchronized(self) {
+    [self discardFieldIfPending:RSSLazyItemFieldPubDate];
+    [super setPubDate:pubDate];
+  }
+}
+
+- (NSString *)mediaTitle
+{
+  [self decodeFieldIfPending:RSSLazyItemFieldMediaTitle];
+  return [super mediaTitle];
+}
+
+- (void)setMediaTitle:(NSString *)mediaTitle
+{
+  @synchronized(self) {
+    [self discardFieldIfPending:RSSLazyItemFieldMediaTitle];
+    [super setMediaTitle:mediaTitle];
+  }
+}
+
+- (NSString *)mediaDescription
+{
+  [self decodeFieldIfPending:RSSLazyItemFieldMediaDescription];
+  return [super mediaDescription];
+}
+
+- (void)setMediaDescription:(NSString *)mediaDescription
+{
+  @synchronized(self) {
+    [self discardFieldIfPending:RSSLazyItemFieldMediaDescription];
+    [super setMediaDescription:mediaDescription];
+  }
+}
+
+- (NSString *)mediaText
+{
+  [self decodeFieldIfPending:RSSLazyItemFieldMediaText];
+  return [super mediaText];
+}
+
+- (void)setMediaText:(NSString *)mediaText
+{
+  @synchronized(self) {
+    [self discardFieldIfPending:RSSLazyItemFieldMediaText];
+    [super setMediaText:mediaText];
+  }
+}
+
+#pragma mark - Identity
+
+- (uint64_t)identityKey
+{
+  @synchronized(self) {
+    return [super identityKey];
+  }
+}
+
+#pragma mark - NSCoding
+
+// Archives hold fully decoded `RSSItem` objects, since encoding reads every property.
+- (Class)classForCoder
+{
+  return [RSSItem class];
+}
+
+@end
@@ -0,0 +1,129 @@
+//
+//  RSSMediaAttributes.h
+//  MediaRSSParser
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+
+
+#import <Foundation/Foundation.h>
+#import <CoreGraphics/CoreGraphics.h>
+#import "RSSParserElements.h"
+
+@class RSSStringPool;
+
+/**
+ *  `RSSAttributeType` is how an attribute's value is converted for the model property it's mapped onto.
+ */
+typedef NS_ENUM(NSInteger, RSSAttributeType) {
+  RSSAttributeTypeString = 0,
+  
+  /**
+   *  A string from a small set of values that repeat throughout a feed, such as a MIME type, which is interned in the decoder's string pool.
+   */
+  RSSAttributeTypeToken,
+  
+  RSSAttributeTypeInteger,
+  RSSAttributeTypeFloat,
+  RSSAttributeTypeBool,
+  RSSAttributeTypeURL,
+  
+  /**
+   *  The width of a `CGSize` property, which is set once all of an element's attributes have been decoded.
+   */
+  RSSAttributeTypeWidth,
+  
+  /**
+   *  The height of a `CGSize` property, see `RSSAttributeTypeWidth`.
+   */
+  RSSAttributeTypeHeight,
+};
+
+/**
+ *  `RSSMediaAttributeDecoder` decodes the attributes of a Media RSS element onto a model object in a single pass, using the element's attribute descriptor table (see `RSSMediaAttributes.m`). Each attribute is matched with one hashed lookup, and its value is converted and passed straight to the property's setter.
+ *
+ *  Begin with `RSSMediaAttributeDecoderBegin`, set each attribute, then call `RSSMediaAttributeDecoderEnd` for the object. Every decoder that's begun must be ended.
+ */
+typedef struct {
+  const void *table;
+  CFTypeRef object;
+  const void *stringPool;
+  CGSize size;
+  BOOL hasSize;
+} RSSMediaAttributeDecoder;
+
+/**
+ *  Returns `YES` if the given element type has a descriptor, i.e. it's a Media RSS element whose attributes or text are mapped onto a model object.
+ */
+extern BOOL RSSElementTypeHasDescriptor(RSSElementType elementType);
+
+/**
+ *  Returns a decoder for the attributes of the given element type.
+ *
+ *  @param elementType An element type for which `RSSElementTypeHasDescriptor` is `YES`
+ *  @param object      The object to decode the attributes onto, or `nil` to create a new instance of the element's model class. The `media:starRating` and `media:statistics` elements have no model class of their own, and are decoded onto their `media:community` element's object.
+ *  @param stringPool  The pool that `RSSAttributeTypeToken` values are interned in, or `nil` to not intern them. The decoder doesn't retain it.
+ */
+extern RSSMediaAttributeDecoder RSSMediaAttributeDecoderBegin(RSSElementType elementType, id object,
+                                                              RSSStringPool *stringPool);
+
+/**
+ *  Decodes the given attribute, given as UTF-8 bytes, such as those reported by libxml2. Attributes that aren't in the element's table are ignored.
+ */
+extern void RSSMediaAttributeDecoderSetBytes(RSSMediaAttributeDecoder *decoder, const char *name, size_t nameLength,
+                                             const char *value, size_t valueLength);
+
+/**
+ *  Decodes the given attribute, such as one from an `NSXMLParser` attribute dictionary. Attributes that aren't in the element's table are ignored.
+ */
+extern void RSSMediaAttributeDecoderSetString(RSSMediaAttributeDecoder *decoder, NSString *name, NSString *value);
+
+/**
+ *  Finishes decoding, and returns the object the attributes were decoded onto (or `nil` if there was none).
+ */
+extern id RSSMediaAttributeDecoderEnd(RSSMediaAttributeDecoder *decoder);
+
+/**
+ *  Decodes the given `NSXMLParser` attribute dictionary onto `object`, or a new instance of the element's model class if `object` is `nil`, and returns the object.
+ */
+extern id RSSMediaObjectWithAttributes(RSSElementType elementType, id object, NSDictionary *attributes,
+                                       RSSStringPool *stringPool);
+
+/**
+ *  Sets the given text, an element's character data, on the object for that element, if its model class has a property for it (such as `RSSMediaCredit`'s `value`). The text is interned in `stringPool`, unless that's `nil`.
+ */
+extern void RSSMediaObjectSetText(RSSElementType elementType, id object, NSString *text, RSSStringPool *stringPool);
+
+///---------------------
+/// @name Converting Values
+///---------------------
+
+/**
+ *  Converts UTF-8 bytes the same way as `-[NSString integerValue]`: leading whitespace, an optional sign, then decimal digits, saturating on overflow.
+ */
+extern NSInteger RSSAttributeIntegerValue(const char *value, size_t length);
+
+/**
+ *  Converts UTF-8 bytes the same way as `-[NSString floatValue]`, for decimal input.
+ */
+extern CGFloat RSSAttributeFloatValue(const char *value, size_t length);
+
+/**
+ *  Converts UTF-8 bytes the same way as `-[NSString boolValue]`: after whitespace, an optional sign and leading zeros, `Y`, `y`, `T`, `t` or a digit 1-9 is `YES`.
+ */
+extern BOOL RSSAttributeBoolValue(const char *value, size_t length);
@@ -0,0 +1,502 @@
+//
+//  RSSMediaAttributes.m
+//  MediaRSSParser
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+
+
+
+#import "RSSMediaAttributes.h"
+#import "RSSStringPool.h"
+
+#import <objc/runtime.h>
+
+typedef struct {
+  const char *name;
+  RSSAttributeType type;
+  const char *property;
+} RSSAttributeDescriptor;
+
+typedef struct {
+  RSSElementType elementType;
+  
+  // The model class whose properties the attributes are mapped onto.
+  const char *className;
+  
+  // `YES` if the element has no object of its own, and is decoded onto its enclosing element's object.
+  BOOL decodesOntoEnclosingObject;
+  
+  const RSSAttributeDescriptor *attributes;
+  NSUInteger attributeCount;
+  
+  // The property set from the element's text, or `NULL` if there is none.
+  const char *textProperty;
+} RSSElementDescriptor;
+
+#define RSSDescriptorCount(descriptors) (sizeof(descriptors) / sizeof((descriptors)[0]))
+
+#pragma mark - Descriptor Tables
+
+// See http://www.rssboard.org/media-rss. Attribute names are matched exactly, and only unprefixed attributes are mapped.
+
+static const RSSAttributeDescriptor gMediaContentAttributes[] = {
+  { "url", RSSAttributeTypeURL, "url" },
+  { "fileSize", RSSAttributeTypeInteger, "fileSize" },
+  { "type", RSSAttributeTypeToken, "type" },
+  { "medium", RSSAttributeTypeToken, "medium" },
+  { "isDefault", RSSAttributeTypeBool, "isDefault" },
+  { "expression", RSSAttributeTypeToken, "expression" },
+  { "bitrate", RSSAttributeTypeInteger, "bitrate" },
+  { "framerate", RSSAttributeTypeInteger, "framerate" },
+  { "samplingrate", RSSAttributeTypeFloat, "samplingRate" },
+  { "channels", RSSAttributeTypeInteger, "channels" },
+  { "duration", RSSAttributeTypeInteger, "duration" },
+  { "width", RSSAttributeTypeWidth, "size" },
+  { "height", RSSAttributeTypeHeight, "size" },
+  { "lang", RSSAttributeTypeToken, "language" },
+};
+
+static const RSSAttributeDescriptor gMediaThumbnailAttributes[] = {
+  { "url", RSSAttributeTypeURL, "url" },
+  { "width", RSSAttributeTypeWidth, "size" },
+  { "height", RSSAttributeTypeHeight, "size" },
+  { "time", RSSAttributeTypeString, "timeOffset" },
+};
+
+static const RSSAttributeDescriptor gMediaCreditAttributes[] = {
+  { "role", RSSAttributeTypeToken, "role" },
+};
+
+static const RSSAttributeDescriptor gMediaPlayerAttributes[] = {
+  { "url", RSSAttributeTypeURL, "url" },
+  { "width", RSSAttributeTypeWidth, "size" },
+  { "height", RSSAttributeTypeHeight, "size" },
+};
+
+static const RSSAttributeDescriptor gMediaCategoryAttributes[] = {
+  { "scheme", RSSAttributeTypeToken, "scheme" },
+  { "label", RSSAttributeTypeToken, "label" },
+};
+
+static const RSSAttributeDescriptor gMediaRatingAttributes[] = {
+  { "scheme", RSSAttributeTypeToken, "scheme" },
+};
+
+static const RSSAttributeDescriptor gMediaRestrictionAttributes[] = {
+  { "relationship", RSSAttributeTypeToken, "relationship" },
+  { "type", RSSAttributeTypeToken, "type" },
+};
+
+static const RSSAttributeDescriptor gMediaStarRatingAttributes[] = {
+  { "average", RSSAttributeTypeFloat, "starRatingAverage" },
+  { "count", RSSAttributeTypeInteger, "starRatingCount" },
+  { "min", RSSAttributeTypeInteger, "starRatingMin" },
+  { "max", RSSAttributeTypeInteger, "starRatingMax" },
+};
+
+static const RSSAttributeDescriptor gMediaStatisticsAttributes[] = {
+  { "views", RSSAttributeTypeInteger, "viewCount" },
+  { "favorites", RSSAttributeTypeInteger, "favoriteCount" },
+};
+
+static const RSSElementDescriptor gElementDescriptors[] = {
+  { RSSElementTypeMediaContent, "RSSMediaContent", NO,
+    gMediaContentAttributes, RSSDescriptorCount(gMediaContentAttributes), NULL },
+  { RSSElementTypeMediaThumbnail, "RSSMediaThumbnail", NO,
+    gMediaThumbnailAttributes, RSSDescriptorCount(gMediaThumbnailAttributes), NULL },
+  { RSSElementTypeMediaCredit, "RSSMediaCredit", NO,
+    gMediaCreditAttributes, RSSDescriptorCount(gMediaCreditAttributes), "value" },
+  { RSSElementTypeMediaPlayer, "RSSMediaPlayer", NO,
+    gMediaPlayerAttributes, RSSDescriptorCount(gMediaPlayerAttributes), NULL },
+  { RSSElementTypeMediaCategory, "RSSMediaCategory", NO,
+    gMediaCategoryAttributes, RSSDescriptorCount(gMediaCategoryAttributes), "value" },
+  { RSSElementTypeMediaRating, "RSSMediaRating", NO,
+    gMediaRatingAttributes, RSSDescriptorCount(gMediaRatingAttributes), "value" },
+  { RSSElementTypeMediaRestriction, "RSSMediaRestriction", NO,
+    gMediaRestrictionAttributes, RSSDescriptorCount(gMediaRestrictionAttributes), "value" },
+  { RSSElementTypeMediaCommunity, "RSSMediaCommunity", NO, NULL, 0, NULL },
+  { RSSElementTypeMediaStarRating, "RSSMediaCommunity", YES,
+    gMediaStarRatingAttributes, RSSDescriptorCount(gMediaStarRatingAttributes), NULL },
+  { RSSElementTypeMediaStatistics, "RSSMediaCommunity", YES,
+    gMediaStatisticsAttributes, RSSDescriptorCount(gMediaStatisticsAttributes), NULL },
+  { RSSElementTypeMediaTags, "RSSMediaCommunity", YES, NULL, 0, "tags" },
+};
+
+#pragma mark - Attribute Values
+
+static inline BOOL RSSAttributeIsSpace(char c)
+{
+  return c == ' ' || c == '\t' || c == '\n' || c == '\r';
+}
+
+static NSString *RSSAttributeStringValue(const char *value, size_t length)
+{
+  return [[NSString alloc] initWithBytes:value length:length encoding:NSUTF8StringEncoding];
+}
+
+NSInteger RSSAttributeIntegerValue(const char *value, size_t length)
+{
+  const char *c = value, *end = value + length;
+  while (c < end && RSSAttributeIsSpace(*c)) {
+    c++;
+  }
+  
+  BOOL negative = NO;
+  if (c < end && (*c == '-' || *c == '+')) {
+    negative = (*c == '-');
+    c++;
+  }
+  
+  NSUInteger result = 0;
+  NSUInteger limit = negative ? (NSUInteger)NSIntegerMax + 1 : (NSUInteger)NSIntegerMax;
+  for (; c < end && *c >= '0' && *c <= '9'; c++) {
+    NSUInteger digit = (NSUInteger)(*c - '0');
+    if (result > (limit - digit) / 10) {
+      return negative ? NSIntegerMin : NSIntegerMax;
+    }
+    result = result * 10 + digit;
+  }
+  
+  return negative ? (NSInteger)(0 - result) : (NSInteger)result;
+}
+
+CGFloat RSSAttributeFloatValue(const char *value, size_t length)
+{
+  char buffer[64];
+  if (length >= sizeof(buffer)) {
+    return (CGFloat)[RSSAttributeStringValue(value, length) floatValue];
+  }
+  memcpy(buffer, value, length);
+  buffer[length] = '\0';
+  return (CGFloat)strtof(buffer, NULL);
+}
+
+BOOL RSSAttributeBoolValue(const char *value, size_t length)
+{
+  const char *c = value, *end = value + length;
+  while (c < end && RSSAttributeIsSpace(*c)) {
+    c++;
+  }
+  if (c < end && (*c == '-' || *c == '+')) {
+    c++;
+  }
+  while (c < end && *c == '0') {
+    c++;
+  }
+  return c < end && (*c == 'Y' || *c == 'y' || *c == 'T' || *c == 't' || (*c >= '1' && *c <= '9'));
+}
+
+#pragma mark - Runtime Tables
+
+// Open-addressed table over an element's attribute names. No element has more than a quarter as many attributes
+// as there are slots, so an attribute is almost always matched with one hash and one comparison.
+#define RSSAttributeSlotCount 64
+
+typedef struct {
+  const char *name;
+  size_t length;
+  RSSAttributeType type;
+  SEL setter;
+  IMP implementation;
+} RSSAttributeSlot;
+
+typedef struct {
+  __unsafe_unretained Class modelClass;
+  BOOL decodesOntoEnclosingObject;
+  
+  SEL sizeSetter;
+  IMP sizeImplementation;
+  
+  SEL textSetter;
+  IMP textImplementation;
+  
+  RSSAttributeSlot slots[RSSAttributeSlotCount];
+} RSSElementTable;
+
+// Element types are small and dense, so tables are indexed by element type.
+#define RSSElementTableCount 64
+
+static RSSElementTable *gElementTables[RSSElementTableCount];
+
+static uint32_t RSSAttributeHashName(const char *name, size_t length)
+{
+  uint32_t hash = 2166136261u;
+  for (size_t i = 0; i < length; i++) {
+    hash = (hash ^ (uint8_t)name[i]) * 16777619u;
+  }
+  return hash;
+}
+
+// Returns the selector of the given property's setter, which is `set` followed by the capitalized property name.
+static SEL RSSSetterForProperty(const char *property)
+{
+  NSString *name = [NSString stringWithUTF8String:property];
+  NSString *setter = [NSString stringWithFormat:@"set%@%@:",
+                      [[name substringToIndex:1] uppercaseString], [name substringFromIndex:1]];
+  return NSSelectorFromString(setter);
+}
+
+static RSSElementTable *RSSCreateElementTable(const RSSElementDescriptor *descriptor)
+{
+  RSSElementTable *table = calloc(1, sizeof(RSSElementTable));
+  table->modelClass = objc_getClass(descriptor->className);
+  table->decodesOntoEnclosingObject = descriptor->decodesOntoEnclosingObject;
+  
+  NSCAssert(descriptor->attributeCount * 4 <= RSSAttributeSlotCount, @"Too many attributes for %s", descriptor->className);
+  
+  for (NSUInteger i = 0; i < descriptor->attributeCount; i++) {
+    const RSSAttributeDescriptor *attribute = &descriptor->attributes[i];
+    SEL setter = RSSSetterForProperty(attribute->property);
+    IMP implementation = class_getMethodImplementation(table->modelClass, setter);
+    
+    if (attribute->type == RSSAttributeTypeWidth || attribute->type == RSSAttributeTypeHeight) {
+      table->sizeSetter = setter;
+      table->sizeImplementation = implementation;
+    }
+    
+    size_t length = strlen(attribute->name);
+    uint32_t index = RSSAttributeHashName(attribute->name, length) & (RSSAttributeSlotCount - 1);
+    while (table->slots[index].name) {
+      index = (index + 1) & (RSSAttributeSlotCount - 1);
+    }
+    table->slots[index].name = attribute->name;
+    table->slots[index].length = length;
+    table->slots[index].type = attribute->type;
+    table->slots[index].setter = setter;
+    table->slots[index].implementation = implementation;
+  }
+  
+  if (descriptor->textProperty) {
+    table->textSetter = RSSSetterForProperty(descriptor->textProperty);
+    table->textImplementation = class_getMethodImplementation(table->modelClass, table->textSetter);
+  }
+  
+  return table;
+}
+
+static const RSSElementTable *RSSElementTableForType(RSSElementType elementType)
+{
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    for (NSUInteger i = 0; i < RSSDescriptorCount(gElementDescriptors); i++) {
+      RSSElementType type = gElementDescriptors[i].elementType;
+      NSCAssert(type < RSSElementTableCount, @"Element type %ld out of range", (long)type);
+      gElementTables[type] = RSSCreateElementTable(&gElementDescriptors[i]);
+    }
+  });
+  
+  if (elementType < 0 || elementType >= RSSElementTableCount) {
+    return NULL;
+  }
+  return gElementTables[elementType];
+}
+
+static const RSSAttributeSlot *RSSAttributeSlotForName(const RSSElementTable *table, const char *name, size_t length)
+{
+  uint32_t index = RSSAttributeHashName(name, length) & (RSSAttributeSlotCount - 1);
+  
+  while (table->slots[index].name) {
+    const RSSAttributeSlot *slot = &table->slots[index];
+    if (slot->length == length && memcmp(slot->name, name, length) == 0) {
+      return slot;
+    }
+    index = (index + 1) & (RSSAttributeSlotCount - 1);
+  }
+  return NULL;
+}
+
+#pragma mark - Decoding
+
+BOOL RSSElementTypeHasDescriptor(RSSElementType elementType)
+{
+  return RSSElementTableForType(elementType) != NULL;
+}
+
+RSSMediaAttributeDecoder RSSMediaAttributeDecoderBegin(RSSElementType elementType, id object,
+                                                       RSSStringPool *stringPool)
+{
+  const RSSElementTable *table = RSSElementTableForType(elementType);
+  RSSMediaAttributeDecoder decoder = { table, NULL, (__bridge const void *)stringPool, CGSizeZero, NO };
+  
+  if (table && !object && !table->decodesOntoEnclosingObject) {
+    object = [[table->modelClass alloc] init];
+  }
+  if (table && [object isKindOfClass:table->modelClass]) {
+    decoder.object = CFBridgingRetain(object);
+  }
+  return decoder;
+}
+
+static inline void RSSSetObject(id object, const RSSAttributeSlot *slot, id value)
+{
+  ((void (*)(id, SEL, id))slot->implementation)(object, slot->setter, value);
+}
+
+static inline void RSSSetSizeDimension(RSSMediaAttributeDecoder *decoder, RSSAttributeType type, CGFloat value)
+{
+  if (type == RSSAttributeTypeWidth) {
+    decoder->size.width = value;
+  } else {
+    decoder->size.height = value;
+  }
+  decoder->hasSize = YES;
+}
+
+void RSSMediaAttributeDecoderSetBytes(RSSMediaAttributeDecoder *decoder, const char *name, size_t nameLength,
+                                      const char *value, size_t valueLength)
+{
+  if (!decoder->object) {
+    return;
+  }
+  
+  const RSSAttributeSlot *slot = RSSAttributeSlotForName(decoder->table, name, nameLength);
+  if (!slot) {
+    return;
+  }
+  
+  id object = (__bridge id)decoder->object;
+  
+  switch (slot->type) {
+    case RSSAttributeTypeString:
+      RSSSetObject(object, slot, RSSAttributeStringValue(value, valueLength));
+      break;
+      
+    case RSSAttributeTypeToken: {
+      RSSStringPool *stringPool = (__bridge RSSStringPool *)decoder->stringPool;
+      RSSSetObject(object, slot, stringPool ? [stringPool stringWithUTF8Bytes:value length:valueLength]
+                                            : RSSAttributeStringValue(value, valueLength));
+      break;
+    }
+      
+    case RSSAttributeTypeURL: {
+      NSString *string = RSSAttributeStringValue(value, valueLength);
+      RSSSetObject(object, slot, string ? [NSURL URLWithString:string] : nil);
+      break;
+    }
+      
+    case RSSAttributeTypeInteger:
+      ((void (*)(id, SEL, NSInteger))slot->implementation)(object, slot->setter,
+                                                           RSSAttributeIntegerValue(value, valueLength));
+      break;
+      
+    case RSSAttributeTypeFloat:
+      ((void (*)(id, SEL, CGFloat))slot->implementation)(object, slot->setter,
+                                                         RSSAttributeFloatValue(value, valueLength));
+      break;
+      
+    case RSSAttributeTypeBool:
+      ((void (*)(id, SEL, BOOL))slot->implementation)(object, slot->setter, RSSAttributeBoolValue(value, valueLength));
+      break;
+      
+    case RSSAttributeTypeWidth:
+    case RSSAttributeTypeHeight:
+      RSSSetSizeDimension(decoder, slot->type, RSSAttributeFloatValue(value, valueLength));
+      break;
+  }
+}
+
+void RSSMediaAttributeDecoderSetString(RSSMediaAttributeDecoder *decoder, NSString *name, NSString *value)
+{
+  if (!decoder->object) {
+    return;
+  }
+  
+  const char *nameBytes = [name UTF8String];
+  const RSSAttributeSlot *slot = nameBytes ? RSSAttributeSlotForName(decoder->table, nameBytes, strlen(nameBytes)) : NULL;
+  if (!slot) {
+    return;
+  }
+  
+  id object = (__bridge id)decoder->object;
+  
+  // Values are converted by `NSString` itself, so this decodes exactly as `NSXMLParser` attribute dictionaries always have.
+  switch (slot->type) {
+    case RSSAttributeTypeString:
+      RSSSetObject(object, slot, value);
+      break;
+      
+    case RSSAttributeTypeToken: {
+      RSSStringPool *stringPool = (__bridge RSSStringPool *)decoder->stringPool;
+      RSSSetObject(object, slot, stringPool ? [stringPool stringByInterningString:value] : value);
+      break;
+    }
+      
+    case RSSAttributeTypeURL:
+      RSSSetObject(object, slot, [NSURL URLWithString:value]);
+      break;
+      
+    case RSSAttributeTypeInteger:
+      ((void (*)(id, SEL, NSInteger))slot->implementation)(object, slot->setter, [value integerValue]);
+      break;
+      
+    case RSSAttributeTypeFloat:
+      ((void (*)(id, SEL, CGFloat))slot->implementation)(object, slot->setter, [value floatValue]);
+      break;
+      
+    case RSSAttributeTypeBool:
+      ((void (*)(id, SEL, BOOL))slot->implementation)(object, slot->setter, [value boolValue]);
+      break;
+      
+    case RSSAttributeTypeWidth:
+    case RSSAttributeTypeHeight:
+      RSSSetSizeDimension(decoder, slot->type, [value floatValue]);
+      break;
+  }
+}
+
+id RSSMediaAttributeDecoderEnd(RSSMediaAttributeDecoder *decoder)
+{
+  if (!decoder->object) {
+    return nil;
+  }
+  
+  id object = CFBridgingRelease(decoder->object);
+  decoder->object = NULL;
+  
+  const RSSElementTable *table = decoder->table;
+  if (table->sizeSetter && decoder->hasSize) {
+    ((void (*)(id, SEL, CGSize))table->sizeImplementation)(object, table->sizeSetter, decoder->size);
+  }
+  return object;
+}
+
+id RSSMediaObjectWithAttributes(RSSElementType elementType, id object, NSDictionary *attributes,
+                                RSSStringPool *stringPool)
+{
+  RSSMediaAttributeDecoder decoder = RSSMediaAttributeDecoderBegin(elementType, object, stringPool);
+  
+  for (NSString *name in attributes) {
+    RSSMediaAttributeDecoderSetString(&decoder, name, attributes[name]);
+  }
+  
+  return RSSMediaAttributeDecoderEnd(&decoder);
+}
+
+void RSSMediaObjectSetText(RSSElementType elementType, id object, NSString *text, RSSStringPool *stringPool)
+{
+  const RSSElementTable *table = RSSElementTableForType(elementType);
+  if (!table || !table->textSetter || ![object isKindOfClass:table->modelClass]) {
+    return;
+  }
+  
+  if (stringPool) {
+    text = [stringPool stringByInterningString:text];
+  }
+  ((void (*)(id, SEL, id))table->textImplementation)(object, table->textSetter, text);
+}
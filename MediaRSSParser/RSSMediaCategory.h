@@ -0,0 +1,50 @@
+//
+//  RSSMediaCategory.h
+//  MediaRSSParser
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+
+
+#import <Foundation/Foundation.h>
+
+/**
+ *  `RSSMediaCategory` corresponds to a single `media:category` element within an `item` element.
+ */
+@interface RSSMediaCategory : NSObject <NSCoding>
+
+/**
+ *  This property corresponds to the `scheme` attribute on a `media:category` element.
+ *
+ *  Per the Media RSS specification, it is the "URI that identifies the categorization scheme."
+ */
+@property (nonatomic, copy) NSString *scheme;
+
+/**
+ *  This property corresponds to the `label` attribute on a `media:category` element.
+ *
+ *  Per the Media RSS specification, it is the "human readable label that can be displayed in end user applications."
+ */
+@property (nonatomic, copy) NSString *label;
+
+/**
+ *  This property corresponds to the value of the `media:category` element.
+ */
+@property (nonatomic, copy) NSString *value;
+
+@end
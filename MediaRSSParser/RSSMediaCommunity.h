@@ -0,0 +1,68 @@
+//
+//  RSSMediaCommunity.h
+//  MediaRSSParser
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+
+
+#import <CoreGraphics/CoreGraphics.h>
+
+/**
+ *  `RSSMediaCommunity` corresponds to a `media:community` element within an `item` element, including the `media:starRating`, `media:statistics` and `media:tags` elements within it.
+ */
+@interface RSSMediaCommunity : NSObject <NSCoding>
+
+/**
+ *  This property corresponds to the `average` attribute on a `media:starRating` element.
+ */
+@property (nonatomic, assign) CGFloat starRatingAverage;
+
+/**
+ *  This property corresponds to the `count` attribute on a `media:starRating` element, the number of ratings.
+ */
+@property (nonatomic, assign) NSInteger starRatingCount;
+
+/**
+ *  This property corresponds to the `min` attribute on a `media:starRating` element, the lowest possible rating.
+ */
+@property (nonatomic, assign) NSInteger starRatingMin;
+
+/**
+ *  This property corresponds to the `max` attribute on a `media:starRating` element, the highest possible rating.
+ */
+@property (nonatomic, assign) NSInteger starRatingMax;
+
+/**
+ *  This property corresponds to the `views` attribute on a `media:statistics` element.
+ */
+@property (nonatomic, assign) NSInteger viewCount;
+
+/**
+ *  This property corresponds to the `favorites` attribute on a `media:statistics` element.
+ */
+@property (nonatomic, assign) NSInteger favoriteCount;
+
+/**
+ *  This property corresponds to the value of the `media:tags` element.
+ *
+ *  Per the Media RSS specification, it "contains user-generated tags separated by commas in the decreasing order of each tag's weight. Each tag can be assigned an integer weight in tag_name:weight format."
+ */
+@property (nonatomic, copy) NSString *tags;
+
+@end
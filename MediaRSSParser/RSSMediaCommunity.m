@@ -0,0 +1,55 @@
+//
+//  RSSMediaCommunity.m
+//  MediaRSSParser
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+
+
+#import "RSSMediaCommunity.h"
+
+@implementation RSSMediaCommunity
+
+#pragma mark - NSCoding
+
+- (instancetype)initWithCoder:(NSCoder *)aDecoder
+{
+  if (self = [super init]) {
+    _starRatingAverage = [[aDecoder decodeObjectForKey:@"starRatingAverage"] floatValue];
+    _starRatingCount = [[aDecoder decodeObjectForKey:@"starRatingCount"] integerValue];
+    _starRatingMin = [[aDecoder decodeObjectForKey:@"starRatingMin"] integerValue];
+    _starRatingMax = [[aDecoder decodeObjectForKey:@"starRatingMax"] integerValue];
+    _viewCount = [[aDecoder decodeObjectForKey:@"viewCount"] integerValue];
+    _favoriteCount = [[aDecoder decodeObjectForKey:@"favoriteCount"] integerValue];
+    _tags = [aDecoder decodeObjectForKey:@"tags"];
+  }
+  return self;
+}
+
+- (void)encodeWithCoder:(NSCoder *)aCoder
+{
+  [aCoder encodeObject:@(self.starRatingAverage) forKey:@"starRatingAverage"];
+  [aCoder encodeObject:@(self.starRatingCount) forKey:@"starRatingCount"];
+  [aCoder encodeObject:@(self.starRatingMin) forKey:@"starRatingMin"];
+  [aCoder encodeObject:@(self.starRatingMax) forKey:@"starRatingMax"];
+  [aCoder encodeObject:@(self.viewCount) forKey:@"viewCount"];
+  [aCoder encodeObject:@(self.favoriteCount) forKey:@"favoriteCount"];
+  [aCoder encodeObject:self.tags forKey:@"tags"];
+}
+
+@end
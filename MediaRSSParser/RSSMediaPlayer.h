@@ -0,0 +1,45 @@
+//
+//  RSSMediaPlayer.h
+//  MediaRSSParser
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+
+
+#import <CoreGraphics/CoreGraphics.h>
+
+/**
+ *  `RSSMediaPlayer` corresponds to a `media:player` element within an `item` element.
+ */
+@interface RSSMediaPlayer : NSObject <NSCoding>
+
+/**
+ *  This property corresponds to the `url` attribute on a `media:player` element.
+ *
+ *  Per the Media RSS specification, it is the "URL of the player console that plays the media."
+ */
+@property (nonatomic, copy) NSURL *url;
+
+/**
+ *  The `size.height` corresponds to the `height` attribute, and the `size.width` corresponds to the `width` attribute on a `media:player` element.
+ *
+ *  Per the Media RSS specification, these are the "height [and width] of the browser window that the URL should be opened in."
+ */
+@property (nonatomic, assign) CGSize size;
+
+@end
@@ -0,0 +1,50 @@
+//
+//  RSSMediaRestriction.h
+//  MediaRSSParser
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+
+
+#import <Foundation/Foundation.h>
+
+/**
+ *  `RSSMediaRestriction` corresponds to a single `media:restriction` element within an `item` element.
+ */
+@interface RSSMediaRestriction : NSObject <NSCoding>
+
+/**
+ *  This property corresponds to the `relationship` attribute on a `media:restriction` element.
+ *
+ *  Per the Media RSS specification, it "indicates the type of relationship that the restriction represents (allow | deny)."
+ */
+@property (nonatomic, copy) NSString *relationship;
+
+/**
+ *  This property corresponds to the `type` attribute on a `media:restriction` element.
+ *
+ *  Per the Media RSS specification, it "specifies the type of restriction (country | uri | sharing) that the media can be syndicated."
+ */
+@property (nonatomic, copy) NSString *type;
+
+/**
+ *  This property corresponds to the value of the `media:restriction` element: a space separated list of country codes or URIs, or `all` or `none`.
+ */
+@property (nonatomic, copy) NSString *value;
+
+@end
@@ -0,0 +1,80 @@
+//
+//  RSSMemoryFeedCache.m
+//  MediaRSSParser
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+
+
+#import "RSSMemoryFeedCache.h"
+#import "RSSFeedCacheEntry.h"
+
+@implementation RSSMemoryFeedCache
+{
+  NSCache *_cache;
+}
+
+#pragma mark - Object Lifecycle
+
+- (instancetype)init
+{
+  self = [super init];
+  if (self) {
+    _cache = [[NSCache alloc] init];
+  }
+  return self;
+}
+
+#pragma mark - Custom Accessors
+
+- (NSUInteger)countLimit
+{
+  return _cache.countLimit;
+}
+
+- (void)setCountLimit:(NSUInteger)countLimit
+{
+  _cache.countLimit = countLimit;
+}
+
+#pragma mark - RSSFeedCache
+
+- (RSSFeedCacheEntry *)cachedEntryForURL:(NSURL *)url
+{
+  return url ? [_cache objectForKey:url.absoluteString] : nil;
+}
+
+- (void)storeEntry:(RSSFeedCacheEntry *)entry forURL:(NSURL *)url
+{
+  if (!url) {
+    return;
+  }
+  
+  if (entry) {
+    [_cache setObject:entry forKey:url.absoluteString];
+  } else {
+    [_cache removeObjectForKey:url.absoluteString];
+  }
+}
+
+- (void)removeEntryForURL:(NSURL *)url
+{
+  [self storeEntry:nil forURL:url];
+}
+
+@end
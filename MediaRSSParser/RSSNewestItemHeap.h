@@ -0,0 +1,55 @@
+//
+//  RSSNewestItemHeap.h
+//  MediaRSSParser
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+
+
+#import <Foundation/Foundation.h>
+
+@class RSSItem;
+
+/**
+ *  `RSSNewestItemHeap` keeps the newest items added to it, up to a fixed capacity, for `RSSParser`'s `newestItemCount`. It's a binary min-heap keyed on each item's `pubDate`, so the oldest retained item is always at hand: adding an item takes O(log capacity) time, and memory never exceeds the capacity.
+ *
+ *  Items without a `pubDate` are older than any item with one. Among items with the same date, the ones added first are newer, so that they're kept in document order.
+ */
+@interface RSSNewestItemHeap : NSObject
+
+/**
+ *  Returns an empty heap that retains up to the given number of items, which must be greater than `0`, or `nil` if it can't be allocated. Memory for the items is allocated as they're added, so a large capacity costs nothing up front.
+ */
+- (instancetype)initWithCapacity:(NSUInteger)capacity;
+
+/**
+ *  Returns `YES` if an item with the given date, added next, would be retained, i.e. the heap isn't full or the date is after that of the oldest retained item.
+ */
+- (BOOL)retainsItemWithDate:(NSDate *)date;
+
+/**
+ *  Adds the given item, replacing the oldest retained item if the heap is full and the item is newer. Otherwise, the item is dropped.
+ */
+- (void)addItem:(RSSItem *)item;
+
+/**
+ *  Returns the retained items, newest first, and empties the heap. This takes O(capacity log capacity) time.
+ */
+- (NSArray *)removeItemsNewestFirst;
+
+@end
@@ -0,0 +1,186 @@
+//
+//  RSSNewestItemHeap.m
+//  MediaRSSParser
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+
+
+#import "RSSNewestItemHeap.h"
+#import "RSSItem.h"
+
+typedef struct {
+  NSTimeInterval date;
+  NSUInteger sequence;
+} RSSNewestItemKey;
+
+// Keys are allocated for at most this many items at first, then doubled as items are added, up to the capacity.
+static const NSUInteger RSSNewestItemHeapInitialKeyCapacity = 1024;
+
+static inline NSTimeInterval RSSNewestItemDate(NSDate *date)
+{
+  return date ? [date timeIntervalSinceReferenceDate] : -INFINITY;
+}
+
+static inline BOOL RSSNewestItemKeyIsOlder(RSSNewestItemKey key, RSSNewestItemKey otherKey)
+{
+  return key.date < otherKey.date || (key.date == otherKey.date && key.sequence > otherKey.sequence);
+}
+
+// The heap's minimum, at index `0`, is its oldest item. Keys are kept in a C array parallel to `_items`.
+@implementation RSSNewestItemHeap
+{
+  NSUInteger _capacity;
+  NSUInteger _sequence;
+  NSUInteger _keyCapacity;
+  RSSNewestItemKey *_keys;
+  NSMutableArray *_items;
+}
+
+#pragma mark - Object Lifecycle
+
+- (instancetype)initWithCapacity:(NSUInteger)capacity
+{
+  NSParameterAssert(capacity > 0);
+  
+  self = [super init];
+  if (self) {
+    _capacity = capacity;
+    _keyCapacity = MIN(capacity, RSSNewestItemHeapInitialKeyCapacity);
+    _keys = malloc(_keyCapacity * sizeof(RSSNewestItemKey));
+    if (!_keys) {
+      return nil;
+    }
+    _items = [[NSMutableArray alloc] initWithCapacity:_keyCapacity];
+  }
+  return self;
+}
+
+- (void)dealloc
+{
+  free(_keys);
+}
+
+#pragma mark - Adding Items
+
+- (BOOL)retainsItemWithDate:(NSDate *)date
+{
+  // An item added next has the highest sequence, so it's older than a retained item with the same date.
+  return _items.count < _capacity || RSSNewestItemDate(date) > _keys[0].date;
+}
+
+- (void)addItem:(RSSItem *)item
+{
+  RSSNewestItemKey key = { RSSNewestItemDate(item.pubDate), _sequence++ };
+  NSUInteger count = _items.count;
+  
+  if (count == _keyCapacity && count < _capacity && ![self growKeys]) {
+    // Without room for more keys, the heap keeps as many of the newest items as it has room for.
+    _capacity = _keyCapacity;
+  }
+  
+  if (count < _capacity) {
+    _keys[count] = key;
+    [_items addObject:item];
+    [self siftUpFromIndex:count];
+    
+  } else if (RSSNewestItemKeyIsOlder(_keys[0], key)) {
+    _keys[0] = key;
+    [_items replaceObjectAtIndex:0 withObject:item];
+    [self siftDownFromIndex:0 count:count];
+  }
+}
+
+// Returns `NO` if the keys can't grow, leaving them as they were.
+- (BOOL)growKeys
+{
+  NSUInteger keyCapacity = _keyCapacity > _capacity / 2 ? _capacity : _keyCapacity * 2;
+  if (keyCapacity > SIZE_MAX / sizeof(RSSNewestItemKey)) {
+    return NO;
+  }
+  
+  RSSNewestItemKey *keys = realloc(_keys, keyCapacity * sizeof(RSSNewestItemKey));
+  if (!keys) {
+    return NO;
+  }
+  
+  _keys = keys;
+  _keyCapacity = keyCapacity;
+  return YES;
+}
+
+#pragma mark - Removing Items
+
+// Heap sort: each oldest item is swapped to the end of the shrinking heap, which leaves the newest at index `0`.
+- (NSArray *)removeItemsNewestFirst
+{
+  for (NSUInteger count = _items.count; count > 1; count--) {
+    [self swapIndex:0 withIndex:count - 1];
+    [self siftDownFromIndex:0 count:count - 1];
+  }
+  
+  NSArray *items = [_items copy];
+  [_items removeAllObjects];
+  return items;
+}
+
+#pragma mark - Heap
+
+- (void)swapIndex:(NSUInteger)index withIndex:(NSUInteger)otherIndex
+{
+  RSSNewestItemKey key = _keys[index];
+  _keys[index] = _keys[otherIndex];
+  _keys[otherIndex] = key;
+  [_items exchangeObjectAtIndex:index withObjectAtIndex:otherIndex];
+}
+
+- (void)siftUpFromIndex:(NSUInteger)index
+{
+  while (index > 0) {
+    NSUInteger parent = (index - 1) / 2;
+    if (!RSSNewestItemKeyIsOlder(_keys[index], _keys[parent])) {
+      return;
+    }
+    [self swapIndex:index withIndex:parent];
+    index = parent;
+  }
+}
+
+- (void)siftDownFromIndex:(NSUInteger)index count:(NSUInteger)count
+{
+  while (YES) {
+    NSUInteger oldest = index;
+    NSUInteger left = 2 * index + 1;
+    NSUInteger right = left + 1;
+    
+    if (left < count && RSSNewestItemKeyIsOlder(_keys[left], _keys[oldest])) {
+      oldest = left;
+    }
+    if (right < count && RSSNewestItemKeyIsOlder(_keys[right], _keys[oldest])) {
+      oldest = right;
+    }
+    if (oldest == index) {
+      return;
+    }
+    
+    [self swapIndex:index withIndex:oldest];
+    index = oldest;
+  }
+}
+
+@end
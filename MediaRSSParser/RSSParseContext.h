@@ -0,0 +1,91 @@
+//
+//  RSSParseContext.h
+//  MediaRSSParser
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+
+
+
+#import <Foundation/Foundation.h>
+
+@class RSSChannel;
+@class RSSItem;
+@class RSSColumnarChannel;
+@class RSSParseMetrics;
+@class RSSFeedCacheEntry;
+@protocol RSSFeedCache;
+
+/**
+ *  `RSSParseContext` holds the blocks passed to one `RSSParser` parse, along with the `parseGeneration` it was started under.
+ *
+ *  A context is built on the calling thread when a parse starts. Once it's handed to `parseQueue`, only `pendingCacheEntry` changes, and only on that queue. Because each parse reads only its own context, starting or cancelling another parse never changes the blocks a running parse calls, or the feed its channel is cached for.
+ */
+@interface RSSParseContext : NSObject
+
+/**
+ *  The value of `parseGeneration` when the parse started.
+ */
+@property (nonatomic, assign) NSUInteger generation;
+
+/**
+ *  The `success` block passed to the parser, called only on successful parse completion.
+ */
+@property (nonatomic, copy) void (^successBlock)(RSSChannel *channel);
+
+/**
+ *  The `failure` block passed to the parser, called if either a network or parse error occurs.
+ */
+@property (nonatomic, copy) void (^failblock)(NSError *error);
+
+/**
+ *  The `itemHandler` passed to the parser, called once for each item as soon as it has been parsed. If this is `nil`, items are instead collected in `items` and set on `channel` at the end of the document.
+ */
+@property (nonatomic, copy) void (^itemBlock)(RSSItem *item);
+
+/**
+ *  The columnar channel being built by `parseColumnarRSSData:success:failure:`, or `nil` for any other parse. When this is set, each item is appended to it instead of being collected in `items`.
+ */
+@property (nonatomic, strong) RSSColumnarChannel *columnarChannel;
+
+/**
+ *  The parser's `metricsHandler` when the parse started, called with the parse's metrics just before the `successBlock` or `failblock`.
+ */
+@property (nonatomic, copy) void (^metricsBlock)(RSSParseMetrics *metrics);
+
+/**
+ *  The parser's `feedCache` when a feed request started, or `nil` for any other parse.
+ */
+@property (nonatomic, strong) id<RSSFeedCache> feedCache;
+
+/**
+ *  The URL of the requested feed, including its query string, used as the `feedCache` key. This is `nil` if there's no `feedCache`.
+ */
+@property (nonatomic, copy) NSURL *feedURL;
+
+/**
+ *  The entry of `feedCache` whose validators were sent with the request, if it has a channel to return on `304 Not Modified`.
+ */
+@property (nonatomic, strong) RSSFeedCacheEntry *cacheEntry;
+
+/**
+ *  The validators of the response being parsed. Its `channel` is set, and it's stored in `feedCache`, once the document has been parsed successfully. This is only used on `parseQueue`.
+ */
+@property (nonatomic, strong) RSSFeedCacheEntry *pendingCacheEntry;
+
+@end
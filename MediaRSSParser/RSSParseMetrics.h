@@ -0,0 +1,105 @@
+//
+//  RSSParseMetrics.h
+//  MediaRSSParser
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+
+
+#import <Foundation/Foundation.h>
+
+/**
+ *  `RSSParseMetrics` describes a single parse by `RSSParser`: how much data it read, how long it took, and how much of that time was spent in each kind of parser callback. See `metricsHandler` on `RSSParser`.
+ *
+ *  Times are wall-clock durations measured with a monotonic clock. Counts and times only cover work done while parsing, so they don't include item properties that `decodesItemFieldsLazily` leaves to be decoded later.
+ */
+@interface RSSParseMetrics : NSObject
+
+///---------------------
+/// @name Input
+///---------------------
+
+/**
+ *  The number of bytes parsed: the length of the data or file, the bytes read from an input stream, or the bytes of the network response. This is `0` for input streams parsed by the `RSSParserBackendNSXMLParser` backend, which reads the stream itself.
+ */
+@property (nonatomic, assign, readonly) unsigned long long bytesReceived;
+
+/**
+ *  The time from the start of a network request until its response arrived, or `0` if the feed wasn't requested over the network.
+ */
+@property (nonatomic, assign, readonly) NSTimeInterval timeToFirstByte;
+
+///---------------------
+/// @name Parse
+///---------------------
+
+/**
+ *  The time from the start of parsing, after any network request completed, until the `success` or `failure` block was dispatched.
+ */
+@property (nonatomic, assign, readonly) NSTimeInterval parseTime;
+
+/**
+ *  The number of elements the XML parser reported, including those skipped because of `channelFields` or `itemFields`.
+ */
+@property (nonatomic, assign, readonly) NSUInteger elementCount;
+
+/**
+ *  The number of `RSSItem` objects created. This includes known items (see `knownItemKeys`) that were skipped once parsed.
+ */
+@property (nonatomic, assign, readonly) NSUInteger itemCount;
+
+/**
+ *  The number of `RSSMediaContent`, `RSSMediaThumbnail` and `RSSMediaCredit` objects created.
+ */
+@property (nonatomic, assign, readonly) NSUInteger mediaObjectCount;
+
+/**
+ *  The number of non-empty date elements that neither the fast date parser nor `dateFormatter` could read, whose date property was left `nil`.
+ */
+@property (nonatomic, assign, readonly) NSUInteger dateParseFailureCount;
+
+///---------------------
+/// @name Handler Times
+///---------------------
+
+/**
+ *  The time spent handling the start of elements, including creating items and media objects.
+ */
+@property (nonatomic, assign, readonly) NSTimeInterval elementStartTime;
+
+/**
+ *  The time spent handling characters reported by the XML parser.
+ */
+@property (nonatomic, assign, readonly) NSTimeInterval charactersTime;
+
+/**
+ *  The time spent handling the end of elements, including setting the captured text on the model objects (and so `dateParsingTime`).
+ */
+@property (nonatomic, assign, readonly) NSTimeInterval elementEndTime;
+
+/**
+ *  The time spent converting date elements to `NSDate` objects. This is part of `elementEndTime`.
+ */
+@property (nonatomic, assign, readonly) NSTimeInterval dateParsingTime;
+
+/**
+ *  The time spent in the `itemHandler` block. Since items are passed to it on `callbackQueue`, this is only complete when `callbackQueue` is a serial queue (or the default main queue).
+ */
+@property (nonatomic, assign, readonly) NSTimeInterval itemHandlerTime;
+
+@end
@@ -0,0 +1,173 @@
+//
+//  RSSParseMetrics.m
+//  MediaRSSParser
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+
+
+#import "RSSParseMetrics_Protected.h"
+
+#ifdef __APPLE__
+#import <mach/mach_time.h>
+#else
+#import <time.h>
+#endif
+
+static const uint64_t RSSNanosecondsPerSecond = 1000000000;
+
+uint64_t RSSParseMetricsTimestamp(void)
+{
+#ifdef __APPLE__
+  static mach_timebase_info_data_t timebase;
+  if (timebase.denom == 0) {
+    mach_timebase_info(&timebase);
+  }
+  return mach_absolute_time() * timebase.numer / timebase.denom;
+#else
+  struct timespec now;
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return (uint64_t)now.tv_sec * RSSNanosecondsPerSecond + (uint64_t)now.tv_nsec;
+#endif
+}
+
+static inline NSTimeInterval RSSParseMetricsInterval(uint64_t nanoseconds)
+{
+  return (NSTimeInterval)nanoseconds / RSSNanosecondsPerSecond;
+}
+
+// Handler times are kept as nanoseconds and only converted when read.
+@implementation RSSParseMetrics
+{
+  uint64_t _parseStart;
+  uint64_t _parseNanoseconds;
+  uint64_t _timeToFirstByteNanoseconds;
+  uint64_t _elementStartNanoseconds;
+  uint64_t _charactersNanoseconds;
+  uint64_t _elementEndNanoseconds;
+  uint64_t _dateParsingNanoseconds;
+  uint64_t _itemHandlerNanoseconds;
+}
+
+#pragma mark - Times
+
+- (NSTimeInterval)timeToFirstByte
+{
+  return RSSParseMetricsInterval(_timeToFirstByteNanoseconds);
+}
+
+- (NSTimeInterval)parseTime
+{
+  return RSSParseMetricsInterval(_parseNanoseconds);
+}
+
+- (NSTimeInterval)elementStartTime
+{
+  return RSSParseMetricsInterval(_elementStartNanoseconds);
+}
+
+- (NSTimeInterval)charactersTime
+{
+  return RSSParseMetricsInterval(_charactersNanoseconds);
+}
+
+- (NSTimeInterval)elementEndTime
+{
+  return RSSParseMetricsInterval(_elementEndNanoseconds);
+}
+
+- (NSTimeInterval)dateParsingTime
+{
+  return RSSParseMetricsInterval(_dateParsingNanoseconds);
+}
+
+- (NSTimeInterval)itemHandlerTime
+{
+  return RSSParseMetricsInterval(_itemHandlerNanoseconds);
+}
+
+#pragma mark - Recording
+
+- (void)beginParse
+{
+  _parseStart = RSSParseMetricsTimestamp();
+}
+
+- (void)finishParse
+{
+  _parseNanoseconds = RSSParseMetricsTimestamp() - _parseStart;
+}
+
+- (void)recordRequestTimestamp:(uint64_t)requestTimestamp responseTimestamp:(uint64_t)responseTimestamp
+{
+  _timeToFirstByteNanoseconds = responseTimestamp > requestTimestamp ? responseTimestamp - requestTimestamp : 0;
+}
+
+- (void)recordElementStartSince:(uint64_t)timestamp
+{
+  _elementCount += 1;
+  _elementStartNanoseconds += RSSParseMetricsTimestamp() - timestamp;
+}
+
+- (void)recordCharactersSince:(uint64_t)timestamp
+{
+  _charactersNanoseconds += RSSParseMetricsTimestamp() - timestamp;
+}
+
+- (void)recordElementEndSince:(uint64_t)timestamp
+{
+  _elementEndNanoseconds += RSSParseMetricsTimestamp() - timestamp;
+}
+
+- (void)recordDateParseSince:(uint64_t)timestamp succeeded:(BOOL)succeeded
+{
+  _dateParsingNanoseconds += RSSParseMetricsTimestamp() - timestamp;
+  if (!succeeded) {
+    _dateParseFailureCount += 1;
+  }
+}
+
+- (void)recordItemHandlerSince:(uint64_t)timestamp
+{
+  _itemHandlerNanoseconds += RSSParseMetricsTimestamp() - timestamp;
+}
+
+- (void)recordItem
+{
+  _itemCount += 1;
+}
+
+- (void)recordMediaObject
+{
+  _mediaObjectCount += 1;
+}
+
+#pragma mark - NSObject
+
+- (NSString *)description
+{
+  return [NSString stringWithFormat:@"<%@: %p; bytes = %llu; timeToFirstByte = %.6f; parseTime = %.6f; elements = %lu; "
+          @"items = %lu; mediaObjects = %lu; dateParseFailures = %lu; elementStartTime = %.6f; charactersTime = %.6f; "
+          @"elementEndTime = %.6f; dateParsingTime = %.6f; itemHandlerTime = %.6f>",
+          NSStringFromClass([self class]), self, self.bytesReceived, self.timeToFirstByte, self.parseTime,
+          (unsigned long)self.elementCount, (unsigned long)self.itemCount, (unsigned long)self.mediaObjectCount,
+          (unsigned long)self.dateParseFailureCount, self.elementStartTime, self.charactersTime, self.elementEndTime,
+          self.dateParsingTime, self.itemHandlerTime];
+}
+
+@end
@@ -0,0 +1,66 @@
+//
+//  RSSParseMetrics_Protected.h
+//  MediaRSSParser
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+
+
+#import "RSSParseMetrics.h"
+
+/**
+ *  Returns the current time of a monotonic clock in nanoseconds. Only differences between these timestamps are meaningful.
+ */
+extern uint64_t RSSParseMetricsTimestamp(void);
+
+/**
+ *  `RSSParseMetrics_Protected` contains the methods `RSSParser` uses to fill in an `RSSParseMetrics` object. Each one takes a timestamp returned by `RSSParseMetricsTimestamp()` when the work started.
+ *
+ *  The parsing backends call these on a metrics object that's `nil` when `metricsHandler` isn't set, so that collecting nothing costs only a message to `nil`.
+ */
+@interface RSSParseMetrics ()
+
+@property (nonatomic, assign, readwrite) unsigned long long bytesReceived;
+
+/**
+ *  Starts timing `parseTime`.
+ */
+- (void)beginParse;
+
+/**
+ *  Sets `parseTime` to the time since `beginParse`.
+ */
+- (void)finishParse;
+
+/**
+ *  Sets `timeToFirstByte` to the time between the given timestamps.
+ */
+- (void)recordRequestTimestamp:(uint64_t)requestTimestamp responseTimestamp:(uint64_t)responseTimestamp;
+
+// These add the time since the given timestamp to the matching handler time, and update the matching count.
+- (void)recordElementStartSince:(uint64_t)timestamp;
+- (void)recordCharactersSince:(uint64_t)timestamp;
+- (void)recordElementEndSince:(uint64_t)timestamp;
+- (void)recordDateParseSince:(uint64_t)timestamp succeeded:(BOOL)succeeded;
+- (void)recordItemHandlerSince:(uint64_t)timestamp;
+
+// These count an object created while parsing.
+- (void)recordItem;
+- (void)recordMediaObject;
+
+@end
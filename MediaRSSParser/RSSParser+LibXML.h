@@ -0,0 +1,46 @@
+//
+//  RSSParser+LibXML.h
+//  MediaRSSParser
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+
+
+#import "RSSParser.h"
+
+/**
+ *  `RSSParser (LibXML)` implements the `RSSParserBackendLibXML` backend. It drives a libxml2 push parser with SAX2 callbacks that match element names and decode `media:*` attributes straight from libxml2's UTF-8 byte ranges, then builds the same model objects as the `NSXMLParser` backend through the methods in `RSSParser_Protected.h`.
+ */
+@interface RSSParser (LibXML)
+
+/**
+ *  Parses the given document with libxml2, feeding it to the push parser in bounded-size chunks.
+ */
+- (void)parseDataWithLibXML:(NSData *)data;
+
+/**
+ *  Parses the document read from the given (unopened) stream with libxml2, reading and feeding it in bounded-size chunks.
+ */
+- (void)parseInputStreamWithLibXML:(NSInputStream *)stream;
+
+/**
+ *  Stops the libxml2 parser, if one is running. No further delegate methods are called after this.
+ */
+- (void)stopLibXMLParser;
+
+@end
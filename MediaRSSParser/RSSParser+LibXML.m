@@ -0,0 +1,529 @@
+//
+//  RSSParser+LibXML.m
+//  MediaRSSParser
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+
+
+#import "RSSParser+LibXML.h"
+#import "RSSParser_Protected.h"
+#import "RSSLazyItem.h"
+
+#import <libxml/parser.h>
+
+// The number of bytes passed to libxml2 per call; this bounds the parser's input buffering.
+static const NSUInteger RSSLibXMLChunkSize = 64 * 1024;
+
+// Attributes are reported by SAX2 as five pointers each: local name, prefix, URI, value and value end.
+static const int RSSLibXMLAttributeFieldCount = 5;
+
+#pragma mark - Media Objects
+
+// Only unprefixed attributes are mapped, the same as the `NSXMLParser` backend's attribute dictionary keys.
+static id RSSLibXMLMediaObject(RSSParser *parser, RSSElementType elementType, const xmlChar **attributes, int count)
+{
+  RSSMediaAttributeDecoder decoder = RSSMediaAttributeDecoderBegin(elementType,
+                                                                   [parser enclosingMediaObjectForElementType:elementType],
+                                                                   parser.parseStringPool);
+  
+  for (int i = 0; i < count; i++) {
+    const xmlChar **fields = attributes + i * RSSLibXMLAttributeFieldCount;
+    if (fields[1] == NULL) {
+      const char *name = (const char *)fields[0];
+      RSSMediaAttributeDecoderSetBytes(&decoder, name, strlen(name),
+                                       (const char *)fields[3], (size_t)(fields[4] - fields[3]));
+    }
+  }
+  
+  return RSSMediaAttributeDecoderEnd(&decoder);
+}
+
+#pragma mark - Characters
+
+// A UTF-16 code unit takes at most three bytes of UTF-8, so this many bytes (less any incomplete sequence at the end) always decode to more than `maxTextLength` code units. The decoded text is cut to length when the element ends.
+static NSUInteger RSSLibXMLTextByteLimit(NSUInteger maxTextLength)
+{
+  return maxTextLength <= (NSUIntegerMax - 4) / 4 ? maxTextLength * 4 + 4 : NSUIntegerMax;
+}
+
+static void RSSLibXMLAppendCharactersWithinTextLimit(RSSParser *parser, const xmlChar *characters, NSUInteger length)
+{
+  NSMutableData *bytes = parser.tempBytes;
+  NSUInteger byteLimit = RSSLibXMLTextByteLimit(parser.maxTextLength);
+  
+  if (bytes.length + length <= byteLimit) {
+    [bytes appendBytes:characters length:length];
+    return;
+  }
+  
+  if ([parser stopForExceededLimit:RSSParserLimitTextLength]) {
+    return;
+  }
+  
+  // Back up to the start of the UTF-8 sequence that doesn't fit, so that the bytes still decode.
+  NSUInteger available = byteLimit - MIN(bytes.length, byteLimit);
+  while (available > 0 && (characters[available] & 0xC0) == 0x80) {
+    available--;
+  }
+  [bytes appendBytes:characters length:available];
+}
+
+// Converts the captured UTF-8 bytes and appends them to `tempString` in a single step.
+static void RSSLibXMLFlushCharacters(RSSParser *parser)
+{
+  NSMutableData *bytes = parser.tempBytes;
+  if (bytes.length == 0) {
+    return;
+  }
+  
+  NSString *string = [[NSString alloc] initWithBytesNoCopy:bytes.mutableBytes
+                                                    length:bytes.length
+                                                  encoding:NSUTF8StringEncoding
+                                              freeWhenDone:NO];
+  if (string) {
+    [parser.tempString appendString:string];
+  }
+  [bytes setLength:0];
+}
+
+#pragma mark - Lazy Decoding
+
+// At `startElementNs`, libxml2 has consumed the start tag up to its closing `>`, or the `/>` of an empty element tag, for which `NSNotFound` is returned.
+static NSUInteger RSSLibXMLContentStart(RSSParser *parser)
+{
+  const char *bytes = parser.lazySourceData.bytes;
+  NSUInteger length = parser.lazySourceData.length;
+  NSUInteger offset = (NSUInteger)xmlByteConsumed(parser.libXMLContext);
+  
+  if (offset == 0 || offset > length) {
+    return NSNotFound;
+  }
+  
+  if (bytes[offset - 1] != '>') {
+    while (offset < length && bytes[offset] != '>') {
+      offset++;
+    }
+    if (offset == length) {
+      return NSNotFound;
+    }
+    offset++;
+  }
+  
+  return (offset >= 2 && bytes[offset - 2] == '/') ? NSNotFound : offset;
+}
+
+// At `endElementNs`, libxml2 has consumed the end tag, so the content ends at the last `<` before the current offset. The content can't contain a `<` other than in markup, which is always closed by a `>`.
+static NSRange RSSLibXMLContentRange(RSSParser *parser, NSUInteger start)
+{
+  const char *bytes = parser.lazySourceData.bytes;
+  NSUInteger end = MIN((NSUInteger)xmlByteConsumed(parser.libXMLContext), parser.lazySourceData.length);
+  
+  while (end > start && bytes[end - 1] != '<') {
+    end--;
+  }
+  return NSMakeRange(start, end > start ? end - 1 - start : 0);
+}
+
+static void RSSLibXMLStartLazyElement(RSSParser *parser, RSSElementType elementType)
+{
+  NSUInteger start = RSSLibXMLContentStart(parser);
+  
+  parser.capturingCharacters = NO;
+  parser.lazyElementType = (start == NSNotFound) ? RSSElementTypeUnknown : elementType;
+  parser.lazyElementStart = start;
+}
+
+static void RSSLibXMLEndLazyElement(RSSParser *parser, RSSElementType elementType)
+{
+  NSRange range = RSSLibXMLContentRange(parser, parser.lazyElementStart);
+  [(RSSLazyItem *)parser.currentItem setSourceRange:range forElementType:elementType];
+  parser.lazyElementType = RSSElementTypeUnknown;
+}
+
+#pragma mark - Namespaces
+
+// Namespace URIs are interned by libxml2's dictionary, so only declarations are compared as strings.
+static void RSSLibXMLInternNamespaces(RSSParser *parser, int namespaceCount, const xmlChar **namespaces)
+{
+  for (int i = 0; i < namespaceCount; i++) {
+    const xmlChar *URI = namespaces[i * 2 + 1];
+    if (URI && RSSNamespaceForURI((const char *)URI, strlen((const char *)URI)) == RSSNamespaceMediaRSS) {
+      parser.libXMLMediaNamespaceURI = URI;
+    }
+  }
+}
+
+static RSSNamespace RSSLibXMLNamespace(RSSParser *parser, const xmlChar *prefix, const xmlChar *URI)
+{
+  if (URI) {
+    if (URI == parser.libXMLMediaNamespaceURI) {
+      return RSSNamespaceMediaRSS;
+    }
+    // Unprefixed elements in a default namespace other than Media RSS's, such as Atom's, are core elements
+    return prefix ? RSSNamespaceOther : RSSNamespaceNone;
+  }
+  
+  // libxml2 reports an undeclared prefix as a namespace error, and the element as having no namespace
+  return prefix ? RSSNamespaceForUndeclaredPrefix((const char *)prefix, strlen((const char *)prefix)) : RSSNamespaceNone;
+}
+
+#pragma mark - SAX2 Callbacks
+
+static void RSSLibXMLStartDocument(void *context)
+{
+  RSSParser *parser = (__bridge RSSParser *)context;
+  xmlParserCtxtPtr parserContext = parser.libXMLContext;
+  
+  // Byte ranges into the document can only be decoded if libxml2 reads it as UTF-8, without converting it first.
+  if (parserContext->input && parserContext->input->buf && parserContext->input->buf->encoder) {
+    parser.lazySourceData = nil;
+  }
+  
+  [parser parserDidStartDocument:nil];
+}
+
+static void RSSLibXMLEndDocument(void *context)
+{
+  RSSParser *parser = (__bridge RSSParser *)context;
+  parser.libXMLDocumentEnded = YES;
+}
+
+static RSSElementType RSSLibXMLElementType(RSSParser *parser, const xmlChar *localName, const xmlChar *prefix,
+                                           const xmlChar *URI)
+{
+  RSSNamespace namespaceID = RSSLibXMLNamespace(parser, prefix, URI);
+  size_t localNameLength = strlen((const char *)localName);
+  
+  if (parser.currentItem) {
+    return RSSItemElementTypeForNamespacedName(namespaceID, (const char *)localName, localNameLength);
+  }
+  return RSSChannelElementTypeForNamespacedName(namespaceID, (const char *)localName, localNameLength);
+}
+
+static void RSSLibXMLHandleStartElement(RSSParser *parser, const xmlChar *localName, const xmlChar *prefix,
+                                        const xmlChar *URI, int attributeCount, const xmlChar **attributes)
+{
+  if ([parser isParseCancelled]) {
+    [parser stopLibXMLParser];
+    return;
+  }
+  
+  if (![parser enterElement]) {
+    return;
+  }
+  
+  RSSElementType elementType = [parser projectElementType:RSSLibXMLElementType(parser, localName, prefix, URI)];
+  
+  if (elementType == RSSElementTypeItem) {
+    [parser startNewItem];
+    
+  } else if (RSSElementTypeHasDescriptor(elementType)) {
+    [parser addMediaObject:RSSLibXMLMediaObject(parser, elementType, attributes, attributeCount)
+            forElementType:elementType];
+  }
+  
+  // Image extraction reads each description as it's parsed, so there's nothing to gain from decoding it lazily
+  BOOL extractsImages = elementType == RSSElementTypeDescription && parser.extractsImagesFromItemDescriptions;
+  // Likewise, `newestItemCount` needs each item's date as soon as it's parsed
+  BOOL keepsNewest = elementType == RSSElementTypePubDate && parser.newestItemCount > 0;
+  if (parser.lazySourceData && parser.currentItem && !extractsImages && !keepsNewest && [RSSLazyItem decodesElementTypeLazily:elementType]) {
+    RSSLibXMLStartLazyElement(parser, elementType);
+    return;
+  }
+  
+  [parser startCapturingCharactersForElementType:elementType];
+  
+  if (RSSElementTypeHasText(elementType)) {
+    [parser.tempBytes setLength:0];
+  }
+}
+
+static void RSSLibXMLStartElement(void *context, const xmlChar *localName, const xmlChar *prefix, const xmlChar *URI,
+                                  int namespaceCount, const xmlChar **namespaces,
+                                  int attributeCount, int defaultedCount, const xmlChar **attributes)
+{
+  RSSParser *parser = (__bridge RSSParser *)context;
+  RSSParseMetrics *metrics = parser.metrics;
+  uint64_t timestamp = metrics ? RSSParseMetricsTimestamp() : 0;
+  
+  RSSLibXMLInternNamespaces(parser, namespaceCount, namespaces);
+  RSSLibXMLHandleStartElement(parser, localName, prefix, URI, attributeCount, attributes);
+  
+  [metrics recordElementStartSince:timestamp];
+}
+
+static void RSSLibXMLHandleEndElement(RSSParser *parser, const xmlChar *localName, const xmlChar *prefix,
+                                      const xmlChar *URI)
+{
+  if (![parser exitElement]) {
+    return;
+  }
+  
+  RSSElementType elementType = RSSLibXMLElementType(parser, localName, prefix, URI);
+  
+  if (elementType != RSSElementTypeUnknown && elementType == parser.lazyElementType) {
+    RSSLibXMLEndLazyElement(parser, elementType);
+    return;
+  }
+  
+  if (parser.capturingCharacters && RSSElementTypeHasText(elementType)) {
+    RSSLibXMLFlushCharacters(parser);
+  }
+  [parser endElementOfType:elementType];
+}
+
+static void RSSLibXMLEndElement(void *context, const xmlChar *localName, const xmlChar *prefix, const xmlChar *URI)
+{
+  RSSParser *parser = (__bridge RSSParser *)context;
+  RSSParseMetrics *metrics = parser.metrics;
+  uint64_t timestamp = metrics ? RSSParseMetricsTimestamp() : 0;
+  
+  RSSLibXMLHandleEndElement(parser, localName, prefix, URI);
+  
+  [metrics recordElementEndSince:timestamp];
+}
+
+static void RSSLibXMLCharacters(void *context, const xmlChar *characters, int length)
+{
+  RSSParser *parser = (__bridge RSSParser *)context;
+  RSSParseMetrics *metrics = parser.metrics;
+  uint64_t timestamp = metrics ? RSSParseMetricsTimestamp() : 0;
+  
+  if (parser.capturingCharacters) {
+    if (parser.maxTextLength > 0) {
+      RSSLibXMLAppendCharactersWithinTextLimit(parser, characters, (NSUInteger)length);
+    } else {
+      [parser.tempBytes appendBytes:characters length:(NSUInteger)length];
+    }
+  }
+  
+  [metrics recordCharactersSince:timestamp];
+}
+
+// `NSXMLParser` reports CDATA sections through a delegate method `RSSParser` doesn't implement, so they're ignored here too. Without this handler, libxml2 would pass them to `characters`.
+static void RSSLibXMLIgnoreCDATA(void *context, const xmlChar *value, int length)
+{
+}
+
+// Errors are reported through `failWithError:` once the chunk that caused them returns, so the messages themselves are dropped.
+static void RSSLibXMLIgnoreMessage(void *context, const char *message, ...)
+{
+}
+
+@implementation RSSParser (LibXML)
+
+#pragma mark - Parsing
+
+- (xmlSAXHandler)libXMLSAXHandler
+{
+  xmlSAXHandler handler;
+  memset(&handler, 0, sizeof(xmlSAXHandler));
+  
+  handler.initialized = XML_SAX2_MAGIC;
+  handler.startDocument = RSSLibXMLStartDocument;
+  handler.endDocument = RSSLibXMLEndDocument;
+  handler.startElementNs = RSSLibXMLStartElement;
+  handler.endElementNs = RSSLibXMLEndElement;
+  handler.characters = RSSLibXMLCharacters;
+  handler.cdataBlock = RSSLibXMLIgnoreCDATA;
+  handler.warning = RSSLibXMLIgnoreMessage;
+  handler.error = RSSLibXMLIgnoreMessage;
+  handler.fatalError = RSSLibXMLIgnoreMessage;
+  
+  return handler;
+}
+
+- (BOOL)startLibXMLParser
+{
+  xmlSAXHandler handler = [self libXMLSAXHandler];
+  xmlParserCtxtPtr context = xmlCreatePushParserCtxt(&handler, (__bridge void *)self, NULL, 0, NULL);
+  if (!context) {
+    [self failWithError:[NSError errorWithDomain:NSXMLParserErrorDomain code:NSXMLParserInternalError userInfo:nil]];
+    return NO;
+  }
+  
+  xmlCtxtUseOptions(context, XML_PARSE_NONET);
+  self.xmlParser = nil;
+  self.libXMLContext = context;
+  self.libXMLMediaNamespaceURI = NULL;
+  self.libXMLDocumentEnded = NO;
+  self.tempBytes = [[NSMutableData alloc] init];
+  self.lazySourceData = nil;
+  self.lazyElementType = RSSElementTypeUnknown;
+  return YES;
+}
+
+// Returns `NO` if parsing has stopped, either because of a fatal error (which has been reported) or because of `stopLibXMLParser`.
+- (BOOL)parseLibXMLBytes:(const void *)bytes length:(NSUInteger)length terminate:(BOOL)terminate
+{
+  xmlParserCtxtPtr context = self.libXMLContext;
+  if (!context) {
+    return NO;
+  }
+  
+  xmlParseChunk(context, bytes, (int)length, terminate);
+  
+  if (context->errNo == XML_ERR_USER_STOP) {
+    [self finishLibXMLParser];
+    return NO;
+  }
+  
+  if (!context->wellFormed) {
+    NSError *error = [NSError errorWithDomain:NSXMLParserErrorDomain code:context->errNo userInfo:nil];
+    [self finishLibXMLParser];
+    [self failWithError:error];
+    return NO;
+  }
+  
+  return YES;
+}
+
+- (void)finishLibXMLParser
+{
+  xmlParserCtxtPtr context = self.libXMLContext;
+  if (context) {
+    self.libXMLContext = NULL;
+    self.libXMLMediaNamespaceURI = NULL;
+    xmlFreeParserCtxt(context);
+  }
+  self.tempBytes = nil;
+  self.lazySourceData = nil;
+}
+
+- (void)parseDataWithLibXML:(NSData *)data
+{
+  NSUInteger length = data.length;
+  unsigned long long maxInputLength = self.maxInputLength;
+  
+  if (maxInputLength > 0 && length > maxInputLength) {
+    if ([self stopForExceededLimit:RSSParserLimitInputLength]) {
+      return;
+    }
+    length = (NSUInteger)maxInputLength;
+  }
+  
+  if (![self startLibXMLParser]) {
+    return;
+  }
+  // Lazy items would decode their text without `maxTextLength`, so it keeps them eager.
+  self.lazySourceData = (self.decodesItemFieldsLazily && self.maxTextLength == 0) ? [data copy] : nil;
+  
+  const char *bytes = data.bytes;
+  
+  for (NSUInteger offset = 0; offset < length; offset += RSSLibXMLChunkSize) {
+    NSUInteger chunkLength = MIN(RSSLibXMLChunkSize, length - offset);
+    if (![self parseLibXMLBytes:bytes + offset length:chunkLength terminate:NO]) {
+      return;
+    }
+  }
+  
+  if (length < data.length) {
+    [self finishTruncatedLibXMLParser];
+  } else if ([self parseLibXMLBytes:NULL length:0 terminate:YES]) {
+    [self finishLibXMLDocument];
+  }
+}
+
+- (void)parseInputStreamWithLibXML:(NSInputStream *)stream
+{
+  if (![self startLibXMLParser]) {
+    return;
+  }
+  
+  NSMutableData *buffer = [NSMutableData dataWithLength:RSSLibXMLChunkSize];
+  unsigned long long maxInputLength = self.maxInputLength;
+  unsigned long long inputLength = 0;
+  [stream open];
+  
+  while (YES) {
+    NSInteger length = [stream read:buffer.mutableBytes maxLength:RSSLibXMLChunkSize];
+    
+    if (length < 0) {
+      NSError *error = stream.streamError;
+      [stream close];
+      [self finishLibXMLParser];
+      [self failWithError:error];
+      return;
+    }
+    
+    if (length == 0) {
+      break;
+    }
+    self.metrics.bytesReceived += (unsigned long long)length;
+    
+    if (maxInputLength > 0 && inputLength + (unsigned long long)length > maxInputLength) {
+      [stream close];
+      [self parseLibXMLBytesWithinInputLimit:buffer.bytes length:(NSUInteger)(maxInputLength - inputLength)];
+      return;
+    }
+    inputLength += (unsigned long long)length;
+    
+    if (![self parseLibXMLBytes:buffer.bytes length:(NSUInteger)length terminate:NO]) {
+      [stream close];
+      return;
+    }
+  }
+  
+  [stream close];
+  
+  if ([self parseLibXMLBytes:NULL length:0 terminate:YES]) {
+    [self finishLibXMLDocument];
+  }
+}
+
+// Called once the final chunk has been parsed and found well-formed, which is when the document actually ends.
+- (void)finishLibXMLDocument
+{
+  BOOL documentEnded = self.libXMLDocumentEnded;
+  [self finishLibXMLParser];
+  
+  if (documentEnded) {
+    [self parserDidEndDocument:nil];
+  }
+}
+
+// Parses the last bytes within `maxInputLength` of a stream that continues past it, unless the limit fails the parse, and ends the document there.
+- (void)parseLibXMLBytesWithinInputLimit:(const void *)bytes length:(NSUInteger)length
+{
+  if ([self stopForExceededLimit:RSSParserLimitInputLength]) {
+    [self finishLibXMLParser];
+    return;
+  }
+  
+  if ([self parseLibXMLBytes:bytes length:length terminate:NO]) {
+    [self finishTruncatedLibXMLParser];
+  }
+}
+
+// Ends a document cut short by `maxInputLength` with what has been parsed so far. libxml2 isn't told the input has ended, since it would report the missing end tags as errors.
+- (void)finishTruncatedLibXMLParser
+{
+  [self finishLibXMLParser];
+  [self finishTruncatedDocument];
+}
+
+- (void)stopLibXMLParser
+{
+  xmlParserCtxtPtr context = self.libXMLContext;
+  if (context) {
+    xmlStopParser(context);
+  }
+}
+
+@end
@@ -24,25 +24,296 @@
 //  THE SOFTWARE.
 
 #import <Foundation/Foundation.h>
+#import "RSSFeedCache.h"
 
 @class AFHTTPSessionManager;
 @class RSSChannel;
+@class RSSColumnarChannel;
+@class RSSItem;
+@class RSSParseMetrics;
+@class RSSStringPool;
+
+/**
+ *  The error domain for errors reported by `RSSParser` itself, rather than by the network or the XML parser.
+ */
+extern NSString * const RSSParserErrorDomain;
+
+/**
+ *  The error codes within `RSSParserErrorDomain`.
+ */
+typedef NS_ENUM(NSInteger, RSSParserError) {
+  /**
+   *  The channel has more items than `maxItemCount`.
+   */
+  RSSParserErrorItemCountExceeded = 1,
+  
+  /**
+   *  An item has more media objects than `maxMediaObjectCount`.
+   */
+  RSSParserErrorMediaObjectCountExceeded,
+  
+  /**
+   *  The text of an element is longer than `maxTextLength`.
+   */
+  RSSParserErrorTextLengthExceeded,
+  
+  /**
+   *  Elements are nested deeper than `maxElementDepth`.
+   */
+  RSSParserErrorElementDepthExceeded,
+  
+  /**
+   *  The document is longer than `maxInputLength`.
+   */
+  RSSParserErrorInputLengthExceeded
+};
+
+/**
+ *  `RSSParserLimits` identifies the resource limits of `RSSParser`, see `failingLimits`.
+ */
+typedef NS_OPTIONS(NSUInteger, RSSParserLimits) {
+  RSSParserLimitItemCount         = 1 << 0,
+  RSSParserLimitMediaObjectCount  = 1 << 1,
+  RSSParserLimitTextLength        = 1 << 2,
+  RSSParserLimitElementDepth      = 1 << 3,
+  RSSParserLimitInputLength       = 1 << 4,
+  
+  RSSParserLimitAll               = (1 << 5) - 1
+};
+
+/**
+ *  `RSSParserBackend` specifies the XML parser used to read RSS documents.
+ */
+typedef NS_ENUM(NSInteger, RSSParserBackend) {
+  /**
+   *  Parses with `NSXMLParser`. This is the default.
+   */
+  RSSParserBackendNSXMLParser = 0,
+  
+  /**
+   *  Parses with libxml2's push SAX2 parser. Element names and `media:*` attributes are matched directly on libxml2's UTF-8 bytes, and documents are fed to the parser in bounded-size chunks. This is meant to be faster than `NSXMLParser` on large feeds, but the two haven't been measured against each other yet (`RSSParserPerformanceTests` has a test for each).
+   */
+  RSSParserBackendLibXML
+};
+
+/**
+ *  `RSSChannelFields` selects the `RSSChannel` properties that `RSSParser` sets, see `channelFields`.
+ */
+typedef NS_OPTIONS(NSUInteger, RSSChannelFields) {
+  RSSChannelFieldTitle          = 1 << 0,
+  RSSChannelFieldLink           = 1 << 1,
+  RSSChannelFieldDescription    = 1 << 2,
+  RSSChannelFieldLanguage       = 1 << 3,
+  RSSChannelFieldCopyright      = 1 << 4,
+  RSSChannelFieldManagingEditor = 1 << 5,
+  RSSChannelFieldWebMaster      = 1 << 6,
+  RSSChannelFieldPubDate        = 1 << 7,
+  RSSChannelFieldLastBuildDate  = 1 << 8,
+  RSSChannelFieldGenerator      = 1 << 9,
+  RSSChannelFieldDocs           = 1 << 10,
+  RSSChannelFieldTTL            = 1 << 11,
+  
+  RSSChannelFieldAll            = (1 << 12) - 1
+};
+
+/**
+ *  `RSSItemFields` selects the `RSSItem` properties that `RSSParser` sets, see `itemFields`.
+ */
+typedef NS_OPTIONS(NSUInteger, RSSItemFields) {
+  RSSItemFieldTitle             = 1 << 0,
+  RSSItemFieldLink              = 1 << 1,
+  RSSItemFieldDescription       = 1 << 2,
+  RSSItemFieldAuthor            = 1 << 3,
+  RSSItemFieldComments          = 1 << 4,
+  RSSItemFieldGuid              = 1 << 5,
+  RSSItemFieldPubDate           = 1 << 6,
+  RSSItemFieldMediaContents     = 1 << 7,
+  RSSItemFieldMediaThumbnails   = 1 << 8,
+  RSSItemFieldMediaCredits      = 1 << 9,
+  RSSItemFieldMediaTitle        = 1 << 10,
+  RSSItemFieldMediaDescription  = 1 << 11,
+  RSSItemFieldMediaText         = 1 << 12,
+  RSSItemFieldMediaKeywords     = 1 << 13,
+  RSSItemFieldMediaPlayer       = 1 << 14,
+  RSSItemFieldMediaCategories   = 1 << 15,
+  RSSItemFieldMediaRatings      = 1 << 16,
+  RSSItemFieldMediaRestrictions = 1 << 17,
+  RSSItemFieldMediaCommunity    = 1 << 18,
+  
+  RSSItemFieldAll               = (1 << 19) - 1
+};
 
 /**
  *  `RSSParser` is a wrapper around an `AFHTTPSessionManager` object, its `client` property, that handles the parsing of Media RSS feed data.
+ *
+ *  Feed data that is already available locally can also be parsed directly from an `NSData` object, a file or an `NSInputStream`, without involving the `client`.
+ *
+ *  Parsing always happens on a private serial queue, never on the calling thread, and the `itemHandler`, `success` and `failure` blocks are called on `callbackQueue`. The parse methods and `cancel` should all be called from the same thread (typically the main thread).
  */
 @interface RSSParser : NSObject <NSXMLParserDelegate>
 
 /**
  *  The date formatter used for formatting dates from the RSS feed. This object is created on `init` of the `RSSParser`. If your RSS feed uses an atypical date format, you can set the correct date format on this object. The default date format is `EEE, dd MMM yyyy HH:mm:ss Z`.
+ *
+ *  Dates are first parsed with a fast RFC 822 and RFC 3339 parser (see `RSSDateParsing.h`), and this date formatter is only used for dates that parser rejects.
+ *
+ *  This date formatter is used on the parser's private queue. Configure it before starting a parse, not while one is in progress.
  */
 @property (nonatomic, strong, readonly) NSDateFormatter *dateFormatter;
 
+/**
+ *  The keys of items that have already been seen, such as from a previous poll of the same feed. Each key is either an item's `guid` or the absolute string of its `link` (see `setKnownItemsFromChannel:`). The default is `nil`.
+ *
+ *  Known items are skipped: they're neither passed to an `itemHandler` nor added to the channel's `items`. Set `knownItemLimit` to also stop parsing once the newest-first feed reaches items that have already been seen.
+ */
+@property (nonatomic, copy) NSSet *knownItemKeys;
+
+/**
+ *  The number of consecutive known items (see `knownItemKeys`) after which parsing stops early. When this happens, the `success` block is called with the items parsed so far, and the rest of the document is never read. The default is `0`, which means parsing never stops early.
+ *
+ *  A channel from a parse that stopped early is not stored in `feedCache`, because it's missing the older items.
+ */
+@property (nonatomic, assign) NSUInteger knownItemLimit;
+
+/**
+ *  The number of newest items, by `pubDate`, to keep from each parse. The default is `0`, which means all items are kept, in document order.
+ *
+ *  When this is set, the channel's `items` are the newest items, newest first; items without a `pubDate` are treated as older than any item with one. An item that can't be among the newest is dropped as soon as its `pubDate` is parsed, and the rest of it is skipped. If `itemHandler` is set, it's called with the kept items, newest first, only once the whole document has been parsed.
+ */
+@property (nonatomic, assign) NSUInteger newestItemCount;
+
+/**
+ *  The queue the `itemHandler`, `success` and `failure` blocks are called on. If `nil`, which is the default, they're called on the main queue.
+ *
+ *  Items are dispatched in document order, followed by the `success` block, so this should be a serial queue if that order matters.
+ */
+@property (nonatomic, strong) dispatch_queue_t callbackQueue;
 
 /**
- *  This will cancel all of the `NSURLSessionTask` objects of the `client`, call `abortParsing` on `xmlParser`, and set both the `success` and `failure` blocks to `nil` (see `RSSParser_Protected.h` for a description of these internal properties).
+ *  The XML parser used for parsing. The default is `RSSParserBackendNSXMLParser`.
  *
- *  Neither the `success` or `failure` block will be called if `cancel` is called (unless, of course, either is called prior to `cancel`).
+ *  Setting this to `RSSParserBackendLibXML` also replaces the `responseSerializer` of the `client`, so that network responses are passed to libxml2 as raw data. Both backends produce the same `RSSChannel` and `RSSItem` objects.
+ */
+@property (nonatomic, assign) RSSParserBackend backend;
+
+/**
+ *  Whether item text properties are decoded only when they're first read. The default is `NO`.
+ *
+ *  When this is `YES` and `backend` is `RSSParserBackendLibXML`, items parsed from data (a network response, `parseRSSData:success:failure:` or `parseRSSFileAtPath:success:failure:`) don't decode their `title`, `link`, `itemDescription`, `authorEmail`, `commentsURL`, `guid`, `pubDate`, `mediaTitle`, `mediaDescription` or `mediaText` while parsing. Instead, each item keeps the byte range of every such element within the document, and converts it to an `NSString`, `NSURL` or `NSDate` the first time the property is read. Parsing time and memory then depend on the properties that are actually read, rather than on the size of the document.
+ *
+ *  Each item retains the document until all of its properties have been read. For a file, this keeps the file mapped into memory, so it mustn't be modified or truncated while such items exist.
+ *
+ *  This has no effect on the `RSSParserBackendNSXMLParser` backend, on input streams or on documents that aren't UTF-8 encoded, which are always decoded eagerly.
+ */
+@property (nonatomic, assign) BOOL decodesItemFieldsLazily;
+
+/**
+ *  Whether each item's `itemDescriptionImages` is set while parsing, from the `itemDescription` text that was just parsed. The default is `NO`.
+ *
+ *  This saves a later pass over every description when `imagesFromItemDescription` is called for every item. When this is `YES`, `itemDescription` is always decoded eagerly, even if `decodesItemFieldsLazily` is `YES`.
+ */
+@property (nonatomic, assign) BOOL extractsImagesFromItemDescriptions;
+
+/**
+ *  The `RSSChannel` properties to parse. The default is `RSSChannelFieldAll`.
+ *
+ *  The text of an element whose property isn't selected is never captured, and the element and everything within it is skipped. Properties that aren't selected are left `nil` (or `0`).
+ */
+@property (nonatomic, assign) RSSChannelFields channelFields;
+
+/**
+ *  The `RSSItem` properties to parse. The default is `RSSItemFieldAll`.
+ *
+ *  Elements whose property isn't selected are skipped along with everything within them, the same as for `channelFields`, and media objects are only created for the selected `mediaContents`, `mediaThumbnails` and `mediaCredits` arrays; the others are left `nil`. If this is `0`, `item` elements are skipped entirely and the channel has no items.
+ *
+ *  While `knownItemKeys` is set, `RSSItemFieldGuid` and `RSSItemFieldLink` are always parsed, since they identify known items.
+ */
+@property (nonatomic, assign) RSSItemFields itemFields;
+
+/**
+ *  The maximum number of items parsed from a channel. The default is `0`, which means there's no limit.
+ *
+ *  Known items (see `knownItemKeys`) don't count towards this. When the limit is exceeded, parsing stops at the start of the next item, and the `success` block is called with the items parsed so far (or the parse fails, if `RSSParserLimitItemCount` is in `failingLimits`). A channel that was cut short is not stored in `feedCache`.
+ */
+@property (nonatomic, assign) NSUInteger maxItemCount;
+
+/**
+ *  The maximum number of media objects (`RSSMediaContent`, `RSSMediaThumbnail`, `RSSMediaCredit`, `RSSMediaCategory`, `RSSMediaRating` and `RSSMediaRestriction` objects combined) parsed for each item. The default is `0`, which means there's no limit.
+ *
+ *  Media elements beyond the limit are ignored, the same as unselected ones (see `itemFields`), unless `RSSParserLimitMediaObjectCount` is in `failingLimits`.
+ */
+@property (nonatomic, assign) NSUInteger maxMediaObjectCount;
+
+/**
+ *  The maximum length, in UTF-16 code units, of the text of each element. The default is `0`, which means there's no limit.
+ *
+ *  Characters beyond the limit are dropped as they're reported by the XML parser, so a long element never holds more than about this much text in memory. The text is cut short without splitting a surrogate pair, unless `RSSParserLimitTextLength` is in `failingLimits`. While this is set, items are decoded eagerly, even if `decodesItemFieldsLazily` is `YES`.
+ */
+@property (nonatomic, assign) NSUInteger maxTextLength;
+
+/**
+ *  The maximum depth of nested elements, where the root `rss` element is at depth `1`. The default is `0`, which means there's no limit beyond the XML parser's own.
+ *
+ *  Elements nested deeper are skipped along with everything within them, unless `RSSParserLimitElementDepth` is in `failingLimits`.
+ */
+@property (nonatomic, assign) NSUInteger maxElementDepth;
+
+/**
+ *  The maximum number of bytes of a document that are parsed. The default is `0`, which means there's no limit.
+ *
+ *  A document from data, a file or an input stream is parsed up to the limit, and then the `success` block is called with whatever had been parsed by then, unless `RSSParserLimitInputLength` is in `failingLimits`. Since the rest of the document is never read, any XML error at the point it was cut short is ignored.
+ *
+ *  A network response can't be parsed partially, so a request whose response is (or announces, with its `Content-Length`) more than this many bytes is cancelled as soon as that's known, and always fails.
+ */
+@property (nonatomic, assign) unsigned long long maxInputLength;
+
+/**
+ *  The limits whose violation fails the parse, instead of cutting short whatever exceeded them. When one of these limits is exceeded, parsing stops and the `failure` block is called with an error within `RSSParserErrorDomain`. The default is `0`, which means every limit truncates.
+ */
+@property (nonatomic, assign) RSSParserLimits failingLimits;
+
+/**
+ *  A block that's passed an `RSSParseMetrics` object describing each parse: the bytes read, the time to the first byte of a network response, the parse time, counts of the elements, items and media objects seen, and the time spent in each kind of parser callback. The default is `nil`, in which case no metrics are collected.
+ *
+ *  The block in effect when a parse starts is called once that parse finishes, on `callbackQueue` immediately before the `success` or `failure` block. Like those blocks, it isn't called for a parse that was cancelled.
+ */
+@property (nonatomic, copy) void (^metricsHandler)(RSSParseMetrics *metrics);
+
+/**
+ *  The maximum number of strings interned by each parse. The default is `RSSStringPoolDefaultCountLimit`; `0` turns interning off.
+ *
+ *  Values that repeat throughout a feed's media objects, such as the `type`, `medium`, `expression` and `lang` of media contents, the `role` and text of media credits, and the `scheme` and `label` of categories, are interned in a string pool, so that equal values share a single `NSString` instance. Each parse has its own pool, unless `stringPool` is set.
+ */
+@property (nonatomic, assign) NSUInteger stringPoolCountLimit;
+
+/**
+ *  A string pool shared by every parse, in place of a pool per parse (see `stringPoolCountLimit`). The default is `nil`.
+ *
+ *  Set the same pool on every parser to share values across feeds for the life of the process. The pool's own `countLimit` bounds its size.
+ */
+@property (nonatomic, strong) RSSStringPool *stringPool;
+
+
+/**
+ *  The cache of HTTP validators and parsed channels used by `parseRSSFeed:parameters:success:failure:` and related methods. The default is `nil`, in which case every request is unconditional.
+ *
+ *  When set, a request for a feed URL that has a cached entry sends the entry's `ETag` as `If-None-Match` and its `Last-Modified` date as `If-Modified-Since`. If the server responds `304 Not Modified`, the cached `RSSChannel` is passed to the `success` block without parsing anything (and no items are passed to an `itemHandler`). Otherwise the response is parsed as usual, and its validators and channel replace the cached entry.
+ *
+ *  See `RSSMemoryFeedCache` and `RSSDiskFeedCache`.
+ */
+@property (nonatomic, strong) id<RSSFeedCache> feedCache;
+
+/**
+ *  Sets `knownItemKeys` to the `guid` and `link` of every item within the given channel, so that a later parse of the same feed only reports new items.
+ *
+ *  @param channel A channel previously parsed from the same feed
+ */
+- (void)setKnownItemsFromChannel:(RSSChannel *)channel;
+
+/**
+ *  This will cancel all of the `NSURLSessionTask` objects of the `client` and stop any parse in progress on the private parse queue at its next element, which then releases its `success` and `failure` blocks (see `RSSParseContext.h` for a description of how these are held).
+ *
+ *  Neither the `success` or `failure` block will be called if `cancel` is called (unless, of course, either has already been called prior to `cancel`), even if it had already been dispatched to `callbackQueue`.
  */
 - (void)cancel;
 
@@ -56,19 +327,125 @@
                     failure:(void (^)(NSError *error))failure;
 
 /**
- *  This method will initiate a GET request of the given `urlString`, including passing the `parameters`,  using the `client`. Both the `success` and `failure` blocks will be copied as internal properties (see `RSSParser_Protected` for a description of these internal properties).
+ *  This method will initiate a GET request of the given `urlString`, including passing the `parameters`,  using the `client`. Both the `success` and `failure` blocks will be copied into the parse's `RSSParseContext` (see `RSSParseContext.h` for a description of these internal properties).
  *
  *  @param urlString  The URL in string format to GET
  *  @param parameters The parameters to be included in the GET request
  *  @param success    The success block to be called on parser successful completion
  *  @param failure    The failure block to be called on network or parser error
 
- *  @warning Both the `success` and `failure` blocks capture self (creates a strong references self). This creates a retain cycle until either success or failure results (both `success` and `failure` block are set to `nil` after either occurs).
+ *  @warning Both the `success` and `failure` blocks capture self (creates a strong references self). This creates a retain cycle until either success or failure results (both `success` and `failure` block are released after either occurs).
+ *
+ */
+- (void)parseRSSFeed:(NSString *)urlString
+          parameters:(NSDictionary *)parameters
+             success:(void (^)(RSSChannel *channel))success
+             failure:(void (^)(NSError *error))failure;
+
+/**
+ *  This is a convenience method for creating a new `RSSParser` object and calling the `parseRSSFeed:parameters:itemHandler:success:failure:` instance method on it.
+ */
++ (RSSParser *)parseRSSFeed:(NSString *)urlString
+                 parameters:(NSDictionary *)parameters
+                itemHandler:(void (^)(RSSItem *item))itemHandler
+                    success:(void (^)(RSSChannel *channel))success
+                    failure:(void (^)(NSError *error))failure;
+
+/**
+ *  This method works like `parseRSSFeed:parameters:success:failure:`, except each `RSSItem` is passed to the `itemHandler` block as soon as its closing `item` element has been parsed, instead of being collected on the channel.
  *
+ *  Parsing waits on `callbackQueue` for `itemHandler` to return before it continues, and the parser does not keep a reference to any item after passing it to `itemHandler`, so memory use stays flat regardless of the number of items within the feed. A slow `itemHandler` therefore slows down the parse, and one that waits for the parse to finish on `callbackQueue` would never return.
+ *
+ *  @param urlString   The URL in string format to GET
+ *  @param parameters  The parameters to be included in the GET request
+ *  @param itemHandler The block to be called once for each parsed item, in document order. If `nil`, items are collected on the channel as usual.
+ *  @param success     The success block to be called on parser successful completion. The `channel` passed to this block contains all channel-level properties, but its `items` array is empty when an `itemHandler` is given.
+ *  @param failure     The failure block to be called on network or parser error. Items already passed to `itemHandler` are not revoked.
+ *
+ *  @warning The `itemHandler`, `success` and `failure` blocks all capture self, the same as described on `parseRSSFeed:parameters:success:failure:`.
  */
 - (void)parseRSSFeed:(NSString *)urlString
           parameters:(NSDictionary *)parameters
+         itemHandler:(void (^)(RSSItem *item))itemHandler
+             success:(void (^)(RSSChannel *channel))success
+             failure:(void (^)(NSError *error))failure;
+
+
+/**
+ *  This method parses the given RSS document `data` directly, without making any network request. The `success` or `failure` block is called the same as for `parseRSSFeed:parameters:success:failure:`.
+ *
+ *  @param data    The RSS document to parse
+ *  @param success The success block to be called on parser successful completion
+ *  @param failure The failure block to be called on parser error
+ */
+- (void)parseRSSData:(NSData *)data
+             success:(void (^)(RSSChannel *channel))success
+             failure:(void (^)(NSError *error))failure;
+
+/**
+ *  This method works like `parseRSSData:success:failure:`, except each parsed item is passed to `itemHandler` as described on `parseRSSFeed:parameters:itemHandler:success:failure:`.
+ */
+- (void)parseRSSData:(NSData *)data
+         itemHandler:(void (^)(RSSItem *item))itemHandler
              success:(void (^)(RSSChannel *channel))success
              failure:(void (^)(NSError *error))failure;
 
+/**
+ *  This method parses the RSS document at the given file `path`. The file is memory-mapped rather than read into memory, so large files do not need to fit in RAM.
+ *
+ *  @param path    The path of the RSS document to parse
+ *  @param success The success block to be called on parser successful completion
+ *  @param failure The failure block to be called if the file cannot be mapped or on parser error
+ */
+- (void)parseRSSFileAtPath:(NSString *)path
+                   success:(void (^)(RSSChannel *channel))success
+                   failure:(void (^)(NSError *error))failure;
+
+/**
+ *  This method works like `parseRSSFileAtPath:success:failure:`, except each parsed item is passed to `itemHandler` as described on `parseRSSFeed:parameters:itemHandler:success:failure:`.
+ */
+- (void)parseRSSFileAtPath:(NSString *)path
+               itemHandler:(void (^)(RSSItem *item))itemHandler
+                   success:(void (^)(RSSChannel *channel))success
+                   failure:(void (^)(NSError *error))failure;
+
+/**
+ *  This method parses the RSS document read from the given `stream`. The stream is read in bounded-size chunks as parsing proceeds, so the whole document is never held in memory at once.
+ *
+ *  @param stream  An unopened input stream containing the RSS document to parse
+ *  @param success The success block to be called on parser successful completion
+ *  @param failure The failure block to be called on stream or parser error
+ */
+- (void)parseRSSInputStream:(NSInputStream *)stream
+                    success:(void (^)(RSSChannel *channel))success
+                    failure:(void (^)(NSError *error))failure;
+
+/**
+ *  This method works like `parseRSSInputStream:success:failure:`, except each parsed item is passed to `itemHandler` as described on `parseRSSFeed:parameters:itemHandler:success:failure:`.
+ */
+- (void)parseRSSInputStream:(NSInputStream *)stream
+                itemHandler:(void (^)(RSSItem *item))itemHandler
+                    success:(void (^)(RSSChannel *channel))success
+                    failure:(void (^)(NSError *error))failure;
+
+/**
+ *  This method parses the given RSS document `data` directly into an `RSSColumnarChannel`. Each item's values are appended to the columns as soon as its closing `item` element has been parsed, and the parser doesn't keep the `RSSItem` itself, so no object graph of items is built.
+ *
+ *  `newestItemCount` and `knownItemKeys` apply the same as for `parseRSSData:success:failure:`.
+ *
+ *  @param data    The RSS document to parse
+ *  @param success The success block to be called on parser successful completion. The `channel` passed to this block contains all channel-level properties, but its `items` array is empty; the items are within `columns`.
+ *  @param failure The failure block to be called on parser error
+ */
+- (void)parseColumnarRSSData:(NSData *)data
+                     success:(void (^)(RSSChannel *channel, RSSColumnarChannel *columns))success
+                     failure:(void (^)(NSError *error))failure;
+
+/**
+ *  This method works like `parseColumnarRSSData:success:failure:`, except it memory-maps the RSS document at the given file `path`, the same as `parseRSSFileAtPath:success:failure:`.
+ */
+- (void)parseColumnarRSSFileAtPath:(NSString *)path
+                           success:(void (^)(RSSChannel *channel, RSSColumnarChannel *columns))success
+                           failure:(void (^)(NSError *error))failure;
+
 @end
@@ -25,14 +25,122 @@
 
 #import "RSSParser.h"
 #import "RSSParser_Protected.h"
+#import "RSSParser+LibXML.h"
+#import "RSSDateParsing.h"
+#import "RSSParserElements.h"
+#import "RSSLazyItem.h"
+#import "RSSImageURLs.h"
 
 #import "AFURLResponseSerialization.h"
 #import "AFHTTPSessionManager.h"
 
+#import <objc/runtime.h>
+
 @interface RSSParser()
 @property (nonatomic, strong, readwrite) NSDateFormatter *dateFormatter;
 @end
 
+NSString * const RSSParserErrorDomain = @"RSSParserErrorDomain";
+
+// The `RSSParseMetricsTimestamp()` at which a data task's response arrived.
+static char RSSResponseTimestampKey;
+
+// Set on a data task that was cancelled because its response exceeded `maxInputLength`.
+static char RSSInputLengthExceededKey;
+
+#pragma mark - Limits
+
+static NSError *RSSParserLimitError(RSSParserLimits limit)
+{
+  RSSParserError code;
+  
+  switch (limit) {
+    case RSSParserLimitItemCount:
+      code = RSSParserErrorItemCountExceeded;
+      break;
+      
+    case RSSParserLimitMediaObjectCount:
+      code = RSSParserErrorMediaObjectCountExceeded;
+      break;
+      
+    case RSSParserLimitTextLength:
+      code = RSSParserErrorTextLengthExceeded;
+      break;
+      
+    case RSSParserLimitElementDepth:
+      code = RSSParserErrorElementDepthExceeded;
+      break;
+      
+    default:
+      code = RSSParserErrorInputLengthExceeded;
+      break;
+  }
+  
+  return [NSError errorWithDomain:RSSParserErrorDomain code:code userInfo:nil];
+}
+
+// Returns the length of the longest prefix of the string no longer than `maxLength` that doesn't split a surrogate pair.
+static NSUInteger RSSTruncatedLength(NSString *string, NSUInteger maxLength)
+{
+  if (string.length <= maxLength) {
+    return string.length;
+  }
+  if (maxLength > 0 && CFStringIsSurrogateHighCharacter([string characterAtIndex:maxLength - 1])) {
+    return maxLength - 1;
+  }
+  return maxLength;
+}
+
+#pragma mark - Field Projection
+
+static RSSChannelFields RSSChannelFieldForElementType(RSSElementType elementType)
+{
+  switch (elementType) {
+    case RSSElementTypeTitle:           return RSSChannelFieldTitle;
+    case RSSElementTypeLink:            return RSSChannelFieldLink;
+    case RSSElementTypeDescription:     return RSSChannelFieldDescription;
+    case RSSElementTypeLanguage:        return RSSChannelFieldLanguage;
+    case RSSElementTypeCopyright:       return RSSChannelFieldCopyright;
+    case RSSElementTypeManagingEditor:  return RSSChannelFieldManagingEditor;
+    case RSSElementTypeWebMaster:       return RSSChannelFieldWebMaster;
+    case RSSElementTypePubDate:         return RSSChannelFieldPubDate;
+    case RSSElementTypeLastBuildDate:   return RSSChannelFieldLastBuildDate;
+    case RSSElementTypeGenerator:       return RSSChannelFieldGenerator;
+    case RSSElementTypeDocs:            return RSSChannelFieldDocs;
+    case RSSElementTypeTTL:             return RSSChannelFieldTTL;
+    default:                            return 0;
+  }
+}
+
+static RSSItemFields RSSItemFieldForElementType(RSSElementType elementType)
+{
+  switch (elementType) {
+    case RSSElementTypeTitle:             return RSSItemFieldTitle;
+    case RSSElementTypeLink:              return RSSItemFieldLink;
+    case RSSElementTypeDescription:       return RSSItemFieldDescription;
+    case RSSElementTypeAuthor:            return RSSItemFieldAuthor;
+    case RSSElementTypeComments:          return RSSItemFieldComments;
+    case RSSElementTypeGuid:              return RSSItemFieldGuid;
+    case RSSElementTypePubDate:           return RSSItemFieldPubDate;
+    case RSSElementTypeMediaContent:      return RSSItemFieldMediaContents;
+    case RSSElementTypeMediaThumbnail:    return RSSItemFieldMediaThumbnails;
+    case RSSElementTypeMediaCredit:       return RSSItemFieldMediaCredits;
+    case RSSElementTypeMediaTitle:        return RSSItemFieldMediaTitle;
+    case RSSElementTypeMediaDescription:  return RSSItemFieldMediaDescription;
+    case RSSElementTypeMediaText:         return RSSItemFieldMediaText;
+    case RSSElementTypeMediaKeywords:     return RSSItemFieldMediaKeywords;
+    case RSSElementTypeMediaPlayer:       return RSSItemFieldMediaPlayer;
+    case RSSElementTypeMediaCategory:     return RSSItemFieldMediaCategories;
+    case RSSElementTypeMediaRating:       return RSSItemFieldMediaRatings;
+    case RSSElementTypeMediaRestriction:  return RSSItemFieldMediaRestrictions;
+    case RSSElementTypeMediaCommunity:    return RSSItemFieldMediaCommunity;
+    case RSSElementTypeMediaStarRating:   return RSSItemFieldMediaCommunity;
+    case RSSElementTypeMediaStatistics:   return RSSItemFieldMediaCommunity;
+    case RSSElementTypeMediaTags:         return RSSItemFieldMediaCommunity;
+    default:                              return 0;
+  }
+}
+
 @implementation RSSParser
 
 #pragma mark - Object Lifecycle
@@ -40,15 +148,23 @@
 - (instancetype)init {
   self = [super init];
   if (self) {
+    [self setUpParseQueue];
     [self setUpClient];
     [self setUpDateFormatter];
+    [self setUpFields];
   }
   return self;
 }
 
+- (void)setUpParseQueue
+{
+  _parseQueue = dispatch_queue_create("com.mediarssparser.parse", DISPATCH_QUEUE_SERIAL);
+}
+
 - (void)setUpClient
 {
   _client = [[AFHTTPSessionManager alloc] init];
+  _client.completionQueue = _parseQueue;
   
   _client.responseSerializer = [[AFXMLParserResponseSerializer alloc] init];
   _client.responseSerializer.acceptableContentTypes  = [NSSet setWithObjects:@"application/xml",
@@ -56,88 +172,760 @@
                                                         @"application/rss+xml",
                                                         @"application/atom+xml",
                                                         nil];
+  
+  [self setUpSessionBlocksForClient:_client];
+}
+
+- (void)setClient:(AFHTTPSessionManager *)client
+{
+  _client = client;
+  _client.completionQueue = self.parseQueue;
+  [self setUpSessionBlocksForClient:client];
+}
+
+// These record when each response arrives and enforce `maxInputLength` while it downloads.
+- (void)setUpSessionBlocksForClient:(AFHTTPSessionManager *)client
+{
+  __weak RSSParser *weakSelf = self;
+  [client setDataTaskDidReceiveResponseBlock:^NSURLSessionResponseDisposition(NSURLSession *session,
+                                                                             NSURLSessionDataTask *dataTask,
+                                                                             NSURLResponse *response) {
+    // This runs on the session's queue, so it doesn't check whether the parse wants metrics.
+    objc_setAssociatedObject(dataTask, &RSSResponseTimestampKey, @(RSSParseMetricsTimestamp()), OBJC_ASSOCIATION_RETAIN_NONATOMIC);
+    
+    unsigned long long maxInputLength = weakSelf.maxInputLength;
+    if (maxInputLength > 0 && response.expectedContentLength > 0 && (unsigned long long)response.expectedContentLength > maxInputLength) {
+      objc_setAssociatedObject(dataTask, &RSSInputLengthExceededKey, @YES, OBJC_ASSOCIATION_RETAIN_NONATOMIC);
+      return NSURLSessionResponseCancel;
+    }
+    return NSURLSessionResponseAllow;
+  }];
+  
+  [client setDataTaskDidReceiveDataBlock:^(NSURLSession *session, NSURLSessionDataTask *dataTask, NSData *data) {
+    unsigned long long maxInputLength = weakSelf.maxInputLength;
+    if (maxInputLength > 0 && dataTask.countOfBytesReceived > 0 && (unsigned long long)dataTask.countOfBytesReceived > maxInputLength) {
+      objc_setAssociatedObject(dataTask, &RSSInputLengthExceededKey, @YES, OBJC_ASSOCIATION_RETAIN_NONATOMIC);
+      [dataTask cancel];
+    }
+  }];
+}
+
+#pragma mark - Backend
+
+- (void)setBackend:(RSSParserBackend)backend
+{
+  if (_backend == backend) {
+    return;
+  }
+  _backend = backend;
+  
+  NSSet *acceptableContentTypes = self.client.responseSerializer.acceptableContentTypes;
+  
+  if (backend == RSSParserBackendLibXML) {
+    self.client.responseSerializer = [[AFHTTPResponseSerializer alloc] init];
+  } else {
+    self.client.responseSerializer = [[AFXMLParserResponseSerializer alloc] init];
+  }
+  
+  self.client.responseSerializer.acceptableContentTypes = acceptableContentTypes;
+}
+
+- (void)setUpDateFormatter
+{
+  self.dateFormatter = [[NSDateFormatter alloc] init];
+  [self.dateFormatter setDateFormat:@"EEE, dd MMM yyyy HH:mm:ss Z"];
+}
+
+- (void)setUpFields
+{
+  _channelFields = RSSChannelFieldAll;
+  _itemFields = RSSItemFieldAll;
+  _stringPoolCountLimit = RSSStringPoolDefaultCountLimit;
+}
+
+#pragma mark - Field Projection
+
+- (RSSItemFields)effectiveItemFields
+{
+  RSSItemFields fields = self.itemFields;
+  if (fields && self.knownItemKeys.count) {
+    fields |= RSSItemFieldGuid | RSSItemFieldLink;
+  }
+  if (fields && self.newestItemCount > 0) {
+    fields |= RSSItemFieldPubDate;
+  }
+  return fields;
+}
+
+- (RSSElementType)projectElementType:(RSSElementType)elementType
+{
+  BOOL selected;
+  
+  if (elementType == RSSElementTypeUnknown) {
+    return elementType;
+    
+  } else if (elementType == RSSElementTypeItem) {
+    selected = self.itemFields != 0;
+    
+  } else if ([self hasCurrentItem]) {
+    selected = (RSSItemFieldForElementType(elementType) & [self effectiveItemFields]) != 0;
+    
+  } else {
+    selected = (RSSChannelFieldForElementType(elementType) & self.channelFields) != 0;
+  }
+  
+  if (selected && [self hasRoomForElementType:elementType]) {
+    return elementType;
+  }
+  
+  // Media groups, content and thumbnail elements may contain other media elements, such as `media:title`
+  if (elementType != RSSElementTypeMediaGroup && elementType != RSSElementTypeMediaContent &&
+      elementType != RSSElementTypeMediaThumbnail) {
+    [self startSkippingElement];
+  }
+  return RSSElementTypeUnknown;
+}
+
+- (void)startSkippingElement
+{
+  self.skippedElementDepth = 1;
+  self.capturingCharacters = NO;
+}
+
+#pragma mark - Limits
+
+- (BOOL)stopForExceededLimit:(RSSParserLimits)limit
+{
+  if ((self.failingLimits & limit) == 0) {
+    return NO;
+  }
+  
+  [self failWithError:RSSParserLimitError(limit)];
+  [self stopParsing];
+  return YES;
+}
+
+- (BOOL)enterElement
+{
+  self.elementDepth += 1;
+  
+  if (self.skippedElementDepth > 0) {
+    self.skippedElementDepth += 1;
+    return NO;
+  }
+  
+  if (self.maxElementDepth > 0 && self.elementDepth > self.maxElementDepth) {
+    if (![self stopForExceededLimit:RSSParserLimitElementDepth]) {
+      [self startSkippingElement];
+    }
+    return NO;
+  }
+  
+  return YES;
+}
+
+- (BOOL)exitElement
+{
+  self.elementDepth -= 1;
+  
+  if (self.skippedElementDepth > 0) {
+    self.skippedElementDepth -= 1;
+    return NO;
+  }
+  
+  return YES;
+}
+
+// Returns `NO` if an item's media object of the given type would exceed `maxMediaObjectCount`.
+- (BOOL)hasRoomForElementType:(RSSElementType)elementType
+{
+  NSUInteger maxMediaObjectCount = self.maxMediaObjectCount;
+  if (maxMediaObjectCount == 0 || !RSSElementTypeIsMediaObject(elementType)) {
+    return YES;
+  }
+  
+  NSUInteger mediaObjectCount = self.mediaContents.count + self.mediaThumbnails.count + self.mediaCredits.count +
+    self.mediaCategories.count + self.mediaRatings.count + self.mediaRestrictions.count;
+  if (mediaObjectCount < maxMediaObjectCount) {
+    return YES;
+  }
+  
+  [self stopForExceededLimit:RSSParserLimitMediaObjectCount];
+  return NO;
+}
+
+// Returns `nil` if the data exceeds `maxInputLength` and that fails the parse.
+- (NSData *)dataWithinInputLimit:(NSData *)data
+{
+  unsigned long long maxInputLength = self.maxInputLength;
+  if (maxInputLength == 0 || data.length <= maxInputLength) {
+    return data;
+  }
+  
+  if ([self stopForExceededLimit:RSSParserLimitInputLength]) {
+    return nil;
+  }
+  
+  self.inputTruncated = YES;
+  return [data subdataWithRange:NSMakeRange(0, (NSUInteger)maxInputLength)];
+}
+
+// Returns `NO` if the text exceeds `maxTextLength` and that fails the parse; otherwise cuts it to length.
+- (BOOL)limitTempStringLength
+{
+  NSUInteger maxTextLength = self.maxTextLength;
+  if (maxTextLength == 0 || self.tempString.length <= maxTextLength) {
+    return YES;
+  }
+  
+  if ([self stopForExceededLimit:RSSParserLimitTextLength]) {
+    return NO;
+  }
+  
+  NSUInteger length = RSSTruncatedLength(self.tempString, maxTextLength);
+  [self.tempString deleteCharactersInRange:NSMakeRange(length, self.tempString.length - length)];
+  return YES;
+}
+
+- (void)appendCharactersWithinTextLimit:(NSString *)string
+{
+  if ([self stopForExceededLimit:RSSParserLimitTextLength]) {
+    return;
+  }
+  
+  NSUInteger available = self.maxTextLength - MIN(self.tempString.length, self.maxTextLength);
+  NSUInteger length = RSSTruncatedLength(string, available);
+  
+  if (length > 0) {
+    [self.tempString appendString:[string substringToIndex:length]];
+  }
+}
+
+#pragma mark - Known Items
+
+- (void)setKnownItemsFromChannel:(RSSChannel *)channel
+{
+  NSMutableSet *keys = [NSMutableSet setWithCapacity:channel.items.count * 2];
+  
+  for (RSSItem *item in channel.items) {
+    if (item.guid.length) {
+      [keys addObject:item.guid];
+    }
+    if (item.link.absoluteString.length) {
+      [keys addObject:item.link.absoluteString];
+    }
+  }
+  
+  self.knownItemKeys = keys;
+}
+
+- (BOOL)isKnownItem:(RSSItem *)item
+{
+  if (!self.knownItemKeys.count) {
+    return NO;
+  }
+  
+  return (item.guid && [self.knownItemKeys containsObject:item.guid]) ||
+    (item.link && [self.knownItemKeys containsObject:item.link.absoluteString]);
+}
+
+#pragma mark - Stopping Early
+
+- (void)finishParsingEarly
+{
+  // The channel lacks the rest of the document, so it mustn't replace the cached one.
+  self.parseContext.pendingCacheEntry = nil;
+  [self parserDidEndDocument:nil];
+  [self stopParsing];
+}
+
+- (void)finishTruncatedDocument
+{
+  // `items` is set when the document starts, and only cleared when it ends.
+  if (!self.items) {
+    [self parserDidStartDocument:nil];
+  }
+  [self finishParsingEarly];
+}
+
+- (void)stopParsing
+{
+  self.inputTruncated = NO;
+  [self.xmlParser abortParsing];
+  [self stopLibXMLParser];
+}
+
+#pragma mark - Cancel
+
+- (void)cancel
+{
+  self.parseGeneration += 1;
+  [self cancelAllTasks];
+}
+
+- (BOOL)isParseCancelled
+{
+  return self.parseContext.generation != self.parseGeneration;
+}
+
+// Cancels any previous parse, then captures the blocks of the new one. This is called on the calling thread.
+- (RSSParseContext *)contextForNewParseWithItemHandler:(void (^)(RSSItem *item))itemHandler
+                                               success:(void (^)(RSSChannel *channel))success
+                                               failure:(void (^)(NSError *error))failure
+{
+  [self cancel];
+  
+  RSSParseContext *context = [[RSSParseContext alloc] init];
+  context.generation = self.parseGeneration;
+  context.successBlock = success;
+  context.failblock = failure;
+  context.itemBlock = itemHandler;
+  context.metricsBlock = self.metricsHandler;
+  return context;
+}
+
+- (BOOL)beginParseWithContext:(RSSParseContext *)context
+{
+  if (context.generation != self.parseGeneration) {
+    return NO;
+  }
+  
+  self.parseContext = context;
+  self.inputTruncated = NO;
+  [self startMetrics];
+  return YES;
+}
+
+- (void)performParseWithContext:(RSSParseContext *)context parse:(void (^)(void))parse
+{
+  dispatch_async(self.parseQueue, ^{
+    if ([self beginParseWithContext:context]) {
+      parse();
+    }
+  });
+}
+
+- (void)cancelAllTasks
+{
+  for (NSURLSessionTask *task in self.client.tasks) {
+    [task cancel];
+  }
+}
+
+#pragma mark - Starting Parser
+
++ (RSSParser *)parseRSSFeed:(NSString *)urlString
+                 parameters:(NSDictionary *)parameters
+                    success:(void (^)(RSSChannel *channel))success
+                    failure:(void (^)(NSError *error))failure
+{
+  RSSParser *parser = [[RSSParser alloc] init];
+  [parser parseRSSFeed:urlString parameters:parameters success:success failure:failure];
+  return parser;
+}
+
++ (RSSParser *)parseRSSFeed:(NSString *)urlString
+                 parameters:(NSDictionary *)parameters
+                itemHandler:(void (^)(RSSItem *item))itemHandler
+                    success:(void (^)(RSSChannel *channel))success
+                    failure:(void (^)(NSError *error))failure
+{
+  RSSParser *parser = [[RSSParser alloc] init];
+  [parser parseRSSFeed:urlString parameters:parameters itemHandler:itemHandler success:success failure:failure];
+  return parser;
+}
+
+- (void)parseRSSFeed:(NSString *)urlString
+          parameters:(NSDictionary *)parameters
+             success:(void (^)(RSSChannel *channel))success
+             failure:(void (^)(NSError *error))failure
+{
+  [self parseRSSFeed:urlString parameters:parameters itemHandler:nil success:success failure:failure];
+}
+
+- (void)parseRSSFeed:(NSString *)urlString
+          parameters:(NSDictionary *)parameters
+         itemHandler:(void (^)(RSSItem *item))itemHandler
+             success:(void (^)(RSSChannel *channel))success
+             failure:(void (^)(NSError *error))failure
+{
+  RSSParseContext *context = [self contextForNewParseWithItemHandler:itemHandler success:success failure:failure];
+  [self prepareConditionalGETWithContext:context urlString:urlString parameters:parameters];
+  uint64_t requestTimestamp = context.metricsBlock ? RSSParseMetricsTimestamp() : 0;
+  
+  [self.client GET:urlString
+        parameters:parameters
+           success:^(NSURLSessionDataTask *task, id responseObject) {
+             if (![self beginParseWithContext:context]) {
+               return;
+             }
+             [self recordMetricsForTask:task requestTimestamp:requestTimestamp];
+             [self setPendingCacheEntryFromResponse:task.response];
+             
+             if ([responseObject isKindOfClass:[NSXMLParser class]]) {
+               [self GETSucceeded:responseObject];
+             } else {
+               [self parseDataWithLibXML:responseObject];
+             }
+             
+           } failure:^(NSURLSessionDataTask *task, NSError *error) {
+             if (![self beginParseWithContext:context]) {
+               return;
+             }
+             [self recordMetricsForTask:task requestTimestamp:requestTimestamp];
+             
+             if ([self isNotModifiedResponse:task.response] && context.cacheEntry.channel) {
+               [self finishWithCachedChannel:context.cacheEntry.channel];
+             } else if (objc_getAssociatedObject(task, &RSSInputLengthExceededKey)) {
+               [self failWithError:RSSParserLimitError(RSSParserLimitInputLength)];
+             } else {
+               [self failWithError:error];
+             }
+           }];
+}
+
+- (void)GETSucceeded:(NSXMLParser *)responseObject
+{
+  [self startXMLParser:responseObject];
+}
+
+- (void)startXMLParser:(NSXMLParser *)xmlParser
+{
+  self.xmlParser = xmlParser;
+  [self.xmlParser setDelegate:self];
+  [self.xmlParser setShouldReportNamespacePrefixes:YES];
+  [self.xmlParser parse];
+}
+
+#pragma mark - Starting Parser - Feed Cache
+
+// This runs on the calling thread, as does `GET:`, which is the only other user of the request serializer's headers.
+- (void)prepareConditionalGETWithContext:(RSSParseContext *)context
+                               urlString:(NSString *)urlString
+                              parameters:(NSDictionary *)parameters
+{
+  RSSFeedCacheEntry *cacheEntry = nil;
+  context.feedCache = self.feedCache;
+  
+  if (context.feedCache) {
+    context.feedURL = [self feedURLForURLString:urlString parameters:parameters];
+    cacheEntry = [context.feedCache cachedEntryForURL:context.feedURL];
+  }
+  
+  // Validators are only useful if there's a channel to return on `304`.
+  if (cacheEntry.channel) {
+    context.cacheEntry = cacheEntry;
+  }
+  
+  [self.client.requestSerializer setValue:context.cacheEntry.etag forHTTPHeaderField:@"If-None-Match"];
+  [self.client.requestSerializer setValue:context.cacheEntry.lastModified forHTTPHeaderField:@"If-Modified-Since"];
+}
+
+// This is the URL `client` requests, including any query string built from `parameters`.
+- (NSURL *)feedURLForURLString:(NSString *)urlString parameters:(NSDictionary *)parameters
+{
+  NSString *absoluteString = [[NSURL URLWithString:urlString relativeToURL:self.client.baseURL] absoluteString];
+  NSURLRequest *request = [self.client.requestSerializer requestWithMethod:@"GET"
+                                                                 URLString:absoluteString
+                                                                parameters:parameters
+                                                                     error:nil];
+  return request.URL;
+}
+
+- (void)setPendingCacheEntryFromResponse:(NSURLResponse *)response
+{
+  RSSParseContext *context = self.parseContext;
+  context.pendingCacheEntry = context.feedURL ? [RSSFeedCacheEntry entryWithResponse:(NSHTTPURLResponse *)response] : nil;
+}
+
+- (BOOL)isNotModifiedResponse:(NSURLResponse *)response
+{
+  return [response isKindOfClass:[NSHTTPURLResponse class]] && [(NSHTTPURLResponse *)response statusCode] == 304;
+}
+
+- (void)finishWithCachedChannel:(RSSChannel *)channel
+{
+  self.channel = channel;
+  [self dispatchSuccess];
+}
+
+- (void)storePendingCacheEntry
+{
+  RSSParseContext *context = self.parseContext;
+  RSSFeedCacheEntry *entry = context.pendingCacheEntry;
+  context.pendingCacheEntry = nil;
+  
+  // A cancelled parse may not have read the whole response.
+  if (entry && context.feedURL && ![self isParseCancelled]) {
+    entry.channel = self.channel;
+    [context.feedCache storeEntry:entry forURL:context.feedURL];
+  }
+}
+
+#pragma mark - Starting Parser - Local Data
+
+- (void)parseRSSData:(NSData *)data
+             success:(void (^)(RSSChannel *channel))success
+             failure:(void (^)(NSError *error))failure
+{
+  [self parseRSSData:data itemHandler:nil success:success failure:failure];
+}
+
+- (void)parseRSSData:(NSData *)data
+         itemHandler:(void (^)(RSSItem *item))itemHandler
+             success:(void (^)(RSSChannel *channel))success
+             failure:(void (^)(NSError *error))failure
+{
+  RSSParseContext *context = [self contextForNewParseWithItemHandler:itemHandler success:success failure:failure];
+  
+  [self performParseWithContext:context parse:^{
+    [self parseData:data];
+  }];
+}
+
+- (void)parseData:(NSData *)data
+{
+  self.metrics.bytesReceived = data.length;
+  
+  if (self.backend == RSSParserBackendLibXML) {
+    [self parseDataWithLibXML:data];
+    return;
+  }
+  
+  NSData *input = [self dataWithinInputLimit:data];
+  if (input) {
+    [self startXMLParser:[[NSXMLParser alloc] initWithData:input]];
+  }
+}
+
+- (void)parseRSSFileAtPath:(NSString *)path
+                   success:(void (^)(RSSChannel *channel))success
+                   failure:(void (^)(NSError *error))failure
+{
+  [self parseRSSFileAtPath:path itemHandler:nil success:success failure:failure];
+}
+
+- (void)parseRSSFileAtPath:(NSString *)path
+               itemHandler:(void (^)(RSSItem *item))itemHandler
+                   success:(void (^)(RSSChannel *channel))success
+                   failure:(void (^)(NSError *error))failure
+{
+  RSSParseContext *context = [self contextForNewParseWithItemHandler:itemHandler success:success failure:failure];
+  
+  [self performParseWithContext:context parse:^{
+    NSError *error = nil;
+    NSData *data = [NSData dataWithContentsOfFile:path options:NSDataReadingMappedAlways error:&error];
+    
+    if (data) {
+      [self parseData:data];
+    } else {
+      [self failWithError:error];
+    }
+  }];
+}
+
+- (void)parseRSSInputStream:(NSInputStream *)stream
+                    success:(void (^)(RSSChannel *channel))success
+                    failure:(void (^)(NSError *error))failure
+{
+  [self parseRSSInputStream:stream itemHandler:nil success:success failure:failure];
+}
+
+- (void)parseRSSInputStream:(NSInputStream *)stream
+                itemHandler:(void (^)(RSSItem *item))itemHandler
+                    success:(void (^)(RSSChannel *channel))success
+                    failure:(void (^)(NSError *error))failure
+{
+  RSSParseContext *context = [self contextForNewParseWithItemHandler:itemHandler success:success failure:failure];
+  
+  [self performParseWithContext:context parse:^{
+    if (self.backend == RSSParserBackendLibXML) {
+      [self parseInputStreamWithLibXML:stream];
+    } else if (self.maxInputLength > 0) {
+      [self parseInputStreamWithinInputLimit:stream];
+    } else {
+      [self startXMLParser:[[NSXMLParser alloc] initWithStream:stream]];
+    }
+  }];
+}
+
+// `NSXMLParser` reads input streams itself, so to enforce `maxInputLength` the stream is read into memory first, up to one buffer past the limit.
+- (void)parseInputStreamWithinInputLimit:(NSInputStream *)stream
+{
+  NSMutableData *data = [[NSMutableData alloc] init];
+  uint8_t buffer[16 * 1024];
+  [stream open];
+  
+  while (data.length <= self.maxInputLength) {
+    NSInteger length = [stream read:buffer maxLength:sizeof(buffer)];
+    
+    if (length < 0) {
+      NSError *error = stream.streamError;
+      [stream close];
+      [self failWithError:error];
+      return;
+    }
+    
+    if (length == 0) {
+      break;
+    }
+    [data appendBytes:buffer length:(NSUInteger)length];
+  }
+  
+  [stream close];
+  [self parseData:data];
+}
+
+#pragma mark - Starting Parser - Columnar Data
+
+- (void)parseColumnarRSSData:(NSData *)data
+                     success:(void (^)(RSSChannel *channel, RSSColumnarChannel *columns))success
+                     failure:(void (^)(NSError *error))failure
+{
+  RSSParseContext *context = [self contextForColumnarParseWithSuccess:success failure:failure];
+  
+  [self performParseWithContext:context parse:^{
+    [self parseData:data];
+  }];
+}
+
+- (void)parseColumnarRSSFileAtPath:(NSString *)path
+                           success:(void (^)(RSSChannel *channel, RSSColumnarChannel *columns))success
+                           failure:(void (^)(NSError *error))failure
+{
+  RSSParseContext *context = [self contextForColumnarParseWithSuccess:success failure:failure];
+  
+  [self performParseWithContext:context parse:^{
+    NSError *error = nil;
+    NSData *data = [NSData dataWithContentsOfFile:path options:NSDataReadingMappedAlways error:&error];
+    
+    if (data) {
+      [self parseData:data];
+    } else {
+      [self failWithError:error];
+    }
+  }];
+}
+
+- (RSSParseContext *)contextForColumnarParseWithSuccess:(void (^)(RSSChannel *channel, RSSColumnarChannel *columns))success
+                                                failure:(void (^)(NSError *error))failure
+{
+  RSSColumnarChannel *columns = [[RSSColumnarChannel alloc] init];
+  
+  RSSParseContext *context = [self contextForNewParseWithItemHandler:nil success:^(RSSChannel *channel) {
+    if (success) {
+      success(channel, columns);
+    }
+  } failure:failure];
+  
+  context.columnarChannel = columns;
+  return context;
+}
+
+#pragma mark - NSXMLParserDelegate - Error Handling
+
+- (void)parser:(NSXMLParser *)parser parseErrorOccurred:(NSError *)parseError
+{
+  [parser abortParsing];
+  
+  if (self.inputTruncated) {
+    [self finishTruncatedDocument];
+  } else {
+    [self failWithError:parseError];
+  }
+}
+
+- (void)failWithError:(NSError *)error
+{
+  void (^failblock)(NSError *) = [self isParseCancelled] ? nil : self.parseContext.failblock;
+  [self dispatchMetrics];
+  
+  if (failblock) {
+    [self dispatchCallback:^{
+      failblock(error);
+    }];
+  }
+  
+  [self finishParseContext];
 }
 
-- (void)setUpDateFormatter
+// Once a parse has finished or noticed it was cancelled, its blocks (which may well retain the caller) aren't kept until the next parse begins.
+- (void)finishParseContext
 {
-  self.dateFormatter = [[NSDateFormatter alloc] init];
-  [self.dateFormatter setDateFormat:@"EEE, dd MMM yyyy HH:mm:ss Z"];
+  self.parseContext = nil;
 }
 
-#pragma mark - Cancel
+#pragma mark - Callbacks
 
-- (void)cancel
+- (dispatch_queue_t)queueForCallbacks
 {
-  [self cancelAllTasks];
-  [self.xmlParser abortParsing];
-  [self nilSuccessAndFailureBlocks];
+  return self.callbackQueue ?: dispatch_get_main_queue();
 }
 
-- (void)cancelAllTasks
+- (void)dispatchCallback:(dispatch_block_t)callback
 {
-  for (NSURLSessionTask *task in self.client.tasks) {
-    [task cancel];
-  }
+  NSUInteger generation = self.parseContext.generation;
+  
+  dispatch_async([self queueForCallbacks], ^{
+    if (generation == self.parseGeneration) {
+      callback();
+    }
+  });
 }
 
-- (void)nilSuccessAndFailureBlocks
+// Unlike `dispatchCallback:`, this returns only once the callback has run, so the parse doesn't get ahead of it.
+- (void)dispatchCallbackAndWait:(dispatch_block_t)callback
 {
-  [self setSuccessBlock:nil];
-  [self setFailblock:nil];
+  NSUInteger generation = self.parseContext.generation;
+  dispatch_queue_t queue = [self queueForCallbacks];
+  
+  dispatch_block_t block = ^{
+    if (generation == self.parseGeneration) {
+      callback();
+    }
+  };
+  
+  // Waiting on the queue this is already running on would deadlock.
+  if (queue == self.parseQueue || (queue == dispatch_get_main_queue() && [NSThread isMainThread])) {
+    block();
+  } else {
+    dispatch_sync(queue, block);
+  }
 }
 
-#pragma mark - Starting Parser
+#pragma mark - Metrics
 
-+ (RSSParser *)parseRSSFeed:(NSString *)urlString
-                 parameters:(NSDictionary *)parameters
-                    success:(void (^)(RSSChannel *channel))success
-                    failure:(void (^)(NSError *error))failure
+- (void)startMetrics
 {
-  RSSParser *parser = [[RSSParser alloc] init];
-  [parser parseRSSFeed:urlString parameters:parameters success:success failure:failure];
-  return parser;
+  self.metrics = self.parseContext.metricsBlock ? [[RSSParseMetrics alloc] init] : nil;
+  [self.metrics beginParse];
 }
 
-- (void)parseRSSFeed:(NSString *)urlString
-          parameters:(NSDictionary *)parameters
-             success:(void (^)(RSSChannel *channel))success
-             failure:(void (^)(NSError *error))failure
+- (void)recordMetricsForTask:(NSURLSessionTask *)task requestTimestamp:(uint64_t)requestTimestamp
 {
-  [self cancel];
-  [self setSuccessBlock:success];
-  [self setFailblock:failure];
+  RSSParseMetrics *metrics = self.metrics;
+  if (!metrics) {
+    return;
+  }
   
-  [self.client GET:urlString
-        parameters:parameters
-           success:^(NSURLSessionDataTask *task, NSXMLParser *responseObject) {
-             [self GETSucceeded:responseObject];
-             
-           } failure:^(NSURLSessionDataTask *task, NSError *error) {
-             if (failure) {
-               failure(error);
-             }
-             [self nilSuccessAndFailureBlocks];
-           }];
-}
-
-- (void)GETSucceeded:(NSXMLParser *)responseObject
-{
-  self.xmlParser = responseObject;
-  [self.xmlParser setDelegate:self];
-  [self.xmlParser parse];
+  metrics.bytesReceived = (unsigned long long)MAX(task.countOfBytesReceived, 0);
+  
+  NSNumber *responseTimestamp = objc_getAssociatedObject(task, &RSSResponseTimestampKey);
+  [metrics recordRequestTimestamp:requestTimestamp responseTimestamp:responseTimestamp.unsignedLongLongValue];
 }
 
-#pragma mark - NSXMLParserDelegate - Error Handling
-
-- (void)parser:(NSXMLParser *)parser parseErrorOccurred:(NSError *)parseError
+- (void)dispatchMetrics
 {
-  [parser abortParsing];
+  void (^metricsBlock)(RSSParseMetrics *) = [self isParseCancelled] ? nil : self.parseContext.metricsBlock;
+  RSSParseMetrics *metrics = self.metrics;
+  self.metrics = nil;
   
-  if (self.failblock) {
-    self.failblock(parseError);
+  if (metricsBlock && metrics) {
+    [metrics finishParse];
+    [self dispatchCallback:^{
+      metricsBlock(metrics);
+    }];
   }
-  
-  [self nilSuccessAndFailureBlocks];
 }
 
 #pragma mark - NSXMLParserDelegate - Document Start
@@ -146,13 +934,42 @@
 {
   self.channel = [[RSSChannel alloc] init];
   self.items = [[NSMutableArray alloc] init];
+  self.consecutiveKnownItemCount = 0;
+  self.parsedItemCount = 0;
+  self.elementDepth = 0;
+  self.skippedElementDepth = 0;
+  self.namespacePrefixes = nil;
+  self.remappedPrefixCount = 0;
+  self.newestItems = self.newestItemCount > 0 ? [[RSSNewestItemHeap alloc] initWithCapacity:self.newestItemCount] : nil;
+  self.parseStringPool = [self stringPoolForParse];
+}
+
+- (RSSStringPool *)stringPoolForParse
+{
+  if (self.stringPool) {
+    return self.stringPool;
+  }
+  return self.stringPoolCountLimit > 0 ? [[RSSStringPool alloc] initWithCountLimit:self.stringPoolCountLimit] : nil;
 }
 
 #pragma mark - NSXMLParserDelegate - Found Characters
 
 - (void)parser:(NSXMLParser *)parser foundCharacters:(NSString *)string
 {
-  [self.tempString appendString:string];
+  RSSParseMetrics *metrics = self.metrics;
+  uint64_t timestamp = metrics ? RSSParseMetricsTimestamp() : 0;
+  
+  if (self.capturingCharacters) {
+    NSUInteger maxTextLength = self.maxTextLength;
+    
+    if (maxTextLength > 0 && self.tempString.length + string.length > maxTextLength) {
+      [self appendCharactersWithinTextLimit:string];
+    } else {
+      [self.tempString appendString:string];
+    }
+  }
+  
+  [metrics recordCharactersSince:timestamp];
 }
 
 #pragma mark - NSXMLParserDelegate - Document End
@@ -161,32 +978,52 @@
 {
   [self setChannelProperties];
   [self nilTemporaryProperties];
+  [self storePendingCacheEntry];
   [self dispatchSuccess];
 }
 
 - (void)setChannelProperties
 {
+  [self takeNewestItems];
   self.channel.items = self.items;
 }
 
+- (void)takeNewestItems
+{
+  if (!self.newestItems) {
+    return;
+  }
+  
+  for (RSSItem *item in [self.newestItems removeItemsNewestFirst]) {
+    [self collectItem:item];
+  }
+  self.newestItems = nil;
+}
+
 - (void)nilTemporaryProperties
 {
-  self.currentItem = nil;
-  self.mediaCredits = nil;
-  self.mediaContents = nil;
-  self.mediaThumbnails = nil;
+  [self nilCurrentItemProperties];
   self.items = nil;
+  self.newestItems = nil;
+  self.parseStringPool = nil;
+  self.namespacePrefixes = nil;
   self.tempString = nil;
+  self.capturingCharacters = NO;
 }
 
 - (void)dispatchSuccess
 {
-  if (self.successBlock) {
-    dispatch_async(dispatch_get_main_queue(), ^{
-      self.successBlock(self.channel);
-      [self nilSuccessAndFailureBlocks];
-    });
+  void (^successBlock)(RSSChannel *) = [self isParseCancelled] ? nil : self.parseContext.successBlock;
+  RSSChannel *channel = self.channel;
+  [self dispatchMetrics];
+  
+  if (successBlock) {
+    [self dispatchCallback:^{
+      successBlock(channel);
+    }];
   }
+  
+  [self finishParseContext];
 }
 
 #pragma mark - NSXMLParserDelegate - Element Start
@@ -195,111 +1032,240 @@
   namespaceURI:(NSString *)namespaceURI qualifiedName:(NSString *)qualifiedName
     attributes:(NSDictionary *)attributeDict
 {
-  if ([self matchesItemElement:elementName]) {
+  RSSParseMetrics *metrics = self.metrics;
+  uint64_t timestamp = metrics ? RSSParseMetricsTimestamp() : 0;
+  
+  [self parser:parser startElement:elementName attributes:attributeDict];
+  
+  [metrics recordElementStartSince:timestamp];
+}
+
+- (void)parser:(NSXMLParser *)parser startElement:(NSString *)elementName attributes:(NSDictionary *)attributeDict
+{
+  if ([self isParseCancelled]) {
+    [parser abortParsing];
+    return;
+  }
+  
+  if (![self enterElement]) {
+    return;
+  }
+  
+  RSSElementType elementType = [self projectElementType:[self elementTypeForName:elementName]];
+  
+  if (elementType == RSSElementTypeItem) {
     [self startNewItem];
     
-  } else if ([self matchesMediaContentElement:elementName]) {
-    [self addMediaContentFromAttributes:attributeDict];
-    
-  } else if ([self matchesMediaThumbnailElement:elementName]) {
-    [self addMediaThumbnailFromAttributes:attributeDict];
-    
-  } else if ([self matchesMediaCreditElement:elementName]) {
-    [self addMediaCreditFromAttributes:attributeDict];
-    
+  } else if (RSSElementTypeHasDescriptor(elementType)) {
+    id mediaObject = [self enclosingMediaObjectForElementType:elementType];
+    [self addMediaObject:RSSMediaObjectWithAttributes(elementType, mediaObject, attributeDict, self.parseStringPool)
+          forElementType:elementType];
   }
   
-  self.tempString = [[NSMutableString alloc] init];
+  [self startCapturingCharactersForElementType:elementType];
 }
 
-- (void)startNewItem
+- (void)startCapturingCharactersForElementType:(RSSElementType)elementType
 {
-  self.currentItem = [[RSSItem alloc] init];
+  if (elementType == RSSElementTypeUnknown) {
+    return;
+  }
+  
+  self.capturingCharacters = RSSElementTypeHasText(elementType);
+  
+  if (!self.capturingCharacters) {
+    return;
+  }
   
-  self.mediaContents = [[NSMutableArray alloc] init];
-  self.mediaThumbnails = [[NSMutableArray alloc] init];
-  self.mediaCredits = [[NSMutableArray alloc] init];
+  if (self.tempString) {
+    [self.tempString setString:@""];
+  } else {
+    self.tempString = [[NSMutableString alloc] init];
+  }
 }
 
-#pragma mark - Start Matchers
-
-- (BOOL)matchesItemElement:(NSString *)elementName
+- (void)startNewItem
 {
-  return [elementName isEqualToString:@"item"] || [elementName isEqualToString:@"entry"];
+  if (self.maxItemCount > 0 && self.parsedItemCount >= self.maxItemCount) {
+    if (![self stopForExceededLimit:RSSParserLimitItemCount]) {
+      [self finishParsingEarly];
+    }
+    return;
+  }
+  
+  if (self.lazySourceData) {
+    self.currentItem = [[RSSLazyItem alloc] initWithSourceData:self.lazySourceData dateFormatter:self.dateFormatter];
+  } else {
+    self.currentItem = [[RSSItem alloc] init];
+  }
+  self.lazyElementType = RSSElementTypeUnknown;
+  [self.metrics recordItem];
+  
+  RSSItemFields fields = self.itemFields;
+  self.mediaContents = (fields & RSSItemFieldMediaContents) ? [[NSMutableArray alloc] init] : nil;
+  self.mediaThumbnails = (fields & RSSItemFieldMediaThumbnails) ? [[NSMutableArray alloc] init] : nil;
+  self.mediaCredits = (fields & RSSItemFieldMediaCredits) ? [[NSMutableArray alloc] init] : nil;
+  self.mediaCategories = (fields & RSSItemFieldMediaCategories) ? [[NSMutableArray alloc] init] : nil;
+  self.mediaRatings = (fields & RSSItemFieldMediaRatings) ? [[NSMutableArray alloc] init] : nil;
+  self.mediaRestrictions = (fields & RSSItemFieldMediaRestrictions) ? [[NSMutableArray alloc] init] : nil;
 }
 
-- (BOOL)matchesMediaContentElement:(NSString *)elementName
-{
-  return [elementName isEqualToString:@"media:content"];
-}
+#pragma mark - Element Lookup
 
-- (BOOL)matchesMediaThumbnailElement:(NSString *)elementName
+- (RSSElementType)elementTypeForName:(NSString *)elementName
 {
-  return [elementName isEqualToString:@"media:thumbnail"];
+  if (self.remappedPrefixCount > 0) {
+    return [self elementTypeForRemappedName:elementName];
+  }
+  return [self hasCurrentItem] ? RSSItemElementTypeForName(elementName) : RSSChannelElementTypeForName(elementName);
 }
 
-- (BOOL)matchesMediaCreditElement:(NSString *)elementName
+- (RSSElementType)elementTypeForRemappedName:(NSString *)elementName
 {
-  return [elementName isEqual:@"media:credit"];
+  NSRange colon = [elementName rangeOfString:@":" options:NSLiteralSearch];
+  NSString *prefix = @"";
+  NSString *localName = elementName;
+  
+  if (colon.location != NSNotFound) {
+    prefix = [elementName substringToIndex:colon.location];
+    localName = [elementName substringFromIndex:NSMaxRange(colon)];
+  }
+  
+  RSSNamespace namespaceID = [self namespaceForPrefix:prefix];
+  const char *bytes = [localName UTF8String];
+  
+  if ([self hasCurrentItem]) {
+    return RSSItemElementTypeForNamespacedName(namespaceID, bytes, strlen(bytes));
+  }
+  return RSSChannelElementTypeForNamespacedName(namespaceID, bytes, strlen(bytes));
 }
 
-#pragma mark - Add Media Credit
-
-- (void)addMediaCreditFromAttributes:(NSDictionary *)attributes
+- (RSSNamespace)namespaceForPrefix:(NSString *)prefix
 {
-  RSSMediaCredit *mediaCredit = [self mediaCreditFromAttributes:attributes];
-  [self.mediaCredits addObject:mediaCredit];
+  NSNumber *namespaceID = [self.namespacePrefixes[prefix] lastObject];
+  if (namespaceID) {
+    return [namespaceID integerValue];
+  }
+  
+  if (prefix.length == 0) {
+    return RSSNamespaceNone;
+  }
+  const char *bytes = [prefix UTF8String];
+  return RSSNamespaceForUndeclaredPrefix(bytes, strlen(bytes));
 }
 
-- (RSSMediaCredit *)mediaCreditFromAttributes:(NSDictionary *)attributes
+// A binding is conventional if element names under it can be matched as written.
+- (BOOL)isConventionalPrefix:(NSString *)prefix forNamespace:(RSSNamespace)namespaceID
 {
-  RSSMediaCredit *mediaCredit = [[RSSMediaCredit alloc] init];
-  mediaCredit.role = attributes[@"role"];
-  return mediaCredit;
+  if ([prefix isEqualToString:@"media"]) {
+    return namespaceID == RSSNamespaceMediaRSS;
+  }
+  return namespaceID != RSSNamespaceMediaRSS;
 }
 
-#pragma mark - Add Media Thumbnail
+#pragma mark - NSXMLParserDelegate - Namespace Prefixes
 
-- (void)addMediaThumbnailFromAttributes:(NSDictionary *)attributes
+- (void)parser:(NSXMLParser *)parser didStartMappingPrefix:(NSString *)prefix toURI:(NSString *)namespaceURI
 {
-  RSSMediaThumbnail *mediaItem = [self mediaThumbnailFromAttributes:attributes];
-  [self.mediaThumbnails addObject:mediaItem];
+  prefix = prefix ?: @"";
+  const char *bytes = [namespaceURI UTF8String] ?: "";
+  RSSNamespace namespaceID = RSSNamespaceForURI(bytes, strlen(bytes));
+  
+  // Unprefixed elements in a default namespace other than Media RSS's, such as Atom's, are core elements
+  if (prefix.length == 0 && namespaceID == RSSNamespaceOther) {
+    namespaceID = RSSNamespaceNone;
+  }
+  
+  if (!self.namespacePrefixes) {
+    self.namespacePrefixes = [[NSMutableDictionary alloc] init];
+  }
+  NSMutableArray *bindings = self.namespacePrefixes[prefix];
+  if (!bindings) {
+    bindings = [[NSMutableArray alloc] initWithCapacity:1];
+    self.namespacePrefixes[prefix] = bindings;
+  }
+  [bindings addObject:@(namespaceID)];
+  
+  if (![self isConventionalPrefix:prefix forNamespace:namespaceID]) {
+    self.remappedPrefixCount += 1;
+  }
 }
 
-- (RSSMediaThumbnail *)mediaThumbnailFromAttributes:(NSDictionary *)attributes
+- (void)parser:(NSXMLParser *)parser didEndMappingPrefix:(NSString *)prefix
 {
-  RSSMediaThumbnail *mediaThumbnail = [[RSSMediaThumbnail alloc] init];
-  mediaThumbnail.url = [NSURL URLWithString:attributes[@"url"]];
-  mediaThumbnail.size = CGSizeMake([attributes[@"width"] floatValue], [attributes[@"height"] floatValue]);
-  mediaThumbnail.timeOffset = attributes[@"time"];
-  return mediaThumbnail;
+  prefix = prefix ?: @"";
+  NSMutableArray *bindings = self.namespacePrefixes[prefix];
+  NSNumber *namespaceID = [bindings lastObject];
+  if (!namespaceID) {
+    return;
+  }
+  
+  if (![self isConventionalPrefix:prefix forNamespace:[namespaceID integerValue]]) {
+    self.remappedPrefixCount -= 1;
+  }
+  [bindings removeLastObject];
 }
 
-#pragma mark - Add Media Content
+#pragma mark - Add Media Objects
 
-- (void)addMediaContentFromAttributes:(NSDictionary *)attributes
+- (id)enclosingMediaObjectForElementType:(RSSElementType)elementType
 {
-  RSSMediaContent *mediaItem = [self mediaContentFromAttributes:attributes];
-  [self.mediaContents addObject:mediaItem];
+  switch (elementType) {
+    case RSSElementTypeMediaStarRating:
+    case RSSElementTypeMediaStatistics:
+    case RSSElementTypeMediaTags:
+      return self.currentItem.mediaCommunity;
+      
+    default:
+      return nil;
+  }
 }
 
-- (RSSMediaContent *)mediaContentFromAttributes:(NSDictionary *)attributes
+- (void)addMediaObject:(id)mediaObject forElementType:(RSSElementType)elementType
 {
-  RSSMediaContent *mediaContent = [[RSSMediaContent alloc] init];
-  mediaContent.fileSize = [attributes[@"fileSize"] integerValue];
-  mediaContent.type = attributes[@"type"];
-  mediaContent.medium = attributes[@"medium"];
-  mediaContent.isDefault = [attributes[@"isDefault"] boolValue];
-  mediaContent.expression = attributes[@"expression"];
-  mediaContent.bitrate = [attributes[@"bitrate"] integerValue];
-  mediaContent.framerate = [attributes[@"framerate"] integerValue];
-  mediaContent.samplingRate = [attributes[@"samplingrate"] floatValue];
-  mediaContent.channels = [attributes[@"channels"] integerValue];
-  mediaContent.duration = [attributes[@"duration"] integerValue];
-  mediaContent.url = [NSURL URLWithString:attributes[@"url"]];
-  mediaContent.size = CGSizeMake([attributes[@"width"] floatValue], [attributes[@"height"] floatValue]);
-  mediaContent.language = attributes[@"lang"];
-  return mediaContent;
+  if (!mediaObject) {
+    return;
+  }
+  
+  switch (elementType) {
+    case RSSElementTypeMediaContent:
+      [self.mediaContents addObject:mediaObject];
+      break;
+      
+    case RSSElementTypeMediaThumbnail:
+      [self.mediaThumbnails addObject:mediaObject];
+      break;
+      
+    case RSSElementTypeMediaCredit:
+      [self.mediaCredits addObject:mediaObject];
+      break;
+      
+    case RSSElementTypeMediaCategory:
+      [self.mediaCategories addObject:mediaObject];
+      break;
+      
+    case RSSElementTypeMediaRating:
+      [self.mediaRatings addObject:mediaObject];
+      break;
+      
+    case RSSElementTypeMediaRestriction:
+      [self.mediaRestrictions addObject:mediaObject];
+      break;
+      
+    case RSSElementTypeMediaPlayer:
+      self.currentItem.mediaPlayer = mediaObject;
+      break;
+      
+    case RSSElementTypeMediaCommunity:
+      self.currentItem.mediaCommunity = mediaObject;
+      break;
+      
+    default:
+      // The elements within `media:community` are decoded onto its existing object
+      return;
+  }
+  
+  [self.metrics recordMediaObject];
 }
 
 #pragma mark - NSXMLParserDelegate - Element End
@@ -307,88 +1273,172 @@
 - (void)parser:(NSXMLParser *)parser didEndElement:(NSString *)elementName
   namespaceURI:(NSString *)namespaceURI qualifiedName:(NSString *)qName
 {
-  if ([self matchesItemElement:elementName]) {
+  RSSParseMetrics *metrics = self.metrics;
+  uint64_t timestamp = metrics ? RSSParseMetricsTimestamp() : 0;
+  
+  if ([self exitElement]) {
+    [self endElementOfType:[self elementTypeForName:elementName]];
+  }
+  
+  [metrics recordElementEndSince:timestamp];
+}
+
+- (void)endElementOfType:(RSSElementType)elementType
+{
+  if (elementType == RSSElementTypeItem) {
     [self endCurrentItem];
     
-  } else if ([self hasTempString] == NO) {
+  } else if (self.capturingCharacters == NO || RSSElementTypeHasText(elementType) == NO) {
+    return;
+    
+  } else {
+    self.capturingCharacters = NO;
+    [self setValueForElementType:elementType];
+  }
+}
+
+- (void)setValueForElementType:(RSSElementType)elementType
+{
+  if ([self hasTempString] == NO || [self limitTempStringLength] == NO) {
     return;
     
   } else if ([self hasCurrentItem] == NO) {
+    [self setChannelValueForElementType:elementType];
     
-    if ([self matchesTitleElement:elementName]) {
+  } else {
+    [self setItemValueForElementType:elementType];
+  }
+}
+
+- (void)setChannelValueForElementType:(RSSElementType)elementType
+{
+  switch (elementType) {
+    case RSSElementTypeTitle:
       [self.channel setTitle:self.tempString];
+      break;
       
-    } else if ([self matchesLinkElement:elementName]) {
+    case RSSElementTypeLink:
       [self.channel setLink:[self urlFromTempString]];
+      break;
       
-    } else if ([self matchesDescriptionElement:elementName]) {
+    case RSSElementTypeDescription:
       [self.channel setChannelDescription:self.tempString];
+      break;
       
-    } else if ([self matchesLanguageElement:elementName]) {
+    case RSSElementTypeLanguage:
       [self.channel setLanguage:self.tempString];
+      break;
       
-    } else if ([self matchesCopyrightElement:elementName]) {
+    case RSSElementTypeCopyright:
       [self.channel setCopyright:self.tempString];
+      break;
       
-    } else if ([self matchesManagingEditorElement:elementName]) {
+    case RSSElementTypeManagingEditor:
       [self.channel setManagingEditorEmail:self.tempString];
+      break;
       
-    } else if ([self matchesWebMasterElement:elementName]) {
+    case RSSElementTypeWebMaster:
       [self.channel setWebMasterEmail:self.tempString];
+      break;
       
-    } else if ([self matchesPubDateElement:elementName]) {
+    case RSSElementTypePubDate:
       [self.channel setPubDate:[self dateFromTempString]];
+      break;
       
-    } else if ([self matchesLastBuildDate:elementName]) {
+    case RSSElementTypeLastBuildDate:
       [self.channel setLastBuildDate:[self dateFromTempString]];
+      break;
       
-    } else if ([self matchesGeneratorElement:elementName]) {
+    case RSSElementTypeGenerator:
       [self.channel setGenerator:self.tempString];
+      break;
       
-    } else if ([self matchesDocsElement:elementName]) {
+    case RSSElementTypeDocs:
       [self.channel setDocsURL:[self urlFromTempString]];
+      break;
       
-    } else if ([self matchesTTLElement:elementName]) {
+    case RSSElementTypeTTL:
       [self.channel setTtl:[self integerFromTempString]];
+      break;
       
-    }
-    
-  } else {
-    
-    if ([self matchesTitleElement:elementName]) {
+    default:
+      break;
+  }
+}
+
+- (void)setItemValueForElementType:(RSSElementType)elementType
+{
+  switch (elementType) {
+    case RSSElementTypeTitle:
       [self.currentItem setTitle:self.tempString];
+      break;
       
-    } else if ([self matchesLinkElement:elementName]) {
+    case RSSElementTypeLink:
       [self.currentItem setLink:[self urlFromTempString]];
+      break;
       
-    } else if ([self matchesDescriptionElement:elementName]) {
+    case RSSElementTypeDescription:
       [self.currentItem setItemDescription:self.tempString];
+      if (self.extractsImagesFromItemDescriptions && self.tempString.length) {
+        [self.currentItem setItemDescriptionImages:RSSImageURLStringsInString(self.tempString)];
+      }
+      break;
       
-    } else if ([self matchesAuthorElement:elementName]) {
+    case RSSElementTypeAuthor:
       [self.currentItem setAuthorEmail:self.tempString];
+      break;
       
-    } else if ([self matchesCommentsElement:elementName]) {
+    case RSSElementTypeComments:
       [self.currentItem setCommentsURL:[self urlFromTempString]];
+      break;
       
-    } else if ([self matchesGuidElement:elementName]) {
+    case RSSElementTypeGuid:
       [self.currentItem setGuid:self.tempString];
+      break;
       
-    } else if ([self matchesPubDateElement:elementName]) {
+    case RSSElementTypePubDate:
       self.currentItem.pubDate = [self dateFromTempString];
+      [self dropItemIfNotNewest];
+      break;
       
-    } else if ([self matchesMediaTitleElement:elementName]) {
+    case RSSElementTypeMediaTitle:
       [self.currentItem setMediaTitle:self.tempString];
+      break;
       
-    } else if ([self matchesMediaDescriptionElement:elementName]) {
+    case RSSElementTypeMediaDescription:
       [self.currentItem setMediaDescription:self.tempString];
+      break;
       
-    } else if ([self matchesMediaCreditElement:elementName]) {
-      [self setMediaCreditValue];
-      
-    } else if ([self matchesMediaTextElement:elementName]) {
+    case RSSElementTypeMediaText:
       [self.currentItem setMediaText:self.tempString];
+      break;
       
-    }
+    case RSSElementTypeMediaKeywords:
+      [self.currentItem setMediaKeywords:[self keywordsFromTempString]];
+      break;
+      
+    case RSSElementTypeMediaCredit:
+      RSSMediaObjectSetText(elementType, [self.mediaCredits lastObject], self.tempString, self.parseStringPool);
+      break;
+      
+    case RSSElementTypeMediaCategory:
+      RSSMediaObjectSetText(elementType, [self.mediaCategories lastObject], self.tempString, self.parseStringPool);
+      break;
+      
+    case RSSElementTypeMediaRating:
+      RSSMediaObjectSetText(elementType, [self.mediaRatings lastObject], self.tempString, self.parseStringPool);
+      break;
+      
+    case RSSElementTypeMediaRestriction:
+      RSSMediaObjectSetText(elementType, [self.mediaRestrictions lastObject], self.tempString, self.parseStringPool);
+      break;
+      
+    case RSSElementTypeMediaTags:
+      RSSMediaObjectSetText(elementType, self.currentItem.mediaCommunity, self.tempString, self.parseStringPool);
+      break;
+      
+    default:
+      break;
   }
 }
 
@@ -407,121 +1457,132 @@
   self.currentItem.mediaContents = self.mediaContents;
   self.currentItem.mediaThumbnails = self.mediaThumbnails;
   self.currentItem.mediaCredits = self.mediaCredits;
+  self.currentItem.mediaCategories = self.mediaCategories;
+  self.currentItem.mediaRatings = self.mediaRatings;
+  self.currentItem.mediaRestrictions = self.mediaRestrictions;
   
-  [self.items addObject:self.currentItem];
-}
-
-- (NSURL *)urlFromTempString
-{
-  return [NSURL URLWithString:self.tempString];
-}
-
-- (NSDate *)dateFromTempString
-{
-  return [self.dateFormatter dateFromString:self.tempString];
-}
-
-- (NSInteger)integerFromTempString
-{
-  return [self.tempString integerValue];
-}
-
-- (void)setMediaCreditValue
-{
-  RSSMediaCredit *mediaCredit = [self.mediaCredits lastObject];
-  [mediaCredit setValue:self.tempString];
-}
-
-#pragma mark - End Matchers
-
-- (BOOL)matchesTitleElement:(NSString *)elementName
-{
-  return [elementName isEqualToString:@"title"];
-}
-
-- (BOOL)matchesLinkElement:(NSString *)elementName
-{
-  return [elementName isEqualToString:@"link"];
-}
-
-- (BOOL)matchesDescriptionElement:(NSString *)elementName
-{
-  return [elementName isEqualToString:@"description"];
-}
-
-- (BOOL)matchesLanguageElement:(NSString *)elementName
-{
-  return [elementName isEqualToString:@"language"];
-}
-
-- (BOOL)matchesCopyrightElement:(NSString *)elementName
-{
-  return [elementName isEqualToString:@"copyright"];
-}
-
-- (BOOL)matchesManagingEditorElement:(NSString *)elementName
-{
-  return [elementName isEqualToString:@"managingEditor"];
-}
-
-- (BOOL)matchesWebMasterElement:(NSString *)elementName
-{
-  return [elementName isEqualToString:@"webMaster"];
-}
-
-- (BOOL)matchesPubDateElement:(NSString *)elementName
-{
-  return [elementName isEqualToString:@"pubDate"];
+  if ([self isKnownItem:self.currentItem]) {
+    [self endKnownItem];
+    return;
+  }
+  
+  self.consecutiveKnownItemCount = 0;
+  self.parsedItemCount += 1;
+  
+  if (self.newestItems) {
+    [self.newestItems addItem:self.currentItem];
+  } else {
+    [self collectItem:self.currentItem];
+  }
+  
+  [self nilCurrentItemProperties];
 }
 
-- (BOOL)matchesLastBuildDate:(NSString *)elementName
+- (void)computeIdentityKeyOfItem:(RSSItem *)item
 {
-  return [elementName isEqualToString:@"lastBuildDate"];
+  // Lazy items compute it on first access, so that their guid and link stay undecoded until then.
+  if (![item isKindOfClass:[RSSLazyItem class]]) {
+    [item identityKey];
+  }
 }
 
-- (BOOL)matchesGeneratorElement:(NSString *)elementName
+- (void)collectItem:(RSSItem *)item
 {
-  return [elementName isEqualToString:@"generator"];
+  RSSColumnarChannel *columnarChannel = self.parseContext.columnarChannel;
+  if (columnarChannel) {
+    [columnarChannel appendItem:item];
+    return;
+  }
+  
+  [self computeIdentityKeyOfItem:item];
+  
+  if (self.parseContext.itemBlock) {
+    [self dispatchItem:item];
+  } else {
+    [self.items addObject:item];
+  }
 }
 
-- (BOOL)matchesDocsElement:(NSString *)elementName
+- (void)dropItemIfNotNewest
 {
-  return [elementName isEqualToString:@"docs"];
+  if (!self.newestItems || [self.newestItems retainsItemWithDate:self.currentItem.pubDate]) {
+    return;
+  }
+  
+  // The rest of the item, up to and including its end tag, is skipped, so its media objects are never built.
+  self.parsedItemCount += 1;
+  [self nilCurrentItemProperties];
+  [self startSkippingElement];
 }
 
-- (BOOL)matchesTTLElement:(NSString *)elementName
+- (void)endKnownItem
 {
-  return [elementName isEqualToString:@"ttl"];
+  [self nilCurrentItemProperties];
+  self.consecutiveKnownItemCount += 1;
+  
+  if (self.knownItemLimit > 0 && self.consecutiveKnownItemCount >= self.knownItemLimit) {
+    [self finishParsingEarly];
+  }
 }
 
-- (BOOL)matchesAuthorElement:(NSString *)elementName
+- (void)nilCurrentItemProperties
 {
-  return [elementName isEqualToString:@"author"];
+  self.currentItem = nil;
+  self.mediaCredits = nil;
+  self.mediaContents = nil;
+  self.mediaThumbnails = nil;
+  self.mediaCategories = nil;
+  self.mediaRatings = nil;
+  self.mediaRestrictions = nil;
 }
 
-- (BOOL)matchesCommentsElement:(NSString *)elementName
+- (void)dispatchItem:(RSSItem *)item
 {
-  return [elementName isEqualToString:@"comments"];
+  void (^itemBlock)(RSSItem *) = self.parseContext.itemBlock;
+  RSSParseMetrics *metrics = self.metrics;
+  
+  // Each item is handed over before the next one is parsed, so items never pile up on `callbackQueue`.
+  [self dispatchCallbackAndWait:^{
+    uint64_t timestamp = metrics ? RSSParseMetricsTimestamp() : 0;
+    itemBlock(item);
+    [metrics recordItemHandlerSince:timestamp];
+  }];
 }
 
-- (BOOL)matchesGuidElement:(NSString *)elementName
+- (NSURL *)urlFromTempString
 {
-  return [elementName isEqualToString:@"guid"];
+  return [NSURL URLWithString:self.tempString];
 }
 
-- (BOOL)matchesMediaTitleElement:(NSString *)elementName
+- (NSDate *)dateFromTempString
 {
-  return [elementName isEqualToString:@"media:title"];
+  RSSParseMetrics *metrics = self.metrics;
+  uint64_t timestamp = metrics ? RSSParseMetricsTimestamp() : 0;
+  
+  NSDate *date = RSSDateFromString(self.tempString) ?: [self.dateFormatter dateFromString:self.tempString];
+  
+  [metrics recordDateParseSince:timestamp succeeded:(date != nil)];
+  return date;
 }
 
-- (BOOL)matchesMediaDescriptionElement:(NSString *)elementName
+- (NSInteger)integerFromTempString
 {
-  return [elementName isEqualToString:@"media:description"];
+  return [self.tempString integerValue];
 }
 
-- (BOOL)matchesMediaTextElement:(NSString *)elementName
+// Splits a `media:keywords` list on commas, trimming whitespace and dropping empty keywords.
+- (NSArray *)keywordsFromTempString
 {
-  return [elementName isEqual:@"media:text"];
+  NSCharacterSet *whitespace = [NSCharacterSet whitespaceAndNewlineCharacterSet];
+  NSMutableArray *keywords = [[NSMutableArray alloc] init];
+  
+  for (NSString *component in [self.tempString componentsSeparatedByString:@","]) {
+    NSString *keyword = [component stringByTrimmingCharactersInSet:whitespace];
+    if (keyword.length) {
+      [keywords addObject:keyword];
+    }
+  }
+  return keywords;
 }
 
 @end
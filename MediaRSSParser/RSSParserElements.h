@@ -0,0 +1,143 @@
+//
+//  RSSParserElements.h
+//  MediaRSSParser
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+
+
+#import <Foundation/Foundation.h>
+
+/**
+ *  `RSSElementType` identifies each element that `RSSParser` maps onto a model property or object.
+ */
+typedef NS_ENUM(NSInteger, RSSElementType) {
+  RSSElementTypeUnknown = 0,
+  
+  RSSElementTypeItem,
+  
+  RSSElementTypeTitle,
+  RSSElementTypeLink,
+  RSSElementTypeDescription,
+  RSSElementTypeLanguage,
+  RSSElementTypeCopyright,
+  RSSElementTypeManagingEditor,
+  RSSElementTypeWebMaster,
+  RSSElementTypePubDate,
+  RSSElementTypeLastBuildDate,
+  RSSElementTypeGenerator,
+  RSSElementTypeDocs,
+  RSSElementTypeTTL,
+  
+  RSSElementTypeAuthor,
+  RSSElementTypeComments,
+  RSSElementTypeGuid,
+  
+  RSSElementTypeMediaContent,
+  RSSElementTypeMediaThumbnail,
+  RSSElementTypeMediaCredit,
+  RSSElementTypeMediaTitle,
+  RSSElementTypeMediaDescription,
+  RSSElementTypeMediaText,
+  RSSElementTypeMediaGroup,
+  RSSElementTypeMediaKeywords,
+  RSSElementTypeMediaPlayer,
+  RSSElementTypeMediaCategory,
+  RSSElementTypeMediaRating,
+  RSSElementTypeMediaRestriction,
+  RSSElementTypeMediaCommunity,
+  RSSElementTypeMediaStarRating,
+  RSSElementTypeMediaStatistics,
+  RSSElementTypeMediaTags,
+};
+
+/**
+ *  `RSSNamespace` identifies the XML namespace of an element, independent of the prefix a feed binds it to.
+ */
+typedef NS_ENUM(NSInteger, RSSNamespace) {
+  /**
+   *  The core RSS elements: elements in no namespace, and unprefixed elements in a default namespace other than Media RSS's (such as Atom's or RSS 1.0's).
+   */
+  RSSNamespaceNone = 0,
+  
+  /**
+   *  Media RSS, `http://search.yahoo.com/mrss/`.
+   */
+  RSSNamespaceMediaRSS,
+  
+  /**
+   *  Any other namespace, none of whose elements the parser maps.
+   */
+  RSSNamespaceOther,
+};
+
+/**
+ *  Returns the namespace for the given UTF-8 encoded namespace URI: `RSSNamespaceMediaRSS` for the Media RSS URI `http://search.yahoo.com/mrss/` or one of its common variants (`https`, the `video.search.yahoo.com` host, and either without the trailing slash), or `RSSNamespaceOther` for any other URI.
+ *
+ *  Parsers call this once per namespace declaration, and then match each element's namespace to the result by its prefix or interned URI.
+ */
+extern RSSNamespace RSSNamespaceForURI(const char *URI, size_t length);
+
+/**
+ *  Returns the namespace for an element prefix that the document never declared. Many feeds use `media:` elements without declaring the prefix, so `media` is taken to be Media RSS; any other undeclared prefix is `RSSNamespaceOther`.
+ */
+extern RSSNamespace RSSNamespaceForUndeclaredPrefix(const char *prefix, size_t length);
+
+/**
+ *  Returns `YES` if the given element type maps its character data onto a model property, i.e. it's a leaf element whose text the parser reads.
+ */
+extern BOOL RSSElementTypeHasText(RSSElementType elementType);
+
+/**
+ *  Returns `YES` if the given element type creates one of the current item's media objects (an `RSSMediaContent`, `RSSMediaThumbnail`, `RSSMediaCredit`, `RSSMediaCategory`, `RSSMediaRating` or `RSSMediaRestriction`), which count towards `maxMediaObjectCount`.
+ */
+extern BOOL RSSElementTypeIsMediaObject(RSSElementType elementType);
+
+/**
+ *  Returns the element type for the given element name found directly within a `channel` element, or `RSSElementTypeUnknown` if the parser doesn't map it.
+ *
+ *  Names are matched as written, with Media RSS elements under their conventional `media` prefix (e.g. `media:content`). This is a single hashed lookup into a table built once per process, so its cost doesn't depend on the number of known elements.
+ */
+extern RSSElementType RSSChannelElementTypeForName(NSString *elementName);
+
+/**
+ *  Returns the element type for the given element name found within an `item` element, or `RSSElementTypeUnknown` if the parser doesn't map it.
+ *
+ *  See `RSSChannelElementTypeForName` for how names are matched.
+ */
+extern RSSElementType RSSItemElementTypeForName(NSString *elementName);
+
+/**
+ *  Returns the element type for the given element found directly within a `channel` element, or `RSSElementTypeUnknown` if the parser doesn't map it.
+ *
+ *  The element is identified by its namespace and UTF-8 encoded local name, e.g. `RSSNamespaceMediaRSS` and `content` for `media:content`, so it matches whatever prefix the feed binds the namespace to, and it can be looked up straight from the byte ranges reported by libxml2 without creating any string objects.
+ *
+ *  @param namespaceID     The element's namespace
+ *  @param localName       The local name bytes
+ *  @param localNameLength The number of bytes in `localName`
+ */
+extern RSSElementType RSSChannelElementTypeForNamespacedName(RSSNamespace namespaceID,
+                                                             const char *localName, size_t localNameLength);
+
+/**
+ *  Returns the element type for the given element found within an `item` element, or `RSSElementTypeUnknown` if the parser doesn't map it.
+ *
+ *  See `RSSChannelElementTypeForNamespacedName` for a description of the parameters.
+ */
+extern RSSElementType RSSItemElementTypeForNamespacedName(RSSNamespace namespaceID,
+                                                          const char *localName, size_t localNameLength);
@@ -0,0 +1,284 @@
+//
+//  RSSParserElements.m
+//  MediaRSSParser
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+
+
+#import "RSSParserElements.h"
+
+typedef struct {
+  RSSNamespace namespaceID;
+  const char *name;
+  RSSElementType type;
+} RSSElementMapping;
+
+// Elements mapped onto `RSSChannel` properties.
+static RSSElementMapping gChannelElementMap[] = {
+  { RSSNamespaceNone, "item", RSSElementTypeItem },
+  { RSSNamespaceNone, "entry", RSSElementTypeItem },
+  
+  { RSSNamespaceNone, "title", RSSElementTypeTitle },
+  { RSSNamespaceNone, "link", RSSElementTypeLink },
+  { RSSNamespaceNone, "description", RSSElementTypeDescription },
+  { RSSNamespaceNone, "language", RSSElementTypeLanguage },
+  { RSSNamespaceNone, "copyright", RSSElementTypeCopyright },
+  { RSSNamespaceNone, "managingEditor", RSSElementTypeManagingEditor },
+  { RSSNamespaceNone, "webMaster", RSSElementTypeWebMaster },
+  { RSSNamespaceNone, "pubDate", RSSElementTypePubDate },
+  { RSSNamespaceNone, "lastBuildDate", RSSElementTypeLastBuildDate },
+  { RSSNamespaceNone, "generator", RSSElementTypeGenerator },
+  { RSSNamespaceNone, "docs", RSSElementTypeDocs },
+  { RSSNamespaceNone, "ttl", RSSElementTypeTTL },
+};
+
+// Elements mapped onto `RSSItem` properties and media model objects.
+static RSSElementMapping gItemElementMap[] = {
+  { RSSNamespaceNone, "item", RSSElementTypeItem },
+  { RSSNamespaceNone, "entry", RSSElementTypeItem },
+  
+  { RSSNamespaceNone, "title", RSSElementTypeTitle },
+  { RSSNamespaceNone, "link", RSSElementTypeLink },
+  { RSSNamespaceNone, "description", RSSElementTypeDescription },
+  { RSSNamespaceNone, "author", RSSElementTypeAuthor },
+  { RSSNamespaceNone, "comments", RSSElementTypeComments },
+  { RSSNamespaceNone, "guid", RSSElementTypeGuid },
+  { RSSNamespaceNone, "pubDate", RSSElementTypePubDate },
+  
+  { RSSNamespaceMediaRSS, "content", RSSElementTypeMediaContent },
+  { RSSNamespaceMediaRSS, "thumbnail", RSSElementTypeMediaThumbnail },
+  { RSSNamespaceMediaRSS, "credit", RSSElementTypeMediaCredit },
+  { RSSNamespaceMediaRSS, "title", RSSElementTypeMediaTitle },
+  { RSSNamespaceMediaRSS, "description", RSSElementTypeMediaDescription },
+  { RSSNamespaceMediaRSS, "text", RSSElementTypeMediaText },
+  { RSSNamespaceMediaRSS, "group", RSSElementTypeMediaGroup },
+  { RSSNamespaceMediaRSS, "keywords", RSSElementTypeMediaKeywords },
+  { RSSNamespaceMediaRSS, "player", RSSElementTypeMediaPlayer },
+  { RSSNamespaceMediaRSS, "category", RSSElementTypeMediaCategory },
+  { RSSNamespaceMediaRSS, "rating", RSSElementTypeMediaRating },
+  { RSSNamespaceMediaRSS, "restriction", RSSElementTypeMediaRestriction },
+  { RSSNamespaceMediaRSS, "community", RSSElementTypeMediaCommunity },
+  { RSSNamespaceMediaRSS, "starRating", RSSElementTypeMediaStarRating },
+  { RSSNamespaceMediaRSS, "statistics", RSSElementTypeMediaStatistics },
+  { RSSNamespaceMediaRSS, "tags", RSSElementTypeMediaTags },
+};
+
+#pragma mark - Namespaces
+
+// The conventional prefix, under which Media RSS elements are matched by name.
+static const char RSSMediaRSSPrefix[] = "media";
+
+// The URI of the specification, plus the variants that feeds commonly declare instead: the older
+// `video.search.yahoo.com` host and `https`, each with or without the trailing slash.
+static const char *gMediaRSSNamespaceURIs[] = {
+  "http://search.yahoo.com/mrss/",
+  "http://search.yahoo.com/mrss",
+  "https://search.yahoo.com/mrss/",
+  "https://search.yahoo.com/mrss",
+  "http://video.search.yahoo.com/mrss/",
+  "http://video.search.yahoo.com/mrss",
+  "https://video.search.yahoo.com/mrss/",
+  "https://video.search.yahoo.com/mrss",
+};
+
+static BOOL RSSBytesEqualString(const char *bytes, size_t length, const char *string)
+{
+  return strlen(string) == length && memcmp(bytes, string, length) == 0;
+}
+
+RSSNamespace RSSNamespaceForURI(const char *URI, size_t length)
+{
+  for (size_t i = 0; i < sizeof(gMediaRSSNamespaceURIs) / sizeof(gMediaRSSNamespaceURIs[0]); i++) {
+    if (RSSBytesEqualString(URI, length, gMediaRSSNamespaceURIs[i])) {
+      return RSSNamespaceMediaRSS;
+    }
+  }
+  return RSSNamespaceOther;
+}
+
+RSSNamespace RSSNamespaceForUndeclaredPrefix(const char *prefix, size_t length)
+{
+  return RSSBytesEqualString(prefix, length, RSSMediaRSSPrefix) ? RSSNamespaceMediaRSS : RSSNamespaceOther;
+}
+
+#pragma mark - Element Types
+
+BOOL RSSElementTypeHasText(RSSElementType elementType)
+{
+  switch (elementType) {
+    case RSSElementTypeUnknown:
+    case RSSElementTypeItem:
+    case RSSElementTypeMediaContent:
+    case RSSElementTypeMediaThumbnail:
+    case RSSElementTypeMediaGroup:
+    case RSSElementTypeMediaPlayer:
+    case RSSElementTypeMediaCommunity:
+    case RSSElementTypeMediaStarRating:
+    case RSSElementTypeMediaStatistics:
+      return NO;
+      
+    default:
+      return YES;
+  }
+}
+
+BOOL RSSElementTypeIsMediaObject(RSSElementType elementType)
+{
+  return elementType == RSSElementTypeMediaContent ||
+    elementType == RSSElementTypeMediaThumbnail ||
+    elementType == RSSElementTypeMediaCredit ||
+    elementType == RSSElementTypeMediaCategory ||
+    elementType == RSSElementTypeMediaRating ||
+    elementType == RSSElementTypeMediaRestriction;
+}
+
+// Values are stored unboxed, so a lookup is one hash of the element name plus one string comparison.
+static CFDictionaryRef RSSCreateElementTable(RSSElementMapping *map, NSUInteger count)
+{
+  CFMutableDictionaryRef table = CFDictionaryCreateMutable(kCFAllocatorDefault, count,
+                                                           &kCFTypeDictionaryKeyCallBacks, NULL);
+  for (NSUInteger i = 0; i < count; i++) {
+    CFStringRef name;
+    if (map[i].namespaceID == RSSNamespaceMediaRSS) {
+      name = CFStringCreateWithFormat(kCFAllocatorDefault, NULL, CFSTR("%s:%s"), RSSMediaRSSPrefix, map[i].name);
+    } else {
+      name = CFStringCreateWithCString(kCFAllocatorDefault, map[i].name, kCFStringEncodingUTF8);
+    }
+    CFDictionarySetValue(table, name, (const void *)(intptr_t)map[i].type);
+    CFRelease(name);
+  }
+  return table;
+}
+
+static RSSElementType RSSElementTypeForNameInTable(CFDictionaryRef table, NSString *elementName)
+{
+  if (!elementName) {
+    return RSSElementTypeUnknown;
+  }
+  return (RSSElementType)(intptr_t)CFDictionaryGetValue(table, (__bridge CFStringRef)elementName);
+}
+
+RSSElementType RSSChannelElementTypeForName(NSString *elementName)
+{
+  static CFDictionaryRef table;
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    table = RSSCreateElementTable(gChannelElementMap, sizeof(gChannelElementMap) / sizeof(RSSElementMapping));
+  });
+  
+  return RSSElementTypeForNameInTable(table, elementName);
+}
+
+RSSElementType RSSItemElementTypeForName(NSString *elementName)
+{
+  static CFDictionaryRef table;
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    table = RSSCreateElementTable(gItemElementMap, sizeof(gItemElementMap) / sizeof(RSSElementMapping));
+  });
+  
+  return RSSElementTypeForNameInTable(table, elementName);
+}
+
+#pragma mark - Namespaced Names
+
+// Open-addressed table over the namespaced element names. It has more than twice as many slots as
+// there are known names, so a lookup hashes the name once and almost always compares one slot.
+#define RSSElementByteTableSize 64
+
+typedef struct {
+  RSSNamespace namespaceID;
+  const char *name;
+  size_t length;
+  RSSElementType type;
+} RSSElementByteSlot;
+
+typedef struct {
+  RSSElementByteSlot slots[RSSElementByteTableSize];
+} RSSElementByteTable;
+
+static uint32_t RSSElementHashNamespacedName(RSSNamespace namespaceID, const char *localName, size_t localNameLength)
+{
+  uint32_t hash = (2166136261u ^ (uint8_t)namespaceID) * 16777619u;
+  for (size_t i = 0; i < localNameLength; i++) {
+    hash = (hash ^ (uint8_t)localName[i]) * 16777619u;
+  }
+  return hash;
+}
+
+static void RSSBuildElementByteTable(RSSElementByteTable *table, RSSElementMapping *map, NSUInteger count)
+{
+  memset(table, 0, sizeof(RSSElementByteTable));
+  
+  for (NSUInteger i = 0; i < count; i++) {
+    size_t length = strlen(map[i].name);
+    uint32_t index = RSSElementHashNamespacedName(map[i].namespaceID, map[i].name, length) & (RSSElementByteTableSize - 1);
+    while (table->slots[index].name) {
+      index = (index + 1) & (RSSElementByteTableSize - 1);
+    }
+    table->slots[index].namespaceID = map[i].namespaceID;
+    table->slots[index].name = map[i].name;
+    table->slots[index].length = length;
+    table->slots[index].type = map[i].type;
+  }
+}
+
+static RSSElementType RSSElementTypeInByteTable(RSSElementByteTable *table, RSSNamespace namespaceID,
+                                                const char *localName, size_t localNameLength)
+{
+  if (namespaceID == RSSNamespaceOther) {
+    return RSSElementTypeUnknown;
+  }
+  
+  uint32_t index = RSSElementHashNamespacedName(namespaceID, localName, localNameLength) & (RSSElementByteTableSize - 1);
+  
+  while (table->slots[index].name) {
+    RSSElementByteSlot *slot = &table->slots[index];
+    if (slot->namespaceID == namespaceID && slot->length == localNameLength &&
+        memcmp(slot->name, localName, localNameLength) == 0) {
+      return slot->type;
+    }
+    index = (index + 1) & (RSSElementByteTableSize - 1);
+  }
+  return RSSElementTypeUnknown;
+}
+
+RSSElementType RSSChannelElementTypeForNamespacedName(RSSNamespace namespaceID,
+                                                      const char *localName, size_t localNameLength)
+{
+  static RSSElementByteTable table;
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    RSSBuildElementByteTable(&table, gChannelElementMap, sizeof(gChannelElementMap) / sizeof(RSSElementMapping));
+  });
+  
+  return RSSElementTypeInByteTable(&table, namespaceID, localName, localNameLength);
+}
+
+RSSElementType RSSItemElementTypeForNamespacedName(RSSNamespace namespaceID,
+                                                   const char *localName, size_t localNameLength)
+{
+  static RSSElementByteTable table;
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    RSSBuildElementByteTable(&table, gItemElementMap, sizeof(gItemElementMap) / sizeof(RSSElementMapping));
+  });
+  
+  return RSSElementTypeInByteTable(&table, namespaceID, localName, localNameLength);
+}
@@ -23,6 +23,14 @@
 //  THE SOFTWARE.
 
 #import "RSSParser.h"
+#import "RSSParserElements.h"
+#import "RSSFeedCacheEntry.h"
+#import "RSSNewestItemHeap.h"
+#import "RSSParseMetrics_Protected.h"
+#import "RSSMediaAttributes.h"
+#import "RSSStringPool.h"
+#import "RSSColumnarChannel.h"
+#import "RSSParseContext.h"
 
 #import "RSSChannel.h"
 #import "RSSItem.h"
@@ -30,10 +38,17 @@
 #import "RSSMediaContent.h"
 #import "RSSMediaThumbnail.h"
 #import "RSSMediaCredit.h"
+#import "RSSMediaPlayer.h"
+#import "RSSMediaCategory.h"
+#import "RSSMediaRating.h"
+#import "RSSMediaRestriction.h"
+#import "RSSMediaCommunity.h"
 
 /**
  *  `RSSParser_Protected` contains internal properties used by `RSSParser` that should not be used by other
  *  controllers or classes. These properties are only exposed for unit testing purposes (see `RSSParserTests.m`)
+ *
+ *  Thread safety: the construction properties, `parseContext` and parsing backend methods are only used on `parseQueue`, one parse at a time, and aren't synchronized. Each parse's blocks are captured in its own `RSSParseContext` on the calling thread, so starting or cancelling a parse never changes the blocks another one calls; `parseGeneration` keeps a cancelled parse from calling them.
  */
 
 @interface RSSParser ()
@@ -43,25 +58,40 @@
 ///---------------------
 
 /**
- *  The client that handles network requests for the parser.
+ *  The client that handles network requests for the parser. Setting it sets its `completionQueue` to `parseQueue`, so responses are always parsed there.
  */
 @property (nonatomic, strong) AFHTTPSessionManager *client;
 
+/**
+ *  The private serial queue all parsing happens on.
+ */
+@property (nonatomic, strong) dispatch_queue_t parseQueue;
+
+/**
+ *  Incremented by `cancel`, which is also called when each parse starts. Work started under an older generation is abandoned, and callbacks dispatched by it are dropped.
+ */
+@property (atomic, assign) NSUInteger parseGeneration;
+
 /**
  *  This property stores a reference to the `NSXMLParser` object returned on network request successful completion.
- *  It allows the parser to be cancelled programmatically (see the `cancel` method on `RSSParser.h`).
+ *  When the parse is cancelled (see the `cancel` method on `RSSParser.h`), it's aborted from its own delegate methods on `parseQueue`.
  */
 @property (nonatomic, strong) NSXMLParser *xmlParser;
 
 /**
- *  This is a copy of the `successBlock` passed to the parser, called only on successful parse completion.
+ *  The libxml2 push parser context (an `xmlParserCtxtPtr`) while the `RSSParserBackendLibXML` backend is parsing, otherwise `NULL`. Like `xmlParser`, this allows the parser to be cancelled.
+ */
+@property (nonatomic, assign) void *libXMLContext;
+
+/**
+ *  The context of the parse running on `parseQueue`, which holds the blocks passed to it. This is set when the parse begins and released when its `successBlock` or `failblock` is dispatched.
  */
-@property (nonatomic, copy) void (^successBlock)(RSSChannel *channel);
+@property (nonatomic, strong) RSSParseContext *parseContext;
 
 /**
- *  This is a copy of the `failBlock` passed on to the parser, called if either a network or parse error occurs.
+ *  The metrics of the current parse, or `nil` if the `metricsBlock` of `parseContext` is `nil`. Each parsing backend reports its work to this object, so nothing is measured when it's `nil`.
  */
-@property (nonatomic, copy) void (^failblock)(NSError *error);
+@property (nonatomic, strong) RSSParseMetrics *metrics;
 
 ///---------------------
 /// @name Construction Properties Used In NSXMLParserDelegate Methods
@@ -79,7 +109,7 @@
 @property (nonatomic, strong) RSSItem *currentItem;
 
 /**
- *  The array of `RSSItem` objects that have already been parsed
+ *  The array of `RSSItem` objects that have already been parsed. This array stays empty if `parseContext` has an `itemBlock`.
  */
 @property (nonatomic, strong) NSMutableArray *items;
 
@@ -99,13 +129,177 @@
 @property (nonatomic, strong) NSMutableArray *mediaThumbnails;
 
 /**
- *  The temporary, builder string that characters are added to as the parser encounters them.
+ *  The current array of media categories that is being parsed, ultimately set as `mediaCategories` on `currentItem`
+ */
+@property (nonatomic, strong) NSMutableArray *mediaCategories;
+
+/**
+ *  The current array of media ratings that is being parsed, ultimately set as `mediaRatings` on `currentItem`
+ */
+@property (nonatomic, strong) NSMutableArray *mediaRatings;
+
+/**
+ *  The current array of media restrictions that is being parsed, ultimately set as `mediaRestrictions` on `currentItem`
+ */
+@property (nonatomic, strong) NSMutableArray *mediaRestrictions;
+
+/**
+ *  The number of known items (see `knownItemKeys`) parsed since the last new item.
+ */
+@property (nonatomic, assign) NSUInteger consecutiveKnownItemCount;
+
+/**
+ *  The number of new items parsed so far, counted against `maxItemCount`.
+ */
+@property (nonatomic, assign) NSUInteger parsedItemCount;
+
+/**
+ *  The newest items parsed so far, if `newestItemCount` is set. These are moved to `items`, dispatched to the `itemBlock` or appended to the `columnarChannel` of `parseContext` when the document ends.
+ */
+@property (nonatomic, strong) RSSNewestItemHeap *newestItems;
+
+/**
+ *  The string pool of the current parse: `stringPool` if it's set, otherwise a pool of `stringPoolCountLimit` strings, or `nil` if that's `0`.
+ */
+@property (nonatomic, strong) RSSStringPool *parseStringPool;
+
+/**
+ *  The depth of the element being parsed, counted against `maxElementDepth`. This includes skipped elements.
+ */
+@property (nonatomic, assign) NSUInteger elementDepth;
+
+/**
+ *  Whether the `NSXMLParser` backend was given only the part of the document within `maxInputLength`, so that the error at the point it was cut short ends the document instead of failing the parse.
+ */
+@property (nonatomic, assign) BOOL inputTruncated;
+
+/**
+ *  The depth within an element that's being skipped because none of its content is selected (see `channelFields` and `itemFields`), or `0` if no element is being skipped. While this is non-zero, each parsing backend only updates it as elements start and end.
+ */
+@property (nonatomic, assign) NSUInteger skippedElementDepth;
+
+/**
+ *  The namespaces bound to each prefix in scope while the `NSXMLParser` backend is parsing, as stacks of boxed `RSSNamespace` values keyed by prefix. Unprefixed elements use the `@""` prefix.
+ */
+@property (nonatomic, strong) NSMutableDictionary *namespacePrefixes;
+
+/**
+ *  The number of bindings in `namespacePrefixes` that differ from the conventional ones, i.e. Media RSS bound to a prefix other than `media`, or `media` bound to another namespace. While this is `0`, element names are matched as written, without resolving their prefixes.
+ */
+@property (nonatomic, assign) NSUInteger remappedPrefixCount;
+
+/**
+ *  The Media RSS namespace URI as interned by libxml2's dictionary, once the document being parsed by the libxml2 backend has declared it, otherwise `NULL`. libxml2 reports each element's namespace URI as the same interned string, so elements are matched to the namespace by comparing pointers.
+ */
+@property (nonatomic, assign) const void *libXMLMediaNamespaceURI;
+
+/**
+ *  Set when libxml2 reports the end of the document. libxml2 does so from within the final chunk even if that chunk then turns out not to be well-formed, so the document is only ended once the chunk has been checked.
+ */
+@property (nonatomic, assign) BOOL libXMLDocumentEnded;
+
+/**
+ *  The temporary, builder string that characters are added to as the parser encounters them. This single buffer is reused for every element whose text is read; it's emptied when such an element starts.
  */
 @property (nonatomic, strong) NSMutableString *tempString;
 
+/**
+ *  Whether characters found by the parser are currently added to `tempString`. This is only `YES` while inside an element whose text is mapped onto a model property.
+ */
+@property (nonatomic, assign) BOOL capturingCharacters;
+
+/**
+ *  The UTF-8 bytes of captured characters reported by the libxml2 backend. These are converted and added to `tempString` once, when the element ends, rather than for every callback.
+ */
+@property (nonatomic, strong) NSMutableData *tempBytes;
+
+/**
+ *  The document being parsed by the libxml2 backend when items are decoded lazily (see `decodesItemFieldsLazily`), otherwise `nil`. New items are `RSSLazyItem` objects referring to this data.
+ */
+@property (nonatomic, strong) NSData *lazySourceData;
+
+/**
+ *  The type of the lazily decoded item element that has started but not yet ended, or `RSSElementTypeUnknown`.
+ */
+@property (nonatomic, assign) RSSElementType lazyElementType;
+
+/**
+ *  The offset within `lazySourceData` at which the content of the `lazyElementType` element starts.
+ */
+@property (nonatomic, assign) NSUInteger lazyElementStart;
+
 /**
  *  This method is called on successful GET response. This method is exposed only for testing purposes.
  */
 - (void)GETSucceeded:(NSXMLParser *)responseObject;
 
+///---------------------
+/// @name Parsing Backend Methods
+///---------------------
+
+/**
+ *  Creates a new `currentItem` and empty media arrays for it. Called by each parsing backend when an item element starts.
+ */
+- (void)startNewItem;
+
+/**
+ *  Returns the object that the attributes of the given element type are decoded onto (see `RSSMediaAttributeDecoderBegin`): the current item's `mediaCommunity` for the elements within `media:community`, otherwise `nil`.
+ */
+- (id)enclosingMediaObjectForElementType:(RSSElementType)elementType;
+
+/**
+ *  Adds the given media object, decoded from an element of the given type, to the current item: to one of the media arrays, such as `mediaContents`, or as its `mediaPlayer` or `mediaCommunity`.
+ */
+- (void)addMediaObject:(id)mediaObject forElementType:(RSSElementType)elementType;
+
+/**
+ *  Returns the given type of an element that has just started if its property is selected by `channelFields` or `itemFields`, otherwise `RSSElementTypeUnknown`. If none of the element's content is selected, this also starts skipping it (see `skippedElementDepth`).
+ */
+- (RSSElementType)projectElementType:(RSSElementType)elementType;
+
+/**
+ *  Called by each parsing backend as an element starts, before anything else. Updates `elementDepth`, and returns `NO` if the element is to be ignored, because it's within a skipped element, or because it's nested deeper than `maxElementDepth` (in which case it's skipped, or the parse fails).
+ */
+- (BOOL)enterElement;
+
+/**
+ *  Called by each parsing backend as an element ends, before anything else. Updates `elementDepth`, and returns `NO` if the element was skipped.
+ */
+- (BOOL)exitElement;
+
+/**
+ *  Called when one of the resource limits has been exceeded. If the limit is one of `failingLimits`, this fails the parse with the limit's error, stops parsing and returns `YES`. Otherwise, it returns `NO`, and the caller truncates whatever exceeded the limit.
+ */
+- (BOOL)stopForExceededLimit:(RSSParserLimits)limit;
+
+/**
+ *  Ends the document with whatever has been parsed so far, as if it ended there, and stops parsing. The channel isn't stored in `feedCache`.
+ */
+- (void)finishParsingEarly;
+
+/**
+ *  Like `finishParsingEarly`, for a document cut short by `maxInputLength`, which may end before its start was even reported.
+ */
+- (void)finishTruncatedDocument;
+
+/**
+ *  Sets `capturingCharacters` for an element of the given type that has just started, and empties `tempString` if its text is to be captured. Unknown elements leave the capture state unchanged.
+ */
+- (void)startCapturingCharactersForElementType:(RSSElementType)elementType;
+
+/**
+ *  Applies the end of an element of the given type: finishes the current item, or sets the captured text on the matching `channel` or `currentItem` property.
+ */
+- (void)endElementOfType:(RSSElementType)elementType;
+
+/**
+ *  Calls the `failblock` of `parseContext` with the given error on `callbackQueue`, then releases the context. Does nothing if the parse has been cancelled.
+ */
+- (void)failWithError:(NSError *)error;
+
+/**
+ *  Returns `YES` if `cancel` has been called since the current parse began. Each parsing backend checks this as elements start and stops parsing if so.
+ */
+- (BOOL)isParseCancelled;
+
 @end
@@ -0,0 +1,43 @@
+//
+//  RSSSnapshotItemArray.h
+//  MediaRSSParser
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+
+
+#import <Foundation/Foundation.h>
+
+/**
+ *  `RSSSnapshotItemArray` is the immutable `items` array of a channel read by `RSSChannelSnapshot`. Each `RSSItem` is decoded from the snapshot data the first time it's accessed and kept for later accesses.
+ *
+ *  Copying the array returns the same instance, so setting it on an `RSSChannel` (whose `items` property is `copy`) doesn't decode every item.
+ */
+@interface RSSSnapshotItemArray : NSArray
+
+/**
+ *  Returns an array of `count` items decoded from the given snapshot data.
+ */
+- (instancetype)initWithSnapshotData:(NSData *)data count:(NSUInteger)count;
+
+/**
+ *  The number of items that have been decoded so far.
+ */
+@property (nonatomic, assign, readonly) NSUInteger materializedCount;
+
+@end
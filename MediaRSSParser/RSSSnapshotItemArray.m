@@ -0,0 +1,87 @@
+//
+//  RSSSnapshotItemArray.m
+//  MediaRSSParser
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+
+
+#import "RSSSnapshotItemArray.h"
+#import "RSSChannelSnapshot.h"
+
+@implementation RSSSnapshotItemArray
+{
+  NSData *_data;
+  NSUInteger _count;
+  NSMutableDictionary *_items;
+}
+
+#pragma mark - Object Lifecycle
+
+- (instancetype)initWithSnapshotData:(NSData *)data count:(NSUInteger)count
+{
+  self = [super init];
+  if (self) {
+    _data = data;
+    _count = count;
+    _items = [[NSMutableDictionary alloc] init];
+  }
+  return self;
+}
+
+#pragma mark - Custom Accessors
+
+- (NSUInteger)materializedCount
+{
+  @synchronized(_items) {
+    return _items.count;
+  }
+}
+
+#pragma mark - NSArray
+
+- (NSUInteger)count
+{
+  return _count;
+}
+
+- (id)objectAtIndex:(NSUInteger)index
+{
+  if (index >= _count) {
+    [NSException raise:NSRangeException format:@"Index %lu beyond bounds [0 .. %lu]",
+     (unsigned long)index, (unsigned long)_count - 1];
+  }
+  
+  @synchronized(_items) {
+    id item = _items[@(index)];
+    if (!item) {
+      item = [RSSChannelSnapshot itemAtIndex:index inSnapshotData:_data];
+      _items[@(index)] = item;
+    }
+    return item;
+  }
+}
+
+#pragma mark - NSCopying
+
+- (id)copyWithZone:(NSZone *)zone
+{
+  return self;
+}
+
+@end
@@ -0,0 +1,77 @@
+//
+//  RSSStringPool.h
+//  MediaRSSParser
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+
+
+#import <Foundation/Foundation.h>
+
+/**
+ *  The default `countLimit` of a string pool, `1024`.
+ */
+extern NSUInteger const RSSStringPoolDefaultCountLimit;
+
+/**
+ *  The length in UTF-8 bytes of the longest string that's pooled, `64`. Longer strings are rarely repeated.
+ */
+extern NSUInteger const RSSStringPoolMaxLength;
+
+/**
+ *  `RSSStringPool` interns short strings, so that equal strings share a single immutable `NSString` instance. `RSSParser` uses a pool for the values that repeat throughout a feed's media objects, such as MIME types, media types, languages and credit roles (see `-[RSSParser stringPool]`).
+ *
+ *  Once the pool holds `countLimit` strings, any other string is returned without being added, so the pool's memory stays bounded however many different values a feed has.
+ *
+ *  A pool may be used from multiple threads at once, so one pool can be shared by every parser in a process.
+ */
+@interface RSSStringPool : NSObject
+
+/**
+ *  Creates a pool that holds at most `countLimit` strings. This is the designated initializer; `init` uses `RSSStringPoolDefaultCountLimit`.
+ */
+- (instancetype)initWithCountLimit:(NSUInteger)countLimit;
+
+/**
+ *  The maximum number of strings in the pool.
+ */
+@property (nonatomic, assign, readonly) NSUInteger countLimit;
+
+/**
+ *  The number of strings in the pool.
+ */
+@property (nonatomic, assign, readonly) NSUInteger count;
+
+/**
+ *  Returns the pooled string for the given UTF-8 bytes, adding it to the pool if it isn't there yet. A pooled string is returned without allocating anything.
+ *
+ *  @return The string, or `nil` if the bytes aren't valid UTF-8.
+ */
+- (NSString *)stringWithUTF8Bytes:(const char *)bytes length:(NSUInteger)length;
+
+/**
+ *  Returns the pooled string equal to `string`, adding an immutable copy of it to the pool if it isn't there yet.
+ */
+- (NSString *)stringByInterningString:(NSString *)string;
+
+/**
+ *  Removes every string from the pool.
+ */
+- (void)removeAllStrings;
+
+@end
@@ -0,0 +1,199 @@
+//
+//  RSSStringPool.m
+//  MediaRSSParser
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+
+
+
+#import "RSSStringPool.h"
+
+enum { RSSStringPoolBufferLength = 64 };
+
+NSUInteger const RSSStringPoolDefaultCountLimit = 1024;
+NSUInteger const RSSStringPoolMaxLength = RSSStringPoolBufferLength;
+
+// The table starts small, so that pools of short feeds stay small, and doubles before it's half full.
+static const NSUInteger RSSStringPoolInitialSlotCount = 64;
+
+typedef struct {
+  uint32_t hash;
+  uint32_t length;
+  char *bytes;
+  CFStringRef string;
+} RSSStringPoolSlot;
+
+static uint32_t RSSStringPoolHash(const char *bytes, NSUInteger length)
+{
+  uint32_t hash = 2166136261u;
+  for (NSUInteger i = 0; i < length; i++) {
+    hash = (hash ^ (uint8_t)bytes[i]) * 16777619u;
+  }
+  return hash;
+}
+
+@implementation RSSStringPool
+{
+  RSSStringPoolSlot *_slots;
+  NSUInteger _slotCount;
+  NSUInteger _count;
+}
+
+#pragma mark - Object Lifecycle
+
+- (instancetype)init
+{
+  return [self initWithCountLimit:RSSStringPoolDefaultCountLimit];
+}
+
+- (instancetype)initWithCountLimit:(NSUInteger)countLimit
+{
+  self = [super init];
+  if (self) {
+    _countLimit = countLimit;
+  }
+  return self;
+}
+
+- (void)dealloc
+{
+  [self freeSlots];
+}
+
+- (void)freeSlots
+{
+  for (NSUInteger i = 0; i < _slotCount; i++) {
+    if (_slots[i].string) {
+      free(_slots[i].bytes);
+      CFRelease(_slots[i].string);
+    }
+  }
+  free(_slots);
+  _slots = NULL;
+  _slotCount = 0;
+  _count = 0;
+}
+
+#pragma mark - Interning
+
+- (NSString *)stringWithUTF8Bytes:(const char *)bytes length:(NSUInteger)length
+{
+  if (length > RSSStringPoolMaxLength || _countLimit == 0) {
+    return [[NSString alloc] initWithBytes:bytes length:length encoding:NSUTF8StringEncoding];
+  }
+  
+  @synchronized(self) {
+    return [self pooledStringWithBytes:bytes length:length string:nil];
+  }
+}
+
+- (NSString *)stringByInterningString:(NSString *)string
+{
+  char buffer[RSSStringPoolBufferLength];
+  NSUInteger length = 0;
+  NSRange remaining = NSMakeRange(0, 0);
+  
+  if (!string || string.length > RSSStringPoolMaxLength || _countLimit == 0 ||
+      ![string getBytes:buffer maxLength:sizeof(buffer) usedLength:&length encoding:NSUTF8StringEncoding
+                options:0 range:NSMakeRange(0, string.length) remainingRange:&remaining] ||
+      remaining.length > 0) {
+    return [string copy];
+  }
+  
+  @synchronized(self) {
+    return [self pooledStringWithBytes:buffer length:length string:string];
+  }
+}
+
+// Looks up the bytes, and on a miss adds `string` (or a string decoded from the bytes, if it's `nil`) while there's room.
+- (NSString *)pooledStringWithBytes:(const char *)bytes length:(NSUInteger)length string:(NSString *)string
+{
+  uint32_t hash = RSSStringPoolHash(bytes, length);
+  
+  if (_slotCount > 0) {
+    NSUInteger index = hash & (_slotCount - 1);
+    while (_slots[index].string) {
+      RSSStringPoolSlot *slot = &_slots[index];
+      if (slot->hash == hash && slot->length == length && memcmp(slot->bytes, bytes, length) == 0) {
+        return (__bridge NSString *)slot->string;
+      }
+      index = (index + 1) & (_slotCount - 1);
+    }
+  }
+  
+  NSString *newString = string ? [string copy] : [[NSString alloc] initWithBytes:bytes length:length
+                                                                         encoding:NSUTF8StringEncoding];
+  if (!newString || _count >= _countLimit) {
+    return newString;
+  }
+  
+  if ((_count + 1) * 2 > _slotCount) {
+    [self growSlots];
+  }
+  
+  char *copiedBytes = malloc(MAX(length, 1));
+  memcpy(copiedBytes, bytes, length);
+  [self insertSlot:(RSSStringPoolSlot){ hash, (uint32_t)length, copiedBytes, CFBridgingRetain(newString) }];
+  _count += 1;
+  
+  return newString;
+}
+
+- (void)insertSlot:(RSSStringPoolSlot)slot
+{
+  NSUInteger index = slot.hash & (_slotCount - 1);
+  while (_slots[index].string) {
+    index = (index + 1) & (_slotCount - 1);
+  }
+  _slots[index] = slot;
+}
+
+- (void)growSlots
+{
+  RSSStringPoolSlot *oldSlots = _slots;
+  NSUInteger oldSlotCount = _slotCount;
+  
+  _slotCount = oldSlotCount ? oldSlotCount * 2 : RSSStringPoolInitialSlotCount;
+  _slots = calloc(_slotCount, sizeof(RSSStringPoolSlot));
+  
+  for (NSUInteger i = 0; i < oldSlotCount; i++) {
+    if (oldSlots[i].string) {
+      [self insertSlot:oldSlots[i]];
+    }
+  }
+  free(oldSlots);
+}
+
+- (void)removeAllStrings
+{
+  @synchronized(self) {
+    [self freeSlots];
+  }
+}
+
+#pragma mark - Accessors
+
+- (NSUInteger)count
+{
+  @synchronized(self) {
+    return _count;
+  }
+}
+
+@end
@@ -0,0 +1,102 @@
+//
+//  GTMNSString+HTMLTests.m
+//  MediaRSSParser
+//
+
+// Test Class
+#import "GTMNSString+HTML.h"
+
+// Collaborators
+#import "NSString+HTML.h"
+
+// Test Support
+#import <XCTest/XCTest.h>
+#import "NSString+HTMLReference.h"
+
+#define HC_SHORTHAND
+#import <OCHamcrest/OCHamcrest.h>
+
+@interface GTMNSString_HTMLTests : XCTestCase
+@end
+
+@implementation GTMNSString_HTMLTests
+
+#pragma mark - Reference Equivalence
+
+- (NSString *)everyBMPCodeUnit
+{
+  NSUInteger length = 0xFFFF;
+  unichar *characters = malloc(length * sizeof(unichar));
+  for (NSUInteger i = 0; i < length; i++) {
+    characters[i] = (unichar)(i + 1);
+  }
+  return [[NSString alloc] initWithCharactersNoCopy:characters length:length freeWhenDone:YES];
+}
+
+- (NSArray *)corpus
+{
+  return @[@"a",
+           @"plain ASCII text that is longer than one vector",
+           @"<p class=\"x\">Q&A 'quoted'</p>",
+           @"12345678<2345678&2345678>",
+           @"1234567\"1234567'",
+           @"Café — €5 … Œuvre ♦",
+           @"中文内容中文内容<中文&内容>",
+           @"\U0001F600 emoji \U0001F600",
+           [@"" stringByPaddingToLength:1000 withString:@"abc<def>ghi&é中 " startingAtIndex:0]];
+}
+
+- (void)test___gtm_stringByEscapingForHTML___matches_reference_for_every_BMP_code_unit
+{
+  NSString *string = [self everyBMPCodeUnit];
+  
+  assertThat([string gtm_stringByEscapingForHTML], equalTo([string reference_gtm_stringByEscapingForHTML]));
+}
+
+- (void)test___gtm_stringByEscapingForAsciiHTML___matches_reference_for_every_BMP_code_unit
+{
+  NSString *string = [self everyBMPCodeUnit];
+  
+  assertThat([string gtm_stringByEscapingForAsciiHTML], equalTo([string reference_gtm_stringByEscapingForAsciiHTML]));
+}
+
+- (void)test___gtm_stringByEscapingForHTML___matches_reference_for_corpus
+{
+  for (NSString *string in [self corpus]) {
+    assertThat([string gtm_stringByEscapingForHTML], equalTo([string reference_gtm_stringByEscapingForHTML]));
+    assertThat([string gtm_stringByEscapingForAsciiHTML], equalTo([string reference_gtm_stringByEscapingForAsciiHTML]));
+  }
+}
+
+#pragma mark - Escaping - Tests
+
+- (void)test___gtm_stringByEscapingForHTML___escapes_special_and_named_characters
+{
+  assertThat([@"<a href=\"x\">Q&A — 中</a>" gtm_stringByEscapingForHTML],
+             equalTo(@"&lt;a href=&quot;x&quot;&gt;Q&amp;A &mdash; 中&lt;/a&gt;"));
+}
+
+- (void)test___gtm_stringByEscapingForAsciiHTML___escapes_non_ASCII_characters
+{
+  assertThat([@"café 中ÿ" gtm_stringByEscapingForAsciiHTML], equalTo(@"caf&eacute; &#20013;&yuml;"));
+}
+
+- (void)test___gtm_stringByEscapingForHTML___returns_self_for_empty_string
+{
+  NSString *string = @"";
+  
+  assertThat([string gtm_stringByEscapingForHTML], sameInstance(string));
+}
+
+#pragma mark - NSString+HTML - Tests
+
+- (void)test___stringByEncodingHTMLEntities___matches_reference
+{
+  for (NSString *string in [self corpus]) {
+    assertThat([string stringByEncodingHTMLEntities], equalTo([string reference_gtm_stringByEscapingForAsciiHTML]));
+    assertThat([string stringByEncodingHTMLEntities:YES], equalTo([string reference_gtm_stringByEscapingForHTML]));
+    assertThat([string stringByEncodingHTMLEntities:NO], equalTo([string reference_gtm_stringByEscapingForAsciiHTML]));
+  }
+}
+
+@end
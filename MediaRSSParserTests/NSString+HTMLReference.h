@@ -0,0 +1,21 @@
+//
+//  NSString+HTMLReference.h
+//  MediaRSSParser
+//
+
+#import <Foundation/Foundation.h>
+
+/**
+ *  The original implementations of methods that have since been rewritten for speed, kept as the reference the rewrites are checked against: the `NSScanner` based `stringByConvertingHTMLToPlainText` and `stringByStrippingTags`, and the `bsearch` based escaping of `GTMNSString+HTML`.
+ */
+@interface NSString (HTMLReference)
+
+- (NSString *)reference_stringByConvertingHTMLToPlainText;
+
+- (NSString *)reference_stringByStrippingTags;
+
+- (NSString *)reference_gtm_stringByEscapingForHTML;
+
+- (NSString *)reference_gtm_stringByEscapingForAsciiHTML;
+
+@end
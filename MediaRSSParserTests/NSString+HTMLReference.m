@@ -0,0 +1,606 @@
+//
+//  NSString+HTMLReference.m
+//  MediaRSSParser
+//
+
+#import "NSString+HTMLReference.h"
+#import "NSString+HTML.h"
+
+// The escape tables of GTMNSString+HTML.m, which are private to that file
+typedef struct {
+	__unsafe_unretained NSString *escapeSequence;
+	unichar uchar;
+} ReferenceHTMLEscapeMap;
+
+// Taken from http://www.w3.org/TR/xhtml1/dtds.html#a_dtd_Special_characters
+// Ordered by uchar lowest to highest for bsearching
+static ReferenceHTMLEscapeMap gReferenceAsciiHTMLEscapeMap[] = {
+	// A.2.2. Special characters
+	{ @"&quot;", 34 },
+	{ @"&amp;", 38 },
+	{ @"&apos;", 39 },
+	{ @"&lt;", 60 },
+	{ @"&gt;", 62 },
+	
+    // A.2.1. Latin-1 characters
+	{ @"&nbsp;", 160 }, 
+	{ @"&iexcl;", 161 }, 
+	{ @"&cent;", 162 }, 
+	{ @"&pound;", 163 }, 
+	{ @"&curren;", 164 }, 
+	{ @"&yen;", 165 }, 
+	{ @"&brvbar;", 166 }, 
+	{ @"&sect;", 167 }, 
+	{ @"&uml;", 168 }, 
+	{ @"&copy;", 169 }, 
+	{ @"&ordf;", 170 }, 
+	{ @"&laquo;", 171 }, 
+	{ @"&not;", 172 }, 
+	{ @"&shy;", 173 }, 
+	{ @"&reg;", 174 }, 
+	{ @"&macr;", 175 }, 
+	{ @"&deg;", 176 }, 
+	{ @"&plusmn;", 177 }, 
+	{ @"&sup2;", 178 }, 
+	{ @"&sup3;", 179 }, 
+	{ @"&acute;", 180 }, 
+	{ @"&micro;", 181 }, 
+	{ @"&para;", 182 }, 
+	{ @"&middot;", 183 }, 
+	{ @"&cedil;", 184 }, 
+	{ @"&sup1;", 185 }, 
+	{ @"&ordm;", 186 }, 
+	{ @"&raquo;", 187 }, 
+	{ @"&frac14;", 188 }, 
+	{ @"&frac12;", 189 }, 
+	{ @"&frac34;", 190 }, 
+	{ @"&iquest;", 191 }, 
+	{ @"&Agrave;", 192 }, 
+	{ @"&Aacute;", 193 }, 
+	{ @"&Acirc;", 194 }, 
+	{ @"&Atilde;", 195 }, 
+	{ @"&Auml;", 196 }, 
+	{ @"&Aring;", 197 }, 
+	{ @"&AElig;", 198 }, 
+	{ @"&Ccedil;", 199 }, 
+	{ @"&Egrave;", 200 }, 
+	{ @"&Eacute;", 201 }, 
+	{ @"&Ecirc;", 202 }, 
+	{ @"&Euml;", 203 }, 
+	{ @"&Igrave;", 204 }, 
+	{ @"&Iacute;", 205 }, 
+	{ @"&Icirc;", 206 }, 
+	{ @"&Iuml;", 207 }, 
+	{ @"&ETH;", 208 }, 
+	{ @"&Ntilde;", 209 }, 
+	{ @"&Ograve;", 210 }, 
+	{ @"&Oacute;", 211 }, 
+	{ @"&Ocirc;", 212 }, 
+	{ @"&Otilde;", 213 }, 
+	{ @"&Ouml;", 214 }, 
+	{ @"&times;", 215 }, 
+	{ @"&Oslash;", 216 }, 
+	{ @"&Ugrave;", 217 }, 
+	{ @"&Uacute;", 218 }, 
+	{ @"&Ucirc;", 219 }, 
+	{ @"&Uuml;", 220 }, 
+	{ @"&Yacute;", 221 }, 
+	{ @"&THORN;", 222 }, 
+	{ @"&szlig;", 223 }, 
+	{ @"&agrave;", 224 }, 
+	{ @"&aacute;", 225 }, 
+	{ @"&acirc;", 226 }, 
+	{ @"&atilde;", 227 }, 
+	{ @"&auml;", 228 }, 
+	{ @"&aring;", 229 }, 
+	{ @"&aelig;", 230 }, 
+	{ @"&ccedil;", 231 }, 
+	{ @"&egrave;", 232 }, 
+	{ @"&eacute;", 233 }, 
+	{ @"&ecirc;", 234 }, 
+	{ @"&euml;", 235 }, 
+	{ @"&igrave;", 236 }, 
+	{ @"&iacute;", 237 }, 
+	{ @"&icirc;", 238 }, 
+	{ @"&iuml;", 239 }, 
+	{ @"&eth;", 240 }, 
+	{ @"&ntilde;", 241 }, 
+	{ @"&ograve;", 242 }, 
+	{ @"&oacute;", 243 }, 
+	{ @"&ocirc;", 244 }, 
+	{ @"&otilde;", 245 }, 
+	{ @"&ouml;", 246 }, 
+	{ @"&divide;", 247 }, 
+	{ @"&oslash;", 248 }, 
+	{ @"&ugrave;", 249 }, 
+	{ @"&uacute;", 250 }, 
+	{ @"&ucirc;", 251 }, 
+	{ @"&uuml;", 252 }, 
+	{ @"&yacute;", 253 }, 
+	{ @"&thorn;", 254 }, 
+	{ @"&yuml;", 255 },
+	
+	// A.2.2. Special characters cont'd
+	{ @"&OElig;", 338 },
+	{ @"&oelig;", 339 },
+	{ @"&Scaron;", 352 },
+	{ @"&scaron;", 353 },
+	{ @"&Yuml;", 376 },
+	
+	// A.2.3. Symbols
+	{ @"&fnof;", 402 }, 
+	
+	// A.2.2. Special characters cont'd
+	{ @"&circ;", 710 },
+	{ @"&tilde;", 732 },
+	
+	// A.2.3. Symbols cont'd
+	{ @"&Alpha;", 913 }, 
+	{ @"&Beta;", 914 }, 
+	{ @"&Gamma;", 915 }, 
+	{ @"&Delta;", 916 }, 
+	{ @"&Epsilon;", 917 }, 
+	{ @"&Zeta;", 918 }, 
+	{ @"&Eta;", 919 }, 
+	{ @"&Theta;", 920 }, 
+	{ @"&Iota;", 921 }, 
+	{ @"&Kappa;", 922 }, 
+	{ @"&Lambda;", 923 }, 
+	{ @"&Mu;", 924 }, 
+	{ @"&Nu;", 925 }, 
+	{ @"&Xi;", 926 }, 
+	{ @"&Omicron;", 927 }, 
+	{ @"&Pi;", 928 }, 
+	{ @"&Rho;", 929 }, 
+	{ @"&Sigma;", 931 }, 
+	{ @"&Tau;", 932 }, 
+	{ @"&Upsilon;", 933 }, 
+	{ @"&Phi;", 934 }, 
+	{ @"&Chi;", 935 }, 
+	{ @"&Psi;", 936 }, 
+	{ @"&Omega;", 937 }, 
+	{ @"&alpha;", 945 }, 
+	{ @"&beta;", 946 }, 
+	{ @"&gamma;", 947 }, 
+	{ @"&delta;", 948 }, 
+	{ @"&epsilon;", 949 }, 
+	{ @"&zeta;", 950 }, 
+	{ @"&eta;", 951 }, 
+	{ @"&theta;", 952 }, 
+	{ @"&iota;", 953 }, 
+	{ @"&kappa;", 954 }, 
+	{ @"&lambda;", 955 }, 
+	{ @"&mu;", 956 }, 
+	{ @"&nu;", 957 }, 
+	{ @"&xi;", 958 }, 
+	{ @"&omicron;", 959 }, 
+	{ @"&pi;", 960 }, 
+	{ @"&rho;", 961 }, 
+	{ @"&sigmaf;", 962 }, 
+	{ @"&sigma;", 963 }, 
+	{ @"&tau;", 964 }, 
+	{ @"&upsilon;", 965 }, 
+	{ @"&phi;", 966 }, 
+	{ @"&chi;", 967 }, 
+	{ @"&psi;", 968 }, 
+	{ @"&omega;", 969 }, 
+	{ @"&thetasym;", 977 }, 
+	{ @"&upsih;", 978 }, 
+	{ @"&piv;", 982 }, 
+	
+	// A.2.2. Special characters cont'd
+	{ @"&ensp;", 8194 },
+	{ @"&emsp;", 8195 },
+	{ @"&thinsp;", 8201 },
+	{ @"&zwnj;", 8204 },
+	{ @"&zwj;", 8205 },
+	{ @"&lrm;", 8206 },
+	{ @"&rlm;", 8207 },
+	{ @"&ndash;", 8211 },
+	{ @"&mdash;", 8212 },
+	{ @"&lsquo;", 8216 },
+	{ @"&rsquo;", 8217 },
+	{ @"&sbquo;", 8218 },
+	{ @"&ldquo;", 8220 },
+	{ @"&rdquo;", 8221 },
+	{ @"&bdquo;", 8222 },
+	{ @"&dagger;", 8224 },
+	{ @"&Dagger;", 8225 },
+    // A.2.3. Symbols cont'd  
+	{ @"&bull;", 8226 }, 
+	{ @"&hellip;", 8230 }, 
+	
+	// A.2.2. Special characters cont'd
+	{ @"&permil;", 8240 },
+	
+	// A.2.3. Symbols cont'd  
+	{ @"&prime;", 8242 }, 
+	{ @"&Prime;", 8243 }, 
+	
+	// A.2.2. Special characters cont'd
+	{ @"&lsaquo;", 8249 },
+	{ @"&rsaquo;", 8250 },
+	
+	// A.2.3. Symbols cont'd  
+	{ @"&oline;", 8254 }, 
+	{ @"&frasl;", 8260 }, 
+	
+	// A.2.2. Special characters cont'd
+	{ @"&euro;", 8364 },
+	
+	// A.2.3. Symbols cont'd  
+	{ @"&image;", 8465 },
+	{ @"&weierp;", 8472 }, 
+	{ @"&real;", 8476 }, 
+	{ @"&trade;", 8482 }, 
+	{ @"&alefsym;", 8501 }, 
+	{ @"&larr;", 8592 }, 
+	{ @"&uarr;", 8593 }, 
+	{ @"&rarr;", 8594 }, 
+	{ @"&darr;", 8595 }, 
+	{ @"&harr;", 8596 }, 
+	{ @"&crarr;", 8629 }, 
+	{ @"&lArr;", 8656 }, 
+	{ @"&uArr;", 8657 }, 
+	{ @"&rArr;", 8658 }, 
+	{ @"&dArr;", 8659 }, 
+	{ @"&hArr;", 8660 }, 
+	{ @"&forall;", 8704 }, 
+	{ @"&part;", 8706 }, 
+	{ @"&exist;", 8707 }, 
+	{ @"&empty;", 8709 }, 
+	{ @"&nabla;", 8711 }, 
+	{ @"&isin;", 8712 }, 
+	{ @"&notin;", 8713 }, 
+	{ @"&ni;", 8715 }, 
+	{ @"&prod;", 8719 }, 
+	{ @"&sum;", 8721 }, 
+	{ @"&minus;", 8722 }, 
+	{ @"&lowast;", 8727 }, 
+	{ @"&radic;", 8730 }, 
+	{ @"&prop;", 8733 }, 
+	{ @"&infin;", 8734 }, 
+	{ @"&ang;", 8736 }, 
+	{ @"&and;", 8743 }, 
+	{ @"&or;", 8744 }, 
+	{ @"&cap;", 8745 }, 
+	{ @"&cup;", 8746 }, 
+	{ @"&int;", 8747 }, 
+	{ @"&there4;", 8756 }, 
+	{ @"&sim;", 8764 }, 
+	{ @"&cong;", 8773 }, 
+	{ @"&asymp;", 8776 }, 
+	{ @"&ne;", 8800 }, 
+	{ @"&equiv;", 8801 }, 
+	{ @"&le;", 8804 }, 
+	{ @"&ge;", 8805 }, 
+	{ @"&sub;", 8834 }, 
+	{ @"&sup;", 8835 }, 
+	{ @"&nsub;", 8836 }, 
+	{ @"&sube;", 8838 }, 
+	{ @"&supe;", 8839 }, 
+	{ @"&oplus;", 8853 }, 
+	{ @"&otimes;", 8855 }, 
+	{ @"&perp;", 8869 }, 
+	{ @"&sdot;", 8901 }, 
+	{ @"&lceil;", 8968 }, 
+	{ @"&rceil;", 8969 }, 
+	{ @"&lfloor;", 8970 }, 
+	{ @"&rfloor;", 8971 }, 
+	{ @"&lang;", 9001 }, 
+	{ @"&rang;", 9002 }, 
+	{ @"&loz;", 9674 }, 
+	{ @"&spades;", 9824 }, 
+	{ @"&clubs;", 9827 }, 
+	{ @"&hearts;", 9829 }, 
+	{ @"&diams;", 9830 }
+};
+
+// Taken from http://www.w3.org/TR/xhtml1/dtds.html#a_dtd_Special_characters
+// This is table A.2.2 Special Characters
+static ReferenceHTMLEscapeMap gReferenceUnicodeHTMLEscapeMap[] = {
+	// C0 Controls and Basic Latin
+	{ @"&quot;", 34 },
+	{ @"&amp;", 38 },
+	{ @"&apos;", 39 },
+	{ @"&lt;", 60 },
+	{ @"&gt;", 62 },
+	
+	// Latin Extended-A
+	{ @"&OElig;", 338 },
+	{ @"&oelig;", 339 },
+	{ @"&Scaron;", 352 },
+	{ @"&scaron;", 353 },
+	{ @"&Yuml;", 376 },
+	
+	// Spacing Modifier Letters
+	{ @"&circ;", 710 },
+	{ @"&tilde;", 732 },
+    
+	// General Punctuation
+	{ @"&ensp;", 8194 },
+	{ @"&emsp;", 8195 },
+	{ @"&thinsp;", 8201 },
+	{ @"&zwnj;", 8204 },
+	{ @"&zwj;", 8205 },
+	{ @"&lrm;", 8206 },
+	{ @"&rlm;", 8207 },
+	{ @"&ndash;", 8211 },
+	{ @"&mdash;", 8212 },
+	{ @"&lsquo;", 8216 },
+	{ @"&rsquo;", 8217 },
+	{ @"&sbquo;", 8218 },
+	{ @"&ldquo;", 8220 },
+	{ @"&rdquo;", 8221 },
+	{ @"&bdquo;", 8222 },
+	{ @"&dagger;", 8224 },
+	{ @"&Dagger;", 8225 },
+	{ @"&permil;", 8240 },
+	{ @"&lsaquo;", 8249 },
+	{ @"&rsaquo;", 8250 },
+	{ @"&euro;", 8364 },
+};
+
+
+// Utility function for Bsearching table above
+static int ReferenceEscapeMapCompare(const void *ucharVoid, const void *mapVoid) {
+	const unichar *uchar = (const unichar*)ucharVoid;
+	const ReferenceHTMLEscapeMap *map = (const ReferenceHTMLEscapeMap*)mapVoid;
+	int val;
+	if (*uchar > map->uchar) {
+		val = 1;
+	} else if (*uchar < map->uchar) {
+		val = -1;
+	} else {
+		val = 0;
+	}
+	return val;
+}
+
+@implementation NSString (HTMLReference)
+
+- (NSString *)reference_stringByConvertingHTMLToPlainText {
+    @autoreleasepool {
+        
+        // Character sets
+        NSCharacterSet *stopCharacters = [NSCharacterSet characterSetWithCharactersInString:[NSString stringWithFormat:@"< \t\n\r%C%C%C%C", (unichar)0x0085, (unichar)0x000C, (unichar)0x2028, (unichar)0x2029]];
+        NSCharacterSet *newLineAndWhitespaceCharacters = [NSCharacterSet characterSetWithCharactersInString:[NSString stringWithFormat:@" \t\n\r%C%C%C%C", (unichar)0x0085, (unichar)0x000C, (unichar)0x2028, (unichar)0x2029]];
+        NSCharacterSet *tagNameCharacters = [NSCharacterSet characterSetWithCharactersInString:@"abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ"];
+        
+        // Scan and find all tags
+        NSMutableString *result = [[NSMutableString alloc] initWithCapacity:self.length];
+        NSScanner *scanner = [[NSScanner alloc] initWithString:self];
+        [scanner setCharactersToBeSkipped:nil];
+        [scanner setCaseSensitive:YES];
+        NSString *str = nil, *tagName = nil;
+        BOOL dontReplaceTagWithSpace = NO;
+        do {
+            
+            // Scan up to the start of a tag or whitespace
+            if ([scanner scanUpToCharactersFromSet:stopCharacters intoString:&str]) {
+                [result appendString:str];
+                str = nil; // reset
+            }
+            
+            // Check if we've stopped at a tag/comment or whitespace
+            if ([scanner scanString:@"<" intoString:NULL]) {
+                
+                // Stopped at a comment, script tag, or other tag
+                if ([scanner scanString:@"!--" intoString:NULL]) {
+                    
+                    // Comment
+                    [scanner scanUpToString:@"-->" intoString:NULL];
+                    [scanner scanString:@"-->" intoString:NULL];
+                    
+                } else if ([scanner scanString:@"script" intoString:NULL]) {
+                    
+                    // Script tag where things don't need escaping!
+                    [scanner scanUpToString:@"</script>" intoString:NULL];
+                    [scanner scanString:@"</script>" intoString:NULL];
+                    
+                } else {
+                    
+                    // Tag - remove and replace with space unless it's
+                    // a closing inline tag then dont replace with a space
+                    if ([scanner scanString:@"/" intoString:NULL]) {
+                        
+                        // Closing tag - replace with space unless it's inline
+                        tagName = nil; dontReplaceTagWithSpace = NO;
+                        if ([scanner scanCharactersFromSet:tagNameCharacters intoString:&tagName]) {
+                            tagName = [tagName lowercaseString];
+                            dontReplaceTagWithSpace = ([tagName isEqualToString:@"a"] ||
+                                                       [tagName isEqualToString:@"b"] ||
+                                                       [tagName isEqualToString:@"i"] ||
+                                                       [tagName isEqualToString:@"q"] ||
+                                                       [tagName isEqualToString:@"span"] ||
+                                                       [tagName isEqualToString:@"em"] ||
+                                                       [tagName isEqualToString:@"strong"] ||
+                                                       [tagName isEqualToString:@"cite"] ||
+                                                       [tagName isEqualToString:@"abbr"] ||
+                                                       [tagName isEqualToString:@"acronym"] ||
+                                                       [tagName isEqualToString:@"label"]);
+                        }
+                        
+                        // Replace tag with string unless it was an inline
+                        if (!dontReplaceTagWithSpace && result.length > 0 && ![scanner isAtEnd]) [result appendString:@" "];
+                        
+                    }
+                    
+                    // Scan past tag
+                    [scanner scanUpToString:@">" intoString:NULL];
+                    [scanner scanString:@">" intoString:NULL];
+                    
+                }
+                
+            } else {
+                
+                // Stopped at whitespace - replace all whitespace and newlines with a space
+                if ([scanner scanCharactersFromSet:newLineAndWhitespaceCharacters intoString:NULL]) {
+                    if (result.length > 0 && ![scanner isAtEnd]) [result appendString:@" "]; // Dont append space to beginning or end of result
+                }
+                
+            }
+            
+        } while (![scanner isAtEnd]);
+        
+        // Cleanup
+        
+        // Decode HTML entities and return
+        NSString *retString = [result stringByDecodingHTMLEntities];
+        
+        // Return
+        return retString;
+        
+    }
+}
+
+- (NSString *)reference_stringByStrippingTags {
+	@autoreleasepool {
+        
+        // Find first & and short-cut if we can
+        NSUInteger ampIndex = [self rangeOfString:@"<" options:NSLiteralSearch].location;
+        if (ampIndex == NSNotFound) {
+            return [NSString stringWithString:self]; // return copy of string as no tags found
+        }
+        
+        // Scan and find all tags
+        NSScanner *scanner = [NSScanner scannerWithString:self];
+        [scanner setCharactersToBeSkipped:nil];
+        NSMutableSet *tags = [[NSMutableSet alloc] init];
+        NSString *tag;
+        do {
+            
+            // Scan up to <
+            tag = nil;
+            [scanner scanUpToString:@"<" intoString:NULL];
+            [scanner scanUpToString:@">" intoString:&tag];
+            
+            // Add to set
+            if (tag) {
+                NSString *t = [[NSString alloc] initWithFormat:@"%@>", tag];
+                [tags addObject:t];
+            }
+            
+        } while (![scanner isAtEnd]);
+        
+        // Strings
+        NSMutableString *result = [[NSMutableString alloc] initWithString:self];
+        NSString *finalString;
+        
+        // Replace tags
+        NSString *replacement;
+        for (NSString *t in tags) {
+            
+            // Replace tag with space unless it's an inline element
+            replacement = @" ";
+            if ([t isEqualToString:@"<a>"] ||
+                [t isEqualToString:@"</a>"] ||
+                [t isEqualToString:@"<span>"] ||
+                [t isEqualToString:@"</span>"] ||
+                [t isEqualToString:@"<strong>"] ||
+                [t isEqualToString:@"</strong>"] ||
+                [t isEqualToString:@"<em>"] ||
+                [t isEqualToString:@"</em>"]) {
+                replacement = @"";
+            }
+            
+            // Replace
+            [result replaceOccurrencesOfString:t
+                                    withString:replacement
+                                       options:NSLiteralSearch
+                                         range:NSMakeRange(0, result.length)];
+        }
+        
+        // Remove multi-spaces and line breaks
+        finalString = [result stringByRemovingNewLinesAndWhitespace];
+        
+        // Cleanup
+        
+        // Return
+        return finalString;
+        
+	}
+}
+
+- (NSString *)reference_gtm_stringByEscapingHTMLUsingTable:(ReferenceHTMLEscapeMap*)table 
+                                          ofSize:(NSUInteger)size 
+                                 escapingUnicode:(BOOL)escapeUnicode {  
+	NSUInteger length = [self length];
+	if (!length) {
+		return self;
+	}
+	
+	NSMutableString *finalString = [NSMutableString string];
+	NSMutableData *data2 = [NSMutableData dataWithCapacity:sizeof(unichar) * length];
+	
+	// this block is common between GTMNSString+HTML and GTMNSString+XML but
+	// it's so short that it isn't really worth trying to share.
+	const unichar *buffer = CFStringGetCharactersPtr((CFStringRef)self);
+	if (!buffer) {
+		// We want this buffer to be autoreleased.
+		NSMutableData *data = [NSMutableData dataWithLength:length * sizeof(UniChar)];
+		if (!data) {
+			// COV_NF_START  - Memory fail case
+//			_GTMDevLog(@"couldn't alloc buffer");
+			return nil;
+			// COV_NF_END
+		}
+		[self getCharacters:[data mutableBytes]];
+		buffer = [data bytes];
+	}
+	
+	if (!buffer || !data2) {
+		// COV_NF_START
+//		_GTMDevLog(@"Unable to allocate buffer or data2");
+		return nil;
+		// COV_NF_END
+	}
+	
+	unichar *buffer2 = (unichar *)[data2 mutableBytes];
+	
+	NSUInteger buffer2Length = 0;
+	
+	for (NSUInteger i = 0; i < length; ++i) {
+		ReferenceHTMLEscapeMap *val = bsearch(&buffer[i], table, 
+									 size / sizeof(ReferenceHTMLEscapeMap), 
+									 sizeof(ReferenceHTMLEscapeMap), ReferenceEscapeMapCompare);
+		if (val || (escapeUnicode && buffer[i] > 127)) {
+			if (buffer2Length) {
+				CFStringAppendCharacters((CFMutableStringRef)finalString, 
+										 buffer2, 
+										 buffer2Length);
+				buffer2Length = 0;
+			}
+			if (val) {
+				[finalString appendString:val->escapeSequence];
+			}
+			else {
+//				_GTMDevAssert(escapeUnicode && buffer[i] > 127, @"Illegal Character");
+				[finalString appendFormat:@"&#%d;", buffer[i]];
+			}
+		} else {
+			buffer2[buffer2Length] = buffer[i];
+			buffer2Length += 1;
+		}
+	}
+	if (buffer2Length) {
+		CFStringAppendCharacters((CFMutableStringRef)finalString, 
+								 buffer2, 
+								 buffer2Length);
+	}
+	return finalString;
+}
+
+- (NSString *)reference_gtm_stringByEscapingForHTML {
+	return [self reference_gtm_stringByEscapingHTMLUsingTable:gReferenceUnicodeHTMLEscapeMap 
+											 ofSize:sizeof(gReferenceUnicodeHTMLEscapeMap) 
+									escapingUnicode:NO];
+} // gtm_stringByEscapingHTML
+
+- (NSString *)reference_gtm_stringByEscapingForAsciiHTML {
+	return [self reference_gtm_stringByEscapingHTMLUsingTable:gReferenceAsciiHTMLEscapeMap 
+											 ofSize:sizeof(gReferenceAsciiHTMLEscapeMap) 
+									escapingUnicode:YES];
+} // gtm_stringByEscapingAsciiHTML
+
+@end
@@ -0,0 +1,224 @@
+//
+//  RSSChannelSnapshotTests.m
+//  MediaRSSParser
+//
+
+// Test Class
+#import "RSSChannelSnapshot.h"
+#import "RSSSnapshotItemArray.h"
+
+// Collaborators
+#import "RSSParser_Protected.h"
+
+// Test Support
+#import <XCTest/XCTest.h>
+
+#define HC_SHORTHAND
+#import <OCHamcrest/OCHamcrest.h>
+
+@interface RSSChannelSnapshotTests : XCTestCase
+@end
+
+@implementation RSSChannelSnapshotTests
+
+#pragma mark - Given
+
+- (RSSChannel *)givenChannelForResource:(NSString *)resource
+{
+  NSBundle *bundle = [NSBundle bundleForClass:[self class]];
+  NSData *data = [NSData dataWithContentsOfFile:[bundle pathForResource:resource ofType:@"xml"]];
+  
+  RSSParser *parser = [[RSSParser alloc] init];
+  [parser GETSucceeded:[[NSXMLParser alloc] initWithData:data]];
+  return parser.channel;
+}
+
+#pragma mark - Verify
+
+- (void)verifyChannel:(RSSChannel *)channel equalToChannel:(RSSChannel *)expected
+{
+  assertThat(channel.title, equalTo(expected.title));
+  assertThat(channel.link, equalTo(expected.link));
+  assertThat(channel.channelDescription, equalTo(expected.channelDescription));
+  assertThat(channel.language, equalTo(expected.language));
+  assertThat(channel.copyright, equalTo(expected.copyright));
+  assertThat(channel.managingEditorEmail, equalTo(expected.managingEditorEmail));
+  assertThat(channel.webMasterEmail, equalTo(expected.webMasterEmail));
+  assertThat(channel.pubDate, equalTo(expected.pubDate));
+  assertThat(channel.lastBuildDate, equalTo(expected.lastBuildDate));
+  assertThat(channel.generator, equalTo(expected.generator));
+  assertThat(channel.docsURL, equalTo(expected.docsURL));
+  assertThatInteger(channel.ttl, equalToInteger(expected.ttl));
+  
+  assertThatUnsignedInteger(channel.items.count, equalToUnsignedInteger(expected.items.count));
+  for (NSUInteger i = 0; i < expected.items.count; i++) {
+    [self verifyItem:channel.items[i] equalToItem:expected.items[i]];
+  }
+}
+
+- (void)verifyItem:(RSSItem *)item equalToItem:(RSSItem *)expected
+{
+  assertThat(item.title, equalTo(expected.title));
+  assertThat(item.link, equalTo(expected.link));
+  assertThat(item.itemDescription, equalTo(expected.itemDescription));
+  assertThat(item.authorEmail, equalTo(expected.authorEmail));
+  assertThat(item.commentsURL, equalTo(expected.commentsURL));
+  assertThat(item.guid, equalTo(expected.guid));
+  assertThat(item.pubDate, equalTo(expected.pubDate));
+  assertThat(item.mediaTitle, equalTo(expected.mediaTitle));
+  assertThat(item.mediaDescription, equalTo(expected.mediaDescription));
+  assertThat(item.mediaText, equalTo(expected.mediaText));
+  
+  assertThatUnsignedInteger(item.mediaContents.count, equalToUnsignedInteger(expected.mediaContents.count));
+  for (NSUInteger i = 0; i < expected.mediaContents.count; i++) {
+    RSSMediaContent *content = item.mediaContents[i];
+    RSSMediaContent *expectedContent = expected.mediaContents[i];
+    assertThat(content.url, equalTo(expectedContent.url));
+    assertThatInteger(content.fileSize, equalToInteger(expectedContent.fileSize));
+    assertThat(content.type, equalTo(expectedContent.type));
+    assertThat(content.medium, equalTo(expectedContent.medium));
+    assertThatBool(content.isDefault, equalToBool(expectedContent.isDefault));
+    assertThat(content.expression, equalTo(expectedContent.expression));
+    assertThatInteger(content.bitrate, equalToInteger(expectedContent.bitrate));
+    assertThatInteger(content.framerate, equalToInteger(expectedContent.framerate));
+    assertThatDouble(content.samplingRate, equalToDouble(expectedContent.samplingRate));
+    assertThatInteger(content.channels, equalToInteger(expectedContent.channels));
+    assertThatInteger(content.duration, equalToInteger(expectedContent.duration));
+    assertThatDouble(content.size.width, equalToDouble(expectedContent.size.width));
+    assertThatDouble(content.size.height, equalToDouble(expectedContent.size.height));
+    assertThat(content.language, equalTo(expectedContent.language));
+  }
+  
+  assertThatUnsignedInteger(item.mediaThumbnails.count, equalToUnsignedInteger(expected.mediaThumbnails.count));
+  for (NSUInteger i = 0; i < expected.mediaThumbnails.count; i++) {
+    RSSMediaThumbnail *thumbnail = item.mediaThumbnails[i];
+    RSSMediaThumbnail *expectedThumbnail = expected.mediaThumbnails[i];
+    assertThat(thumbnail.url, equalTo(expectedThumbnail.url));
+    assertThat(thumbnail.timeOffset, equalTo(expectedThumbnail.timeOffset));
+    assertThatDouble(thumbnail.size.width, equalToDouble(expectedThumbnail.size.width));
+    assertThatDouble(thumbnail.size.height, equalToDouble(expectedThumbnail.size.height));
+  }
+  
+  assertThatUnsignedInteger(item.mediaCredits.count, equalToUnsignedInteger(expected.mediaCredits.count));
+  for (NSUInteger i = 0; i < expected.mediaCredits.count; i++) {
+    RSSMediaCredit *credit = item.mediaCredits[i];
+    RSSMediaCredit *expectedCredit = expected.mediaCredits[i];
+    assertThat(credit.role, equalTo(expectedCredit.role));
+    assertThat(credit.value, equalTo(expectedCredit.value));
+  }
+}
+
+#pragma mark - Round Trip - Tests
+
+- (void)test___dataWithChannel___round_trips_RSS_2
+{
+  // given
+  RSSChannel *channel = [self givenChannelForResource:@"RSS_2_Example"];
+  
+  // when
+  NSData *data = [RSSChannelSnapshot dataWithChannel:channel];
+  RSSChannel *decoded = [RSSChannelSnapshot channelWithData:data error:nil];
+  
+  // then
+  [self verifyChannel:decoded equalToChannel:channel];
+}
+
+- (void)test___dataWithChannel___round_trips_Media_RSS
+{
+  // given
+  RSSChannel *channel = [self givenChannelForResource:@"Media_RSS_Example"];
+  
+  // when
+  NSData *data = [RSSChannelSnapshot dataWithChannel:channel];
+  RSSChannel *decoded = [RSSChannelSnapshot channelWithData:data error:nil];
+  
+  // then
+  [self verifyChannel:decoded equalToChannel:channel];
+}
+
+- (void)test___writeChannel_toFile___round_trips_through_mapped_file
+{
+  // given
+  RSSChannel *channel = [self givenChannelForResource:@"Media_RSS_Example"];
+  NSString *path = [NSTemporaryDirectory() stringByAppendingPathComponent:[[NSUUID UUID] UUIDString]];
+  
+  // when
+  BOOL written = [RSSChannelSnapshot writeChannel:channel toFile:path error:nil];
+  RSSChannel *decoded = [RSSChannelSnapshot channelWithContentsOfFile:path error:nil];
+  
+  // then
+  XCTAssertTrue(written);
+  [self verifyChannel:decoded equalToChannel:channel];
+  
+  [[NSFileManager defaultManager] removeItemAtPath:path error:nil];
+}
+
+#pragma mark - Lazy Items - Tests
+
+- (void)test___channelWithData___decodes_items_on_first_access
+{
+  // given
+  RSSChannel *channel = [self givenChannelForResource:@"RSS_2_Example"];
+  NSData *data = [RSSChannelSnapshot dataWithChannel:channel];
+  
+  // when
+  RSSChannel *decoded = [RSSChannelSnapshot channelWithData:data error:nil];
+  RSSSnapshotItemArray *items = (RSSSnapshotItemArray *)decoded.items;
+  
+  // then
+  XCTAssertTrue([items isKindOfClass:[RSSSnapshotItemArray class]]);
+  assertThatUnsignedInteger(items.materializedCount, equalToUnsignedInteger(0));
+  
+  RSSItem *item = items[2];
+  assertThat(items[2], sameInstance(item));
+  assertThatUnsignedInteger(items.materializedCount, equalToUnsignedInteger(1));
+}
+
+#pragma mark - Invalid Data - Tests
+
+- (void)test___channelWithData___returns_error_for_invalid_data
+{
+  // given
+  NSError *error = nil;
+  NSData *data = [@"<rss version=\"2.0\"></rss>" dataUsingEncoding:NSUTF8StringEncoding];
+  
+  // when
+  RSSChannel *channel = [RSSChannelSnapshot channelWithData:data error:&error];
+  
+  // then
+  assertThat(channel, nilValue());
+  assertThat(error.domain, equalTo(RSSChannelSnapshotErrorDomain));
+  assertThatInteger(error.code, equalToInteger(RSSChannelSnapshotErrorInvalidData));
+}
+
+- (void)test___channelWithData___returns_error_for_truncated_data
+{
+  // given
+  NSError *error = nil;
+  NSData *data = [RSSChannelSnapshot dataWithChannel:[self givenChannelForResource:@"RSS_2_Example"]];
+  
+  // when
+  RSSChannel *channel = [RSSChannelSnapshot channelWithData:[data subdataWithRange:NSMakeRange(0, 40)] error:&error];
+  
+  // then
+  assertThat(channel, nilValue());
+  assertThatInteger(error.code, equalToInteger(RSSChannelSnapshotErrorInvalidData));
+}
+
+- (void)test___channelWithData___returns_error_for_unsupported_version
+{
+  // given
+  NSError *error = nil;
+  NSMutableData *data = [[RSSChannelSnapshot dataWithChannel:[[RSSChannel alloc] init]] mutableCopy];
+  uint16_t version = CFSwapInt16HostToLittle(99);
+  [data replaceBytesInRange:NSMakeRange(4, sizeof(version)) withBytes:&version];
+  
+  // when
+  RSSChannel *channel = [RSSChannelSnapshot channelWithData:data error:&error];
+  
+  // then
+  assertThat(channel, nilValue());
+  assertThatInteger(error.code, equalToInteger(RSSChannelSnapshotErrorUnsupportedVersion));
+}
+
+@end
@@ -0,0 +1,304 @@
+//
+//  RSSColumnarChannelTests.m
+//  MediaRSSParser
+//
+
+// Test Class
+#import "RSSColumnarChannel.h"
+
+// Collaborators
+#import "RSSChannel.h"
+#import "RSSItem.h"
+#import "RSSMediaContent.h"
+
+// Test Support
+#import <XCTest/XCTest.h>
+
+#define HC_SHORTHAND
+#import <OCHamcrest/OCHamcrest.h>
+
+@interface RSSColumnarChannelTests : XCTestCase
+@end
+
+@implementation RSSColumnarChannelTests
+{
+  RSSColumnarChannel *sut;
+}
+
+#pragma mark - Test Lifecycle
+
+- (void)setUp
+{
+  [super setUp];
+  sut = [[RSSColumnarChannel alloc] init];
+}
+
+#pragma mark - Given
+
+- (RSSItem *)itemWithTitle:(NSString *)title date:(NSTimeInterval)date medium:(NSString *)medium duration:(NSInteger)duration
+{
+  RSSItem *item = [[RSSItem alloc] init];
+  item.title = title;
+  item.link = [NSURL URLWithString:[@"http://www.example.com/" stringByAppendingString:title]];
+  item.pubDate = isnan(date) ? nil : [NSDate dateWithTimeIntervalSinceReferenceDate:date];
+  
+  RSSMediaContent *content = [[RSSMediaContent alloc] init];
+  content.medium = medium;
+  content.duration = duration;
+  content.bitrate = duration * 10;
+  content.size = CGSizeMake(640, 360);
+  item.mediaContents = @[content];
+  
+  return item;
+}
+
+- (RSSChannel *)channel
+{
+  RSSChannel *channel = [[RSSChannel alloc] init];
+  channel.items = @[[self itemWithTitle:@"a" date:300 medium:@"video" duration:60],
+                    [self itemWithTitle:@"b" date:100 medium:@"audio" duration:-5],
+                    [self itemWithTitle:@"c" date:NAN medium:@"video" duration:600],
+                    [self itemWithTitle:@"d" date:200 medium:@"video" duration:60]];
+  return channel;
+}
+
+- (NSIndexSet *)indexSetWithIndexes:(NSArray *)indexes
+{
+  NSMutableIndexSet *indexSet = [[NSMutableIndexSet alloc] init];
+  for (NSNumber *index in indexes) {
+    [indexSet addIndex:[index unsignedIntegerValue]];
+  }
+  return indexSet;
+}
+
+#pragma mark - Appending - Tests
+
+- (void)test___initWithChannel___appends_all_items_in_order
+{
+  // when
+  sut = [[RSSColumnarChannel alloc] initWithChannel:[self channel]];
+  
+  // then
+  assertThatUnsignedInteger(sut.count, equalToUnsignedInteger(4));
+  assertThat([sut stringForColumn:RSSColumnarChannelStringColumnTitle atIndex:0], equalTo(@"a"));
+  assertThat([sut stringForColumn:RSSColumnarChannelStringColumnTitle atIndex:3], equalTo(@"d"));
+  assertThat([sut stringForColumn:RSSColumnarChannelStringColumnLink atIndex:1], equalTo(@"http://www.example.com/b"));
+}
+
+- (void)test___appendItem___sets_numeric_columns_from_item_and_primary_content
+{
+  // when
+  [sut appendItem:[self itemWithTitle:@"a" date:300 medium:@"video" duration:60]];
+  
+  // then
+  XCTAssertEqual(sut.pubDates[0], 300.0);
+  XCTAssertEqual(sut.durations[0], (int64_t)60);
+  XCTAssertEqual(sut.bitrates[0], (int64_t)600);
+  XCTAssertEqual(sut.widths[0], 640.0f);
+  XCTAssertEqual(sut.heights[0], 360.0f);
+  XCTAssertEqual([sut valueOfColumn:RSSColumnarChannelColumnDuration atIndex:0], 60.0);
+}
+
+- (void)test___appendItem___uses_default_media_content
+{
+  // given
+  RSSItem *item = [self itemWithTitle:@"a" date:300 medium:@"video" duration:60];
+  RSSMediaContent *defaultContent = [[RSSMediaContent alloc] init];
+  defaultContent.medium = @"audio";
+  defaultContent.duration = 30;
+  defaultContent.isDefault = YES;
+  item.mediaContents = [item.mediaContents arrayByAddingObject:defaultContent];
+  
+  // when
+  [sut appendItem:item];
+  
+  // then
+  XCTAssertEqual(sut.durations[0], (int64_t)30);
+  assertThat([sut stringForColumn:RSSColumnarChannelStringColumnMedium atIndex:0], equalTo(@"audio"));
+}
+
+- (void)test___appendItem___missing_values
+{
+  // when
+  [sut appendItem:[[RSSItem alloc] init]];
+  
+  // then
+  XCTAssertTrue(isnan(sut.pubDates[0]));
+  XCTAssertEqual(sut.durations[0], (int64_t)0);
+  XCTAssertEqual([sut stringIdentifiersForColumn:RSSColumnarChannelStringColumnGUID][0], RSSColumnarChannelNoString);
+  assertThat([sut stringForColumn:RSSColumnarChannelStringColumnTitle atIndex:0], nilValue());
+}
+
+- (void)test___appendItem___equal_strings_share_one_identifier
+{
+  // when
+  [sut appendItemsFromChannel:[self channel]];
+  
+  // then
+  const uint32_t *media = [sut stringIdentifiersForColumn:RSSColumnarChannelStringColumnMedium];
+  XCTAssertEqual(media[0], media[2]);
+  XCTAssertNotEqual(media[0], media[1]);
+  XCTAssertEqual([sut identifierOfString:@"video"], media[0]);
+  assertThat([sut stringWithIdentifier:media[1]], equalTo(@"audio"));
+  assertThatUnsignedInteger(sut.stringCount, equalToUnsignedInteger(4 + 4 + 2));
+}
+
+- (void)test___appendItem___grows_columns
+{
+  // when
+  for (NSUInteger i = 0; i < 1000; i++) {
+    [sut appendItem:[self itemWithTitle:[NSString stringWithFormat:@"%lu", (unsigned long)i] date:i medium:@"video" duration:i]];
+  }
+  
+  // then
+  assertThatUnsignedInteger(sut.count, equalToUnsignedInteger(1000));
+  XCTAssertEqual(sut.durations[999], (int64_t)999);
+  assertThat([sut stringForColumn:RSSColumnarChannelStringColumnTitle atIndex:999], equalTo(@"999"));
+}
+
+#pragma mark - Filtering - Tests
+
+- (void)test___indexesOfItemsPublishedFrom_to___returns_items_within_inclusive_range
+{
+  // given
+  [sut appendItemsFromChannel:[self channel]];
+  
+  // when
+  NSIndexSet *indexes = [sut indexesOfItemsPublishedFrom:[NSDate dateWithTimeIntervalSinceReferenceDate:100]
+                                                      to:[NSDate dateWithTimeIntervalSinceReferenceDate:200]];
+  
+  // then
+  assertThat(indexes, equalTo([self indexSetWithIndexes:@[@1, @3]]));
+}
+
+- (void)test___indexesOfItemsPublishedFrom_to___nil_dates_are_open_and_exclude_missing_dates
+{
+  // given
+  [sut appendItemsFromChannel:[self channel]];
+  
+  // when
+  NSIndexSet *indexes = [sut indexesOfItemsPublishedFrom:nil to:nil];
+  
+  // then
+  assertThat(indexes, equalTo([self indexSetWithIndexes:@[@0, @1, @3]]));
+}
+
+- (void)test___indexesOfItemsWithColumn_from_to___integer_column_rounds_bounds_inward
+{
+  // given
+  [sut appendItemsFromChannel:[self channel]];
+  
+  // when
+  NSIndexSet *indexes = [sut indexesOfItemsWithColumn:RSSColumnarChannelColumnDuration from:-5.5 to:60.5];
+  
+  // then
+  assertThat(indexes, equalTo([self indexSetWithIndexes:@[@0, @1, @3]]));
+}
+
+- (void)test___indexesOfItemsWithColumn_from_to___returns_empty_set_for_empty_range
+{
+  // given
+  [sut appendItemsFromChannel:[self channel]];
+  
+  // when
+  NSIndexSet *indexes = [sut indexesOfItemsWithColumn:RSSColumnarChannelColumnDuration from:61 to:60];
+  
+  // then
+  assertThatUnsignedInteger(indexes.count, equalToUnsignedInteger(0));
+}
+
+- (void)test___indexesOfItemsWithColumn_from_to___spans_filter_blocks
+{
+  // given
+  for (NSUInteger i = 0; i < 3000; i++) {
+    [sut appendItem:[self itemWithTitle:@"a" date:i medium:@"video" duration:i]];
+  }
+  
+  // when
+  NSIndexSet *indexes = [sut indexesOfItemsWithColumn:RSSColumnarChannelColumnDuration from:1000 to:2500];
+  
+  // then
+  assertThat(indexes, equalTo([NSIndexSet indexSetWithIndexesInRange:NSMakeRange(1000, 1501)]));
+}
+
+- (void)test___indexesOfItemsWithString_inColumn___returns_matching_items
+{
+  // given
+  [sut appendItemsFromChannel:[self channel]];
+  
+  // then
+  assertThat([sut indexesOfItemsWithString:@"video" inColumn:RSSColumnarChannelStringColumnMedium],
+             equalTo([self indexSetWithIndexes:@[@0, @2, @3]]));
+  assertThatUnsignedInteger([sut indexesOfItemsWithString:@"image" inColumn:RSSColumnarChannelStringColumnMedium].count,
+                            equalToUnsignedInteger(0));
+  assertThatUnsignedInteger([sut indexesOfItemsWithString:nil inColumn:RSSColumnarChannelStringColumnGUID].count,
+                            equalToUnsignedInteger(4));
+}
+
+#pragma mark - Sorting - Tests
+
+- (void)test___getIndexes_sortedByColumn_ascending___sorts_dates_with_missing_dates_last
+{
+  // given
+  [sut appendItemsFromChannel:[self channel]];
+  uint32_t indexes[4];
+  
+  // when
+  [sut getIndexes:indexes sortedByColumn:RSSColumnarChannelColumnPubDate ascending:YES];
+  
+  // then
+  XCTAssertEqual(indexes[0], 1u);
+  XCTAssertEqual(indexes[1], 3u);
+  XCTAssertEqual(indexes[2], 0u);
+  XCTAssertEqual(indexes[3], 2u);
+}
+
+- (void)test___getIndexes_sortedByColumn_ascending___descending_dates_keep_missing_dates_last
+{
+  // given
+  [sut appendItemsFromChannel:[self channel]];
+  uint32_t indexes[4];
+  
+  // when
+  [sut getIndexes:indexes sortedByColumn:RSSColumnarChannelColumnPubDate ascending:NO];
+  
+  // then
+  XCTAssertEqual(indexes[0], 0u);
+  XCTAssertEqual(indexes[1], 3u);
+  XCTAssertEqual(indexes[2], 1u);
+  XCTAssertEqual(indexes[3], 2u);
+}
+
+- (void)test___getIndexes_sortedByColumn_ascending___is_stable_and_orders_negative_integers
+{
+  // given
+  [sut appendItemsFromChannel:[self channel]];
+  uint32_t indexes[4];
+  
+  // when
+  [sut getIndexes:indexes sortedByColumn:RSSColumnarChannelColumnDuration ascending:YES];
+  
+  // then
+  XCTAssertEqual(indexes[0], 1u);
+  XCTAssertEqual(indexes[1], 0u);
+  XCTAssertEqual(indexes[2], 3u);
+  XCTAssertEqual(indexes[3], 2u);
+}
+
+- (void)test___getIndexes_sortedByColumn_ascending___descending_is_stable
+{
+  // given
+  [sut appendItemsFromChannel:[self channel]];
+  uint32_t indexes[4];
+  
+  // when
+  [sut getIndexes:indexes sortedByColumn:RSSColumnarChannelColumnDuration ascending:NO];
+  
+  // then
+  XCTAssertEqual(indexes[0], 2u);
+  XCTAssertEqual(indexes[1], 0u);
+  XCTAssertEqual(indexes[2], 3u);
+  XCTAssertEqual(indexes[3], 1u);
+}
+
+@end
@@ -0,0 +1,152 @@
+//
+//  RSSDateParsingTests.m
+//  MediaRSSParser
+//
+
+// Test Class
+#import "RSSDateParsing.h"
+
+// Test Support
+#import <XCTest/XCTest.h>
+
+#define HC_SHORTHAND
+#import <OCHamcrest/OCHamcrest.h>
+
+@interface RSSDateParsingTests : XCTestCase
+@end
+
+@implementation RSSDateParsingTests
+{
+  NSDateFormatter *dateFormatter;
+}
+
+#pragma mark - Test Lifecycle
+
+- (void)setUp
+{
+  [super setUp];
+  dateFormatter = [[NSDateFormatter alloc] init];
+  [dateFormatter setLocale:[[NSLocale alloc] initWithLocaleIdentifier:@"en_US_POSIX"]];
+  [dateFormatter setDateFormat:@"EEE, dd MMM yyyy HH:mm:ss Z"];
+}
+
+#pragma mark - Utilities
+
+- (NSDate *)dateFromFormatterString:(NSString *)string
+{
+  return [dateFormatter dateFromString:string];
+}
+
+#pragma mark - RFC 822 - Tests
+
+- (void)test___RSSDateFromString___parses_RFC_822_GMT
+{
+  NSString *string = @"Tue, 10 Jun 2003 11:00:00 GMT";
+  assertThat(RSSDateFromString(string), equalTo([self dateFromFormatterString:string]));
+}
+
+- (void)test___RSSDateFromString___parses_RFC_822_numeric_zone
+{
+  NSString *string = @"Tue, 10 Jun 2003 11:00:00 +0200";
+  assertThat(RSSDateFromString(string), equalTo([self dateFromFormatterString:string]));
+}
+
+- (void)test___RSSDateFromString___parses_RFC_822_named_zone
+{
+  assertThat(RSSDateFromString(@"Wed, 02 Oct 2002 08:00:00 EST"),
+             equalTo([self dateFromFormatterString:@"Wed, 02 Oct 2002 13:00:00 +0000"]));
+}
+
+- (void)test___RSSDateFromString___parses_RFC_822_missing_weekday_and_seconds
+{
+  assertThat(RSSDateFromString(@"10 Jun 2003 11:00 GMT"),
+             equalTo([self dateFromFormatterString:@"Tue, 10 Jun 2003 11:00:00 GMT"]));
+}
+
+- (void)test___RSSDateFromString___parses_RFC_822_two_digit_year
+{
+  assertThat(RSSDateFromString(@"Tue, 10 Jun 03 11:00:00 GMT"),
+             equalTo([self dateFromFormatterString:@"Tue, 10 Jun 2003 11:00:00 GMT"]));
+}
+
+- (void)test___RSSDateFromString___parses_RFC_822_full_month_name
+{
+  assertThat(RSSDateFromString(@"Wed, 10 September 2003 11:00:00 GMT"),
+             equalTo([self dateFromFormatterString:@"Wed, 10 Sep 2003 11:00:00 GMT"]));
+}
+
+- (void)test___RSSDateFromString___parses_RFC_822_military_zones
+{
+  assertThat(RSSDateFromString(@"Tue, 10 Jun 2003 11:00:00 A"),
+             equalTo([self dateFromFormatterString:@"Tue, 10 Jun 2003 11:00:00 +0100"]));
+  assertThat(RSSDateFromString(@"Tue, 10 Jun 2003 11:00:00 M"),
+             equalTo([self dateFromFormatterString:@"Tue, 10 Jun 2003 11:00:00 +1200"]));
+  assertThat(RSSDateFromString(@"Tue, 10 Jun 2003 11:00:00 N"),
+             equalTo([self dateFromFormatterString:@"Tue, 10 Jun 2003 11:00:00 -0100"]));
+  assertThat(RSSDateFromString(@"Tue, 10 Jun 2003 11:00:00 Y"),
+             equalTo([self dateFromFormatterString:@"Tue, 10 Jun 2003 11:00:00 -1200"]));
+  assertThat(RSSDateFromString(@"Tue, 10 Jun 2003 11:00:00 Z"),
+             equalTo([self dateFromFormatterString:@"Tue, 10 Jun 2003 11:00:00 GMT"]));
+}
+
+- (void)test___RSSDateFromString___ignores_surrounding_whitespace
+{
+  assertThat(RSSDateFromString(@"\n    Tue, 10 Jun 2003 11:00:00 GMT\n  "),
+             equalTo([self dateFromFormatterString:@"Tue, 10 Jun 2003 11:00:00 GMT"]));
+}
+
+#pragma mark - RFC 3339 - Tests
+
+- (void)test___RSSDateFromString___parses_RFC_3339_UTC
+{
+  assertThat(RSSDateFromString(@"2003-06-10T11:00:00Z"),
+             equalTo([self dateFromFormatterString:@"Tue, 10 Jun 2003 11:00:00 GMT"]));
+}
+
+- (void)test___RSSDateFromString___parses_RFC_3339_offset
+{
+  assertThat(RSSDateFromString(@"2003-06-10T13:00:00+02:00"),
+             equalTo([self dateFromFormatterString:@"Tue, 10 Jun 2003 11:00:00 GMT"]));
+}
+
+- (void)test___RSSDateFromString___parses_RFC_3339_fractional_seconds
+{
+  NSDate *date = RSSDateFromString(@"2003-06-10T11:00:00.25Z");
+  NSDate *expected = [[self dateFromFormatterString:@"Tue, 10 Jun 2003 11:00:00 GMT"] dateByAddingTimeInterval:0.25];
+  assertThatDouble([date timeIntervalSince1970], equalToDouble([expected timeIntervalSince1970]));
+}
+
+#pragma mark - Invalid Dates - Tests
+
+- (void)test___RSSDateFromString___returns_nil_for_nil_string
+{
+  assertThat(RSSDateFromString(nil), nilValue());
+}
+
+- (void)test___RSSDateFromString___returns_nil_for_missing_zone
+{
+  assertThat(RSSDateFromString(@"Tue, 10 Jun 2003 11:00:00"), nilValue());
+}
+
+- (void)test___RSSDateFromString___returns_nil_for_invalid_day
+{
+  assertThat(RSSDateFromString(@"Sun, 29 Feb 2021 00:00:00 GMT"), nilValue());
+}
+
+- (void)test___RSSDateFromString___returns_nil_for_word_starting_with_month_name
+{
+  assertThat(RSSDateFromString(@"Tue, 10 Junk 2003 11:00:00 GMT"), nilValue());
+  assertThat(RSSDateFromString(@"Tue, 10 Marvel 2003 11:00:00 GMT"), nilValue());
+}
+
+- (void)test___RSSDateFromString___returns_nil_for_military_zone_J
+{
+  assertThat(RSSDateFromString(@"Tue, 10 Jun 2003 11:00:00 J"), nilValue());
+}
+
+- (void)test___RSSDateFromString___returns_nil_for_garbage
+{
+  assertThat(RSSDateFromString(@"yesterday"), nilValue());
+}
+
+@end
@@ -0,0 +1,163 @@
+//
+//  RSSFeedCacheTests.m
+//  MediaRSSParser
+//
+
+// Test Classes
+#import "RSSMemoryFeedCache.h"
+#import "RSSDiskFeedCache.h"
+#import "RSSFeedCacheEntry.h"
+
+// Collaborators
+#import "RSSChannel.h"
+
+// Test Support
+#import <XCTest/XCTest.h>
+
+#define HC_SHORTHAND
+#import <OCHamcrest/OCHamcrest.h>
+
+@interface RSSFeedCacheTests : XCTestCase
+@end
+
+@implementation RSSFeedCacheTests
+{
+  NSURL *feedURL;
+  NSURL *directoryURL;
+}
+
+#pragma mark - Test Lifecycle
+
+- (void)setUp
+{
+  [super setUp];
+  feedURL = [NSURL URLWithString:@"http://www.example.com/feed.xml?page=1"];
+  
+  NSString *directoryName = [NSString stringWithFormat:@"RSSFeedCacheTests-%@", [[NSUUID UUID] UUIDString]];
+  directoryURL = [NSURL fileURLWithPath:[NSTemporaryDirectory() stringByAppendingPathComponent:directoryName]];
+}
+
+- (void)tearDown
+{
+  [[NSFileManager defaultManager] removeItemAtURL:directoryURL error:nil];
+  [super tearDown];
+}
+
+#pragma mark - Given
+
+- (RSSFeedCacheEntry *)givenEntry
+{
+  RSSChannel *channel = [[RSSChannel alloc] init];
+  channel.title = @"Cached Channel";
+  
+  RSSFeedCacheEntry *entry = [[RSSFeedCacheEntry alloc] init];
+  entry.etag = @"\"abc123\"";
+  entry.lastModified = @"Sat, 07 Sep 2002 09:42:31 GMT";
+  entry.channel = channel;
+  return entry;
+}
+
+#pragma mark - RSSFeedCacheEntry - Tests
+
+- (void)test___entryWithResponse___reads_validators
+{
+  // given
+  NSHTTPURLResponse *response = [[NSHTTPURLResponse alloc] initWithURL:feedURL statusCode:200 HTTPVersion:@"HTTP/1.1"
+                                                          headerFields:@{@"ETag": @"\"abc123\"",
+                                                                         @"Last-Modified": @"Sat, 07 Sep 2002 09:42:31 GMT"}];
+  
+  // when
+  RSSFeedCacheEntry *entry = [RSSFeedCacheEntry entryWithResponse:response];
+  
+  // then
+  assertThat(entry.etag, equalTo(@"\"abc123\""));
+  assertThat(entry.lastModified, equalTo(@"Sat, 07 Sep 2002 09:42:31 GMT"));
+}
+
+- (void)test___entryWithResponse___returns_nil_without_validators
+{
+  // given
+  NSHTTPURLResponse *response = [[NSHTTPURLResponse alloc] initWithURL:feedURL statusCode:200 HTTPVersion:@"HTTP/1.1"
+                                                          headerFields:@{@"Content-Type": @"application/rss+xml"}];
+  
+  // then
+  assertThat([RSSFeedCacheEntry entryWithResponse:response], nilValue());
+}
+
+#pragma mark - RSSMemoryFeedCache - Tests
+
+- (void)test___memoryFeedCache___returns_stored_entry
+{
+  // given
+  RSSMemoryFeedCache *cache = [[RSSMemoryFeedCache alloc] init];
+  RSSFeedCacheEntry *entry = [self givenEntry];
+  
+  // when
+  [cache storeEntry:entry forURL:feedURL];
+  
+  // then
+  assertThat([cache cachedEntryForURL:feedURL], sameInstance(entry));
+  assertThat([cache cachedEntryForURL:[NSURL URLWithString:@"http://www.example.com/other.xml"]], nilValue());
+}
+
+- (void)test___memoryFeedCache___removeEntryForURL
+{
+  // given
+  RSSMemoryFeedCache *cache = [[RSSMemoryFeedCache alloc] init];
+  [cache storeEntry:[self givenEntry] forURL:feedURL];
+  
+  // when
+  [cache removeEntryForURL:feedURL];
+  
+  // then
+  assertThat([cache cachedEntryForURL:feedURL], nilValue());
+}
+
+#pragma mark - RSSDiskFeedCache - Tests
+
+- (void)test___diskFeedCache___entry_survives_new_instance
+{
+  // given
+  RSSDiskFeedCache *cache = [[RSSDiskFeedCache alloc] initWithDirectoryURL:directoryURL];
+  [cache storeEntry:[self givenEntry] forURL:feedURL];
+  
+  // when
+  RSSDiskFeedCache *otherCache = [[RSSDiskFeedCache alloc] initWithDirectoryURL:directoryURL];
+  RSSFeedCacheEntry *entry = [otherCache cachedEntryForURL:feedURL];
+  
+  // then
+  assertThat(entry.etag, equalTo(@"\"abc123\""));
+  assertThat(entry.lastModified, equalTo(@"Sat, 07 Sep 2002 09:42:31 GMT"));
+  assertThat(entry.channel.title, equalTo(@"Cached Channel"));
+}
+
+- (void)test___diskFeedCache___ignores_unreadable_file
+{
+  // given
+  RSSDiskFeedCache *cache = [[RSSDiskFeedCache alloc] initWithDirectoryURL:directoryURL];
+  [cache storeEntry:[self givenEntry] forURL:feedURL];
+  
+  NSURL *fileURL = [[[NSFileManager defaultManager] contentsOfDirectoryAtURL:directoryURL
+                                                  includingPropertiesForKeys:nil
+                                                                     options:0
+                                                                       error:nil] firstObject];
+  [[@"not an archive" dataUsingEncoding:NSUTF8StringEncoding] writeToURL:fileURL atomically:YES];
+  
+  // then
+  assertThat([cache cachedEntryForURL:feedURL], nilValue());
+}
+
+- (void)test___diskFeedCache___removeAllEntries
+{
+  // given
+  RSSDiskFeedCache *cache = [[RSSDiskFeedCache alloc] initWithDirectoryURL:directoryURL];
+  [cache storeEntry:[self givenEntry] forURL:feedURL];
+  
+  // when
+  [cache removeAllEntries];
+  
+  // then
+  assertThat([cache cachedEntryForURL:feedURL], nilValue());
+}
+
+@end
@@ -0,0 +1,88 @@
+//
+//  RSSHTMLEntitiesTests.m
+//  MediaRSSParser
+//
+
+// Test Class
+#import "RSSHTMLEntities.h"
+
+// Collaborators
+#import "NSString+HTML.h"
+
+// Test Support
+#import <XCTest/XCTest.h>
+
+#define HC_SHORTHAND
+#import <OCHamcrest/OCHamcrest.h>
+
+@interface RSSHTMLEntitiesTests : XCTestCase
+@end
+
+@implementation RSSHTMLEntitiesTests
+
+#pragma mark - Named References - Tests
+
+- (void)test___RSSStringByDecodingHTMLEntities___decodes_XML_entities
+{
+  assertThat(RSSStringByDecodingHTMLEntities(@"&lt;b&gt;Q&amp;A&lt;/b&gt; &quot;x&quot; &apos;y&apos;"),
+             equalTo(@"<b>Q&A</b> \"x\" 'y'"));
+}
+
+- (void)test___RSSStringByDecodingHTMLEntities___decodes_HTML5_named_references
+{
+  assertThat(RSSStringByDecodingHTMLEntities(@"&nbsp;&copy;&eacute;&hellip;&CounterClockwiseContourIntegral;"),
+             equalTo(@" ©é…∳"));
+}
+
+- (void)test___RSSStringByDecodingHTMLEntities___decodes_two_code_point_and_astral_references
+{
+  assertThat(RSSStringByDecodingHTMLEntities(@"&nGt;&Afr;"), equalTo(@"≫⃒\U0001D504"));
+}
+
+- (void)test___RSSStringByDecodingHTMLEntities___keeps_unknown_and_unterminated_references
+{
+  assertThat(RSSStringByDecodingHTMLEntities(@"&bogus; &amp AT&T &; end&"), equalTo(@"&bogus; &amp AT&T &; end&"));
+}
+
+#pragma mark - Numeric References - Tests
+
+- (void)test___RSSStringByDecodingHTMLEntities___decodes_decimal_and_hex_references
+{
+  assertThat(RSSStringByDecodingHTMLEntities(@"&#38;&#x26;&#X26;&#8364;"), equalTo(@"&&&€"));
+}
+
+- (void)test___RSSStringByDecodingHTMLEntities___decodes_code_points_above_BMP_as_surrogate_pairs
+{
+  NSString *decoded = RSSStringByDecodingHTMLEntities(@"&#x1F600;&#128512;");
+  
+  assertThat(decoded, equalTo(@"\U0001F600\U0001F600"));
+  assertThatUnsignedInteger(decoded.length, equalToUnsignedInteger(4));
+}
+
+- (void)test___RSSStringByDecodingHTMLEntities___keeps_invalid_numeric_references
+{
+  assertThat(RSSStringByDecodingHTMLEntities(@"&#0;&#xD800;&#x110000;&#;&#x;&#12a;"),
+             equalTo(@"&#0;&#xD800;&#x110000;&#;&#x;&#12a;"));
+}
+
+#pragma mark - NSString+HTML - Tests
+
+- (void)test___stringByDecodingHTMLEntities___returns_immutable_copy_without_references
+{
+  // given
+  NSMutableString *string = [NSMutableString stringWithString:@"No references"];
+  
+  // when
+  NSString *decoded = [string stringByDecodingHTMLEntities];
+  [string appendString:@" here"];
+  
+  // then
+  assertThat(decoded, equalTo(@"No references"));
+}
+
+- (void)test___stringByConvertingHTMLToPlainText___decodes_references
+{
+  assertThat([@"<p>Fish &amp; Chips &#x1F41F;" stringByConvertingHTMLToPlainText], equalTo(@"Fish & Chips \U0001F41F"));
+}
+
+@end
@@ -0,0 +1,166 @@
+//
+//  RSSHTMLPlainTextTests.m
+//  MediaRSSParser
+//
+
+// Test Class
+#import "RSSHTMLPlainText.h"
+
+// Collaborators
+#import "NSString+HTML.h"
+
+// Test Support
+#import <XCTest/XCTest.h>
+#import "NSString+HTMLReference.h"
+
+#define HC_SHORTHAND
+#import <OCHamcrest/OCHamcrest.h>
+
+@interface RSSHTMLPlainTextTests : XCTestCase
+@end
+
+@implementation RSSHTMLPlainTextTests
+
+#pragma mark - Regression Corpus
+
+- (NSArray *)corpus
+{
+  return @[@"",
+           @"   ",
+           @"plain",
+           @"  lead and trail  ",
+           @"a\n\n\tb",
+           [NSString stringWithFormat:@"a%Cb%Cc%Cd%Ce", (unichar)0x2028, (unichar)0x0085, (unichar)0x000C, (unichar)0x2029],
+           @"<p>Hello</p><p>World</p>",
+           @"<p>a</p>",
+           @"a </p> b",
+           @"a<br>b",
+           @"a<br/>b",
+           @"a<BR />b",
+           @"<b>bold</b>text",
+           @"<em>x</em> <strong>y</strong>",
+           @"<a href=\"http://example.com\">link</a>, <span class=\"s\">s</span>.",
+           @"<A HREF=\"x\">Upper</A> and </H1>heading</h1>done",
+           @"<cite>c</cite><abbr>a</abbr><acronym>n</acronym><label>l</label><q>q</q><i>i</i>!",
+           @"x<!-- comment -->y",
+           @"x<!-- unterminated",
+           @"x<!---->y",
+           @"x<script>var a = 1 < 2;</script>y",
+           @"x<script>unterminated",
+           @"x<SCRIPT>z</SCRIPT>y",
+           @"a<",
+           @"a</",
+           @"a</b",
+           @"a<b",
+           @"<>",
+           @"</>",
+           @"1 &lt; 2 &amp;&amp; &eacute;&#x1F600;",
+           @"&lt;p&gt;escaped&lt;/p&gt;",
+           @"<p>Caf&eacute; &mdash; <a href=\"x\">more&hellip;</a></p>\n<img src=\"http://example.com/a.jpg\" />",
+           @"<div><ul><li>one</li><li>two</li></ul></div>trailing",
+           @"\U0001F600<p>\U0001F600</p>\U0001F600"];
+}
+
+- (void)test___RSSStringByConvertingHTMLToPlainText___matches_reference_implementation_for_corpus
+{
+  for (NSString *html in [self corpus]) {
+    assertThat(RSSStringByConvertingHTMLToPlainText(html), equalTo([html reference_stringByConvertingHTMLToPlainText]));
+  }
+}
+
+- (void)test___RSSStringByStrippingTags___matches_reference_implementation_for_corpus
+{
+  for (NSString *html in [self corpus]) {
+    assertThat(RSSStringByStrippingTags(html), equalTo([html reference_stringByStrippingTags]));
+  }
+}
+
+- (void)test___RSSStringByConvertingHTMLToPlainText___matches_reference_implementation_for_feed_descriptions
+{
+  // given
+  NSBundle *bundle = [NSBundle bundleForClass:[self class]];
+  NSString *path = [bundle pathForResource:@"Media_RSS_Example" ofType:@"xml"];
+  NSString *feed = [NSString stringWithContentsOfFile:path encoding:NSUTF8StringEncoding error:nil];
+  
+  // when
+  NSString *converted = RSSStringByConvertingHTMLToPlainText(feed);
+  NSString *stripped = RSSStringByStrippingTags(feed);
+  
+  // then
+  assertThat(converted, equalTo([feed reference_stringByConvertingHTMLToPlainText]));
+  assertThat(stripped, equalTo([feed reference_stringByStrippingTags]));
+}
+
+#pragma mark - Convert To Plain Text - Tests
+
+- (void)test___RSSStringByConvertingHTMLToPlainText___replaces_closing_block_tags_with_space
+{
+  assertThat(RSSStringByConvertingHTMLToPlainText(@"<p>Hello</p><p>World</p>!"), equalTo(@"Hello World !"));
+}
+
+- (void)test___RSSStringByConvertingHTMLToPlainText___keeps_inline_tags_adjacent
+{
+  assertThat(RSSStringByConvertingHTMLToPlainText(@"<b>bold</b>text <a href=\"x\">link</a>,"), equalTo(@"boldtext link,"));
+}
+
+- (void)test___RSSStringByConvertingHTMLToPlainText___collapses_and_trims_whitespace
+{
+  assertThat(RSSStringByConvertingHTMLToPlainText(@"  a \n\n\t b  "), equalTo(@"a b"));
+}
+
+- (void)test___RSSStringByConvertingHTMLToPlainText___removes_comments_and_scripts
+{
+  assertThat(RSSStringByConvertingHTMLToPlainText(@"x<!-- c -->y<script>if (a < b) {}</script>z"), equalTo(@"xyz"));
+}
+
+- (void)test___RSSStringByConvertingHTMLToPlainText___decodes_entities
+{
+  assertThat(RSSStringByConvertingHTMLToPlainText(@"<p>1 &lt; 2 &amp; Caf&eacute;</p>."), equalTo(@"1 < 2 & Café ."));
+}
+
+#pragma mark - Strip Tags - Tests
+
+- (void)test___RSSStringByStrippingTags___replaces_tags_with_space_except_plain_inline_tags
+{
+  assertThat(RSSStringByStrippingTags(@"<p>a<span>b</span><a>c</a></p><br/>d"), equalTo(@"abc d"));
+}
+
+- (void)test___RSSStringByStrippingTags___keeps_unterminated_tag
+{
+  assertThat(RSSStringByStrippingTags(@"a<b>b</b> c<d"), equalTo(@"a b c<d"));
+}
+
+- (void)test___RSSStringByStrippingTags___does_not_decode_entities
+{
+  assertThat(RSSStringByStrippingTags(@"<p>&amp;</p>"), equalTo(@"&amp;"));
+}
+
+#pragma mark - NSString+HTML - Tests
+
+- (void)test___stringByConvertingHTMLToPlainText___uses_single_pass_engine
+{
+  // given
+  NSString *html = @"<p>Caf&eacute; &mdash; <a href=\"x\">more&hellip;</a></p>\n<img src=\"a.jpg\" />";
+  
+  // when
+  NSString *converted = [html stringByConvertingHTMLToPlainText];
+  
+  // then
+  assertThat(converted, equalTo(RSSStringByConvertingHTMLToPlainText(html)));
+  assertThat(converted, equalTo([html reference_stringByConvertingHTMLToPlainText]));
+}
+
+- (void)test___stringByStrippingTags___returns_immutable_copy_without_tags
+{
+  // given
+  NSMutableString *string = [NSMutableString stringWithString:@"No tags"];
+  
+  // when
+  NSString *stripped = [string stringByStrippingTags];
+  [string appendString:@" here"];
+  
+  // then
+  assertThat(stripped, equalTo(@"No tags"));
+}
+
+@end
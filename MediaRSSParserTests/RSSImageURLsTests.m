@@ -0,0 +1,154 @@
+//
+//  RSSImageURLsTests.m
+//  MediaRSSParser
+//
+
+// Test Class
+#import "RSSImageURLs.h"
+
+// Collaborators
+#import "RSSChannel.h"
+#import "RSSItem.h"
+
+// Test Support
+#import <XCTest/XCTest.h>
+
+#define HC_SHORTHAND
+#import <OCHamcrest/OCHamcrest.h>
+
+@interface RSSImageURLsTests : XCTestCase
+@end
+
+@implementation RSSImageURLsTests
+
+#pragma mark - Regular Expression Equivalence
+
+- (NSArray *)regularExpressionMatchesInString:(NSString *)string
+{
+  NSRegularExpression *regex = [NSRegularExpression regularExpressionWithPattern:@"(https?)\\S*(png|jpg|jpeg|gif)"
+                                                                         options:NSRegularExpressionCaseInsensitive
+                                                                           error:nil];
+  NSMutableArray *matches = [NSMutableArray array];
+  [regex enumerateMatchesInString:string options:0 range:NSMakeRange(0, string.length)
+                       usingBlock:^(NSTextCheckingResult *result, NSMatchingFlags flags, BOOL *stop) {
+                         [matches addObject:[string substringWithRange:result.range]];
+                       }];
+  return matches;
+}
+
+- (NSArray *)corpus
+{
+  return @[@"",
+           @"http",
+           @"no images here",
+           @"<img src=\"http://example.com/a.jpg\">",
+           @"<img src=\"HTTPS://EXAMPLE.COM/A.JPEG\"/><img src='http://example.com/b.gif'>",
+           @"http://example.com/a.png?size=large.jpg trailing",
+           @"http://example.com/a.pngx http://example.com/b.jpgjpeg",
+           @"xhttp://example.com/a.gif",
+           @"httpjpg httppng http.gif",
+           @"http://example.com/page.html\nhttp://example.com/a.jpg",
+           @"http://example.com/a.jpg,http://example.com/b.jpg",
+           @"http://example.com/a b.jpg http://example.com/c d.png",
+           @"http://example.com/\U0001F600.gif",
+           @"<a href=\"http://example.com\">link</a> <img src=\"http://example.com/a.jpg\" alt=\"\">"];
+}
+
+- (void)test___RSSImageURLStringsInString___matches_regular_expression_for_corpus
+{
+  for (NSString *string in [self corpus]) {
+    assertThat(RSSImageURLStringsInString(string), equalTo([self regularExpressionMatchesInString:string]));
+  }
+}
+
+- (void)test___RSSImageURLStringsInString___matches_regular_expression_for_many_images
+{
+  // given
+  NSMutableString *html = [NSMutableString string];
+  for (NSUInteger i = 0; i < 100; i++) {
+    [html appendFormat:@"<p><img src=\"http://example.com/%lu.jpg\"></p>", (unsigned long)i];
+  }
+  
+  // when
+  NSArray *images = RSSImageURLStringsInString(html);
+  
+  // then
+  assertThatUnsignedInteger(images.count, equalToUnsignedInteger(100));
+  assertThat(images, equalTo([self regularExpressionMatchesInString:html]));
+}
+
+#pragma mark - Matching - Tests
+
+- (void)test___RSSImageURLStringsInString___ends_match_at_last_extension_before_whitespace
+{
+  assertThat(RSSImageURLStringsInString(@"<img src=\"http://example.com/a.png\"/><br/>b.jpg c.gif"),
+             equalTo(@[@"http://example.com/a.png\"/><br/>b.jpg"]));
+}
+
+- (void)test___RSSImageURLStringsInString___returns_empty_array_without_images
+{
+  assertThat(RSSImageURLStringsInString(@"http://example.com/page.html"), equalTo(@[]));
+}
+
+#pragma mark - RSSItem - Tests
+
+- (void)test___imagesFromItemDescription___returns_itemDescriptionImages_if_set
+{
+  // given
+  RSSItem *item = [[RSSItem alloc] init];
+  item.itemDescription = @"<img src=\"http://example.com/a.jpg\">";
+  item.itemDescriptionImages = @[@"http://example.com/b.jpg"];
+  
+  // when
+  NSArray *images = [item imagesFromItemDescription];
+  
+  // then
+  assertThat(images, equalTo(@[@"http://example.com/b.jpg"]));
+}
+
+- (void)test___setItemDescription___resets_itemDescriptionImages
+{
+  // given
+  RSSItem *item = [[RSSItem alloc] init];
+  item.itemDescriptionImages = @[@"http://example.com/b.jpg"];
+  
+  // when
+  item.itemDescription = @"<img src=\"http://example.com/a.jpg\">";
+  
+  // then
+  assertThat(item.itemDescriptionImages, nilValue());
+  assertThat([item imagesFromItemDescription], equalTo(@[@"http://example.com/a.jpg"]));
+}
+
+#pragma mark - RSSChannel - Tests
+
+- (void)test___imagesFromItemDescriptions___returns_images_of_each_item_in_order
+{
+  // given
+  RSSChannel *channel = [[RSSChannel alloc] init];
+  NSMutableArray *items = [NSMutableArray array];
+  for (NSUInteger i = 0; i < 50; i++) {
+    RSSItem *item = [[RSSItem alloc] init];
+    if (i % 2 == 0) {
+      item.itemDescription = [NSString stringWithFormat:@"<img src=\"http://example.com/%lu.jpg\">", (unsigned long)i];
+    }
+    [items addObject:item];
+  }
+  channel.items = items;
+  
+  // when
+  NSArray *images = [channel imagesFromItemDescriptions];
+  
+  // then
+  assertThatUnsignedInteger(images.count, equalToUnsignedInteger(50));
+  assertThat(images[0], equalTo(@[@"http://example.com/0.jpg"]));
+  assertThat(images[1], equalTo(@[]));
+  assertThat(images[48], equalTo(@[@"http://example.com/48.jpg"]));
+}
+
+- (void)test___imagesFromItemDescriptions___returns_empty_array_without_items
+{
+  assertThat([[[RSSChannel alloc] init] imagesFromItemDescriptions], equalTo(@[]));
+}
+
+@end
@@ -0,0 +1,157 @@
+//
+//  RSSItemDedupIndexTests.m
+//  MediaRSSParser
+//
+
+// Test Class
+#import "RSSItemDedupIndex.h"
+
+// Collaborators
+#import "RSSItem.h"
+#import "RSSItemIdentity.h"
+
+// Test Support
+#import <XCTest/XCTest.h>
+
+#define HC_SHORTHAND
+#import <OCHamcrest/OCHamcrest.h>
+
+@interface RSSItemDedupIndexTests : XCTestCase
+@end
+
+@implementation RSSItemDedupIndexTests
+{
+  RSSItemDedupIndex *sut;
+}
+
+#pragma mark - Test Lifecycle
+
+- (void)setUp
+{
+  [super setUp];
+  sut = [[RSSItemDedupIndex alloc] init];
+}
+
+#pragma mark - Given
+
+- (RSSItem *)itemWithGuid:(NSString *)guid
+{
+  RSSItem *item = [[RSSItem alloc] init];
+  item.guid = guid;
+  return item;
+}
+
+#pragma mark - Init - Tests
+
+- (void)test___init___uses_default_shardCount
+{
+  assertThatUnsignedInteger(sut.shardCount, equalToUnsignedInteger(RSSItemDedupIndexDefaultShardCount));
+  assertThatUnsignedInteger(sut.count, equalToUnsignedInteger(0));
+}
+
+- (void)test___initWithShardCount___rounds_up_to_power_of_two
+{
+  assertThatUnsignedInteger([[RSSItemDedupIndex alloc] initWithShardCount:5].shardCount, equalToUnsignedInteger(8));
+  assertThatUnsignedInteger([[RSSItemDedupIndex alloc] initWithShardCount:0].shardCount, equalToUnsignedInteger(1));
+}
+
+#pragma mark - Adding Items - Tests
+
+- (void)test___addItem___returns_NO_for_duplicate_from_another_channel
+{
+  // given
+  RSSItem *item1 = [self itemWithGuid:@"guid"];
+  RSSItem *item2 = [self itemWithGuid:@"guid"];
+  item2.link = [NSURL URLWithString:@"http://www.example.com/other"];
+  
+  // then
+  XCTAssertTrue([sut addItem:item1]);
+  XCTAssertFalse([sut addItem:item2]);
+  XCTAssertTrue([sut containsItem:item2]);
+  assertThatUnsignedInteger(sut.count, equalToUnsignedInteger(1));
+}
+
+- (void)test___addItem___item_without_identity_is_always_added_but_not_stored
+{
+  // given
+  RSSItem *item = [[RSSItem alloc] init];
+  
+  // then
+  XCTAssertTrue([sut addItem:item]);
+  XCTAssertTrue([sut addItem:item]);
+  XCTAssertFalse([sut containsItem:item]);
+  assertThatUnsignedInteger(sut.count, equalToUnsignedInteger(0));
+}
+
+- (void)test___addItemsFromArray___returns_new_items_in_order
+{
+  // given
+  [sut addItem:[self itemWithGuid:@"b"]];
+  RSSItem *a = [self itemWithGuid:@"a"];
+  RSSItem *c = [self itemWithGuid:@"c"];
+  
+  // when
+  NSArray *newItems = [sut addItemsFromArray:@[a, [self itemWithGuid:@"b"], c, [self itemWithGuid:@"a"]]];
+  
+  // then
+  assertThat(newItems, contains(sameInstance(a), sameInstance(c), nil));
+  assertThatUnsignedInteger(sut.count, equalToUnsignedInteger(3));
+}
+
+- (void)test___addIdentityKey___grows_shards
+{
+  // given
+  sut = [[RSSItemDedupIndex alloc] initWithShardCount:1];
+  
+  // when
+  for (uint64_t key = 1; key <= 10000; key++) {
+    XCTAssertTrue([sut addIdentityKey:key]);
+  }
+  
+  // then
+  assertThatUnsignedInteger(sut.count, equalToUnsignedInteger(10000));
+  for (uint64_t key = 1; key <= 10000; key++) {
+    XCTAssertFalse([sut addIdentityKey:key]);
+  }
+  XCTAssertFalse([sut containsIdentityKey:10001]);
+}
+
+- (void)test___addIdentityKey___is_safe_from_many_threads
+{
+  // when
+  __block NSUInteger addedCount = 0;
+  NSObject *lock = [[NSObject alloc] init];
+  
+  dispatch_apply(8, dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0), ^(size_t thread) {
+    NSUInteger added = 0;
+    for (NSUInteger i = 0; i < 20000; i++) {
+      added += [sut addIdentityKey:RSSItemIdentityKey([NSString stringWithFormat:@"%lu", (unsigned long)i], nil)] ? 1 : 0;
+    }
+    @synchronized(lock) {
+      addedCount += added;
+    }
+  });
+  
+  // then
+  assertThatUnsignedInteger(addedCount, equalToUnsignedInteger(20000));
+  assertThatUnsignedInteger(sut.count, equalToUnsignedInteger(20000));
+}
+
+#pragma mark - Removing Items - Tests
+
+- (void)test___removeAllItems___empties_index
+{
+  // given
+  RSSItem *item = [self itemWithGuid:@"guid"];
+  [sut addItem:item];
+  
+  // when
+  [sut removeAllItems];
+  
+  // then
+  assertThatUnsignedInteger(sut.count, equalToUnsignedInteger(0));
+  XCTAssertFalse([sut containsItem:item]);
+  XCTAssertTrue([sut addItem:item]);
+}
+
+@end
@@ -0,0 +1,193 @@
+//
+//  RSSItemIdentityTests.m
+//  MediaRSSParser
+//
+
+// Test Class
+#import "RSSItemIdentity.h"
+
+// Collaborators
+#import "RSSItem.h"
+#import "RSSLazyItem.h"
+
+// Test Support
+#import <XCTest/XCTest.h>
+
+#define HC_SHORTHAND
+#import <OCHamcrest/OCHamcrest.h>
+
+@interface RSSItemIdentityTests : XCTestCase
+@end
+
+@implementation RSSItemIdentityTests
+
+#pragma mark - Given
+
+- (RSSItem *)itemWithGuid:(NSString *)guid link:(NSString *)link
+{
+  RSSItem *item = [[RSSItem alloc] init];
+  item.guid = guid;
+  item.link = link ? [NSURL URLWithString:link] : nil;
+  return item;
+}
+
+#pragma mark - RSSItemNormalizedLinkString - Tests
+
+- (void)test___RSSItemNormalizedLinkString___lowercases_scheme_and_host_only
+{
+  assertThat(RSSItemNormalizedLinkString([NSURL URLWithString:@"HTTP://WWW.Example.COM/Path/A?Query=B"]),
+             equalTo(@"http://www.example.com/Path/A?Query=B"));
+}
+
+- (void)test___RSSItemNormalizedLinkString___removes_default_port_and_fragment
+{
+  assertThat(RSSItemNormalizedLinkString([NSURL URLWithString:@"http://example.com:80/a#comments"]),
+             equalTo(@"http://example.com/a"));
+  assertThat(RSSItemNormalizedLinkString([NSURL URLWithString:@"https://example.com:443/a"]),
+             equalTo(@"https://example.com/a"));
+  assertThat(RSSItemNormalizedLinkString([NSURL URLWithString:@"https://example.com:8443/a"]),
+             equalTo(@"https://example.com:8443/a"));
+}
+
+- (void)test___RSSItemNormalizedLinkString___adds_empty_path
+{
+  assertThat(RSSItemNormalizedLinkString([NSURL URLWithString:@"http://example.com"]), equalTo(@"http://example.com/"));
+  assertThat(RSSItemNormalizedLinkString([NSURL URLWithString:@"http://example.com?a=1"]), equalTo(@"http://example.com/?a=1"));
+}
+
+- (void)test___RSSItemNormalizedLinkString___returns_nil_for_nil_link
+{
+  assertThat(RSSItemNormalizedLinkString(nil), nilValue());
+}
+
+#pragma mark - RSSItemIdentityKey - Tests
+
+- (void)test___RSSItemIdentityKey___returns_no_identity_without_guid_or_link
+{
+  XCTAssertEqual(RSSItemIdentityKey(nil, nil), RSSItemNoIdentityKey);
+  XCTAssertEqual(RSSItemIdentityKey(@"", nil), RSSItemNoIdentityKey);
+}
+
+- (void)test___RSSItemIdentityKey___prefers_guid_over_link
+{
+  // given
+  NSURL *link1 = [NSURL URLWithString:@"http://example.com/1"];
+  NSURL *link2 = [NSURL URLWithString:@"http://example.com/2"];
+  
+  // then
+  XCTAssertEqual(RSSItemIdentityKey(@"guid", link1), RSSItemIdentityKey(@"guid", link2));
+  XCTAssertNotEqual(RSSItemIdentityKey(@"guid", link1), RSSItemIdentityKey(nil, link1));
+}
+
+- (void)test___RSSItemIdentityKey___guid_and_link_keys_differ_for_same_string
+{
+  XCTAssertNotEqual(RSSItemIdentityKey(@"http://example.com/1", nil),
+                    RSSItemIdentityKey(nil, [NSURL URLWithString:@"http://example.com/1"]));
+}
+
+- (void)test___RSSItemIdentityKey___equal_for_equivalent_links
+{
+  XCTAssertEqual(RSSItemIdentityKey(nil, [NSURL URLWithString:@"HTTP://Example.com:80#top"]),
+                 RSSItemIdentityKey(nil, [NSURL URLWithString:@"http://example.com/"]));
+}
+
+- (void)test___RSSItemIdentityKey___is_stable
+{
+  // The key may be persisted, so it must never change between releases.
+  XCTAssertEqual(RSSItemIdentityKey(@"guid", nil), RSSItemIdentityKey([@"gu" stringByAppendingString:@"id"], nil));
+  XCTAssertEqual(RSSItemIdentityKey(@"café", nil), RSSItemIdentityKey([NSString stringWithUTF8String:"caf\xC3\xA9"], nil));
+}
+
+#pragma mark - RSSItem - Tests
+
+- (void)test___identityKey___is_recomputed_when_guid_or_link_is_set
+{
+  // given
+  RSSItem *item = [self itemWithGuid:nil link:@"http://example.com/1"];
+  uint64_t linkKey = item.identityKey;
+  
+  // when
+  item.guid = @"guid";
+  
+  // then
+  XCTAssertNotEqual(item.identityKey, linkKey);
+  XCTAssertEqual(item.identityKey, RSSItemIdentityKey(@"guid", nil));
+  
+  // when
+  item.guid = nil;
+  item.link = [NSURL URLWithString:@"http://example.com/2"];
+  
+  // then
+  XCTAssertEqual(item.identityKey, RSSItemIdentityKey(nil, item.link));
+}
+
+- (void)test___isEqual___items_with_same_guid_are_equal_regardless_of_link
+{
+  // given
+  RSSItem *item1 = [self itemWithGuid:@"guid" link:@"http://example.com/1"];
+  RSSItem *item2 = [self itemWithGuid:@"guid" link:@"http://example.com/2"];
+  
+  // then
+  assertThat(item1, equalTo(item2));
+  XCTAssertEqual([item1 hash], [item2 hash]);
+}
+
+- (void)test___isEqual___items_with_same_link_but_different_guids_are_not_equal
+{
+  // given
+  RSSItem *item1 = [self itemWithGuid:@"guid1" link:@"http://example.com/1"];
+  RSSItem *item2 = [self itemWithGuid:@"guid2" link:@"http://example.com/1"];
+  
+  // then
+  assertThat(item1, isNot(equalTo(item2)));
+}
+
+- (void)test___isEqual___items_without_guid_compare_normalized_links
+{
+  // given
+  RSSItem *item1 = [self itemWithGuid:nil link:@"http://Example.com/1#comments"];
+  RSSItem *item2 = [self itemWithGuid:nil link:@"http://example.com/1"];
+  
+  // then
+  assertThat(item1, equalTo(item2));
+}
+
+- (void)test___isEqual___item_without_identity_is_only_equal_to_itself
+{
+  // given
+  RSSItem *item1 = [[RSSItem alloc] init];
+  RSSItem *item2 = [[RSSItem alloc] init];
+  
+  // then
+  assertThat(item1, equalTo(item1));
+  assertThat(item1, isNot(equalTo(item2)));
+}
+
+- (void)test___hash___deduplicates_items_within_set
+{
+  // given
+  NSArray *items = @[[self itemWithGuid:@"a" link:nil], [self itemWithGuid:@"a" link:nil],
+                     [self itemWithGuid:nil link:@"http://example.com/b"], [self itemWithGuid:nil link:@"http://example.com:80/b"]];
+  
+  // when
+  NSSet *set = [NSSet setWithArray:items];
+  
+  // then
+  assertThatUnsignedInteger(set.count, equalToUnsignedInteger(2));
+}
+
+- (void)test___identityKey___lazy_item_decodes_guid_on_first_access
+{
+  // given
+  NSData *data = [@"<guid>guid</guid>" dataUsingEncoding:NSUTF8StringEncoding];
+  RSSLazyItem *item = [[RSSLazyItem alloc] initWithSourceData:data dateFormatter:nil];
+  [item setSourceRange:NSMakeRange(6, 4) forElementType:RSSElementTypeGuid];
+  
+  // when
+  uint64_t identityKey = item.identityKey;
+  
+  // then
+  XCTAssertEqual(identityKey, RSSItemIdentityKey(@"guid", nil));
+}
+
+@end
@@ -0,0 +1,154 @@
+//
+//  RSSLazyItemTests.m
+//  MediaRSSParser
+//
+
+// Test Class
+#import "RSSLazyItem.h"
+
+// Test Support
+#import <XCTest/XCTest.h>
+
+#define HC_SHORTHAND
+#import <OCHamcrest/OCHamcrest.h>
+
+@interface RSSLazyItemTests : XCTestCase
+@end
+
+@implementation RSSLazyItemTests
+{
+  RSSLazyItem *sut;
+  NSData *sourceData;
+}
+
+#pragma mark - Given
+
+- (void)givenSource:(NSString *)source
+{
+  sourceData = [source dataUsingEncoding:NSUTF8StringEncoding];
+  sut = [[RSSLazyItem alloc] initWithSourceData:sourceData dateFormatter:nil];
+}
+
+- (void)givenRangeOfContent:(NSString *)content forElementType:(RSSElementType)elementType
+{
+  NSString *source = [[NSString alloc] initWithData:sourceData encoding:NSUTF8StringEncoding];
+  NSRange range = [source rangeOfString:content];
+  NSUInteger location = [[source substringToIndex:range.location] lengthOfBytesUsingEncoding:NSUTF8StringEncoding];
+  NSUInteger length = [content lengthOfBytesUsingEncoding:NSUTF8StringEncoding];
+  
+  [sut setSourceRange:NSMakeRange(location, length) forElementType:elementType];
+}
+
+- (NSString *)textFromString:(NSString *)string
+{
+  NSData *data = [string dataUsingEncoding:NSUTF8StringEncoding];
+  return RSSXMLTextFromBytes(data.bytes, data.length);
+}
+
+#pragma mark - RSSXMLTextFromBytes - Tests
+
+- (void)test___RSSXMLTextFromBytes___returns_plain_text_unchanged
+{
+  assertThat([self textFromString:@"Item 1 Title"], equalTo(@"Item 1 Title"));
+}
+
+- (void)test___RSSXMLTextFromBytes___decodes_predefined_entities
+{
+  assertThat([self textFromString:@"&lt;b&gt;Q&amp;A&lt;/b&gt; &quot;x&quot; &apos;y&apos;"],
+             equalTo(@"<b>Q&A</b> \"x\" 'y'"));
+}
+
+- (void)test___RSSXMLTextFromBytes___decodes_character_references
+{
+  assertThat([self textFromString:@"&#38;&#x26;&#233;&#x20AC;&#x1F600;"], equalTo(@"&&é€\U0001F600"));
+}
+
+- (void)test___RSSXMLTextFromBytes___keeps_references_it_cannot_decode
+{
+  assertThat([self textFromString:@"&nbsp; &#0; &#xD800; & AT&T"], equalTo(@"&nbsp; &#0; &#xD800; & AT&T"));
+}
+
+- (void)test___RSSXMLTextFromBytes___drops_markup_but_keeps_nested_text
+{
+  assertThat([self textFromString:@"a<![CDATA[b]]>c<!-- d -->e<?pi f?>g<span title=\"<>\">h</span>"],
+             equalTo(@"acegh"));
+}
+
+- (void)test___RSSXMLTextFromBytes___normalizes_line_endings
+{
+  assertThat([self textFromString:@"a\r\nb\rc\nd"], equalTo(@"a\nb\nc\nd"));
+}
+
+#pragma mark - Decoding Fields - Tests
+
+- (void)test___title___decodes_range_on_first_access
+{
+  // given
+  [self givenSource:@"<item><title>Fish &amp; Chips</title></item>"];
+  [self givenRangeOfContent:@"Fish &amp; Chips" forElementType:RSSElementTypeTitle];
+  assertThatUnsignedInteger(sut.pendingFieldCount, equalToUnsignedInteger(1));
+  
+  // when
+  NSString *title = sut.title;
+  
+  // then
+  assertThat(title, equalTo(@"Fish & Chips"));
+  assertThatUnsignedInteger(sut.pendingFieldCount, equalToUnsignedInteger(0));
+  XCTAssertTrue(sut.title == title);
+}
+
+- (void)test___link_and_pubDate___decode_url_and_date
+{
+  // given
+  [self givenSource:@"<link>http://www.example.com/a?b=1&amp;c=2</link><pubDate>Tue, 10 Jun 2003 04:00:00 GMT</pubDate>"];
+  [self givenRangeOfContent:@"http://www.example.com/a?b=1&amp;c=2" forElementType:RSSElementTypeLink];
+  [self givenRangeOfContent:@"Tue, 10 Jun 2003 04:00:00 GMT" forElementType:RSSElementTypePubDate];
+  
+  // then
+  assertThat([sut.link absoluteString], equalTo(@"http://www.example.com/a?b=1&c=2"));
+  assertThat(sut.pubDate, equalTo([NSDate dateWithTimeIntervalSince1970:1055217600]));
+}
+
+- (void)test___setTitle___replaces_pending_range
+{
+  // given
+  [self givenSource:@"<title>Source Title</title>"];
+  [self givenRangeOfContent:@"Source Title" forElementType:RSSElementTypeTitle];
+  
+  // when
+  sut.title = @"New Title";
+  
+  // then
+  assertThat(sut.title, equalTo(@"New Title"));
+  assertThatUnsignedInteger(sut.pendingFieldCount, equalToUnsignedInteger(0));
+}
+
+- (void)test___setSourceRange_forElementType___ignores_empty_range_and_unsupported_types
+{
+  // given
+  [self givenSource:@"<title></title>"];
+  
+  // when
+  [sut setSourceRange:NSMakeRange(7, 0) forElementType:RSSElementTypeTitle];
+  [sut setSourceRange:NSMakeRange(0, 7) forElementType:RSSElementTypeMediaCredit];
+  
+  // then
+  assertThatUnsignedInteger(sut.pendingFieldCount, equalToUnsignedInteger(0));
+  assertThat(sut.title, nilValue());
+}
+
+- (void)test___encodeWithCoder___archives_decoded_RSSItem
+{
+  // given
+  [self givenSource:@"<guid>Item#0001</guid>"];
+  [self givenRangeOfContent:@"Item#0001" forElementType:RSSElementTypeGuid];
+  
+  // when
+  RSSItem *item = [NSKeyedUnarchiver unarchiveObjectWithData:[NSKeyedArchiver archivedDataWithRootObject:sut]];
+  
+  // then
+  assertThat([item class], equalTo([RSSItem class]));
+  assertThat(item.guid, equalTo(@"Item#0001"));
+}
+
+@end
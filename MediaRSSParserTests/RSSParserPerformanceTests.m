@@ -0,0 +1,1037 @@
+//
+//  RSSParserPerformanceTests.m
+//  MediaRSSParser
+//
+
+// Test Class
+#import "RSSParser_Protected.h"
+#import "RSSParser+LibXML.h"
+#import "RSSDateParsing.h"
+#import "RSSChannelSnapshot.h"
+#import "RSSItemDedupIndex.h"
+#import "RSSItemIdentity.h"
+#import "RSSHTMLEntities.h"
+#import "GTMNSString+HTML.h"
+#import "RSSHTMLPlainText.h"
+#import "RSSImageURLs.h"
+#import "NSString+HTMLReference.h"
+
+#import <XCTest/XCTest.h>
+
+static NSUInteger const RSSPerformanceItemRepeatCount = 2000;
+
+@interface RSSElementNameCollector : NSObject <NSXMLParserDelegate>
+@property (nonatomic, strong) NSMutableArray *elementNames;
+@end
+
+@implementation RSSElementNameCollector
+
+- (void)parser:(NSXMLParser *)parser didStartElement:(NSString *)elementName
+  namespaceURI:(NSString *)namespaceURI qualifiedName:(NSString *)qualifiedName
+    attributes:(NSDictionary *)attributeDict
+{
+  if (!self.elementNames) {
+    self.elementNames = [NSMutableArray array];
+  }
+  [self.elementNames addObject:elementName];
+}
+
+@end
+
+@interface RSSParserPerformanceTests : XCTestCase
+@end
+
+@implementation RSSParserPerformanceTests
+
+#pragma mark - Data
+
+- (NSString *)stringForResource:(NSString *)resource
+{
+  NSBundle *bundle = [NSBundle bundleForClass:[self class]];
+  NSString *path = [bundle pathForResource:resource ofType:@"xml"];
+  return [NSString stringWithContentsOfFile:path encoding:NSUTF8StringEncoding error:nil];
+}
+
+/**
+ *  Returns the given fixture with all of its `item` elements repeated `count` times, keeping the channel elements intact.
+ */
+- (NSData *)scaledDataForResource:(NSString *)resource itemRepeatCount:(NSUInteger)count
+{
+  NSString *document = [self stringForResource:resource];
+  
+  NSRange firstItem = [document rangeOfString:@"<item>"];
+  NSRange lastItem = [document rangeOfString:@"</item>" options:NSBackwardsSearch];
+  NSUInteger itemsEnd = NSMaxRange(lastItem);
+  NSString *items = [document substringWithRange:NSMakeRange(firstItem.location, itemsEnd - firstItem.location)];
+  
+  NSMutableString *scaled = [NSMutableString stringWithString:[document substringToIndex:firstItem.location]];
+  for (NSUInteger i = 0; i < count; i++) {
+    [scaled appendString:items];
+  }
+  [scaled appendString:[document substringFromIndex:itemsEnd]];
+  
+  return [scaled dataUsingEncoding:NSUTF8StringEncoding];
+}
+
+/**
+ *  Returns the element names of the given document, in document order, by running a bare `NSXMLParser` over it.
+ */
+- (NSArray *)elementNamesForData:(NSData *)data
+{
+  NSXMLParser *xmlParser = [[NSXMLParser alloc] initWithData:data];
+  RSSElementNameCollector *collector = [[RSSElementNameCollector alloc] init];
+  xmlParser.delegate = collector;
+  [xmlParser parse];
+  return collector.elementNames;
+}
+
+#pragma mark - Utilities
+
+- (void)parseData:(NSData *)data
+{
+  RSSParser *parser = [[RSSParser alloc] init];
+  [parser GETSucceeded:[[NSXMLParser alloc] initWithData:data]];
+}
+
+- (void)parseDataWithLibXML:(NSData *)data
+{
+  RSSParser *parser = [[RSSParser alloc] init];
+  [parser parseDataWithLibXML:data];
+}
+
+- (void)dispatchElementNames:(NSArray *)elementNames
+{
+  RSSParser *parser = [[RSSParser alloc] init];
+  [parser parserDidStartDocument:nil];
+  
+  for (NSString *elementName in elementNames) {
+    [parser parser:nil didStartElement:elementName namespaceURI:nil qualifiedName:nil attributes:nil];
+    [parser parser:nil didEndElement:elementName namespaceURI:nil qualifiedName:nil];
+  }
+}
+
+#pragma mark - Element Dispatch - Tests
+
+- (void)test___performance___element_dispatch_RSS_2
+{
+  NSData *data = [self scaledDataForResource:@"RSS_2_Example" itemRepeatCount:RSSPerformanceItemRepeatCount];
+  NSArray *elementNames = [self elementNamesForData:data];
+  
+  [self measureBlock:^{
+    [self dispatchElementNames:elementNames];
+  }];
+}
+
+- (void)test___performance___element_dispatch_Media_RSS
+{
+  NSData *data = [self scaledDataForResource:@"Media_RSS_Example" itemRepeatCount:RSSPerformanceItemRepeatCount];
+  NSArray *elementNames = [self elementNamesForData:data];
+  
+  [self measureBlock:^{
+    [self dispatchElementNames:elementNames];
+  }];
+}
+
+#pragma mark - Parse - Tests
+
+- (void)test___performance___parse_RSS_2
+{
+  NSData *data = [self scaledDataForResource:@"RSS_2_Example" itemRepeatCount:RSSPerformanceItemRepeatCount];
+  
+  [self measureBlock:^{
+    [self parseData:data];
+  }];
+}
+
+- (void)test___performance___parse_Media_RSS
+{
+  NSData *data = [self scaledDataForResource:@"Media_RSS_Example" itemRepeatCount:RSSPerformanceItemRepeatCount];
+  
+  [self measureBlock:^{
+    [self parseData:data];
+  }];
+}
+
+#pragma mark - Parse - Known Items - Tests
+
+/**
+ *  Returns a newest-first feed of `count` items, each with a unique `guid` of the form `item-<index>`.
+ */
+- (NSData *)feedDataWithItemCount:(NSUInteger)count
+{
+  NSMutableString *feed = [NSMutableString stringWithString:@"<rss version=\"2.0\"><channel><title>Polled Feed</title>"];
+  for (NSUInteger i = 0; i < count; i++) {
+    [feed appendFormat:@"<item><title>Item %lu</title><link>http://www.example.com/item-%lu</link>"
+     @"<description>Item %lu Description</description><guid>item-%lu</guid>"
+     @"<pubDate>Tue, 10 Jun 2003 02:00:00 GMT</pubDate></item>",
+     (unsigned long)i, (unsigned long)i, (unsigned long)i, (unsigned long)i];
+  }
+  [feed appendString:@"</channel></rss>"];
+  return [feed dataUsingEncoding:NSUTF8StringEncoding];
+}
+
+- (NSSet *)guidsFromIndex:(NSUInteger)start toIndex:(NSUInteger)end
+{
+  NSMutableSet *guids = [NSMutableSet set];
+  for (NSUInteger i = start; i < end; i++) {
+    [guids addObject:[NSString stringWithFormat:@"item-%lu", (unsigned long)i]];
+  }
+  return guids;
+}
+
+- (void)test___performance___poll_500_items_without_known_items
+{
+  NSData *data = [self feedDataWithItemCount:500];
+  
+  [self measureBlock:^{
+    [self parseData:data];
+  }];
+}
+
+- (void)test___performance___poll_500_items_with_3_new_items
+{
+  NSData *data = [self feedDataWithItemCount:500];
+  NSSet *knownItemKeys = [self guidsFromIndex:3 toIndex:500];
+  
+  [self measureBlock:^{
+    RSSParser *parser = [[RSSParser alloc] init];
+    parser.knownItemKeys = knownItemKeys;
+    parser.knownItemLimit = 5;
+    [parser GETSucceeded:[[NSXMLParser alloc] initWithData:data]];
+  }];
+}
+
+#pragma mark - Parse - LibXML Backend - Tests
+
+- (void)test___performance___parse_RSS_2_with_libXML
+{
+  NSData *data = [self scaledDataForResource:@"RSS_2_Example" itemRepeatCount:RSSPerformanceItemRepeatCount];
+  
+  [self measureBlock:^{
+    [self parseDataWithLibXML:data];
+  }];
+}
+
+- (void)test___performance___parse_Media_RSS_with_libXML
+{
+  NSData *data = [self scaledDataForResource:@"Media_RSS_Example" itemRepeatCount:RSSPerformanceItemRepeatCount];
+  
+  [self measureBlock:^{
+    [self parseDataWithLibXML:data];
+  }];
+}
+
+#pragma mark - Parse - Namespaces - Tests
+
+/**
+ *  Returns the scaled Media RSS fixture with the Media RSS namespace bound to the `m` prefix instead of `media`, so that its elements can only be matched by resolving their namespace.
+ */
+- (NSData *)remappedPrefixMediaRSSData
+{
+  NSData *data = [self scaledDataForResource:@"Media_RSS_Example" itemRepeatCount:RSSPerformanceItemRepeatCount];
+  NSMutableString *document = [[NSMutableString alloc] initWithData:data encoding:NSUTF8StringEncoding];
+  
+  NSDictionary *replacements = @{@"<rss ": @"<rss xmlns:m=\"http://search.yahoo.com/mrss/\" ",
+                                 @"<media:": @"<m:",
+                                 @"</media:": @"</m:"};
+  for (NSString *target in replacements) {
+    [document replaceOccurrencesOfString:target withString:replacements[target] options:NSLiteralSearch
+                                   range:NSMakeRange(0, document.length)];
+  }
+  return [document dataUsingEncoding:NSUTF8StringEncoding];
+}
+
+- (void)test___performance___parse_Media_RSS_with_remapped_prefix
+{
+  NSData *data = [self remappedPrefixMediaRSSData];
+  
+  [self measureBlock:^{
+    [self parseData:data];
+  }];
+}
+
+- (void)test___performance___parse_Media_RSS_with_libXML_with_remapped_prefix
+{
+  NSData *data = [self remappedPrefixMediaRSSData];
+  
+  [self measureBlock:^{
+    [self parseDataWithLibXML:data];
+  }];
+}
+
+#pragma mark - Parse - Lazy Item Fields - Tests
+
+- (void)parseDataWithLibXML:(NSData *)data lazily:(BOOL)lazily readingSummaryFields:(BOOL)readingSummaryFields
+{
+  RSSParser *parser = [[RSSParser alloc] init];
+  parser.decodesItemFieldsLazily = lazily;
+  [parser parseDataWithLibXML:data];
+  
+  if (readingSummaryFields) {
+    for (RSSItem *item in parser.channel.items) {
+      [item title];
+      [item link];
+      [item pubDate];
+    }
+  }
+}
+
+- (void)test___performance___parse_Media_RSS_with_libXML_reading_summary_fields
+{
+  NSData *data = [self scaledDataForResource:@"Media_RSS_Example" itemRepeatCount:RSSPerformanceItemRepeatCount];
+  
+  [self measureBlock:^{
+    [self parseDataWithLibXML:data lazily:NO readingSummaryFields:YES];
+  }];
+}
+
+- (void)test___performance___parse_Media_RSS_lazily_with_libXML_reading_summary_fields
+{
+  NSData *data = [self scaledDataForResource:@"Media_RSS_Example" itemRepeatCount:RSSPerformanceItemRepeatCount];
+  
+  [self measureBlock:^{
+    [self parseDataWithLibXML:data lazily:YES readingSummaryFields:YES];
+  }];
+}
+
+- (void)test___performance___parse_Media_RSS_lazily_with_libXML
+{
+  NSData *data = [self scaledDataForResource:@"Media_RSS_Example" itemRepeatCount:RSSPerformanceItemRepeatCount];
+  
+  [self measureBlock:^{
+    [self parseDataWithLibXML:data lazily:YES readingSummaryFields:NO];
+  }];
+}
+
+#pragma mark - Parse - Field Projection - Tests
+
+static RSSItemFields const RSSPerformanceProjectedItemFields = RSSItemFieldGuid | RSSItemFieldMediaContents;
+
+- (void)test___performance___parse_Media_RSS_projecting_guid_and_media_contents
+{
+  NSData *data = [self scaledDataForResource:@"Media_RSS_Example" itemRepeatCount:RSSPerformanceItemRepeatCount];
+  
+  [self measureBlock:^{
+    RSSParser *parser = [[RSSParser alloc] init];
+    parser.itemFields = RSSPerformanceProjectedItemFields;
+    [parser GETSucceeded:[[NSXMLParser alloc] initWithData:data]];
+  }];
+}
+
+- (void)test___performance___parse_Media_RSS_with_libXML_projecting_guid_and_media_contents
+{
+  NSData *data = [self scaledDataForResource:@"Media_RSS_Example" itemRepeatCount:RSSPerformanceItemRepeatCount];
+  
+  [self measureBlock:^{
+    RSSParser *parser = [[RSSParser alloc] init];
+    parser.itemFields = RSSPerformanceProjectedItemFields;
+    [parser parseDataWithLibXML:data];
+  }];
+}
+
+#pragma mark - Snapshot - Tests
+
+- (RSSChannel *)scaledMediaRSSChannel
+{
+  NSData *data = [self scaledDataForResource:@"Media_RSS_Example" itemRepeatCount:RSSPerformanceItemRepeatCount];
+  RSSParser *parser = [[RSSParser alloc] init];
+  [parser GETSucceeded:[[NSXMLParser alloc] initWithData:data]];
+  return parser.channel;
+}
+
+- (void)test___performance___snapshot_is_smaller_than_keyed_archive
+{
+  RSSChannel *channel = [self scaledMediaRSSChannel];
+  
+  NSData *archive = [NSKeyedArchiver archivedDataWithRootObject:channel];
+  NSData *snapshot = [RSSChannelSnapshot dataWithChannel:channel];
+  
+  NSLog(@"%lu items: keyed archive %lu bytes, snapshot %lu bytes", (unsigned long)channel.items.count,
+        (unsigned long)archive.length, (unsigned long)snapshot.length);
+  XCTAssertLessThan(snapshot.length, archive.length);
+}
+
+- (void)test___performance___open_keyed_archive_and_read_first_item
+{
+  NSData *archive = [NSKeyedArchiver archivedDataWithRootObject:[self scaledMediaRSSChannel]];
+  
+  [self measureBlock:^{
+    RSSChannel *channel = [NSKeyedUnarchiver unarchiveObjectWithData:archive];
+    [channel.items[0] title];
+  }];
+}
+
+- (void)test___performance___open_snapshot_and_read_first_item
+{
+  NSData *snapshot = [RSSChannelSnapshot dataWithChannel:[self scaledMediaRSSChannel]];
+  
+  [self measureBlock:^{
+    RSSChannel *channel = [RSSChannelSnapshot channelWithData:snapshot error:nil];
+    [channel.items[0] title];
+  }];
+}
+
+- (void)test___performance___snapshot_read_all_items
+{
+  NSData *snapshot = [RSSChannelSnapshot dataWithChannel:[self scaledMediaRSSChannel]];
+  
+  [self measureBlock:^{
+    RSSChannel *channel = [RSSChannelSnapshot channelWithData:snapshot error:nil];
+    for (RSSItem *item in channel.items) {
+      [item title];
+    }
+  }];
+}
+
+#pragma mark - HTML Entities - Tests
+
+- (NSString *)stringByRepeating:(NSString *)string toLength:(NSUInteger)length
+{
+  NSMutableString *repeated = [NSMutableString stringWithCapacity:length];
+  while (repeated.length < length) {
+    [repeated appendString:string];
+  }
+  return repeated;
+}
+
+- (void)test___performance___decode_1MB_of_amp_with_RSSStringByDecodingHTMLEntities
+{
+  NSString *html = [self stringByRepeating:@"&amp;" toLength:1024 * 1024];
+  
+  [self measureBlock:^{
+    RSSStringByDecodingHTMLEntities(html);
+  }];
+}
+
+- (void)test___performance___decode_64KB_of_amp_with_gtm_stringByUnescapingFromHTML
+{
+  // The GTM decoder is quadratic, so it's measured on a smaller input.
+  NSString *html = [self stringByRepeating:@"&amp;" toLength:64 * 1024];
+  
+  [self measureBlock:^{
+    [html gtm_stringByUnescapingFromHTML];
+  }];
+}
+
+- (void)test___performance___decode_1MB_of_mixed_references_with_RSSStringByDecodingHTMLEntities
+{
+  NSString *html = [self stringByRepeating:@"&lt;p&gt;Caf&eacute; &#x2014; &hellip;&#128512;&nbsp;" toLength:1024 * 1024];
+  
+  [self measureBlock:^{
+    RSSStringByDecodingHTMLEntities(html);
+  }];
+}
+
+#pragma mark - HTML Escaping - Tests
+
+- (NSString *)asciiHeavyText
+{
+  return [self stringByRepeating:@"The quick brown fox jumps over the lazy dog. It's \"fast\" & <free>. " toLength:1024 * 1024];
+}
+
+- (NSString *)cjkHeavyText
+{
+  return [self stringByRepeating:@"敏捷的棕色狐狸跳过了懒狗。这是「快速」和自由的内容，没有需要转义的字符。<b>" toLength:1024 * 1024];
+}
+
+- (void)test___performance___escape_1MB_of_ASCII_with_gtm_stringByEscapingForHTML
+{
+  NSString *text = [self asciiHeavyText];
+  
+  [self measureBlock:^{
+    [text gtm_stringByEscapingForHTML];
+  }];
+}
+
+- (void)test___performance___escape_1MB_of_ASCII_with_reference_gtm_stringByEscapingForHTML
+{
+  NSString *text = [self asciiHeavyText];
+  
+  [self measureBlock:^{
+    [text reference_gtm_stringByEscapingForHTML];
+  }];
+}
+
+- (void)test___performance___escape_1MB_of_ASCII_with_gtm_stringByEscapingForAsciiHTML
+{
+  NSString *text = [self asciiHeavyText];
+  
+  [self measureBlock:^{
+    [text gtm_stringByEscapingForAsciiHTML];
+  }];
+}
+
+- (void)test___performance___escape_1MB_of_ASCII_with_reference_gtm_stringByEscapingForAsciiHTML
+{
+  NSString *text = [self asciiHeavyText];
+  
+  [self measureBlock:^{
+    [text reference_gtm_stringByEscapingForAsciiHTML];
+  }];
+}
+
+- (void)test___performance___escape_1MB_of_CJK_with_gtm_stringByEscapingForHTML
+{
+  NSString *text = [self cjkHeavyText];
+  
+  [self measureBlock:^{
+    [text gtm_stringByEscapingForHTML];
+  }];
+}
+
+- (void)test___performance___escape_1MB_of_CJK_with_reference_gtm_stringByEscapingForHTML
+{
+  NSString *text = [self cjkHeavyText];
+  
+  [self measureBlock:^{
+    [text reference_gtm_stringByEscapingForHTML];
+  }];
+}
+
+- (void)test___performance___escape_1MB_of_CJK_with_gtm_stringByEscapingForAsciiHTML
+{
+  NSString *text = [self cjkHeavyText];
+  
+  [self measureBlock:^{
+    [text gtm_stringByEscapingForAsciiHTML];
+  }];
+}
+
+- (void)test___performance___escape_1MB_of_CJK_with_reference_gtm_stringByEscapingForAsciiHTML
+{
+  NSString *text = [self cjkHeavyText];
+  
+  [self measureBlock:^{
+    [text reference_gtm_stringByEscapingForAsciiHTML];
+  }];
+}
+
+#pragma mark - HTML To Plain Text - Tests
+
+- (NSString *)largeHTMLDescription
+{
+  NSString *paragraph = @"<p>Caf&eacute; <a href=\"http://example.com/story\">story</a> &mdash; "
+                        @"<strong>breaking</strong>\n\t<img src=\"http://example.com/a.jpg\" /><br/>"
+                        @"<!-- tracking --> more&hellip;</p>\n";
+  return [self stringByRepeating:paragraph toLength:256 * 1024];
+}
+
+- (void)test___performance___convert_HTML_to_plain_text_with_RSSStringByConvertingHTMLToPlainText
+{
+  NSString *html = [self largeHTMLDescription];
+  
+  [self measureBlock:^{
+    RSSStringByConvertingHTMLToPlainText(html);
+  }];
+}
+
+- (void)test___performance___convert_HTML_to_plain_text_with_reference_implementation
+{
+  NSString *html = [self largeHTMLDescription];
+  
+  [self measureBlock:^{
+    [html reference_stringByConvertingHTMLToPlainText];
+  }];
+}
+
+- (void)test___performance___strip_tags_with_RSSStringByStrippingTags
+{
+  NSString *html = [self largeHTMLDescription];
+  
+  [self measureBlock:^{
+    RSSStringByStrippingTags(html);
+  }];
+}
+
+- (void)test___performance___strip_tags_with_reference_implementation
+{
+  NSString *html = [self largeHTMLDescription];
+  
+  [self measureBlock:^{
+    [html reference_stringByStrippingTags];
+  }];
+}
+
+#pragma mark - Image URLs - Tests
+
+- (RSSChannel *)channelWithImageDescriptions
+{
+  NSMutableArray *items = [NSMutableArray array];
+  for (NSUInteger i = 0; i < RSSPerformanceItemRepeatCount; i++) {
+    RSSItem *item = [[RSSItem alloc] init];
+    item.itemDescription = [NSString stringWithFormat:@"<p>Story %lu <a href=\"http://example.com/%lu\">more</a></p>"
+                            @"<img src=\"http://example.com/images/%lu.jpg\" width=\"300\" /> <p>%@</p>",
+                            (unsigned long)i, (unsigned long)i, (unsigned long)i,
+                            [self stringByRepeating:@"Lorem ipsum dolor sit amet. " toLength:1024]];
+    [items addObject:item];
+  }
+  RSSChannel *channel = [[RSSChannel alloc] init];
+  channel.items = items;
+  return channel;
+}
+
+- (void)test___performance___images_from_item_descriptions_with_regular_expression
+{
+  NSArray *items = [self channelWithImageDescriptions].items;
+  
+  [self measureBlock:^{
+    for (RSSItem *item in items) {
+      NSRegularExpression *regex = [NSRegularExpression regularExpressionWithPattern:@"(https?)\\S*(png|jpg|jpeg|gif)"
+                                                                             options:NSRegularExpressionCaseInsensitive
+                                                                               error:nil];
+      [regex matchesInString:item.itemDescription options:0 range:NSMakeRange(0, item.itemDescription.length)];
+    }
+  }];
+}
+
+- (void)test___performance___images_from_item_descriptions_with_RSSImageURLStringsInString
+{
+  NSArray *items = [self channelWithImageDescriptions].items;
+  
+  [self measureBlock:^{
+    for (RSSItem *item in items) {
+      [item imagesFromItemDescription];
+    }
+  }];
+}
+
+- (void)test___performance___images_from_item_descriptions_of_channel
+{
+  RSSChannel *channel = [self channelWithImageDescriptions];
+  
+  [self measureBlock:^{
+    [channel imagesFromItemDescriptions];
+  }];
+}
+
+- (NSData *)feedDataWithImageDescriptions
+{
+  NSMutableString *feed = [NSMutableString stringWithString:@"<rss version=\"2.0\"><channel><title>Images</title>"];
+  for (NSUInteger i = 0; i < RSSPerformanceItemRepeatCount; i++) {
+    [feed appendFormat:@"<item><title>Item %lu</title><description><![CDATA[<p>Story %lu</p>"
+     @"<img src=\"http://example.com/images/%lu.jpg\" width=\"300\" />]]></description></item>",
+     (unsigned long)i, (unsigned long)i, (unsigned long)i];
+  }
+  [feed appendString:@"</channel></rss>"];
+  return [feed dataUsingEncoding:NSUTF8StringEncoding];
+}
+
+- (void)test___performance___parse_with_libXML_then_read_images_from_item_descriptions
+{
+  NSData *data = [self feedDataWithImageDescriptions];
+  
+  [self measureBlock:^{
+    RSSParser *parser = [[RSSParser alloc] init];
+    [parser parseDataWithLibXML:data];
+    for (RSSItem *item in parser.channel.items) {
+      [item imagesFromItemDescription];
+    }
+  }];
+}
+
+- (void)test___performance___parse_with_libXML_extracting_images_from_item_descriptions
+{
+  NSData *data = [self feedDataWithImageDescriptions];
+  
+  [self measureBlock:^{
+    RSSParser *parser = [[RSSParser alloc] init];
+    parser.extractsImagesFromItemDescriptions = YES;
+    [parser parseDataWithLibXML:data];
+    for (RSSItem *item in parser.channel.items) {
+      [item imagesFromItemDescription];
+    }
+  }];
+}
+
+#pragma mark - Date Parsing - Tests
+
+- (NSArray *)dateStrings
+{
+  NSMutableArray *dateStrings = [NSMutableArray array];
+  for (NSUInteger i = 0; i < 10000; i++) {
+    [dateStrings addObject:[NSString stringWithFormat:@"Tue, %02lu Jun 2003 %02lu:%02lu:00 GMT",
+                            (unsigned long)(i % 28 + 1), (unsigned long)(i % 24), (unsigned long)(i % 60)]];
+  }
+  return dateStrings;
+}
+
+- (void)test___performance___dates_with_RSSDateFromString
+{
+  NSArray *dateStrings = [self dateStrings];
+  
+  [self measureBlock:^{
+    for (NSString *dateString in dateStrings) {
+      RSSDateFromString(dateString);
+    }
+  }];
+}
+
+- (void)test___performance___dates_with_NSDateFormatter
+{
+  NSArray *dateStrings = [self dateStrings];
+  RSSParser *parser = [[RSSParser alloc] init];
+  
+  [self measureBlock:^{
+    for (NSString *dateString in dateStrings) {
+      [parser.dateFormatter dateFromString:dateString];
+    }
+  }];
+}
+
+
+#pragma mark - Media Attributes - Tests
+
+// Each decode maps 14 attributes, so the per-attribute cost is the measured time over `14 * RSSPerformanceAttributeDecodeCount`.
+static NSUInteger const RSSPerformanceAttributeDecodeCount = 100000;
+
+- (NSDictionary *)mediaContentAttributes
+{
+  return @{ @"url" : @"http://www.foo.com/movie.mov",
+            @"fileSize" : @"12216320",
+            @"type" : @"video/quicktime",
+            @"medium" : @"video",
+            @"isDefault" : @"true",
+            @"expression" : @"full",
+            @"bitrate" : @"128",
+            @"framerate" : @"25",
+            @"samplingrate" : @"44.1",
+            @"channels" : @"2",
+            @"duration" : @"185",
+            @"height" : @"200",
+            @"width" : @"300",
+            @"lang" : @"en" };
+}
+
+// The hand-written decoding that the attribute descriptor tables replaced.
+static RSSMediaContent *RSSReferenceMediaContentFromAttributes(NSDictionary *attributes)
+{
+  RSSMediaContent *mediaContent = [[RSSMediaContent alloc] init];
+  mediaContent.fileSize = [attributes[@"fileSize"] integerValue];
+  mediaContent.type = attributes[@"type"];
+  mediaContent.medium = attributes[@"medium"];
+  mediaContent.isDefault = [attributes[@"isDefault"] boolValue];
+  mediaContent.expression = attributes[@"expression"];
+  mediaContent.bitrate = [attributes[@"bitrate"] integerValue];
+  mediaContent.framerate = [attributes[@"framerate"] integerValue];
+  mediaContent.samplingRate = [attributes[@"samplingrate"] floatValue];
+  mediaContent.channels = [attributes[@"channels"] integerValue];
+  mediaContent.duration = [attributes[@"duration"] integerValue];
+  mediaContent.url = [NSURL URLWithString:attributes[@"url"]];
+  mediaContent.size = CGSizeMake([attributes[@"width"] floatValue], [attributes[@"height"] floatValue]);
+  mediaContent.language = attributes[@"lang"];
+  return mediaContent;
+}
+
+- (void)test___performance___decode_media_content_attributes_with_reference_implementation
+{
+  NSDictionary *attributes = [self mediaContentAttributes];
+  
+  [self measureBlock:^{
+    for (NSUInteger i = 0; i < RSSPerformanceAttributeDecodeCount; i++) {
+      RSSReferenceMediaContentFromAttributes(attributes);
+    }
+  }];
+}
+
+- (void)test___performance___decode_media_content_attributes_with_RSSMediaObjectWithAttributes
+{
+  NSDictionary *attributes = [self mediaContentAttributes];
+  
+  [self measureBlock:^{
+    for (NSUInteger i = 0; i < RSSPerformanceAttributeDecodeCount; i++) {
+      RSSMediaObjectWithAttributes(RSSElementTypeMediaContent, nil, attributes, nil);
+    }
+  }];
+}
+
+- (void)test___performance___decode_media_content_attributes_with_RSSMediaAttributeDecoderSetBytes
+{
+  NSDictionary *attributes = [self mediaContentAttributes];
+  NSArray *names = [attributes allKeys];
+  NSUInteger count = names.count;
+  const char **nameBytes = calloc(count, sizeof(const char *));
+  const char **valueBytes = calloc(count, sizeof(const char *));
+  for (NSUInteger i = 0; i < count; i++) {
+    nameBytes[i] = [names[i] UTF8String];
+    valueBytes[i] = [attributes[names[i]] UTF8String];
+  }
+  
+  [self measureBlock:^{
+    for (NSUInteger i = 0; i < RSSPerformanceAttributeDecodeCount; i++) {
+      RSSMediaAttributeDecoder decoder = RSSMediaAttributeDecoderBegin(RSSElementTypeMediaContent, nil, nil);
+      for (NSUInteger j = 0; j < count; j++) {
+        RSSMediaAttributeDecoderSetBytes(&decoder, nameBytes[j], strlen(nameBytes[j]),
+                                         valueBytes[j], strlen(valueBytes[j]));
+      }
+      RSSMediaAttributeDecoderEnd(&decoder);
+    }
+  }];
+  
+  free(nameBytes);
+  free(valueBytes);
+}
+
+
+#pragma mark - String Pool - Tests
+
+- (void)test___performance___decode_media_content_attributes_with_RSSMediaObjectWithAttributes_interning_tokens
+{
+  NSDictionary *attributes = [self mediaContentAttributes];
+  RSSStringPool *stringPool = [[RSSStringPool alloc] init];
+  
+  [self measureBlock:^{
+    for (NSUInteger i = 0; i < RSSPerformanceAttributeDecodeCount; i++) {
+      RSSMediaObjectWithAttributes(RSSElementTypeMediaContent, nil, attributes, stringPool);
+    }
+  }];
+}
+
+- (void)test___performance___parse_Media_RSS_with_libXML_without_string_pool
+{
+  NSData *data = [self scaledDataForResource:@"Media_RSS_Example" itemRepeatCount:RSSPerformanceItemRepeatCount];
+  
+  [self measureBlock:^{
+    RSSParser *parser = [[RSSParser alloc] init];
+    parser.stringPoolCountLimit = 0;
+    [parser parseDataWithLibXML:data];
+  }];
+}
+
+#pragma mark - Columnar Channel - Tests
+
+static NSUInteger const RSSPerformanceColumnarItemCount = 1000000;
+
+// One item per minute, each with one media content, so a day's range selects 1,440 items.
+- (RSSChannel *)millionItemChannel
+{
+  NSMutableArray *items = [[NSMutableArray alloc] initWithCapacity:RSSPerformanceColumnarItemCount];
+  NSArray *media = @[@"video", @"audio", @"image"];
+  
+  for (NSUInteger i = 0; i < RSSPerformanceColumnarItemCount; i++) {
+    RSSMediaContent *content = [[RSSMediaContent alloc] init];
+    content.medium = media[i % media.count];
+    content.duration = (NSInteger)(i % 3600);
+    content.bitrate = (NSInteger)(i % 5000);
+    
+    RSSItem *item = [[RSSItem alloc] init];
+    item.pubDate = [NSDate dateWithTimeIntervalSinceReferenceDate:i * 60.0];
+    item.mediaContents = @[content];
+    [items addObject:item];
+  }
+  
+  RSSChannel *channel = [[RSSChannel alloc] init];
+  channel.items = items;
+  return channel;
+}
+
+- (NSDate *)columnarRangeStartDate
+{
+  return [NSDate dateWithTimeIntervalSinceReferenceDate:RSSPerformanceColumnarItemCount * 30.0];
+}
+
+- (NSDate *)columnarRangeEndDate
+{
+  return [NSDate dateWithTimeIntervalSinceReferenceDate:RSSPerformanceColumnarItemCount * 30.0 + 86400.0];
+}
+
+- (void)test___performance___filter_1M_items_by_date_range_with_object_graph
+{
+  NSArray *items = [self millionItemChannel].items;
+  NSDate *startDate = [self columnarRangeStartDate];
+  NSDate *endDate = [self columnarRangeEndDate];
+  
+  [self measureBlock:^{
+    NSIndexSet *indexes = [items indexesOfObjectsPassingTest:^BOOL(RSSItem *item, NSUInteger index, BOOL *stop) {
+      NSDate *date = item.pubDate;
+      return date && [date compare:startDate] != NSOrderedAscending && [date compare:endDate] != NSOrderedDescending;
+    }];
+    XCTAssertEqual(indexes.count, (NSUInteger)1441);
+  }];
+}
+
+- (void)test___performance___filter_1M_items_by_date_range_with_RSSColumnarChannel
+{
+  RSSColumnarChannel *columns = [[RSSColumnarChannel alloc] initWithChannel:[self millionItemChannel]];
+  NSDate *startDate = [self columnarRangeStartDate];
+  NSDate *endDate = [self columnarRangeEndDate];
+  
+  [self measureBlock:^{
+    NSIndexSet *indexes = [columns indexesOfItemsPublishedFrom:startDate to:endDate];
+    XCTAssertEqual(indexes.count, (NSUInteger)1441);
+  }];
+}
+
+- (void)test___performance___count_1M_items_by_medium_and_duration_with_object_graph
+{
+  NSArray *items = [self millionItemChannel].items;
+  
+  [self measureBlock:^{
+    NSUInteger count = 0;
+    for (RSSItem *item in items) {
+      RSSMediaContent *content = [item.mediaContents firstObject];
+      if ([content.medium isEqualToString:@"video"] && content.duration >= 60 && content.duration <= 300) {
+        count += 1;
+      }
+    }
+    XCTAssertGreaterThan(count, (NSUInteger)0);
+  }];
+}
+
+- (void)test___performance___count_1M_items_by_medium_and_duration_with_RSSColumnarChannel
+{
+  RSSColumnarChannel *columns = [[RSSColumnarChannel alloc] initWithChannel:[self millionItemChannel]];
+  
+  [self measureBlock:^{
+    const uint32_t *media = [columns stringIdentifiersForColumn:RSSColumnarChannelStringColumnMedium];
+    const int64_t *durations = columns.durations;
+    uint32_t video = [columns identifierOfString:@"video"];
+    
+    NSUInteger count = 0;
+    for (NSUInteger i = 0; i < columns.count; i++) {
+      count += (NSUInteger)((media[i] == video) & (durations[i] >= 60) & (durations[i] <= 300));
+    }
+    XCTAssertGreaterThan(count, (NSUInteger)0);
+  }];
+}
+
+- (void)test___performance___sort_1M_items_by_bitrate_with_object_graph
+{
+  NSArray *items = [self millionItemChannel].items;
+  
+  [self measureBlock:^{
+    [items sortedArrayWithOptions:NSSortStable usingComparator:^NSComparisonResult(RSSItem *item1, RSSItem *item2) {
+      NSInteger bitrate1 = [[item1.mediaContents firstObject] bitrate];
+      NSInteger bitrate2 = [[item2.mediaContents firstObject] bitrate];
+      return bitrate1 > bitrate2 ? NSOrderedAscending : bitrate1 < bitrate2 ? NSOrderedDescending : NSOrderedSame;
+    }];
+  }];
+}
+
+- (void)test___performance___sort_1M_items_by_bitrate_with_RSSColumnarChannel
+{
+  RSSColumnarChannel *columns = [[RSSColumnarChannel alloc] initWithChannel:[self millionItemChannel]];
+  uint32_t *indexes = malloc(columns.count * sizeof(uint32_t));
+  
+  [self measureBlock:^{
+    [columns getIndexes:indexes sortedByColumn:RSSColumnarChannelColumnBitrate ascending:NO];
+  }];
+  
+  free(indexes);
+}
+
+- (void)test___performance___parse_Media_RSS_with_libXML_into_RSSColumnarChannel
+{
+  NSData *data = [self scaledDataForResource:@"Media_RSS_Example" itemRepeatCount:RSSPerformanceItemRepeatCount];
+  
+  [self measureBlock:^{
+    RSSParser *parser = [[RSSParser alloc] init];
+    parser.parseContext = [[RSSParseContext alloc] init];
+    parser.parseContext.columnarChannel = [[RSSColumnarChannel alloc] init];
+    [parser parseDataWithLibXML:data];
+  }];
+}
+
+#pragma mark - Item Identity - Tests
+
+static NSUInteger const RSSPerformanceDedupItemCount = 1000000;
+
+// Half of the items have a guid and half only a link, so both ways of computing identity keys are measured.
+- (NSArray *)millionItemsWithIdentities
+{
+  NSMutableArray *items = [[NSMutableArray alloc] initWithCapacity:RSSPerformanceDedupItemCount];
+  
+  for (NSUInteger i = 0; i < RSSPerformanceDedupItemCount; i++) {
+    RSSItem *item = [[RSSItem alloc] init];
+    if (i % 2 == 0) {
+      item.guid = [NSString stringWithFormat:@"tag:example.com,2014:item-%lu", (unsigned long)i];
+    } else {
+      item.link = [NSURL URLWithString:[NSString stringWithFormat:@"http://www.example.com/items/%lu.html", (unsigned long)i]];
+    }
+    [items addObject:item];
+  }
+  return items;
+}
+
+- (void)test___performance___compute_1M_identity_keys
+{
+  NSArray *items = [self millionItemsWithIdentities];
+  
+  [self measureBlock:^{
+    for (RSSItem *item in items) {
+      RSSItemIdentityKey(item.guid, item.link);
+    }
+  }];
+}
+
+- (void)test___performance___insert_1M_items_into_NSMutableSet
+{
+  NSArray *items = [self millionItemsWithIdentities];
+  
+  [self measureBlock:^{
+    NSMutableSet *set = [[NSMutableSet alloc] initWithCapacity:items.count];
+    for (RSSItem *item in items) {
+      [set addObject:item];
+    }
+    XCTAssertEqual(set.count, items.count);
+  }];
+}
+
+- (void)test___performance___insert_1M_items_into_RSSItemDedupIndex
+{
+  NSArray *items = [self millionItemsWithIdentities];
+  
+  [self measureBlock:^{
+    RSSItemDedupIndex *index = [[RSSItemDedupIndex alloc] init];
+    for (RSSItem *item in items) {
+      [index addItem:item];
+    }
+    XCTAssertEqual(index.count, items.count);
+  }];
+}
+
+- (void)test___performance___insert_1M_items_into_RSSItemDedupIndex_from_8_threads
+{
+  NSArray *items = [self millionItemsWithIdentities];
+  NSUInteger stride = items.count / 8;
+  
+  [self measureBlock:^{
+    RSSItemDedupIndex *index = [[RSSItemDedupIndex alloc] init];
+    dispatch_apply(8, dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0), ^(size_t thread) {
+      for (NSUInteger i = thread * stride; i < (thread + 1) * stride; i++) {
+        [index addItem:items[i]];
+      }
+    });
+    XCTAssertEqual(index.count, items.count);
+  }];
+}
+
+- (void)test___performance___look_up_1M_items_in_NSSet
+{
+  NSArray *items = [self millionItemsWithIdentities];
+  NSSet *set = [NSSet setWithArray:items];
+  
+  [self measureBlock:^{
+    NSUInteger count = 0;
+    for (RSSItem *item in items) {
+      count += [set containsObject:item] ? 1 : 0;
+    }
+    XCTAssertEqual(count, items.count);
+  }];
+}
+
+- (void)test___performance___look_up_1M_items_in_RSSItemDedupIndex
+{
+  NSArray *items = [self millionItemsWithIdentities];
+  RSSItemDedupIndex *index = [[RSSItemDedupIndex alloc] init];
+  [index addItemsFromArray:items];
+  
+  [self measureBlock:^{
+    NSUInteger count = 0;
+    for (RSSItem *item in items) {
+      count += [index containsItem:item] ? 1 : 0;
+    }
+    XCTAssertEqual(count, items.count);
+  }];
+}
+
+@end
@@ -9,6 +9,7 @@
 // Test Class
 #import "Test_RSSParser.h"
 #import "RSSParser_Protected.h"
+#import "RSSParser+LibXML.h"
 
 // Collaborators
 #import <AFNetworking/AFHTTPSessionManager.h>
@@ -16,6 +17,10 @@
 // Test Support
 #import <AOTestCase/AOTestCase.h>
 #import "RSSParser+TestMethods.h"
+#import "RSSStubHTTPProtocol.h"
+#import "RSSMemoryFeedCache.h"
+#import "RSSLazyItem.h"
+#import "RSSItemDedupIndex.h"
 
 #import <objc/runtime.h>
 
@@ -67,6 +72,37 @@ const char RSSParserFailBlockKey;
   return [tasks copy];
 }
 
+- (void)givenStubbedClient
+{
+  [RSSStubHTTPProtocol reset];
+  
+  NSURLSessionConfiguration *configuration = [NSURLSessionConfiguration defaultSessionConfiguration];
+  configuration.protocolClasses = @[[RSSStubHTTPProtocol class]];
+  
+  AFHTTPResponseSerializer *responseSerializer = sut.client.responseSerializer;
+  sut.client = [[AFHTTPSessionManager alloc] initWithSessionConfiguration:configuration];
+  sut.client.responseSerializer = responseSerializer;
+}
+
+- (RSSParseContext *)givenParseContext
+{
+  RSSParseContext *context = [[RSSParseContext alloc] init];
+  context.generation = sut.parseGeneration;
+  sut.parseContext = context;
+  return context;
+}
+
+- (RSSChannel *)givenFeedCacheEntryForURL:(NSURL *)url
+{
+  RSSFeedCacheEntry *entry = [[RSSFeedCacheEntry alloc] init];
+  entry.etag = @"\"v1\"";
+  entry.lastModified = @"Sat, 07 Sep 2002 09:42:31 GMT";
+  entry.channel = [[RSSChannel alloc] init];
+  
+  [sut.feedCache storeEntry:entry forURL:url];
+  return entry.channel;
+}
+
 #pragma mark - When
 
 - (NSXMLParser *)whenGETSucceeded
@@ -80,6 +116,15 @@ const char RSSParserFailBlockKey;
   return mockXMLParser;
 }
 
+- (void)whenMockClientGETSucceeded
+{
+  MKTArgumentCaptor *success = [[MKTArgumentCaptor alloc] init];
+  [verify(sut.client) GET:anything() parameters:anything() success:[success capture] failure:anything()];
+  
+  void (^successBlock)(NSURLSessionDataTask *, id) = [success value];
+  successBlock(nil, mock([NSXMLParser class]));
+}
+
 #pragma mark - Data
 
 - (NSString *)fileURLPathForRSS2Example
@@ -96,16 +141,16 @@ const char RSSParserFailBlockKey;
   return [url absoluteString];
 }
 
-#pragma mark - Verify
-
-- (void)verifySuccessBlockSetAsNil
+- (NSString *)filePathForRSS2Example
 {
-  [verify(sut.parserCopyMock) setSuccessBlock:nil];
+  NSBundle *bundle = [NSBundle bundleForClass:[self class]];
+  return [bundle pathForResource:@"RSS_2_Example" ofType:@"xml"];
 }
 
-- (void)verifyFailBlockSetAsNil
+- (NSString *)filePathForMediaRSSExample
 {
-  [verify(sut.parserCopyMock) setFailblock:nil];
+  NSBundle *bundle = [NSBundle bundleForClass:[self class]];
+  return [bundle pathForResource:@"Media_RSS_Example" ofType:@"xml"];
 }
 
 #pragma mark - Utilities
@@ -137,18 +182,144 @@ const char RSSParserFailBlockKey;
   XCTAssertTrue([set containsObject:@"application/atom+xml"]);
 }
 
+#pragma mark - Backend - Tests
+
+- (void)test___init___sets_backend_to_NSXMLParser
+{
+  XCTAssertEqual(sut.backend, RSSParserBackendNSXMLParser);
+}
+
+- (void)test___setBackend___libXML_sets_client_data_responseSerializer
+{
+  // when
+  sut.backend = RSSParserBackendLibXML;
+  
+  // then
+  XCTAssertFalse([sut.client.responseSerializer isKindOfClass:[AFXMLParserResponseSerializer class]]);
+  XCTAssertTrue([sut.client.responseSerializer.acceptableContentTypes containsObject:@"application/rss+xml"]);
+}
+
+- (void)test___setBackend___NSXMLParser_restores_client_xmlParser_responseSerializer
+{
+  // given
+  sut.backend = RSSParserBackendLibXML;
+  
+  // when
+  sut.backend = RSSParserBackendNSXMLParser;
+  
+  // then
+  XCTAssertTrue([sut.client.responseSerializer isKindOfClass:[AFXMLParserResponseSerializer class]]);
+  XCTAssertTrue([sut.client.responseSerializer.acceptableContentTypes containsObject:@"application/rss+xml"]);
+}
+
+#pragma mark - Threading - Tests
+
+- (void)test___init___sets_client_completionQueue_to_parseQueue
+{
+  assertThat(sut.parseQueue, notNilValue());
+  assertThat(sut.client.completionQueue, sameInstance(sut.parseQueue));
+}
+
+- (void)test___setClient___sets_client_completionQueue_to_parseQueue
+{
+  // given
+  AFHTTPSessionManager *client = [[AFHTTPSessionManager alloc] init];
+  
+  // when
+  sut.client = client;
+  
+  // then
+  assertThat(client.completionQueue, sameInstance(sut.parseQueue));
+}
+
+- (void)test___parseRSSData_success_failure___parses_on_parseQueue
+{
+  [self beginAsynchronousOperation];
+  
+  // given
+  static char parseQueueKey;
+  dispatch_queue_set_specific(sut.parseQueue, &parseQueueKey, &parseQueueKey, NULL);
+  
+  __block BOOL startedDocumentOnParseQueue = NO;
+  sut.didStartDocumentBlock = ^{
+    startedDocumentOnParseQueue = (dispatch_get_specific(&parseQueueKey) == &parseQueueKey);
+  };
+  
+  NSData *data = [NSData dataWithContentsOfFile:[self filePathForRSS2Example]];
+  
+  // when
+  [sut parseRSSData:data success:^(RSSChannel *channel) {
+    
+    // then
+    XCTAssertTrue(startedDocumentOnParseQueue);
+    [self endAsynchronousOperation];
+    
+  } failure:^(NSError *error) {
+    XCTAssertTrue(NO, @"Error:%@", error);
+    [self endAsynchronousOperation];
+  }];
+  
+  [self waitForAsyncronousOperation];
+}
+
+- (void)test___parseRSSData_success_failure___calls_success_on_callbackQueue
+{
+  [self beginAsynchronousOperation];
+  
+  // given
+  dispatch_queue_t callbackQueue = dispatch_queue_create("RSSParserTests.callback", DISPATCH_QUEUE_SERIAL);
+  static char callbackQueueKey;
+  dispatch_queue_set_specific(callbackQueue, &callbackQueueKey, &callbackQueueKey, NULL);
+  sut.callbackQueue = callbackQueue;
+  
+  NSData *data = [NSData dataWithContentsOfFile:[self filePathForRSS2Example]];
+  
+  // when
+  [sut parseRSSData:data success:^(RSSChannel *channel) {
+    
+    // then
+    XCTAssertTrue(dispatch_get_specific(&callbackQueueKey) == &callbackQueueKey);
+    [self endAsynchronousOperation];
+    
+  } failure:^(NSError *error) {
+    XCTAssertTrue(NO, @"Error:%@", error);
+    [self endAsynchronousOperation];
+  }];
+  
+  [self waitForAsyncronousOperation];
+}
+
 #pragma mark - Cancel - Tests
 
 - (void)test___cancel___aborts_parsing
 {
   // given
-  sut.xmlParser = mock([NSXMLParser class]);
+  NSXMLParser *mockParser = mock([NSXMLParser class]);
+  
+  // when
+  [sut cancel];
+  [sut parser:mockParser didStartElement:@"item" namespaceURI:nil qualifiedName:nil attributes:nil];
+  
+  // then
+  [verify(mockParser) abortParsing];
+  assertThat(sut.currentItem, nilValue());
+}
+
+- (void)test___cancel___drops_dispatched_callbacks
+{
+  // given
+  __block BOOL called = NO;
+  [self givenParseContext].failblock = ^(NSError *error) {
+    called = YES;
+  };
+  [sut failWithError:nil];
   
   // when
   [sut cancel];
   
   // then
-  [verify(sut.xmlParser) abortParsing];
+  [[NSRunLoop currentRunLoop] runUntilDate:[NSDate dateWithTimeIntervalSinceNow:0.1]];
+  XCTAssertFalse(called);
 }
 
 - (void)test___cancel___cancels_all_tasks
@@ -167,22 +338,34 @@ const char RSSParserFailBlockKey;
   }
 }
 
-- (void)test___cancel___nils_success_block
+- (void)test___cancel___does_not_change_parseContext
 {
+  // given
+  void (^failure)(NSError *) = ^(NSError *error) { };
+  RSSParseContext *context = [self givenParseContext];
+  context.failblock = failure;
+  
   // when
   [sut cancel];
   
   // then
-  [self verifySuccessBlockSetAsNil];
+  assertThat(sut.parseContext, sameInstance(context));
+  assertThat(context.failblock, equalTo(failure));
 }
 
-- (void)test___cancel___nils_failure_block
+- (void)test___parseRSSData_success_failure___does_not_change_blocks_of_running_parse
 {
+  // given
+  void (^success)(RSSChannel *) = ^(RSSChannel *channel) { };
+  [self givenParseContext].successBlock = success;
+  dispatch_suspend(sut.parseQueue);
+  
   // when
-  [sut cancel];
+  [sut parseRSSData:[NSData data] success:^(RSSChannel *channel) { } failure:nil];
   
   // then
-  [self verifyFailBlockSetAsNil];
+  assertThat(sut.parseContext.successBlock, equalTo(success));
+  dispatch_resume(sut.parseQueue);
 }
 
 #pragma mark - Class Method - Parse - Tests
@@ -240,12 +423,14 @@ const char RSSParserFailBlockKey;
 {
   // given
   void (^success)(RSSChannel *) = ^(RSSChannel *channel) { };
+  [self givenMockClientNumberOfTasks:0];
   
   // when
   [sut parseRSSFeed:@"" parameters:nil success:success failure:nil];
+  [self whenMockClientGETSucceeded];
   
   // then
-  assertThat(sut.successBlock, equalTo(success));
+  assertThat(sut.parseContext.successBlock, equalTo(success));
   
   // clean up
   [sut cancel];
@@ -255,12 +440,31 @@ const char RSSParserFailBlockKey;
 {
   // given
   void (^failure)(NSError *) = ^(NSError *error) { };
+  [self givenMockClientNumberOfTasks:0];
   
   // when
   [sut parseRSSFeed:@"" parameters:nil success:nil failure:failure];
+  [self whenMockClientGETSucceeded];
+  
+  // then
+  assertThat(sut.parseContext.failblock, equalTo(failure));
+  
+  // clean up
+  [sut cancel];
+}
+
+- (void)test___parseRSSFeed_paramemters_itemHandler_success_failure___sets_item_block
+{
+  // given
+  void (^itemHandler)(RSSItem *) = ^(RSSItem *item) { };
+  [self givenMockClientNumberOfTasks:0];
+  
+  // when
+  [sut parseRSSFeed:@"" parameters:nil itemHandler:itemHandler success:nil failure:nil];
+  [self whenMockClientGETSucceeded];
   
   // then
-  assertThat(sut.failblock, equalTo(failure));
+  assertThat(sut.parseContext.itemBlock, equalTo(itemHandler));
   
   // clean up
   [sut cancel];
@@ -314,6 +518,136 @@ const char RSSParserFailBlockKey;
   [verify(sut.xmlParser) parse];
 }
 
+#pragma mark - Feed Cache - Tests
+
+- (void)test___parseRSSFeed_paramemters_success_failure___captures_feedURL_in_parseContext
+{
+  // given
+  [self givenMockClientNumberOfTasks:0];
+  sut.feedCache = [[RSSMemoryFeedCache alloc] init];
+  
+  // when
+  [sut parseRSSFeed:@"http://www.example.com/feed.xml" parameters:@{@"page": @"1"} success:nil failure:nil];
+  [self whenMockClientGETSucceeded];
+  
+  // then
+  assertThat(sut.parseContext.feedURL, equalTo([NSURL URLWithString:@"http://www.example.com/feed.xml?page=1"]));
+  assertThat(sut.parseContext.feedCache, sameInstance(sut.feedCache));
+  
+  // clean up
+  [sut cancel];
+}
+
+- (void)test___parserDidEndDocument___cancelled_parse_does_not_store_channel_in_feedCache
+{
+  // given
+  NSURL *url = [NSURL URLWithString:@"http://www.example.com/feed.xml"];
+  RSSParseContext *context = [self givenParseContext];
+  context.feedCache = [[RSSMemoryFeedCache alloc] init];
+  context.feedURL = url;
+  context.pendingCacheEntry = [[RSSFeedCacheEntry alloc] init];
+  [sut parserDidStartDocument:nil];
+  
+  // when
+  [sut cancel];
+  [sut parserDidEndDocument:nil];
+  
+  // then
+  assertThat([context.feedCache cachedEntryForURL:url], nilValue());
+}
+
+- (void)test___parseRSSFeed_paramemters_success_failure___stores_validators_and_channel_in_feedCache
+{
+  // given
+  [self givenStubbedClient];
+  sut.feedCache = [[RSSMemoryFeedCache alloc] init];
+  NSURL *url = [NSURL URLWithString:@"http://www.example.com/feed.xml"];
+  
+  [RSSStubHTTPProtocol stubResponseWithStatusCode:200
+                                          headers:@{@"Content-Type": @"application/rss+xml", @"ETag": @"\"v2\""}
+                                             data:[NSData dataWithContentsOfFile:[self filePathForRSS2Example]]];
+  
+  [self beginAsynchronousOperation];
+  
+  // when
+  [sut parseRSSFeed:[url absoluteString] parameters:nil success:^(RSSChannel *channel) {
+    
+    // then
+    RSSFeedCacheEntry *entry = [sut.feedCache cachedEntryForURL:url];
+    assertThat(entry.etag, equalTo(@"\"v2\""));
+    assertThat(entry.channel, sameInstance(channel));
+    
+    [self endAsynchronousOperation];
+    
+  } failure:^(NSError *error) {
+    XCTAssertTrue(NO, @"Error:%@", error);
+    [self endAsynchronousOperation];
+  }];
+  
+  [self waitForAsyncronousOperation];
+}
+
+- (void)test___parseRSSFeed_paramemters_success_failure___sends_cached_validators
+{
+  // given
+  [self givenStubbedClient];
+  sut.feedCache = [[RSSMemoryFeedCache alloc] init];
+  NSURL *url = [NSURL URLWithString:@"http://www.example.com/feed.xml"];
+  [self givenFeedCacheEntryForURL:url];
+  
+  [RSSStubHTTPProtocol stubResponseWithStatusCode:200
+                                          headers:@{@"Content-Type": @"application/rss+xml"}
+                                             data:[NSData dataWithContentsOfFile:[self filePathForRSS2Example]]];
+  
+  [self beginAsynchronousOperation];
+  
+  // when
+  [sut parseRSSFeed:[url absoluteString] parameters:nil success:^(RSSChannel *channel) {
+    
+    // then
+    NSURLRequest *request = [RSSStubHTTPProtocol lastRequest];
+    assertThat([request valueForHTTPHeaderField:@"If-None-Match"], equalTo(@"\"v1\""));
+    assertThat([request valueForHTTPHeaderField:@"If-Modified-Since"], equalTo(@"Sat, 07 Sep 2002 09:42:31 GMT"));
+    
+    [self endAsynchronousOperation];
+    
+  } failure:^(NSError *error) {
+    XCTAssertTrue(NO, @"Error:%@", error);
+    [self endAsynchronousOperation];
+  }];
+  
+  [self waitForAsyncronousOperation];
+}
+
+- (void)test___parseRSSFeed_paramemters_success_failure___not_modified_returns_cached_channel
+{
+  // given
+  [self givenStubbedClient];
+  sut.feedCache = [[RSSMemoryFeedCache alloc] init];
+  NSURL *url = [NSURL URLWithString:@"http://www.example.com/feed.xml"];
+  RSSChannel *cachedChannel = [self givenFeedCacheEntryForURL:url];
+  
+  [RSSStubHTTPProtocol stubResponseWithStatusCode:304 headers:@{@"ETag": @"\"v1\""} data:nil];
+  
+  [self beginAsynchronousOperation];
+  
+  // when
+  [sut parseRSSFeed:[url absoluteString] parameters:nil success:^(RSSChannel *channel) {
+    
+    // then
+    assertThat(channel, sameInstance(cachedChannel));
+    assertThat(sut.xmlParser, nilValue());
+    
+    [self endAsynchronousOperation];
+    
+  } failure:^(NSError *error) {
+    XCTAssertTrue(NO, @"Error:%@", error);
+    [self endAsynchronousOperation];
+  }];
+  
+  [self waitForAsyncronousOperation];
+}
+
 #pragma mark - Instance Methods - NSXMLParserDelegate - Tests
 
 - (void)test___parser_parseErrorOccurred___abortsParsing
@@ -330,15 +664,19 @@ const char RSSParserFailBlockKey;
 
 - (void)test___parser_parseErrorOccurred___calls_failBlock
 {
+  [self beginAsynchronousOperation];
+  
   // given
   void (^failBlock)(NSError *) = ^(NSError *error) {
     NSNumber *number = @YES;
     objc_setAssociatedObject(sut, &RSSParserFailBlockKey, number, OBJC_ASSOCIATION_RETAIN_NONATOMIC);
+    [self endAsynchronousOperation];
   };
-  [sut setFailblock:failBlock];
+  [self givenParseContext].failblock = failBlock;
   
   // when
   [sut parser:nil parseErrorOccurred:nil];
+  [self waitForAsyncronousOperation];
   
   // then
   NSNumber *number = objc_getAssociatedObject(sut, &RSSParserFailBlockKey);
@@ -348,77 +686,1551 @@ const char RSSParserFailBlockKey;
 - (void)test___parser_parseErrorOccurred__does_not_crash_if_nil_fail_bloc
 {
   // given
-  [sut setFailblock:nil];
+  [self givenParseContext].failblock = nil;
   
   // then
   XCTAssertNoThrow([sut parser:nil parseErrorOccurred:nil]);
 }
 
-- (void)test___parser_parseErrorOccurred__nils_success_block
+- (void)test___parser_parseErrorOccurred__releases_parseContext
 {
+  // given
+  [self givenParseContext];
+  
   // when
   [sut parser:nil parseErrorOccurred:nil];
   
   // then
-  [self verifySuccessBlockSetAsNil];
+  assertThat(sut.parseContext, nilValue());
 }
 
-- (void)test___parser_parseErrorOccurred__nils_fail_block
+- (void)test__parserDidStartDocument___sets_items_array
 {
+  // given
+  
   // when
-  [sut parser:nil parseErrorOccurred:nil];
+  [sut parserDidStartDocument:nil];
   
   // then
-  [self verifyFailBlockSetAsNil];
+  assertThat(sut.items, notNilValue());
+  assertThatInt(sut.items.count, equalToInt(0));
 }
 
-- (void)test__parserDidStartDocument___sets_items_array
+- (void)test___parser_didEndElement___item_with_itemBlock_does_not_add_to_items
 {
   // given
+  [self givenParseContext].itemBlock = ^(RSSItem *item) { };
+  [sut parserDidStartDocument:nil];
+  [sut parser:nil didStartElement:@"item" namespaceURI:nil qualifiedName:nil attributes:nil];
   
   // when
-  [sut parserDidStartDocument:nil];
+  [sut parser:nil didEndElement:@"item" namespaceURI:nil qualifiedName:nil];
   
   // then
-  assertThat(sut.items, notNilValue());
   assertThatInt(sut.items.count, equalToInt(0));
+  assertThat(sut.currentItem, nilValue());
 }
 
-#pragma mark - Parsing - RSS 2.0
-
-- (void)test__parseRSSFeed_paramemters_success_failure___correctly_parses_RSS_2
+- (void)test___parser_didEndElement___item_without_itemBlock_adds_to_items
 {
-  [self beginAsynchronousOperation];
+  // given
+  [sut parserDidStartDocument:nil];
+  [sut parser:nil didStartElement:@"item" namespaceURI:nil qualifiedName:nil attributes:nil];
   
-  [sut parseRSSFeed:[self fileURLPathForRSS2Example] parameters:nil success:^(RSSChannel *channel) {
-
-    [self endAsynchronousOperation];
-    
-    testChannel = channel;
-    [self verifyRSS2];
-    
-  } failure:^(NSError *error) {
-    XCTAssertTrue(NO, @"Error:%@", error);
-    [self endAsynchronousOperation];
-    
-  }];
+  // when
+  [sut parser:nil didEndElement:@"item" namespaceURI:nil qualifiedName:nil];
   
-  [self waitForAsyncronousOperation];
+  // then
+  assertThatInt(sut.items.count, equalToInt(1));
+  assertThat(sut.currentItem, nilValue());
 }
 
-- (void)verifyRSS2
+#pragma mark - Instance Methods - Character Capture - Tests
+
+- (void)test___parser_foundCharacters___ignores_characters_outside_mapped_elements
 {
-  [self setUpDateFormatter];
-  [self verifyRSS2_channelProperties];
-  [self verifyRSS2_Empty_Item1];
-  [self verifyRSS2_Item2];
-  [self verifyRSS2_Item3];
+  // given
+  [sut parserDidStartDocument:nil];
+  [sut parser:nil didStartElement:@"channel" namespaceURI:nil qualifiedName:nil attributes:nil];
+  
+  // when
+  [sut parser:nil foundCharacters:@"\n    "];
+  
+  // then
+  assertThatBool(sut.capturingCharacters, equalToBool(NO));
+  assertThatInt(sut.tempString.length, equalToInt(0));
 }
 
-- (void)verifyRSS2_channelProperties
+- (void)test___parser_foundCharacters___captures_characters_inside_mapped_elements
 {
-  assertThat(testChannel.title, equalTo(@"RSS 2.0 Example"));
-  assertThat([testChannel.link absoluteString], equalTo(@"http://www.example.com"));
+  // given
+  [sut parserDidStartDocument:nil];
+  [sut parser:nil didStartElement:@"title" namespaceURI:nil qualifiedName:nil attributes:nil];
+  
+  // when
+  [sut parser:nil foundCharacters:@"Title"];
+  [sut parser:nil didEndElement:@"title" namespaceURI:nil qualifiedName:nil];
+  
+  // then
+  assertThat(sut.channel.title, equalTo(@"Title"));
+  assertThatBool(sut.capturingCharacters, equalToBool(NO));
+}
+
+- (void)test___parser_didStartElement___reuses_tempString_buffer
+{
+  // given
+  [sut parserDidStartDocument:nil];
+  [sut parser:nil didStartElement:@"title" namespaceURI:nil qualifiedName:nil attributes:nil];
+  [sut parser:nil foundCharacters:@"Title"];
+  [sut parser:nil didEndElement:@"title" namespaceURI:nil qualifiedName:nil];
+  NSMutableString *buffer = sut.tempString;
+  
+  // when
+  [sut parser:nil didStartElement:@"link" namespaceURI:nil qualifiedName:nil attributes:nil];
+  
+  // then
+  assertThat(sut.tempString, sameInstance(buffer));
+  assertThatInt(sut.tempString.length, equalToInt(0));
+}
+
+- (void)test___parser_didEndElement___hands_off_immutable_copy_of_tempString
+{
+  // given
+  [sut parserDidStartDocument:nil];
+  [sut parser:nil didStartElement:@"title" namespaceURI:nil qualifiedName:nil attributes:nil];
+  [sut parser:nil foundCharacters:@"Title"];
+  [sut parser:nil didEndElement:@"title" namespaceURI:nil qualifiedName:nil];
+  
+  // when
+  [sut parser:nil didStartElement:@"description" namespaceURI:nil qualifiedName:nil attributes:nil];
+  [sut parser:nil foundCharacters:@"Description"];
+  
+  // then
+  assertThat(sut.channel.title, equalTo(@"Title"));
+}
+
+#pragma mark - Known Items - Tests
+
+- (void)test___setKnownItemsFromChannel___adds_guids_and_links
+{
+  // given
+  RSSItem *item = [[RSSItem alloc] init];
+  item.guid = @"Item#0002";
+  item.link = [NSURL URLWithString:@"http://www.example.com/item2"];
+  
+  RSSChannel *channel = [[RSSChannel alloc] init];
+  channel.items = @[item, [[RSSItem alloc] init]];
+  
+  // when
+  [sut setKnownItemsFromChannel:channel];
+  
+  // then
+  assertThat(sut.knownItemKeys, equalTo([NSSet setWithObjects:@"Item#0002", @"http://www.example.com/item2", nil]));
+}
+
+- (void)test___parseRSSData_success_failure___skips_known_items
+{
+  [self beginAsynchronousOperation];
+  
+  // given
+  sut.knownItemKeys = [NSSet setWithObject:@"Item#0003"];
+  NSData *data = [NSData dataWithContentsOfFile:[self filePathForRSS2Example]];
+  
+  // when
+  [sut parseRSSData:data success:^(RSSChannel *channel) {
+    
+    // then
+    assertThatInt(channel.items.count, equalToInt(2));
+    assertThat([channel.items[1] guid], equalTo(@"Item#0002"));
+    [self endAsynchronousOperation];
+    
+  } failure:^(NSError *error) {
+    XCTAssertTrue(NO, @"Error:%@", error);
+    [self endAsynchronousOperation];
+  }];
+  
+  [self waitForAsyncronousOperation];
+}
+
+- (void)test___parseRSSData_success_failure___stops_after_knownItemLimit
+{
+  [self beginAsynchronousOperation];
+  
+  // given
+  sut.knownItemKeys = [NSSet setWithObject:@"http://www.example.com/item2"];
+  sut.knownItemLimit = 1;
+  NSData *data = [NSData dataWithContentsOfFile:[self filePathForRSS2Example]];
+  
+  // when
+  [sut parseRSSData:data success:^(RSSChannel *channel) {
+    
+    // then
+    assertThat(channel.title, equalTo(@"RSS 2.0 Example"));
+    assertThatInt(channel.items.count, equalToInt(1));
+    [self endAsynchronousOperation];
+    
+  } failure:^(NSError *error) {
+    XCTAssertTrue(NO, @"Error:%@", error);
+    [self endAsynchronousOperation];
+  }];
+  
+  [self waitForAsyncronousOperation];
+}
+
+- (void)test___parseRSSData_success_failure___libXML_backend_stops_after_knownItemLimit
+{
+  [self beginAsynchronousOperation];
+  
+  // given
+  sut.backend = RSSParserBackendLibXML;
+  sut.knownItemKeys = [NSSet setWithObject:@"http://www.example.com/item2"];
+  sut.knownItemLimit = 1;
+  NSData *data = [NSData dataWithContentsOfFile:[self filePathForRSS2Example]];
+  
+  // when
+  [sut parseRSSData:data success:^(RSSChannel *channel) {
+    
+    // then
+    assertThatInt(channel.items.count, equalToInt(1));
+    XCTAssertTrue(sut.libXMLContext == NULL);
+    [self endAsynchronousOperation];
+    
+  } failure:^(NSError *error) {
+    XCTAssertTrue(NO, @"Error:%@", error);
+    [self endAsynchronousOperation];
+  }];
+  
+  [self waitForAsyncronousOperation];
+}
+
+- (void)test___parser_didEndElement___known_item_is_not_streamed
+{
+  // given
+  __block BOOL streamed = NO;
+  sut.knownItemKeys = [NSSet setWithObject:@"Item#0002"];
+  [self givenParseContext].itemBlock = ^(RSSItem *item) {
+    streamed = YES;
+  };
+  [sut parserDidStartDocument:nil];
+  [sut parser:nil didStartElement:@"item" namespaceURI:nil qualifiedName:nil attributes:nil];
+  [sut parser:nil didStartElement:@"guid" namespaceURI:nil qualifiedName:nil attributes:nil];
+  [sut parser:nil foundCharacters:@"Item#0002"];
+  [sut parser:nil didEndElement:@"guid" namespaceURI:nil qualifiedName:nil];
+  
+  // when
+  [sut parser:nil didEndElement:@"item" namespaceURI:nil qualifiedName:nil];
+  
+  // then
+  [[NSRunLoop currentRunLoop] runUntilDate:[NSDate dateWithTimeIntervalSinceNow:0.1]];
+  XCTAssertFalse(streamed);
+  assertThatInt(sut.consecutiveKnownItemCount, equalToInt(1));
+}
+
+#pragma mark - Field Projection - Tests
+
+- (NSData *)projectionTestData
+{
+  return [@"<rss><channel><title>Channel</title><link>http://www.example.com</link>"
+          @"<item><title>Item</title><guid>Item#0001</guid>"
+          @"<description>Skipped <title>Nested Title</title></description>"
+          @"<media:content url=\"http://www.example.com/a.mp4\"><media:title>Media Title</media:title></media:content>"
+          @"<media:thumbnail url=\"http://www.example.com/a.jpg\"/></item></channel></rss>"
+          dataUsingEncoding:NSUTF8StringEncoding];
+}
+
+- (void)test___channelFields___only_sets_selected_channel_properties
+{
+  // given
+  sut.channelFields = RSSChannelFieldTitle;
+  
+  // when
+  [sut GETSucceeded:[[NSXMLParser alloc] initWithData:[self projectionTestData]]];
+  
+  // then
+  assertThat(sut.channel.title, equalTo(@"Channel"));
+  assertThat(sut.channel.link, nilValue());
+  assertThatUnsignedInteger(sut.channel.items.count, equalToUnsignedInteger(1));
+}
+
+- (void)test___itemFields___only_sets_selected_item_properties_and_media_objects
+{
+  // given
+  sut.itemFields = RSSItemFieldGuid | RSSItemFieldMediaContents | RSSItemFieldMediaTitle;
+  
+  // when
+  [sut GETSucceeded:[[NSXMLParser alloc] initWithData:[self projectionTestData]]];
+  
+  // then
+  RSSItem *item = sut.channel.items[0];
+  assertThat(item.guid, equalTo(@"Item#0001"));
+  assertThat(item.title, nilValue());
+  assertThat(item.itemDescription, nilValue());
+  assertThat(item.mediaTitle, equalTo(@"Media Title"));
+  assertThatUnsignedInteger(item.mediaContents.count, equalToUnsignedInteger(1));
+  assertThat(item.mediaThumbnails, nilValue());
+  assertThat(item.mediaCredits, nilValue());
+}
+
+- (void)test___itemFields___skips_subtree_of_unselected_element
+{
+  // given
+  sut.itemFields = RSSItemFieldTitle;
+  
+  // when
+  [sut GETSucceeded:[[NSXMLParser alloc] initWithData:[self projectionTestData]]];
+  
+  // then
+  RSSItem *item = sut.channel.items[0];
+  assertThat(item.title, equalTo(@"Item"));
+  assertThatUnsignedInteger(sut.skippedElementDepth, equalToUnsignedInteger(0));
+}
+
+- (void)test___itemFields___zero_skips_items
+{
+  // given
+  sut.itemFields = 0;
+  
+  // when
+  [sut GETSucceeded:[[NSXMLParser alloc] initWithData:[self projectionTestData]]];
+  
+  // then
+  assertThat(sut.channel.title, equalTo(@"Channel"));
+  assertThatUnsignedInteger(sut.channel.items.count, equalToUnsignedInteger(0));
+}
+
+- (void)test___itemFields___libXML_backend_only_sets_selected_item_properties
+{
+  // given
+  sut.itemFields = RSSItemFieldTitle | RSSItemFieldMediaThumbnails;
+  
+  // when
+  [sut parseDataWithLibXML:[self projectionTestData]];
+  
+  // then
+  RSSItem *item = sut.channel.items[0];
+  assertThat(item.title, equalTo(@"Item"));
+  assertThat(item.guid, nilValue());
+  assertThat(item.mediaContents, nilValue());
+  assertThatUnsignedInteger(item.mediaThumbnails.count, equalToUnsignedInteger(1));
+}
+
+- (void)test___itemFields___includes_guid_and_link_while_knownItemKeys_is_set
+{
+  // given
+  sut.itemFields = RSSItemFieldTitle;
+  sut.knownItemKeys = [NSSet setWithObject:@"Other#0001"];
+  
+  // when
+  [sut GETSucceeded:[[NSXMLParser alloc] initWithData:[self projectionTestData]]];
+  
+  // then
+  RSSItem *item = sut.channel.items[0];
+  assertThat(item.guid, equalTo(@"Item#0001"));
+}
+
+#pragma mark - Image Extraction - Tests
+
+- (NSData *)imageExtractionTestData
+{
+  return [@"<rss><channel><title>Channel</title>"
+          @"<item><title>Item</title><description>&lt;img src=\"http://www.example.com/a.jpg\"&gt; "
+          @"&lt;img src=\"https://www.example.com/b.PNG\"&gt;</description></item>"
+          @"<item><title>No Images</title><description>Text</description></item></channel></rss>"
+          dataUsingEncoding:NSUTF8StringEncoding];
+}
+
+- (void)test___extractsImagesFromItemDescriptions___sets_itemDescriptionImages
+{
+  // given
+  sut.extractsImagesFromItemDescriptions = YES;
+  
+  // when
+  [sut GETSucceeded:[[NSXMLParser alloc] initWithData:[self imageExtractionTestData]]];
+  
+  // then
+  RSSItem *item = sut.channel.items[0];
+  assertThat(item.itemDescriptionImages, equalTo(@[@"http://www.example.com/a.jpg", @"https://www.example.com/b.PNG"]));
+  assertThat([sut.channel.items[1] itemDescriptionImages], equalTo(@[]));
+}
+
+- (void)test___extractsImagesFromItemDescriptions___defaults_to_NO
+{
+  // when
+  [sut GETSucceeded:[[NSXMLParser alloc] initWithData:[self imageExtractionTestData]]];
+  
+  // then
+  RSSItem *item = sut.channel.items[0];
+  assertThat(item.itemDescriptionImages, nilValue());
+  assertThatUnsignedInteger([item imagesFromItemDescription].count, equalToUnsignedInteger(2));
+}
+
+- (void)test___extractsImagesFromItemDescriptions___lazy_libXML_backend_decodes_description_eagerly
+{
+  // given
+  sut.decodesItemFieldsLazily = YES;
+  sut.extractsImagesFromItemDescriptions = YES;
+  
+  // when
+  [sut parseDataWithLibXML:[self imageExtractionTestData]];
+  
+  // then
+  RSSLazyItem *item = sut.channel.items[0];
+  assertThatUnsignedInteger(item.pendingFieldCount, equalToUnsignedInteger(1));
+  assertThat(item.itemDescriptionImages, equalTo(@[@"http://www.example.com/a.jpg", @"https://www.example.com/b.PNG"]));
+}
+
+#pragma mark - Parse Metrics - Tests
+
+- (NSData *)metricsTestData
+{
+  return [@"<rss><channel><title>Channel</title><pubDate>Not a date</pubDate>"
+          @"<item><title>Item</title><pubDate>Wed, 02 Oct 2002 13:00:00 GMT</pubDate>"
+          @"<media:content url=\"http://www.example.com/a.mp4\"/><media:thumbnail url=\"http://www.example.com/a.jpg\"/></item>"
+          @"<item><title>Second Item</title></item></channel></rss>"
+          dataUsingEncoding:NSUTF8StringEncoding];
+}
+
+- (void)verifyMetrics:(RSSParseMetrics *)metrics
+{
+  assertThatUnsignedLongLong(metrics.bytesReceived, equalToUnsignedLongLong([self metricsTestData].length));
+  assertThatUnsignedInteger(metrics.elementCount, equalToUnsignedInteger(11));
+  assertThatUnsignedInteger(metrics.itemCount, equalToUnsignedInteger(2));
+  assertThatUnsignedInteger(metrics.mediaObjectCount, equalToUnsignedInteger(2));
+  assertThatUnsignedInteger(metrics.dateParseFailureCount, equalToUnsignedInteger(1));
+  assertThatDouble(metrics.timeToFirstByte, equalToDouble(0));
+  XCTAssertTrue(metrics.parseTime > 0);
+  XCTAssertTrue(metrics.elementStartTime > 0);
+  XCTAssertTrue(metrics.dateParsingTime > 0);
+  XCTAssertTrue(metrics.dateParsingTime <= metrics.elementEndTime);
+}
+
+- (void)test___metricsHandler___called_before_success_block
+{
+  [self beginAsynchronousOperation];
+  
+  __block RSSParseMetrics *metrics = nil;
+  sut.metricsHandler = ^(RSSParseMetrics *parseMetrics) {
+    metrics = parseMetrics;
+  };
+  
+  [sut parseRSSData:[self metricsTestData] success:^(RSSChannel *channel) {
+    
+    [self verifyMetrics:metrics];
+    [self endAsynchronousOperation];
+    
+  } failure:^(NSError *error) {
+    XCTAssertTrue(NO, @"Error:%@", error);
+    [self endAsynchronousOperation];
+  }];
+  
+  [self waitForAsyncronousOperation];
+}
+
+- (void)test___metricsHandler___libXML_backend_reports_same_counts
+{
+  [self beginAsynchronousOperation];
+  
+  sut.backend = RSSParserBackendLibXML;
+  __block RSSParseMetrics *metrics = nil;
+  sut.metricsHandler = ^(RSSParseMetrics *parseMetrics) {
+    metrics = parseMetrics;
+  };
+  
+  [sut parseRSSData:[self metricsTestData] success:^(RSSChannel *channel) {
+    
+    [self verifyMetrics:metrics];
+    [self endAsynchronousOperation];
+    
+  } failure:^(NSError *error) {
+    XCTAssertTrue(NO, @"Error:%@", error);
+    [self endAsynchronousOperation];
+  }];
+  
+  [self waitForAsyncronousOperation];
+}
+
+- (void)test___metricsHandler___called_before_failure_block
+{
+  [self beginAsynchronousOperation];
+  
+  NSData *data = [@"<rss><channel><title>Broken</channel>" dataUsingEncoding:NSUTF8StringEncoding];
+  __block RSSParseMetrics *metrics = nil;
+  sut.metricsHandler = ^(RSSParseMetrics *parseMetrics) {
+    metrics = parseMetrics;
+  };
+  
+  [sut parseRSSData:data success:nil failure:^(NSError *error) {
+    
+    assertThatUnsignedLongLong(metrics.bytesReceived, equalToUnsignedLongLong(data.length));
+    assertThatUnsignedInteger(metrics.elementCount, equalToUnsignedInteger(3));
+    [self endAsynchronousOperation];
+  }];
+  
+  [self waitForAsyncronousOperation];
+}
+
+- (void)test___metricsHandler___measures_itemHandler
+{
+  [self beginAsynchronousOperation];
+  
+  __block RSSParseMetrics *metrics = nil;
+  sut.metricsHandler = ^(RSSParseMetrics *parseMetrics) {
+    metrics = parseMetrics;
+  };
+  
+  [sut parseRSSData:[self metricsTestData] itemHandler:^(RSSItem *item) {
+    [NSThread sleepForTimeInterval:0.01];
+    
+  } success:^(RSSChannel *channel) {
+    
+    XCTAssertTrue(metrics.itemHandlerTime >= 0.02);
+    [self endAsynchronousOperation];
+    
+  } failure:^(NSError *error) {
+    XCTAssertTrue(NO, @"Error:%@", error);
+    [self endAsynchronousOperation];
+  }];
+  
+  [self waitForAsyncronousOperation];
+}
+
+- (void)test___metricsHandler___not_called_after_cancel
+{
+  // given
+  __block BOOL called = NO;
+  sut.metricsHandler = ^(RSSParseMetrics *parseMetrics) {
+    called = YES;
+  };
+  
+  // when
+  [sut parseRSSData:[self metricsTestData] success:nil failure:nil];
+  [sut cancel];
+  [[NSRunLoop currentRunLoop] runUntilDate:[NSDate dateWithTimeIntervalSinceNow:0.1]];
+  
+  // then
+  XCTAssertFalse(called);
+}
+
+#pragma mark - Resource Limits - Tests
+
+- (NSString *)limitsTestStringWithItemCount:(NSUInteger)count
+{
+  NSMutableString *string = [NSMutableString stringWithString:@"<rss><channel><title>Channel</title>"];
+  for (NSUInteger i = 0; i < count; i++) {
+    [string appendFormat:@"<item><title>Item %lu</title></item>", (unsigned long)i];
+  }
+  [string appendString:@"</channel></rss>"];
+  return string;
+}
+
+- (NSData *)limitsTestDataWithItemCount:(NSUInteger)count
+{
+  return [[self limitsTestStringWithItemCount:count] dataUsingEncoding:NSUTF8StringEncoding];
+}
+
+- (NSData *)limitsTestDataWithThumbnailCount:(NSUInteger)count
+{
+  NSMutableString *string = [NSMutableString stringWithString:@"<rss><channel><item><title>Item</title>"];
+  for (NSUInteger i = 0; i < count; i++) {
+    [string appendFormat:@"<media:thumbnail url=\"http://www.example.com/%lu.jpg\"/>", (unsigned long)i];
+  }
+  [string appendString:@"<media:credit>Credit</media:credit></item></channel></rss>"];
+  return [string dataUsingEncoding:NSUTF8StringEncoding];
+}
+
+- (NSData *)limitsTestDataWithDescription:(NSString *)description
+{
+  NSString *string = [NSString stringWithFormat:@"<rss><channel><item><title>Item</title><description>%@</description></item></channel></rss>",
+                      description];
+  return [string dataUsingEncoding:NSUTF8StringEncoding];
+}
+
+- (NSString *)longDescription
+{
+  return [@"" stringByPaddingToLength:1024 * 1024 withString:@"abcdefgh" startingAtIndex:0];
+}
+
+- (void)verifyFailureWithCode:(RSSParserError)code whenParsingData:(NSData *)data
+{
+  [self beginAsynchronousOperation];
+  
+  [sut parseRSSData:data success:^(RSSChannel *channel) {
+    XCTAssertTrue(NO, @"Expected failure");
+    [self endAsynchronousOperation];
+    
+  } failure:^(NSError *error) {
+    assertThat(error.domain, equalTo(RSSParserErrorDomain));
+    assertThatInteger(error.code, equalToInteger(code));
+    [self endAsynchronousOperation];
+  }];
+  
+  [self waitForAsyncronousOperation];
+}
+
+- (void)test___limits___default_to_zero
+{
+  assertThatUnsignedInteger(sut.maxItemCount, equalToUnsignedInteger(0));
+  assertThatUnsignedInteger(sut.maxMediaObjectCount, equalToUnsignedInteger(0));
+  assertThatUnsignedInteger(sut.maxTextLength, equalToUnsignedInteger(0));
+  assertThatUnsignedInteger(sut.maxElementDepth, equalToUnsignedInteger(0));
+  assertThatUnsignedLongLong(sut.maxInputLength, equalToUnsignedLongLong(0));
+  assertThatUnsignedInteger(sut.failingLimits, equalToUnsignedInteger(0));
+}
+
+- (void)test___maxItemCount___stops_after_limit
+{
+  // given
+  sut.maxItemCount = 2;
+  
+  // when
+  [sut GETSucceeded:[[NSXMLParser alloc] initWithData:[self limitsTestDataWithItemCount:5]]];
+  
+  // then
+  assertThat([sut.channel.items valueForKey:@"title"], equalTo(@[@"Item 0", @"Item 1"]));
+}
+
+- (void)test___maxItemCount___libXML_backend_stops_after_limit
+{
+  // given
+  sut.maxItemCount = 2;
+  
+  // when
+  [sut parseDataWithLibXML:[self limitsTestDataWithItemCount:5]];
+  
+  // then
+  assertThat([sut.channel.items valueForKey:@"title"], equalTo(@[@"Item 0", @"Item 1"]));
+  XCTAssertTrue(sut.libXMLContext == NULL);
+}
+
+- (void)test___maxItemCount___does_not_count_known_items
+{
+  // given
+  sut.maxItemCount = 2;
+  sut.knownItemKeys = [NSSet setWithObject:@"Known#0001"];
+  NSData *data = [@"<rss><channel><item><guid>Known#0001</guid></item><item><guid>New#0001</guid></item>"
+                  @"<item><guid>New#0002</guid></item></channel></rss>" dataUsingEncoding:NSUTF8StringEncoding];
+  
+  // when
+  [sut GETSucceeded:[[NSXMLParser alloc] initWithData:data]];
+  
+  // then
+  assertThat([sut.channel.items valueForKey:@"guid"], equalTo(@[@"New#0001", @"New#0002"]));
+}
+
+- (void)test___maxItemCount___failing_limit_calls_failBlock
+{
+  sut.maxItemCount = 2;
+  sut.failingLimits = RSSParserLimitItemCount;
+  
+  [self verifyFailureWithCode:RSSParserErrorItemCountExceeded whenParsingData:[self limitsTestDataWithItemCount:3]];
+}
+
+- (void)test___maxMediaObjectCount___ignores_media_objects_beyond_limit
+{
+  // given
+  sut.maxMediaObjectCount = 3;
+  
+  // when
+  [sut GETSucceeded:[[NSXMLParser alloc] initWithData:[self limitsTestDataWithThumbnailCount:10000]]];
+  
+  // then
+  RSSItem *item = sut.channel.items[0];
+  assertThat(item.title, equalTo(@"Item"));
+  assertThatUnsignedInteger(item.mediaThumbnails.count, equalToUnsignedInteger(3));
+  assertThatUnsignedInteger(item.mediaCredits.count, equalToUnsignedInteger(0));
+}
+
+- (void)test___maxMediaObjectCount___libXML_backend_ignores_media_objects_beyond_limit
+{
+  // given
+  sut.maxMediaObjectCount = 3;
+  
+  // when
+  [sut parseDataWithLibXML:[self limitsTestDataWithThumbnailCount:100000]];
+  
+  // then
+  RSSItem *item = sut.channel.items[0];
+  assertThatUnsignedInteger(item.mediaThumbnails.count, equalToUnsignedInteger(3));
+  assertThatUnsignedInteger(item.mediaCredits.count, equalToUnsignedInteger(0));
+}
+
+- (void)test___maxMediaObjectCount___failing_limit_calls_failBlock
+{
+  sut.maxMediaObjectCount = 3;
+  sut.failingLimits = RSSParserLimitMediaObjectCount;
+  
+  [self verifyFailureWithCode:RSSParserErrorMediaObjectCountExceeded whenParsingData:[self limitsTestDataWithThumbnailCount:4]];
+}
+
+- (void)test___parser_foundCharacters___keeps_tempString_within_maxTextLength
+{
+  // given
+  sut.maxTextLength = 100;
+  sut.tempString = [[NSMutableString alloc] init];
+  sut.capturingCharacters = YES;
+  NSString *characters = [@"" stringByPaddingToLength:1000 withString:@"a" startingAtIndex:0];
+  
+  // when
+  for (NSUInteger i = 0; i < 1000; i++) {
+    [sut parser:nil foundCharacters:characters];
+  }
+  
+  // then
+  assertThatUnsignedInteger(sut.tempString.length, equalToUnsignedInteger(100));
+}
+
+- (void)test___maxTextLength___truncates_text
+{
+  // given
+  sut.maxTextLength = 100;
+  
+  // when
+  [sut GETSucceeded:[[NSXMLParser alloc] initWithData:[self limitsTestDataWithDescription:[self longDescription]]]];
+  
+  // then
+  RSSItem *item = sut.channel.items[0];
+  assertThat(item.itemDescription, equalTo([[self longDescription] substringToIndex:100]));
+  assertThat(item.title, equalTo(@"Item"));
+}
+
+- (void)test___maxTextLength___libXML_backend_truncates_text
+{
+  // given
+  sut.maxTextLength = 100;
+  sut.decodesItemFieldsLazily = YES;
+  
+  // when
+  [sut parseDataWithLibXML:[self limitsTestDataWithDescription:[self longDescription]]];
+  
+  // then
+  RSSItem *item = sut.channel.items[0];
+  assertThat(item.itemDescription, equalTo([[self longDescription] substringToIndex:100]));
+  XCTAssertFalse([item isKindOfClass:[RSSLazyItem class]]);
+}
+
+- (void)test___maxTextLength___does_not_split_surrogate_pair
+{
+  // given
+  sut.maxTextLength = 3;
+  NSData *data = [self limitsTestDataWithDescription:@"ab\U0001F600c"];
+  
+  // when
+  [sut GETSucceeded:[[NSXMLParser alloc] initWithData:data]];
+  NSString *description = [sut.channel.items[0] itemDescription];
+  [sut parseDataWithLibXML:data];
+  NSString *libXMLDescription = [sut.channel.items[0] itemDescription];
+  
+  // then
+  assertThat(description, equalTo(@"ab"));
+  assertThat(libXMLDescription, equalTo(@"ab"));
+}
+
+- (void)test___maxTextLength___failing_limit_calls_failBlock
+{
+  sut.maxTextLength = 100;
+  sut.failingLimits = RSSParserLimitTextLength;
+  
+  [self verifyFailureWithCode:RSSParserErrorTextLengthExceeded
+              whenParsingData:[self limitsTestDataWithDescription:[self longDescription]]];
+}
+
+- (void)test___maxTextLength___libXML_backend_failing_limit_calls_failBlock
+{
+  sut.backend = RSSParserBackendLibXML;
+  sut.maxTextLength = 4;
+  sut.failingLimits = RSSParserLimitTextLength;
+  
+  [self verifyFailureWithCode:RSSParserErrorTextLengthExceeded whenParsingData:[self limitsTestDataWithDescription:@"abcde"]];
+}
+
+- (void)test___maxElementDepth___skips_deeper_elements
+{
+  // given
+  sut.maxElementDepth = 3;
+  NSData *data = [self limitsTestDataWithItemCount:1];
+  
+  // when
+  [sut GETSucceeded:[[NSXMLParser alloc] initWithData:data]];
+  RSSItem *item = sut.channel.items[0];
+  [sut parseDataWithLibXML:data];
+  RSSItem *libXMLItem = sut.channel.items[0];
+  
+  // then
+  assertThat(sut.channel.title, equalTo(@"Channel"));
+  assertThat(item.title, nilValue());
+  assertThat(libXMLItem.title, nilValue());
+  assertThatUnsignedInteger(sut.elementDepth, equalToUnsignedInteger(0));
+}
+
+- (void)test___maxElementDepth___failing_limit_calls_failBlock
+{
+  sut.maxElementDepth = 3;
+  sut.failingLimits = RSSParserLimitElementDepth;
+  
+  [self verifyFailureWithCode:RSSParserErrorElementDepthExceeded whenParsingData:[self limitsTestDataWithItemCount:1]];
+}
+
+- (unsigned long long)inputLengthWithinFourthItem
+{
+  NSString *string = [self limitsTestStringWithItemCount:5];
+  return [string rangeOfString:@"<item><title>Item 3"].location + 10;
+}
+
+- (void)test___maxInputLength___parses_document_up_to_limit
+{
+  [self beginAsynchronousOperation];
+  
+  sut.maxInputLength = [self inputLengthWithinFourthItem];
+  
+  [sut parseRSSData:[self limitsTestDataWithItemCount:5] success:^(RSSChannel *channel) {
+    
+    assertThat([channel.items valueForKey:@"title"], equalTo(@[@"Item 0", @"Item 1", @"Item 2"]));
+    [self endAsynchronousOperation];
+    
+  } failure:^(NSError *error) {
+    XCTAssertTrue(NO, @"Error:%@", error);
+    [self endAsynchronousOperation];
+  }];
+  
+  [self waitForAsyncronousOperation];
+}
+
+- (void)test___maxInputLength___libXML_backend_parses_document_up_to_limit
+{
+  // given
+  sut.maxInputLength = [self inputLengthWithinFourthItem];
+  
+  // when
+  [sut parseDataWithLibXML:[self limitsTestDataWithItemCount:5]];
+  
+  // then
+  assertThat([sut.channel.items valueForKey:@"title"], equalTo(@[@"Item 0", @"Item 1", @"Item 2"]));
+  XCTAssertTrue(sut.libXMLContext == NULL);
+}
+
+- (void)test___maxInputLength___libXML_backend_reads_stream_up_to_limit
+{
+  [self beginAsynchronousOperation];
+  
+  sut.backend = RSSParserBackendLibXML;
+  sut.maxInputLength = [self inputLengthWithinFourthItem];
+  NSInputStream *stream = [NSInputStream inputStreamWithData:[self limitsTestDataWithItemCount:5]];
+  
+  [sut parseRSSInputStream:stream success:^(RSSChannel *channel) {
+    
+    assertThat([channel.items valueForKey:@"title"], equalTo(@[@"Item 0", @"Item 1", @"Item 2"]));
+    [self endAsynchronousOperation];
+    
+  } failure:^(NSError *error) {
+    XCTAssertTrue(NO, @"Error:%@", error);
+    [self endAsynchronousOperation];
+  }];
+  
+  [self waitForAsyncronousOperation];
+}
+
+- (void)test___maxInputLength___reads_stream_up_to_limit
+{
+  [self beginAsynchronousOperation];
+  
+  sut.maxInputLength = [self inputLengthWithinFourthItem];
+  NSInputStream *stream = [NSInputStream inputStreamWithData:[self limitsTestDataWithItemCount:5]];
+  
+  [sut parseRSSInputStream:stream success:^(RSSChannel *channel) {
+    
+    assertThat([channel.items valueForKey:@"title"], equalTo(@[@"Item 0", @"Item 1", @"Item 2"]));
+    [self endAsynchronousOperation];
+    
+  } failure:^(NSError *error) {
+    XCTAssertTrue(NO, @"Error:%@", error);
+    [self endAsynchronousOperation];
+  }];
+  
+  [self waitForAsyncronousOperation];
+}
+
+- (void)test___maxInputLength___failing_limit_calls_failBlock
+{
+  sut.maxInputLength = 10;
+  sut.failingLimits = RSSParserLimitInputLength;
+  
+  [self verifyFailureWithCode:RSSParserErrorInputLengthExceeded whenParsingData:[self limitsTestDataWithItemCount:1]];
+}
+
+- (void)test___maxInputLength___cancels_larger_network_response
+{
+  // given
+  [self givenStubbedClient];
+  sut.maxInputLength = 10;
+  NSData *data = [self limitsTestDataWithItemCount:1];
+  
+  [RSSStubHTTPProtocol stubResponseWithStatusCode:200
+                                          headers:@{@"Content-Type": @"application/rss+xml",
+                                                    @"Content-Length": [@(data.length) stringValue]}
+                                             data:data];
+  
+  [self beginAsynchronousOperation];
+  
+  // when
+  [sut parseRSSFeed:@"http://www.example.com/feed.xml" parameters:nil success:^(RSSChannel *channel) {
+    XCTAssertTrue(NO, @"Expected failure");
+    [self endAsynchronousOperation];
+    
+  } failure:^(NSError *error) {
+    
+    // then
+    assertThat(error.domain, equalTo(RSSParserErrorDomain));
+    assertThatInteger(error.code, equalToInteger(RSSParserErrorInputLengthExceeded));
+    [self endAsynchronousOperation];
+  }];
+  
+  [self waitForAsyncronousOperation];
+}
+
+#pragma mark - Newest Items - Tests
+
+- (NSData *)newestItemsTestData
+{
+  // Items from 1 to 6 September 2002, out of order, plus one without a date
+  NSArray *dates = @[@"Wed, 04", @"Fri, 06", @"Mon, 02", @"", @"Thu, 05", @"Sun, 01", @"Tue, 03"];
+  NSMutableString *string = [NSMutableString stringWithString:@"<rss><channel><title>Channel</title>"];
+  
+  for (NSString *date in dates) {
+    if (date.length) {
+      [string appendFormat:@"<item><title>Day %@</title><pubDate>%@ Sep 2002 09:42:31 GMT</pubDate>",
+       [date substringFromIndex:5], date];
+    } else {
+      [string appendString:@"<item><title>Day none</title>"];
+    }
+    [string appendString:@"<media:thumbnail url=\"http://www.example.com/image.jpg\"/></item>"];
+  }
+  
+  [string appendString:@"</channel></rss>"];
+  return [string dataUsingEncoding:NSUTF8StringEncoding];
+}
+
+- (void)test___newestItemCount___defaults_to_zero
+{
+  assertThatUnsignedInteger(sut.newestItemCount, equalToUnsignedInteger(0));
+}
+
+- (void)test___newestItemCount___keeps_newest_items_newest_first
+{
+  // given
+  sut.newestItemCount = 3;
+  
+  // when
+  [sut GETSucceeded:[[NSXMLParser alloc] initWithData:[self newestItemsTestData]]];
+  
+  // then
+  assertThat([sut.channel.items valueForKey:@"title"], equalTo(@[@"Day 06", @"Day 05", @"Day 04"]));
+  assertThatUnsignedInteger([sut.channel.items[0] mediaThumbnails].count, equalToUnsignedInteger(1));
+}
+
+- (void)test___newestItemCount___lazy_libXML_backend_keeps_newest_items_newest_first
+{
+  // given
+  sut.newestItemCount = 3;
+  sut.decodesItemFieldsLazily = YES;
+  
+  // when
+  [sut parseDataWithLibXML:[self newestItemsTestData]];
+  
+  // then
+  assertThat([sut.channel.items valueForKey:@"title"], equalTo(@[@"Day 06", @"Day 05", @"Day 04"]));
+}
+
+- (void)test___newestItemCount___keeps_items_without_date_last
+{
+  // given
+  sut.newestItemCount = 10;
+  
+  // when
+  [sut GETSucceeded:[[NSXMLParser alloc] initWithData:[self newestItemsTestData]]];
+  
+  // then
+  assertThat([sut.channel.items valueForKey:@"title"],
+             equalTo(@[@"Day 06", @"Day 05", @"Day 04", @"Day 03", @"Day 02", @"Day 01", @"Day none"]));
+}
+
+- (void)test___newestItemCount___larger_than_can_be_allocated_keeps_all_items
+{
+  // given
+  sut.newestItemCount = NSUIntegerMax;
+  
+  // when
+  [sut GETSucceeded:[[NSXMLParser alloc] initWithData:[self newestItemsTestData]]];
+  
+  // then
+  assertThatUnsignedInteger(sut.channel.items.count, equalToUnsignedInteger(7));
+}
+
+- (void)test___newestItemCount___keeps_newest_items_beyond_initial_allocation
+{
+  // given
+  sut.newestItemCount = 1200;
+  NSMutableString *string = [NSMutableString stringWithString:@"<rss><channel>"];
+  for (NSUInteger i = 0; i < 1500; i++) {
+    [string appendFormat:@"<item><title>Item %lu</title><pubDate>Sat, 07 Sep 2002 00:%02lu:%02lu GMT</pubDate></item>",
+     (unsigned long)i, (unsigned long)(i / 60), (unsigned long)(i % 60)];
+  }
+  [string appendString:@"</channel></rss>"];
+  
+  // when
+  [sut GETSucceeded:[[NSXMLParser alloc] initWithData:[string dataUsingEncoding:NSUTF8StringEncoding]]];
+  
+  // then
+  assertThatUnsignedInteger(sut.channel.items.count, equalToUnsignedInteger(1200));
+  assertThat([sut.channel.items.firstObject title], equalTo(@"Item 1499"));
+  assertThat([sut.channel.items.lastObject title], equalTo(@"Item 300"));
+}
+
+- (void)test___newestItemCount___keeps_items_with_same_date_in_document_order
+{
+  // given
+  sut.newestItemCount = 2;
+  NSData *data = [@"<rss><channel><item><title>A</title><pubDate>Sat, 07 Sep 2002 09:42:31 GMT</pubDate></item>"
+                  @"<item><title>B</title><pubDate>Sat, 07 Sep 2002 09:42:31 GMT</pubDate></item>"
+                  @"<item><title>C</title><pubDate>Sat, 07 Sep 2002 09:42:31 GMT</pubDate></item></channel></rss>"
+                  dataUsingEncoding:NSUTF8StringEncoding];
+  
+  // when
+  [sut GETSucceeded:[[NSXMLParser alloc] initWithData:data]];
+  
+  // then
+  assertThat([sut.channel.items valueForKey:@"title"], equalTo(@[@"A", @"B"]));
+}
+
+- (void)test___newestItemCount___does_not_build_media_of_dropped_items
+{
+  [self beginAsynchronousOperation];
+  
+  sut.newestItemCount = 3;
+  __block RSSParseMetrics *metrics = nil;
+  sut.metricsHandler = ^(RSSParseMetrics *parseMetrics) {
+    metrics = parseMetrics;
+  };
+  
+  [sut parseRSSData:[self newestItemsTestData] success:^(RSSChannel *channel) {
+    
+    // Only days 04, 06, 02 and 05 are among the newest when their dates are parsed. The item without a date
+    // can't be dropped until it ends.
+    assertThatUnsignedInteger(metrics.itemCount, equalToUnsignedInteger(7));
+    assertThatUnsignedInteger(metrics.mediaObjectCount, equalToUnsignedInteger(5));
+    [self endAsynchronousOperation];
+    
+  } failure:^(NSError *error) {
+    XCTAssertTrue(NO, @"Error:%@", error);
+    [self endAsynchronousOperation];
+  }];
+  
+  [self waitForAsyncronousOperation];
+}
+
+- (void)test___newestItemCount___passes_newest_items_to_itemHandler_at_end
+{
+  // given
+  [self givenStubbedClient];
+  sut.newestItemCount = 2;
+  [RSSStubHTTPProtocol stubResponseWithStatusCode:200
+                                          headers:@{@"Content-Type": @"application/rss+xml"}
+                                             data:[self newestItemsTestData]];
+  
+  NSMutableArray *titles = [NSMutableArray array];
+  [self beginAsynchronousOperation];
+  
+  // when
+  [sut parseRSSFeed:@"http://www.example.com/feed.xml" parameters:nil itemHandler:^(RSSItem *item) {
+    [titles addObject:item.title];
+    
+  } success:^(RSSChannel *channel) {
+    
+    // then
+    assertThat(titles, equalTo(@[@"Day 06", @"Day 05"]));
+    assertThat(channel.items, equalTo(@[]));
+    [self endAsynchronousOperation];
+    
+  } failure:^(NSError *error) {
+    XCTAssertTrue(NO, @"Error:%@", error);
+    [self endAsynchronousOperation];
+  }];
+  
+  [self waitForAsyncronousOperation];
+}
+
+#pragma mark - Namespaces - Tests
+
+- (NSData *)namespacesTestDataWithRSSAttributes:(NSString *)attributes item:(NSString *)item
+{
+  NSString *string = [NSString stringWithFormat:@"<rss %@><channel><title>Channel</title><item><title>Item</title>%@</item></channel></rss>",
+                      attributes, item];
+  return [string dataUsingEncoding:NSUTF8StringEncoding];
+}
+
+- (NSData *)remappedPrefixTestData
+{
+  return [self namespacesTestDataWithRSSAttributes:@"xmlns:m=\"http://search.yahoo.com/mrss/\""
+                                              item:@"<m:content url=\"http://www.example.com/video.mp4\"/>"
+          @"<m:thumbnail url=\"http://www.example.com/image.jpg\"/><m:title>Media Title</m:title>"];
+}
+
+- (void)verifyRemappedPrefixItem:(RSSItem *)item
+{
+  assertThat(item.title, equalTo(@"Item"));
+  assertThat(item.mediaTitle, equalTo(@"Media Title"));
+  assertThat([[item.mediaContents firstObject] url], equalTo([NSURL URLWithString:@"http://www.example.com/video.mp4"]));
+  assertThat([[item.mediaThumbnails firstObject] url], equalTo([NSURL URLWithString:@"http://www.example.com/image.jpg"]));
+}
+
+- (void)test___parse___matches_media_elements_bound_to_other_prefix
+{
+  // when
+  [sut GETSucceeded:[[NSXMLParser alloc] initWithData:[self remappedPrefixTestData]]];
+  
+  // then
+  [self verifyRemappedPrefixItem:[sut.channel.items firstObject]];
+}
+
+- (void)test___parse___libXML_backend_matches_media_elements_bound_to_other_prefix
+{
+  // when
+  [sut parseDataWithLibXML:[self remappedPrefixTestData]];
+  
+  // then
+  [self verifyRemappedPrefixItem:[sut.channel.items firstObject]];
+}
+
+- (void)test___parse___matches_media_elements_in_default_namespace
+{
+  // given
+  NSData *data = [self namespacesTestDataWithRSSAttributes:@""
+                                                      item:@"<content xmlns=\"http://search.yahoo.com/mrss/\" "
+                  @"url=\"http://www.example.com/video.mp4\"/><title xmlns=\"http://search.yahoo.com/mrss/\">Media Title</title>"];
+  
+  // when
+  [sut GETSucceeded:[[NSXMLParser alloc] initWithData:data]];
+  RSSItem *item = [sut.channel.items firstObject];
+  [sut parseDataWithLibXML:data];
+  RSSItem *libXMLItem = [sut.channel.items firstObject];
+  
+  // then
+  for (RSSItem *parsedItem in @[item, libXMLItem]) {
+    assertThat(parsedItem.title, equalTo(@"Item"));
+    assertThat(parsedItem.mediaTitle, equalTo(@"Media Title"));
+    assertThatUnsignedInteger(parsedItem.mediaContents.count, equalToUnsignedInteger(1));
+  }
+}
+
+- (void)verifyMediaElementsParsedWithNamespaceURI:(NSString *)URI
+{
+  // given
+  NSString *attributes = [NSString stringWithFormat:@"xmlns:media=\"%@\"", URI];
+  NSData *data = [self namespacesTestDataWithRSSAttributes:attributes
+                                                      item:@"<media:content url=\"http://www.example.com/video.mp4\"/>"
+                  @"<media:thumbnail url=\"http://www.example.com/image.jpg\"/><media:title>Media Title</media:title>"];
+  
+  // when
+  [sut GETSucceeded:[[NSXMLParser alloc] initWithData:data]];
+  RSSItem *item = [sut.channel.items firstObject];
+  [sut parseDataWithLibXML:data];
+  RSSItem *libXMLItem = [sut.channel.items firstObject];
+  
+  // then
+  [self verifyRemappedPrefixItem:item];
+  [self verifyRemappedPrefixItem:libXMLItem];
+}
+
+- (void)test___parse___matches_media_elements_with_http_video_search_yahoo_com_with_trailing_slash_namespace_URI
+{
+  [self verifyMediaElementsParsedWithNamespaceURI:@"http://video.search.yahoo.com/mrss/"];
+}
+
+- (void)test___parse___matches_media_elements_with_http_video_search_yahoo_com_without_trailing_slash_namespace_URI
+{
+  [self verifyMediaElementsParsedWithNamespaceURI:@"http://video.search.yahoo.com/mrss"];
+}
+
+- (void)test___parse___matches_media_elements_with_https_search_yahoo_com_with_trailing_slash_namespace_URI
+{
+  [self verifyMediaElementsParsedWithNamespaceURI:@"https://search.yahoo.com/mrss/"];
+}
+
+- (void)test___parse___matches_media_elements_with_https_search_yahoo_com_without_trailing_slash_namespace_URI
+{
+  [self verifyMediaElementsParsedWithNamespaceURI:@"https://search.yahoo.com/mrss"];
+}
+
+- (void)test___parse___matches_media_elements_with_https_video_search_yahoo_com_with_trailing_slash_namespace_URI
+{
+  [self verifyMediaElementsParsedWithNamespaceURI:@"https://video.search.yahoo.com/mrss/"];
+}
+
+- (void)test___parse___matches_media_elements_with_https_video_search_yahoo_com_without_trailing_slash_namespace_URI
+{
+  [self verifyMediaElementsParsedWithNamespaceURI:@"https://video.search.yahoo.com/mrss"];
+}
+
+- (void)test___parse___ignores_media_prefix_bound_to_other_namespace
+{
+  // given
+  NSData *data = [self namespacesTestDataWithRSSAttributes:@"xmlns:media=\"http://www.example.com/other\""
+                                                      item:@"<media:title>Other Title</media:title>"];
+  
+  // when
+  [sut GETSucceeded:[[NSXMLParser alloc] initWithData:data]];
+  RSSItem *item = [sut.channel.items firstObject];
+  [sut parseDataWithLibXML:data];
+  RSSItem *libXMLItem = [sut.channel.items firstObject];
+  
+  // then
+  assertThat(item.mediaTitle, nilValue());
+  assertThat(libXMLItem.mediaTitle, nilValue());
+}
+
+- (void)test___parse___matches_undeclared_media_prefix
+{
+  // given
+  NSData *data = [self namespacesTestDataWithRSSAttributes:@"" item:@"<media:title>Media Title</media:title>"];
+  
+  // when
+  [sut GETSucceeded:[[NSXMLParser alloc] initWithData:data]];
+  RSSItem *item = [sut.channel.items firstObject];
+  [sut parseDataWithLibXML:data];
+  RSSItem *libXMLItem = [sut.channel.items firstObject];
+  
+  // then
+  assertThat(item.mediaTitle, equalTo(@"Media Title"));
+  assertThat(libXMLItem.mediaTitle, equalTo(@"Media Title"));
+}
+
+- (void)test___parse___matches_core_elements_in_default_namespace
+{
+  // given
+  NSData *data = [self namespacesTestDataWithRSSAttributes:@"xmlns=\"http://purl.org/rss/1.0/\""
+                                                      item:@"<link>http://www.example.com/item</link>"];
+  
+  // when
+  [sut GETSucceeded:[[NSXMLParser alloc] initWithData:data]];
+  RSSItem *item = [sut.channel.items firstObject];
+  [sut parseDataWithLibXML:data];
+  RSSItem *libXMLItem = [sut.channel.items firstObject];
+  
+  // then
+  assertThat(item.link, equalTo([NSURL URLWithString:@"http://www.example.com/item"]));
+  assertThat(libXMLItem.link, equalTo([NSURL URLWithString:@"http://www.example.com/item"]));
+}
+
+#pragma mark - Media RSS Elements - Tests
+
+- (NSData *)mediaElementsTestData
+{
+  return [self namespacesTestDataWithRSSAttributes:@"xmlns:media=\"http://search.yahoo.com/mrss/\""
+                                              item:@"<media:group>"
+          @"<media:content url=\"http://www.example.com/video.mp4\" width=\"640\" height=\"360\"/>"
+          @"<media:keywords>kitty, cat , , big dog</media:keywords>"
+          @"<media:player url=\"http://www.example.com/player?id=1\" width=\"400\" height=\"200\"/>"
+          @"<media:category scheme=\"http://search.yahoo.com/mrss/category_schema\" label=\"Music\">music/artist/album</media:category>"
+          @"<media:rating scheme=\"urn:simple\">adult</media:rating>"
+          @"<media:restriction relationship=\"allow\" type=\"country\">au us</media:restriction>"
+          @"<media:community><media:starRating average=\"3.5\" count=\"20\" min=\"1\" max=\"10\"/>"
+          @"<media:statistics views=\"5\" favorites=\"3\"/><media:tags>news: 5, abc:3</media:tags></media:community>"
+          @"</media:group>"];
+}
+
+- (void)verifyMediaElementsItem:(RSSItem *)item
+{
+  RSSMediaContent *content = [item.mediaContents firstObject];
+  assertThat(content.url, equalTo([NSURL URLWithString:@"http://www.example.com/video.mp4"]));
+  assertThatFloat(content.size.width, equalToFloat(640.0f));
+  assertThatFloat(content.size.height, equalToFloat(360.0f));
+  
+  assertThat(item.mediaKeywords, equalTo(@[@"kitty", @"cat", @"big dog"]));
+  
+  assertThat(item.mediaPlayer.url, equalTo([NSURL URLWithString:@"http://www.example.com/player?id=1"]));
+  assertThatFloat(item.mediaPlayer.size.width, equalToFloat(400.0f));
+  assertThatFloat(item.mediaPlayer.size.height, equalToFloat(200.0f));
+  
+  RSSMediaCategory *category = [item.mediaCategories firstObject];
+  assertThat(category.scheme, equalTo(@"http://search.yahoo.com/mrss/category_schema"));
+  assertThat(category.label, equalTo(@"Music"));
+  assertThat(category.value, equalTo(@"music/artist/album"));
+  
+  RSSMediaRating *rating = [item.mediaRatings firstObject];
+  assertThat(rating.scheme, equalTo(@"urn:simple"));
+  assertThat(rating.value, equalTo(@"adult"));
+  
+  RSSMediaRestriction *restriction = [item.mediaRestrictions firstObject];
+  assertThat(restriction.relationship, equalTo(@"allow"));
+  assertThat(restriction.type, equalTo(@"country"));
+  assertThat(restriction.value, equalTo(@"au us"));
+  
+  RSSMediaCommunity *community = item.mediaCommunity;
+  assertThatFloat(community.starRatingAverage, equalToFloat(3.5f));
+  assertThatInt(community.starRatingCount, equalToInt(20));
+  assertThatInt(community.starRatingMin, equalToInt(1));
+  assertThatInt(community.starRatingMax, equalToInt(10));
+  assertThatInt(community.viewCount, equalToInt(5));
+  assertThatInt(community.favoriteCount, equalToInt(3));
+  assertThat(community.tags, equalTo(@"news: 5, abc:3"));
+}
+
+- (void)test___parse___parses_Media_RSS_elements_within_media_group
+{
+  // when
+  [sut GETSucceeded:[[NSXMLParser alloc] initWithData:[self mediaElementsTestData]]];
+  
+  // then
+  [self verifyMediaElementsItem:[sut.channel.items firstObject]];
+}
+
+- (void)test___parse___libXML_backend_parses_Media_RSS_elements_within_media_group
+{
+  // when
+  [sut parseDataWithLibXML:[self mediaElementsTestData]];
+  
+  // then
+  [self verifyMediaElementsItem:[sut.channel.items firstObject]];
+}
+
+- (void)test___parse___media_elements_not_in_itemFields_are_not_set
+{
+  // given
+  sut.itemFields = RSSItemFieldTitle | RSSItemFieldMediaCategories;
+  NSData *data = [self mediaElementsTestData];
+  
+  // when
+  [sut GETSucceeded:[[NSXMLParser alloc] initWithData:data]];
+  RSSItem *item = [sut.channel.items firstObject];
+  [sut parseDataWithLibXML:data];
+  RSSItem *libXMLItem = [sut.channel.items firstObject];
+  
+  // then
+  for (RSSItem *parsedItem in @[item, libXMLItem]) {
+    assertThatUnsignedInteger(parsedItem.mediaCategories.count, equalToUnsignedInteger(1));
+    assertThat(parsedItem.mediaContents, nilValue());
+    assertThat(parsedItem.mediaKeywords, nilValue());
+    assertThat(parsedItem.mediaPlayer, nilValue());
+    assertThat(parsedItem.mediaRatings, nilValue());
+    assertThat(parsedItem.mediaCommunity, nilValue());
+  }
+}
+
+- (void)test___parse___media_categories_count_towards_maxMediaObjectCount
+{
+  // given
+  sut.maxMediaObjectCount = 2;
+  NSData *data = [self mediaElementsTestData];
+  
+  // when
+  [sut GETSucceeded:[[NSXMLParser alloc] initWithData:data]];
+  RSSItem *item = [sut.channel.items firstObject];
+  [sut parseDataWithLibXML:data];
+  RSSItem *libXMLItem = [sut.channel.items firstObject];
+  
+  // then
+  for (RSSItem *parsedItem in @[item, libXMLItem]) {
+    assertThatUnsignedInteger(parsedItem.mediaContents.count, equalToUnsignedInteger(1));
+    assertThatUnsignedInteger(parsedItem.mediaCategories.count, equalToUnsignedInteger(1));
+    assertThatUnsignedInteger(parsedItem.mediaRatings.count, equalToUnsignedInteger(0));
+    assertThatUnsignedInteger(parsedItem.mediaRestrictions.count, equalToUnsignedInteger(0));
+  }
+}
+
+#pragma mark - String Pool - Tests
+
+- (void)test___init___sets_stringPoolCountLimit_to_default
+{
+  assertThatUnsignedInteger(sut.stringPoolCountLimit, equalToUnsignedInteger(RSSStringPoolDefaultCountLimit));
+  assertThat(sut.stringPool, nilValue());
+}
+
+- (NSData *)stringPoolTestData
+{
+  return [self namespacesTestDataWithRSSAttributes:@"xmlns:media=\"http://search.yahoo.com/mrss/\""
+                                              item:@"<media:content url=\"http://www.example.com/1.mp4\" type=\"video/mp4\"/>"
+          @"<media:content url=\"http://www.example.com/2.mp4\" type=\"video/mp4\"/>"
+          @"<media:credit role=\"producer\">Producer</media:credit><media:credit role=\"producer\">Producer</media:credit>"];
+}
+
+- (void)verifyStringPoolItem:(RSSItem *)item
+{
+  RSSMediaContent *content1 = item.mediaContents[0];
+  RSSMediaContent *content2 = item.mediaContents[1];
+  RSSMediaCredit *credit1 = item.mediaCredits[0];
+  RSSMediaCredit *credit2 = item.mediaCredits[1];
+  
+  assertThat(content1.type, equalTo(@"video/mp4"));
+  assertThat(content2.type, sameInstance(content1.type));
+  assertThat(credit2.role, sameInstance(credit1.role));
+  assertThat(credit2.value, sameInstance(credit1.value));
+}
+
+- (void)test___parse___repeated_media_values_share_one_instance
+{
+  // when
+  [sut GETSucceeded:[[NSXMLParser alloc] initWithData:[self stringPoolTestData]]];
+  
+  // then
+  [self verifyStringPoolItem:[sut.channel.items firstObject]];
+}
+
+- (void)test___parse___libXML_backend_repeated_media_values_share_one_instance
+{
+  // when
+  [sut parseDataWithLibXML:[self stringPoolTestData]];
+  
+  // then
+  [self verifyStringPoolItem:[sut.channel.items firstObject]];
+}
+
+- (void)test___parse___shared_stringPool_is_used_across_parses
+{
+  // given
+  RSSStringPool *stringPool = [[RSSStringPool alloc] init];
+  sut.stringPool = stringPool;
+  
+  // when
+  [sut parseDataWithLibXML:[self stringPoolTestData]];
+  NSString *firstType = [[[sut.channel.items firstObject] mediaContents][0] type];
+  [sut GETSucceeded:[[NSXMLParser alloc] initWithData:[self stringPoolTestData]]];
+  NSString *secondType = [[[sut.channel.items firstObject] mediaContents][0] type];
+  
+  // then
+  assertThat(secondType, sameInstance(firstType));
+  assertThatUnsignedInteger(stringPool.count, equalToUnsignedInteger(3));
+}
+
+#pragma mark - Columnar Channel - Tests
+
+- (void)test___parseColumnarRSSData_success_failure___appends_items_to_columns
+{
+  [self beginAsynchronousOperation];
+  
+  [sut parseColumnarRSSData:[self newestItemsTestData] success:^(RSSChannel *channel, RSSColumnarChannel *columns) {
+    assertThat(channel.title, equalTo(@"Channel"));
+    assertThat(channel.items, equalTo(@[]));
+    assertThatUnsignedInteger(columns.count, equalToUnsignedInteger(7));
+    assertThat([columns stringForColumn:RSSColumnarChannelStringColumnTitle atIndex:0], equalTo(@"Day 04"));
+    XCTAssertTrue(isnan(columns.pubDates[3]));
+    [self endAsynchronousOperation];
+    
+  } failure:^(NSError *error) {
+    XCTAssertTrue(NO, @"Error:%@", error);
+    [self endAsynchronousOperation];
+  }];
+  
+  [self waitForAsyncronousOperation];
+}
+
+- (void)test___parseColumnarRSSData_success_failure___newestItemCount_appends_newest_items_first
+{
+  [self beginAsynchronousOperation];
+  sut.newestItemCount = 2;
+  
+  [sut parseColumnarRSSData:[self newestItemsTestData] success:^(RSSChannel *channel, RSSColumnarChannel *columns) {
+    assertThatUnsignedInteger(columns.count, equalToUnsignedInteger(2));
+    assertThat([columns stringForColumn:RSSColumnarChannelStringColumnTitle atIndex:0], equalTo(@"Day 06"));
+    assertThat([columns stringForColumn:RSSColumnarChannelStringColumnTitle atIndex:1], equalTo(@"Day 05"));
+    [self endAsynchronousOperation];
+    
+  } failure:^(NSError *error) {
+    XCTAssertTrue(NO, @"Error:%@", error);
+    [self endAsynchronousOperation];
+  }];
+  
+  [self waitForAsyncronousOperation];
+}
+
+- (void)test___parseRSSData_success_failure___does_not_reuse_columnarChannel_of_previous_parse
+{
+  [self beginAsynchronousOperation];
+  [sut parseColumnarRSSData:[self newestItemsTestData] success:nil failure:nil];
+  
+  [sut parseRSSData:[self newestItemsTestData] success:^(RSSChannel *channel) {
+    assertThatUnsignedInteger(channel.items.count, equalToUnsignedInteger(7));
+    [self endAsynchronousOperation];
+    
+  } failure:^(NSError *error) {
+    XCTAssertTrue(NO, @"Error:%@", error);
+    [self endAsynchronousOperation];
+  }];
+  
+  [self waitForAsyncronousOperation];
+}
+
+- (void)test___parse___libXML_backend_appends_items_to_columnarChannel
+{
+  // given
+  RSSColumnarChannel *columns = [[RSSColumnarChannel alloc] init];
+  [self givenParseContext].columnarChannel = columns;
+  
+  // when
+  [sut parseDataWithLibXML:[self newestItemsTestData]];
+  
+  // then
+  assertThat(sut.channel.items, equalTo(@[]));
+  assertThatUnsignedInteger(columns.count, equalToUnsignedInteger(7));
+  assertThatUnsignedInteger([columns indexesOfItemsPublishedFrom:nil to:nil].count, equalToUnsignedInteger(6));
+}
+
+#pragma mark - Item Identity - Tests
+
+- (void)test___parse___items_of_separate_parses_are_deduplicated_by_identity
+{
+  // given
+  RSSItemDedupIndex *index = [[RSSItemDedupIndex alloc] init];
+  NSData *data = [@"<rss><channel><title>Channel</title>"
+                  @"<item><guid>tag:example.com,2014:1</guid><link>http://www.example.com/1</link></item>"
+                  @"<item><link>HTTP://WWW.EXAMPLE.COM/2#comments</link></item>"
+                  @"</channel></rss>" dataUsingEncoding:NSUTF8StringEncoding];
+  
+  // when
+  [sut GETSucceeded:[[NSXMLParser alloc] initWithData:data]];
+  NSArray *firstItems = sut.channel.items;
+  [sut parseDataWithLibXML:data];
+  NSArray *secondItems = sut.channel.items;
+  
+  // then
+  assertThat(secondItems, equalTo(firstItems));
+  assertThatUnsignedInteger([index addItemsFromArray:firstItems].count, equalToUnsignedInteger(2));
+  assertThatUnsignedInteger([index addItemsFromArray:secondItems].count, equalToUnsignedInteger(0));
+}
+
+#pragma mark - Parsing - RSS 2.0
+
+- (void)test__parseRSSFeed_paramemters_success_failure___correctly_parses_RSS_2
+{
+  [self beginAsynchronousOperation];
+  
+  [sut parseRSSFeed:[self fileURLPathForRSS2Example] parameters:nil success:^(RSSChannel *channel) {
+
+    [self endAsynchronousOperation];
+    
+    testChannel = channel;
+    [self verifyRSS2];
+    
+  } failure:^(NSError *error) {
+    XCTAssertTrue(NO, @"Error:%@", error);
+    [self endAsynchronousOperation];
+    
+  }];
+  
+  [self waitForAsyncronousOperation];
+}
+
+- (void)verifyRSS2
+{
+  [self setUpDateFormatter];
+  [self verifyRSS2_channelProperties];
+  [self verifyRSS2_Empty_Item1];
+  [self verifyRSS2_Item2];
+  [self verifyRSS2_Item3];
+}
+
+- (void)verifyRSS2_channelProperties
+{
+  assertThat(testChannel.title, equalTo(@"RSS 2.0 Example"));
+  assertThat([testChannel.link absoluteString], equalTo(@"http://www.example.com"));
   assertThat(testChannel.channelDescription, equalTo(@"RSS 2.0 Example XML"));
   assertThat(testChannel.language, equalTo(@"en-us"));
   assertThat(testChannel.copyright, equalTo(@"Copyright 2014 Example, Inc."));
@@ -430,43 +2242,395 @@ const char RSSParserFailBlockKey;
   assertThat([testChannel.docsURL absoluteString], equalTo(@"http://blogs.law.harvard.edu/tech/rss"));
   assertThatInt(testChannel.ttl, equalToInt(60));
 
-  assertThatInt(testChannel.items.count, equalToInt(3));
+  assertThatInt(testChannel.items.count, equalToInt(3));
+}
+
+- (void)verifyRSS2_Empty_Item1
+{
+  RSSItem *item1 = testChannel.items[0];
+  assertThat(item1.title, nilValue());
+  assertThat(item1.link, nilValue());
+  assertThat(item1.itemDescription, nilValue());
+  assertThat(item1.authorEmail, nilValue());
+  assertThat(item1.commentsURL, nilValue());
+  assertThat(item1.guid, nilValue());
+  assertThat(item1.pubDate, nilValue());
+}
+
+- (void)verifyRSS2_Item2
+{
+  RSSItem *item2 = testChannel.items[1];
+  assertThat(item2.title, equalTo(@"Item 2 Title"));
+  assertThat([item2.link absoluteString], equalTo(@"http://www.example.com/item2"));
+  assertThat(item2.itemDescription, equalTo(@"Item 2 Description"));
+  assertThat(item2.authorEmail, equalTo(@"author2@example.com"));
+  assertThat([item2.commentsURL absoluteString], equalTo(@"http://www.example.com/item2/comments"));
+  assertThat(item2.guid, equalTo(@"Item#0002"));
+  assertThat(item2.pubDate, equalTo([dateFormatter dateFromString:@"Tue, 10 Jun 2003 02:00:00 GMT"]));
+}
+
+- (void)verifyRSS2_Item3
+{
+  RSSItem *item3 = testChannel.items[2];
+  assertThat(item3.title, equalTo(@"Item 3 Title"));
+  assertThat([item3.link absoluteString], equalTo(@"http://www.example.com/item3"));
+  assertThat(item3.itemDescription, equalTo(@"Item 3 Description"));
+  assertThat(item3.authorEmail, equalTo(@"author3@example.com"));
+  assertThat([item3.commentsURL absoluteString], equalTo(@"http://www.example.com/item3/comments"));
+  assertThat(item3.guid, equalTo(@"Item#0003"));
+  assertThat(item3.pubDate, equalTo([dateFormatter dateFromString:@"Tue, 10 Jun 2003 03:00:00 GMT"]));
+}
+
+- (void)test__parseRSSFeed_paramemters_itemHandler_success_failure___streams_RSS_2_items
+{
+  [self beginAsynchronousOperation];
+  
+  NSMutableArray *streamedItems = [NSMutableArray array];
+  
+  [sut parseRSSFeed:[self fileURLPathForRSS2Example] parameters:nil itemHandler:^(RSSItem *item) {
+    [streamedItems addObject:item];
+    
+  } success:^(RSSChannel *channel) {
+    
+    [self endAsynchronousOperation];
+    
+    assertThatInt(channel.items.count, equalToInt(0));
+    
+    channel.items = streamedItems;
+    testChannel = channel;
+    [self verifyRSS2];
+    
+  } failure:^(NSError *error) {
+    XCTAssertTrue(NO, @"Error:%@", error);
+    [self endAsynchronousOperation];
+    
+  }];
+  
+  [self waitForAsyncronousOperation];
+}
+
+- (void)test___parseRSSData_itemHandler_success_failure___waits_for_itemHandler_before_parsing_next_item
+{
+  [self beginAsynchronousOperation];
+  
+  // given
+  NSData *data = [NSData dataWithContentsOfFile:[self filePathForRSS2Example]];
+  NSMutableArray *parsedItemCounts = [NSMutableArray array];
+  
+  // when
+  [sut parseRSSData:data itemHandler:^(RSSItem *item) {
+    [parsedItemCounts addObject:@(sut.parsedItemCount)];
+    
+  } success:^(RSSChannel *channel) {
+    
+    // then
+    assertThat(parsedItemCounts, equalTo(@[@1, @2, @3]));
+    [self endAsynchronousOperation];
+    
+  } failure:^(NSError *error) {
+    XCTAssertTrue(NO, @"Error:%@", error);
+    [self endAsynchronousOperation];
+  }];
+  
+  [self waitForAsyncronousOperation];
+}
+
+- (void)test___parseRSSData_success_failure___correctly_parses_RSS_2
+{
+  [self beginAsynchronousOperation];
+  
+  NSData *data = [NSData dataWithContentsOfFile:[self filePathForRSS2Example]];
+  
+  [sut parseRSSData:data success:^(RSSChannel *channel) {
+    
+    [self endAsynchronousOperation];
+    
+    testChannel = channel;
+    [self verifyRSS2];
+    
+  } failure:^(NSError *error) {
+    XCTAssertTrue(NO, @"Error:%@", error);
+    [self endAsynchronousOperation];
+    
+  }];
+  
+  [self waitForAsyncronousOperation];
+}
+
+- (void)test___parseRSSData_success_failure___does_not_use_client
+{
+  // given
+  [self givenMockClientNumberOfTasks:0];
+  NSData *data = [NSData dataWithContentsOfFile:[self filePathForRSS2Example]];
+  
+  // when
+  [sut parseRSSData:data success:nil failure:nil];
+  
+  // then
+  [verifyCount(sut.client, never()) GET:anything() parameters:anything() success:anything() failure:anything()];
 }
 
-- (void)verifyRSS2_Empty_Item1
+- (void)test___parseRSSInputStream_success_failure___correctly_parses_RSS_2
 {
-  RSSItem *item1 = testChannel.items[0];
-  assertThat(item1.title, nilValue());
-  assertThat(item1.link, nilValue());
-  assertThat(item1.itemDescription, nilValue());
-  assertThat(item1.authorEmail, nilValue());
-  assertThat(item1.commentsURL, nilValue());
-  assertThat(item1.guid, nilValue());
-  assertThat(item1.pubDate, nilValue());
+  [self beginAsynchronousOperation];
+  
+  NSInputStream *stream = [NSInputStream inputStreamWithFileAtPath:[self filePathForRSS2Example]];
+  
+  [sut parseRSSInputStream:stream success:^(RSSChannel *channel) {
+    
+    [self endAsynchronousOperation];
+    
+    testChannel = channel;
+    [self verifyRSS2];
+    
+  } failure:^(NSError *error) {
+    XCTAssertTrue(NO, @"Error:%@", error);
+    [self endAsynchronousOperation];
+    
+  }];
+  
+  [self waitForAsyncronousOperation];
 }
 
-- (void)verifyRSS2_Item2
+- (void)test___parseRSSFileAtPath_success_failure___calls_failBlock_if_file_is_missing
 {
-  RSSItem *item2 = testChannel.items[1];
-  assertThat(item2.title, equalTo(@"Item 2 Title"));
-  assertThat([item2.link absoluteString], equalTo(@"http://www.example.com/item2"));
-  assertThat(item2.itemDescription, equalTo(@"Item 2 Description"));
-  assertThat(item2.authorEmail, equalTo(@"author2@example.com"));
-  assertThat([item2.commentsURL absoluteString], equalTo(@"http://www.example.com/item2/comments"));
-  assertThat(item2.guid, equalTo(@"Item#0002"));
-  assertThat(item2.pubDate, equalTo([dateFormatter dateFromString:@"Tue, 10 Jun 2003 02:00:00 GMT"]));
+  [self beginAsynchronousOperation];
+  
+  [sut parseRSSFileAtPath:@"/does/not/exist.xml" success:nil failure:^(NSError *error) {
+    
+    assertThat(error, notNilValue());
+    [self endAsynchronousOperation];
+  }];
+  
+  [self waitForAsyncronousOperation];
 }
 
-- (void)verifyRSS2_Item3
+#pragma mark - Parsing - LibXML Backend
+
+- (void)test___parseRSSData_success_failure___libXML_backend_correctly_parses_RSS_2
 {
-  RSSItem *item3 = testChannel.items[2];
-  assertThat(item3.title, equalTo(@"Item 3 Title"));
-  assertThat([item3.link absoluteString], equalTo(@"http://www.example.com/item3"));
-  assertThat(item3.itemDescription, equalTo(@"Item 3 Description"));
-  assertThat(item3.authorEmail, equalTo(@"author3@example.com"));
-  assertThat([item3.commentsURL absoluteString], equalTo(@"http://www.example.com/item3/comments"));
-  assertThat(item3.guid, equalTo(@"Item#0003"));
-  assertThat(item3.pubDate, equalTo([dateFormatter dateFromString:@"Tue, 10 Jun 2003 03:00:00 GMT"]));
+  [self beginAsynchronousOperation];
+  
+  sut.backend = RSSParserBackendLibXML;
+  NSData *data = [NSData dataWithContentsOfFile:[self filePathForRSS2Example]];
+  
+  [sut parseRSSData:data success:^(RSSChannel *channel) {
+    
+    [self endAsynchronousOperation];
+    
+    testChannel = channel;
+    [self verifyRSS2];
+    
+  } failure:^(NSError *error) {
+    XCTAssertTrue(NO, @"Error:%@", error);
+    [self endAsynchronousOperation];
+    
+  }];
+  
+  [self waitForAsyncronousOperation];
+}
+
+- (void)test___parseRSSInputStream_success_failure___libXML_backend_correctly_parses_RSS_2
+{
+  [self beginAsynchronousOperation];
+  
+  sut.backend = RSSParserBackendLibXML;
+  NSInputStream *stream = [NSInputStream inputStreamWithFileAtPath:[self filePathForRSS2Example]];
+  
+  [sut parseRSSInputStream:stream success:^(RSSChannel *channel) {
+    
+    [self endAsynchronousOperation];
+    
+    testChannel = channel;
+    [self verifyRSS2];
+    
+  } failure:^(NSError *error) {
+    XCTAssertTrue(NO, @"Error:%@", error);
+    [self endAsynchronousOperation];
+    
+  }];
+  
+  [self waitForAsyncronousOperation];
+}
+
+- (void)test__parseRSSFeed_paramemters_success_failure___libXML_backend_correctly_parses_Media_RSS
+{
+  [self beginAsynchronousOperation];
+  
+  sut.backend = RSSParserBackendLibXML;
+  
+  [sut parseRSSFeed:[self fileURLPathForMediaRSSExample] parameters:nil success:^(RSSChannel *channel) {
+    
+    testChannel = channel;
+    [self verifyMediaRSS];
+    
+    [self endAsynchronousOperation];
+    
+  } failure:^(NSError *error) {
+    XCTAssertTrue(NO, @"Error:%@", error);
+    
+    [self endAsynchronousOperation];
+  }];
+  
+  [self waitForAsyncronousOperation];
+}
+
+- (void)test___parseRSSFileAtPath_success_failure___libXML_backend_correctly_parses_Media_RSS
+{
+  [self beginAsynchronousOperation];
+  
+  sut.backend = RSSParserBackendLibXML;
+  
+  [sut parseRSSFileAtPath:[self filePathForMediaRSSExample] success:^(RSSChannel *channel) {
+    
+    testChannel = channel;
+    [self verifyMediaRSS];
+    
+    [self endAsynchronousOperation];
+    
+  } failure:^(NSError *error) {
+    XCTAssertTrue(NO, @"Error:%@", error);
+    
+    [self endAsynchronousOperation];
+  }];
+  
+  [self waitForAsyncronousOperation];
+}
+
+- (void)test___parseRSSData_success_failure___libXML_backend_calls_failBlock_on_malformed_document
+{
+  [self beginAsynchronousOperation];
+  
+  sut.backend = RSSParserBackendLibXML;
+  NSData *data = [@"<rss><channel><title>Broken</channel>" dataUsingEncoding:NSUTF8StringEncoding];
+  
+  [sut parseRSSData:data success:nil failure:^(NSError *error) {
+    
+    assertThat(error.domain, equalTo(NSXMLParserErrorDomain));
+    XCTAssertTrue(sut.libXMLContext == NULL);
+    [self endAsynchronousOperation];
+  }];
+  
+  [self waitForAsyncronousOperation];
+}
+
+- (void)test___parseRSSData_success_failure___libXML_backend_calls_failBlock_on_truncated_document
+{
+  [self beginAsynchronousOperation];
+  
+  sut.backend = RSSParserBackendLibXML;
+  NSData *data = [@"<rss><channel><title>Truncated</title>" dataUsingEncoding:NSUTF8StringEncoding];
+  
+  [sut parseRSSData:data success:^(RSSChannel *channel) {
+    XCTAssertTrue(NO, @"Truncated document parsed as %@", channel);
+    [self endAsynchronousOperation];
+    
+  } failure:^(NSError *error) {
+    assertThat(error.domain, equalTo(NSXMLParserErrorDomain));
+    [self endAsynchronousOperation];
+  }];
+  
+  [self waitForAsyncronousOperation];
+}
+
+- (void)test___parseRSSInputStream_success_failure___libXML_backend_calls_failBlock_on_truncated_document
+{
+  [self beginAsynchronousOperation];
+  
+  sut.backend = RSSParserBackendLibXML;
+  NSData *data = [@"<rss><channel><title>Truncated</title>" dataUsingEncoding:NSUTF8StringEncoding];
+  
+  [sut parseRSSInputStream:[NSInputStream inputStreamWithData:data] success:^(RSSChannel *channel) {
+    XCTAssertTrue(NO, @"Truncated document parsed as %@", channel);
+    [self endAsynchronousOperation];
+    
+  } failure:^(NSError *error) {
+    assertThat(error.domain, equalTo(NSXMLParserErrorDomain));
+    [self endAsynchronousOperation];
+  }];
+  
+  [self waitForAsyncronousOperation];
+}
+
+#pragma mark - Parsing - Lazy Item Fields
+
+- (void)test___parseRSSData_success_failure___lazy_libXML_backend_correctly_parses_Media_RSS
+{
+  [self beginAsynchronousOperation];
+  
+  sut.backend = RSSParserBackendLibXML;
+  sut.decodesItemFieldsLazily = YES;
+  NSData *data = [NSData dataWithContentsOfFile:[self filePathForMediaRSSExample]];
+  
+  [sut parseRSSData:data success:^(RSSChannel *channel) {
+    
+    testChannel = channel;
+    [self verifyMediaRSS];
+    
+    [self endAsynchronousOperation];
+    
+  } failure:^(NSError *error) {
+    XCTAssertTrue(NO, @"Error:%@", error);
+    
+    [self endAsynchronousOperation];
+  }];
+  
+  [self waitForAsyncronousOperation];
+}
+
+- (void)test___parseRSSData_success_failure___lazy_libXML_backend_decodes_fields_on_first_access
+{
+  [self beginAsynchronousOperation];
+  
+  // given
+  sut.backend = RSSParserBackendLibXML;
+  sut.decodesItemFieldsLazily = YES;
+  NSData *data = [NSData dataWithContentsOfFile:[self filePathForRSS2Example]];
+  
+  // when
+  [sut parseRSSData:data success:^(RSSChannel *channel) {
+    
+    // then
+    RSSLazyItem *item = channel.items[1];
+    assertThat(item, instanceOf([RSSLazyItem class]));
+    assertThatUnsignedInteger(item.pendingFieldCount, equalToUnsignedInteger(7));
+    
+    assertThat(item.title, equalTo(@"Item 2 Title"));
+    assertThatUnsignedInteger(item.pendingFieldCount, equalToUnsignedInteger(6));
+    
+    [self endAsynchronousOperation];
+    
+  } failure:^(NSError *error) {
+    XCTAssertTrue(NO, @"Error:%@", error);
+    
+    [self endAsynchronousOperation];
+  }];
+  
+  [self waitForAsyncronousOperation];
+}
+
+- (void)test___parseRSSData_success_failure___lazy_NSXMLParser_backend_decodes_eagerly
+{
+  [self beginAsynchronousOperation];
+  
+  // given
+  sut.decodesItemFieldsLazily = YES;
+  NSData *data = [NSData dataWithContentsOfFile:[self filePathForRSS2Example]];
+  
+  // when
+  [sut parseRSSData:data success:^(RSSChannel *channel) {
+    
+    // then
+    assertThat(channel.items[1], isNot(instanceOf([RSSLazyItem class])));
+    [self endAsynchronousOperation];
+    
+  } failure:^(NSError *error) {
+    XCTAssertTrue(NO, @"Error:%@", error);
+    
+    [self endAsynchronousOperation];
+  }];
+  
+  [self waitForAsyncronousOperation];
 }
 
 #pragma mark - Parsing - Media RSS 1.5.1
@@ -491,6 +2655,26 @@ const char RSSParserFailBlockKey;
   [self waitForAsyncronousOperation];
 }
 
+- (void)test___parseRSSFileAtPath_success_failure___correctly_parses_Media_RSS
+{
+  [self beginAsynchronousOperation];
+  
+  [sut parseRSSFileAtPath:[self filePathForMediaRSSExample] success:^(RSSChannel *channel) {
+    
+    testChannel = channel;
+    [self verifyMediaRSS];
+    
+    [self endAsynchronousOperation];
+    
+  } failure:^(NSError *error) {
+    XCTAssertTrue(NO, @"Error:%@", error);
+    
+    [self endAsynchronousOperation];
+  }];
+  
+  [self waitForAsyncronousOperation];
+}
+
 - (void)verifyMediaRSS
 {
   [self setUpDateFormatter];
@@ -0,0 +1,134 @@
+//
+//  RSSStringPoolTests.m
+//  MediaRSSParser
+//
+
+// Test Class
+#import "RSSStringPool.h"
+
+// Test Support
+#import <XCTest/XCTest.h>
+
+#define HC_SHORTHAND
+#import <OCHamcrest/OCHamcrest.h>
+
+@interface RSSStringPoolTests : XCTestCase
+@end
+
+@implementation RSSStringPoolTests
+{
+  RSSStringPool *sut;
+}
+
+#pragma mark - Test Lifecycle
+
+- (void)setUp
+{
+  [super setUp];
+  sut = [[RSSStringPool alloc] init];
+}
+
+#pragma mark - Init - Tests
+
+- (void)test___init___uses_default_countLimit
+{
+  assertThatUnsignedInteger(sut.countLimit, equalToUnsignedInteger(RSSStringPoolDefaultCountLimit));
+  assertThatUnsignedInteger(sut.count, equalToUnsignedInteger(0));
+}
+
+#pragma mark - Interning - Tests
+
+- (void)test___stringWithUTF8Bytes_length___returns_same_instance_for_equal_bytes
+{
+  // when
+  NSString *first = [sut stringWithUTF8Bytes:"video/mp4" length:9];
+  NSString *second = [sut stringWithUTF8Bytes:"video/mp4 trailing" length:9];
+  
+  // then
+  assertThat(first, equalTo(@"video/mp4"));
+  XCTAssertTrue(first == second);
+  assertThatUnsignedInteger(sut.count, equalToUnsignedInteger(1));
+}
+
+- (void)test___stringWithUTF8Bytes_length___returns_nil_for_invalid_UTF8
+{
+  // when
+  NSString *string = [sut stringWithUTF8Bytes:"\xFF\xFE" length:2];
+  
+  // then
+  assertThat(string, nilValue());
+  assertThatUnsignedInteger(sut.count, equalToUnsignedInteger(0));
+}
+
+- (void)test___stringByInterningString___returns_pooled_instance_for_equal_string
+{
+  // given
+  NSString *pooled = [sut stringWithUTF8Bytes:"caf\xC3\xA9" length:5];
+  NSMutableString *string = [NSMutableString stringWithString:@"café"];
+  
+  // when
+  NSString *interned = [sut stringByInterningString:string];
+  
+  // then
+  XCTAssertTrue(interned == pooled);
+}
+
+- (void)test___stringByInterningString___returns_immutable_copy
+{
+  // given
+  NSMutableString *string = [NSMutableString stringWithString:@"producer"];
+  
+  // when
+  NSString *interned = [sut stringByInterningString:string];
+  [string setString:@"director"];
+  
+  // then
+  assertThat(interned, equalTo(@"producer"));
+  assertThat([sut stringByInterningString:@"producer"], sameInstance(interned));
+}
+
+- (void)test___stringByInterningString___does_not_pool_long_strings
+{
+  // given
+  NSString *string = [@"" stringByPaddingToLength:RSSStringPoolMaxLength + 1 withString:@"a" startingAtIndex:0];
+  
+  // when
+  NSString *interned = [sut stringByInterningString:string];
+  
+  // then
+  assertThat(interned, equalTo(string));
+  assertThatUnsignedInteger(sut.count, equalToUnsignedInteger(0));
+}
+
+- (void)test___stringByInterningString___stops_adding_at_countLimit
+{
+  // given
+  sut = [[RSSStringPool alloc] initWithCountLimit:100];
+  
+  // when
+  for (NSUInteger i = 0; i < 200; i++) {
+    [sut stringByInterningString:[NSString stringWithFormat:@"value %lu", (unsigned long)i]];
+  }
+  NSString *pooled = [sut stringByInterningString:@"value 99"];
+  NSString *unpooled = [sut stringByInterningString:@"value 100"];
+  
+  // then
+  assertThatUnsignedInteger(sut.count, equalToUnsignedInteger(100));
+  assertThat([sut stringByInterningString:@"value 99"], sameInstance(pooled));
+  assertThat(unpooled, equalTo(@"value 100"));
+}
+
+- (void)test___removeAllStrings___empties_pool
+{
+  // given
+  [sut stringByInterningString:@"image/jpeg"];
+  
+  // when
+  [sut removeAllStrings];
+  
+  // then
+  assertThatUnsignedInteger(sut.count, equalToUnsignedInteger(0));
+  assertThat([sut stringByInterningString:@"image/jpeg"], equalTo(@"image/jpeg"));
+}
+
+@end
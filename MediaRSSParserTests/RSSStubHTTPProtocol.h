@@ -0,0 +1,28 @@
+//
+//  RSSStubHTTPProtocol.h
+//  MediaRSSParser
+//
+
+#import <Foundation/Foundation.h>
+
+/**
+ *  `RSSStubHTTPProtocol` stands in for an HTTP server: every `http` request made by a session whose configuration lists this class in `protocolClasses` is answered with the stubbed status code, headers and body.
+ */
+@interface RSSStubHTTPProtocol : NSURLProtocol
+
+/**
+ *  Sets the response returned for every following request.
+ */
++ (void)stubResponseWithStatusCode:(NSInteger)statusCode headers:(NSDictionary *)headers data:(NSData *)data;
+
+/**
+ *  The most recent request that was answered.
+ */
++ (NSURLRequest *)lastRequest;
+
+/**
+ *  Clears the stubbed response and `lastRequest`.
+ */
++ (void)reset;
+
+@end
@@ -0,0 +1,84 @@
+//
+//  RSSStubHTTPProtocol.m
+//  MediaRSSParser
+//
+
+#import "RSSStubHTTPProtocol.h"
+
+static NSInteger RSSStubStatusCode = 200;
+static NSDictionary *RSSStubHeaders = nil;
+static NSData *RSSStubData = nil;
+static NSURLRequest *RSSStubLastRequest = nil;
+
+@implementation RSSStubHTTPProtocol
+
+#pragma mark - Stubbing
+
++ (void)stubResponseWithStatusCode:(NSInteger)statusCode headers:(NSDictionary *)headers data:(NSData *)data
+{
+  @synchronized(self) {
+    RSSStubStatusCode = statusCode;
+    RSSStubHeaders = [headers copy];
+    RSSStubData = [data copy];
+  }
+}
+
++ (NSURLRequest *)lastRequest
+{
+  @synchronized(self) {
+    return RSSStubLastRequest;
+  }
+}
+
++ (void)reset
+{
+  @synchronized(self) {
+    RSSStubStatusCode = 200;
+    RSSStubHeaders = nil;
+    RSSStubData = nil;
+    RSSStubLastRequest = nil;
+  }
+}
+
+#pragma mark - NSURLProtocol
+
++ (BOOL)canInitWithRequest:(NSURLRequest *)request
+{
+  return [request.URL.scheme isEqualToString:@"http"];
+}
+
++ (NSURLRequest *)canonicalRequestForRequest:(NSURLRequest *)request
+{
+  return request;
+}
+
+- (void)startLoading
+{
+  NSInteger statusCode;
+  NSDictionary *headers;
+  NSData *data;
+  
+  @synchronized([self class]) {
+    RSSStubLastRequest = self.request;
+    statusCode = RSSStubStatusCode;
+    headers = RSSStubHeaders;
+    data = RSSStubData;
+  }
+  
+  NSHTTPURLResponse *response = [[NSHTTPURLResponse alloc] initWithURL:self.request.URL
+                                                            statusCode:statusCode
+                                                           HTTPVersion:@"HTTP/1.1"
+                                                          headerFields:headers];
+  
+  [self.client URLProtocol:self didReceiveResponse:response cacheStoragePolicy:NSURLCacheStorageNotAllowed];
+  if (data) {
+    [self.client URLProtocol:self didLoadData:data];
+  }
+  [self.client URLProtocolDidFinishLoading:self];
+}
+
+- (void)stopLoading
+{
+}
+
+@end
@@ -9,5 +9,10 @@
 #import "RSSParser.h"
 
 @interface Test_RSSParser : RSSParser
-@property (nonatomic, strong) RSSParser *parserCopyMock;
+
+/**
+ *  Called from `parserDidStartDocument:`, on whichever queue the parser delegate methods run on.
+ */
+@property (nonatomic, copy) void (^didStartDocumentBlock)(void);
+
 @end
@@ -7,32 +7,15 @@
 //
 
 #import "Test_RSSParser.h"
-#import "RSSParser_Protected.h"
-
-#define MOCKITO_SHORTHAND
-#import <OCMockito/OCMockito.h>
 
 @implementation Test_RSSParser
 
-- (instancetype)init
+- (void)parserDidStartDocument:(NSXMLParser *)parser
 {
-  self = [super init];
-  if (self) {
-    self.parserCopyMock = mock([RSSParser class]);
+  if (self.didStartDocumentBlock) {
+    self.didStartDocumentBlock();
   }
-  return self;
-}
-
-- (void)setSuccessBlock:(void (^)(RSSChannel *))successBlock
-{
-  [super setSuccessBlock:successBlock];
-  [self.parserCopyMock setSuccessBlock:successBlock];
-}
-
-- (void)setFailblock:(void (^)(NSError *))failblock
-{
-  [super setFailblock:failblock];
-  [self.parserCopyMock setFailblock:failblock];
+  [super parserDidStartDocument:parser];
 }
 
 @end
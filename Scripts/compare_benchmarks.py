@@ -0,0 +1,88 @@
+#!/usr/bin/env python3
+#
+# Compares two results files written by the `rss-benchmark` tool (see
+# Benchmarks/GNUmakefile), printing the change in each phase's throughput,
+# allocations and peak memory, and in the memory retained by the parsed
+# channel, for every run that's in both.
+#
+# Usage: Scripts/compare_benchmarks.py baseline.json candidate.json [--threshold 10]
+#
+# Exits with status 1 if any phase's items/s dropped by more than the threshold
+# (a percentage).
+
+import argparse
+import json
+import sys
+
+PHASES = ['networkStub', 'xmlParse', 'modelBuild', 'htmlUtilities']
+
+
+def run_key(run):
+    configuration = run['configuration']
+    return (configuration['format'], configuration['itemCount'], configuration['descriptionLength'],
+            configuration['entityDensity'], configuration['mediaElementsPerItem'], configuration['seed'],
+            run['backend'])
+
+
+def change(baseline, candidate):
+    if baseline is None or candidate is None or baseline == 0:
+        return None
+    return (candidate - baseline) / baseline * 100
+
+
+def format_change(value):
+    return '     n/a' if value is None else '%+7.1f%%' % value
+
+
+def main():
+    parser = argparse.ArgumentParser()
+    parser.add_argument('baseline')
+    parser.add_argument('candidate')
+    parser.add_argument('--threshold', type=float, default=10)
+    arguments = parser.parse_args()
+
+    with open(arguments.baseline) as f:
+        baseline = json.load(f)
+    with open(arguments.candidate) as f:
+        candidate = json.load(f)
+
+    baseline_runs = {run_key(run): run for run in baseline['runs']}
+    regressions = []
+
+    print('%s -> %s' % (baseline.get('label') or arguments.baseline, candidate.get('label') or arguments.candidate))
+    print('%-40s %-14s %10s %10s %10s %10s' % ('run', 'phase', 'MB/s', 'items/s', 'allocs', 'peak RSS'))
+
+    for run in candidate['runs']:
+        key = run_key(run)
+        if key not in baseline_runs:
+            continue
+        name = '%s %s items %s' % (key[0], key[1], key[6])
+        for phase in PHASES:
+            old = baseline_runs[key]['phases'].get(phase)
+            new = run['phases'].get(phase)
+            if old is None or new is None:
+                continue
+            items_change = change(old['itemsPerSecond'], new['itemsPerSecond'])
+            print('%-40s %-14s %10s %10s %10s %10s' % (
+                name, phase,
+                format_change(change(old['megabytesPerSecond'], new['megabytesPerSecond'])),
+                format_change(items_change),
+                format_change(change(old['allocationsPerItem'], new['allocationsPerItem'])),
+                format_change(change(old['peakResidentBytes'], new['peakResidentBytes']))))
+            if items_change is not None and items_change < -arguments.threshold:
+                regressions.append('%s %s' % (name, phase))
+        old_memory = baseline_runs[key].get('channelMemory') or {}
+        new_memory = run.get('channelMemory') or {}
+        if old_memory.get('bytesPerItem') is not None and new_memory.get('bytesPerItem') is not None:
+            print('%-40s %-14s %10.0f -> %.0f bytes per item (%s)' % (
+                name, 'channelMemory', old_memory['bytesPerItem'], new_memory['bytesPerItem'],
+                format_change(change(old_memory['bytesPerItem'], new_memory['bytesPerItem'])).strip()))
+
+    if regressions:
+        print('\nRegressed by more than %g%%:\n  %s' % (arguments.threshold, '\n  '.join(regressions)))
+        return 1
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,75 @@
+#!/usr/bin/env python3
+#
+# Generates MediaRSSParser/RSSHTMLEntityTable.h, the named character references
+# of HTML5 (https://html.spec.whatwg.org/multipage/named-characters.html) as an
+# open-addressed hash table, from Python's `html.entities.html5`.
+#
+# Usage: Scripts/generate_html_entity_table.py > MediaRSSParser/RSSHTMLEntityTable.h
+
+import html.entities
+
+SLOT_COUNT = 8192
+
+
+def fnv1a(name):
+    value = 0x811C9DC5
+    for c in name.encode('ascii'):
+        value = ((value ^ c) * 0x01000193) & 0xFFFFFFFF
+    return value
+
+
+def main():
+    # Only references terminated by `;` are decoded.
+    entities = sorted((name[:-1], value) for name, value in html.entities.html5.items() if name.endswith(';'))
+    assert len(entities) * 2 <= SLOT_COUNT
+
+    names = ''.join(name for name, _ in entities)
+    assert len(names) < 0x10000
+
+    slots = [0] * SLOT_COUNT
+    for index, (name, value) in enumerate(entities):
+        assert 1 <= len(value) <= 2
+        # Decoding relies on no reference being shorter than its UTF-16 replacement.
+        assert len(value.encode('utf-16-le')) // 2 <= len(name) + 2
+        slot = fnv1a(name) & (SLOT_COUNT - 1)
+        while slots[slot]:
+            slot = (slot + 1) & (SLOT_COUNT - 1)
+        slots[slot] = index + 1
+
+    print('//')
+    print('//  RSSHTMLEntityTable.h')
+    print('//  MediaRSSParser')
+    print('//')
+    print('//  Generated by Scripts/generate_html_entity_table.py. Do not edit.')
+    print('//')
+    print()
+    print('static const NSUInteger RSSHTMLEntityCount = %d;' % len(entities))
+    print('static const NSUInteger RSSHTMLEntitySlotCount = %d;' % SLOT_COUNT)
+    print('static const NSUInteger RSSHTMLEntityMaxNameLength = %d;' % max(len(name) for name, _ in entities))
+    print()
+    print('static const char RSSHTMLEntityNames[] =')
+    line = ''
+    for name, _ in entities:
+        if len(line) + len(name) > 100:
+            print('  "%s"' % line)
+            line = ''
+        line += name
+    print('  "%s";' % line)
+    print()
+    print('static const RSSHTMLEntity RSSHTMLEntities[] = {')
+    offset = 0
+    for name, value in entities:
+        code_points = [ord(c) for c in value] + [0] * (2 - len(value))
+        print('  { %d, %d, { 0x%04X, 0x%04X } }, // %s' % (offset, len(name), code_points[0], code_points[1], name))
+        offset += len(name)
+    print('};')
+    print()
+    print('// Each slot holds an index into RSSHTMLEntities plus one, or 0 if it is empty.')
+    print('static const uint16_t RSSHTMLEntitySlots[] = {')
+    for i in range(0, SLOT_COUNT, 16):
+        print('  ' + ', '.join('%d' % slot for slot in slots[i:i + 16]) + ',')
+    print('};')
+
+
+if __name__ == '__main__':
+    main()